@@ -5,10 +5,87 @@
 
 // return true if it matches
 uint8_t watermark_check(GRAPH* graph, void* data, unsigned long num_bytes);
+// same as above, using 'ws' instead of allocating
+uint8_t watermark_check_workspace(GRAPH* graph, void* data, unsigned long num_bytes, WORKSPACE* ws);
 uint8_t watermark_rs_check(GRAPH* graph, void* data, unsigned long num_bytes, unsigned long num_parity_symbols);
 
+// what 'watermark_check_get_bit' knows about each node before looking at the key, so
+// many keys can be checked against the same graph (see 'watermark_check_keys')
+typedef struct CHECK_PLAN {
+    unsigned long num_nodes;
+    // bits a key needs to have to match the graph
+    unsigned long n_bits;
+    // CHECK_NODE_* flags of every node
+    uint8_t* nodes;
+    // view of the graph, for backedge destinations and 'has_possible_backedge'
+    WORKSPACE* ws;
+} CHECK_PLAN;
+
+// 'CHECK_PLAN.nodes' flags, a node without MUTE, FORWARD or BACKEDGE is a 0 bit unless
+// it's the fourth last or starts a run of three (rules 2.7 and 2.9)
+#define CHECK_NODE_MUTE 0x01
+// a 1 bit followed by the bit of the inner node (0, or 1 if CHECK_NODE_BIT_1 is set)
+#define CHECK_NODE_FORWARD 0x02
+// a 0 bit (1 if CHECK_NODE_BIT_1 is set)
+#define CHECK_NODE_BACKEDGE 0x04
+#define CHECK_NODE_BIT_1 0x08
+#define CHECK_NODE_FOURTH_LAST 0x10
+#define CHECK_NODE_RUN_OF_THREE 0x20
+
+// keys checked together by 'watermark_check_keys', one per bit of a machine word
+#define CHECK_LANES 64
+
+CHECK_PLAN* watermark_check_plan(GRAPH* graph);
+void watermark_check_plan_free(CHECK_PLAN* plan);
+// 'results[k]' is set to what 'watermark_check' returns for the key 'k' of 'keys' ('n'
+// keys of 'key_len' bytes each). Keys go through the plan CHECK_LANES at a time, bit
+// sliced: keys that agree so far share their stacks, and stop being followed at their
+// first mismatch
+void watermark_check_keys(CHECK_PLAN* plan, void* keys, unsigned long n, unsigned long key_len, uint8_t* results);
+
 // return bit array, in which the values can be '1', '0' or 'x' (for unknown)
 void* watermark_check_analysis(GRAPH* graph, void* data, unsigned long* num_bytes);
 void* watermark_rs_check_analysis(GRAPH* graph, void* data, unsigned long* num_bytes, unsigned long num_parity_symbols);
 
+// 2 bit version of the values above, CHECK_STATUS_NONE for positions the walk didn't reach
+typedef enum CHECK_STATUS {
+    CHECK_STATUS_0,
+    CHECK_STATUS_1,
+    CHECK_STATUS_X,
+    CHECK_STATUS_NONE
+} CHECK_STATUS;
+
+#define CHECK_NUM_STATUS 4
+// bytes taken by 'n' statuses
+#define CHECK_STATUS_BYTES(n) ((n) / 4 + !!((n) % 4))
+
+// status 'idx' of a status vector (same order as 'get_bit', two bits at a time)
+CHECK_STATUS check_status_get(uint8_t* statuses, unsigned long idx);
+void check_status_set(uint8_t* statuses, unsigned long idx, CHECK_STATUS status);
+
+typedef struct CHECK_ANALYSIS_OPTS {
+    // bytes of each key in the 'keys' array
+    unsigned long key_len;
+    // if not zero, keys are analysed with their RS parity appended, as they were encoded
+    // (8 * 'key_len' must be a multiple of 'symsize')
+    unsigned long num_parity_symbols;
+    unsigned long symsize;
+    // 0 uses the OpenMP default
+    unsigned long num_threads;
+} CHECK_ANALYSIS_OPTS;
+
+// same as 'watermark_check_analysis', without allocating or touching the nodes' info:
+// writes the statuses of the key's significant bits to 'statuses' (room for
+// CHECK_STATUS_BYTES(8 * num_bytes)) and returns how many there are, 0 if the key
+// doesn't have as many bits as the graph
+unsigned long watermark_check_analysis_workspace(GRAPH* graph, void* data, unsigned long num_bytes, WORKSPACE* ws, uint8_t* statuses);
+// analyse key 'i' of 'keys' against 'graphs[i]' for the 'n' pairs, in parallel. With
+// 'codeword_len' the bytes of each encoded key ('key_len' plus the parity, rounded up to
+// whole bytes), statuses of pair 'i' go to 'arena + i * CHECK_STATUS_BYTES(8 * codeword_len)'
+// and their number to 'num_positions[i]'. If 'histogram' isn't NULL (room for
+// CHECK_NUM_STATUS * 8 * codeword_len counts), every status is added to
+// 'histogram[CHECK_NUM_STATUS * position + status]', positions counted from each key's
+// first positive bit
+void watermark_check_analysis_batch(GRAPH** graphs, void* keys, unsigned long n, CHECK_ANALYSIS_OPTS* opts, uint8_t* arena, unsigned long* num_positions, unsigned long* histogram);
+
 #endif
@@ -34,6 +34,7 @@ typedef struct CODE_GEN {
     GEN_TABLE operations;
     GEN_TABLE datatypes;
 
+    RNG rng;
 
 } CODE_GEN;
 
@@ -69,5 +70,7 @@ CODE* code_gen_repeat_header(CODE_GEN*, unsigned long tabs);
 CODE* code_declarations(CODE_GEN* code_gen);
 
 char* watermark_generate_code(char* dijkstra_code);
+// same code for the same dijkstra code and seed, the version above seeds from 'rand()'
+char* watermark_generate_code_seeded(char* dijkstra_code, uint64_t seed);
 
 #endif
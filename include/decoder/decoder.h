@@ -3,6 +3,50 @@
 
 #include "graph/graph.h"
 #include "rs_api/rs.h"
+#include "decoder/workspace.h"
+
+// decoder used for each graph of 'watermark_decode_batch' (and by the removal attack)
+typedef enum METHOD {
+  ORIGINAL,
+  IMPROVED,
+  IMPROVED_WITH_RS
+} METHOD;
+
+typedef struct DECODE_OPTS {
+    METHOD method;
+    // keys followed by the improved decoders, one per graph, 'key_len' bytes apart
+    void* keys;
+    unsigned long key_len;
+    // bits of each key (data bits if RS is used)
+    unsigned long n_bits;
+    unsigned long num_parity_symbols;
+    unsigned long symsize;
+    // 0 uses the OpenMP default
+    unsigned long num_threads;
+} DECODE_OPTS;
+
+typedef enum DECODE_STATUS {
+    DECODE_OK,
+    // less than 3 nodes, there is nothing to decode
+    DECODE_TOO_SMALL,
+    // too many errors for the RS code
+    DECODE_RS_FAILED
+} DECODE_STATUS;
+
+typedef struct DECODE_RESULT {
+    DECODE_STATUS status;
+    // decoded sequence, thrown to the right (to be freed with 'free', NULL if it failed)
+    uint8_t* bits;
+    unsigned long num_bytes;
+} DECODE_RESULT;
+
+typedef struct DECODE_STATS {
+    // graphs with DECODE_OK
+    unsigned long num_decoded;
+    unsigned long num_threads;
+    double seconds;
+    double graphs_per_second;
+} DECODE_STATS;
 
 void* watermark2014_decode(GRAPH* graph, unsigned long* num_bytes);
 void* watermark_decode(GRAPH*, unsigned long* num_bytes);
@@ -17,6 +61,33 @@ void* watermark_rs_decode_improved8(GRAPH*, void* key, unsigned long* num_bytes,
 void* watermark_rs_decode_improved(GRAPH*, void* key, unsigned long* num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize);
 
 void* watermark_decode_analysis(GRAPH*, unsigned long* num_bytes);
+
+// workspace variants, nothing is allocated once 'ws' is big enough: the result
+// lives in 'ws->bits' and is only valid until 'ws' is used again
+uint8_t* watermark2014_decode_workspace(GRAPH*, WORKSPACE* ws, unsigned long* num_bytes);
+uint8_t* watermark_decode_workspace(GRAPH*, WORKSPACE* ws, unsigned long* num_bytes);
+uint8_t* watermark_decode_improved_workspace(GRAPH*, uint8_t* key, unsigned long* num_bits, WORKSPACE* ws, unsigned long* num_bytes);
 void* watermark_rs_decode_analysis(GRAPH*, unsigned long* num_parity_symbols);
+// 'watermark_decode_improved' over the graph loaded with 'workspace_load_graph', in
+// O(V) without touching the heap. The sequence is written to 'result', which must hold
+// 'ws->view_num_nodes / 8 + 1' bytes
+uint8_t* watermark_decode_improved_view(WORKSPACE* ws, uint8_t* key, unsigned long* num_bits, uint8_t* result, unsigned long* num_bytes);
+// checks of the improved decoder over a view
+int watermark_decode_view_four_last_are_mute(VIEW_NODE* view, unsigned long num_nodes);
+int watermark_decode_view_sequence_of_three(VIEW_NODE* view, unsigned long num_nodes, unsigned long graph_idx);
+int watermark_decode_view_has_possible_backedge(STACK* possible_backedges, VIEW_NODE* view, unsigned long current_idx);
+
+// decode the 'n' graphs in parallel, each thread with its own workspace. 'results' must
+// have room for 'n' results, 'stats' may be NULL
+void watermark_decode_batch(GRAPH** graphs, unsigned long n, DECODE_OPTS* opts, DECODE_RESULT* results, DECODE_STATS* stats);
+
+// BITVEC variants, the result has exactly the number of bits decoded (NULL if RS fails)
+BITVEC* watermark2014_decode_bitvec(GRAPH*);
+BITVEC* watermark_decode_bitvec(GRAPH*);
+BITVEC* watermark_decode_improved_bitvec(GRAPH*, BITVEC* key);
+BITVEC* watermark2014_rs_decode_bitvec(GRAPH*, unsigned long num_parity_symbols);
+BITVEC* watermark_rs_decode_bitvec(GRAPH*, unsigned long num_parity_symbols);
+BITVEC* watermark_rs_decode_improved_bitvec(GRAPH*, BITVEC* key, unsigned long num_parity_symbols, unsigned long symsize);
+BITVEC* watermark_decode_analysis_bitvec(GRAPH*);
 
 #endif
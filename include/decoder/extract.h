@@ -0,0 +1,43 @@
+#ifndef EXTRACT_H
+#define EXTRACT_H
+
+#include "decoder/decoder.h"
+
+// looks for watermarks embedded in a bigger graph (e.g. the CFG of a function), sorted
+// topologically so the watermark's hamiltonian path is a run of consecutive nodes. Every
+// window [entry, exit] along that order is a candidate if it is a single entry, single
+// exit region: edges from outside only go to 'entry' and edges to outside only leave
+// from 'exit' (which, as the watermark sink, has no edges to the window)
+
+typedef struct EXTRACT_OPTS {
+    // windows with fewer nodes are ignored (never less than 3)
+    unsigned long min_nodes;
+    // 0 for no limit
+    unsigned long max_nodes;
+    // 0 uses the OpenMP default
+    unsigned long num_threads;
+} EXTRACT_OPTS;
+
+typedef struct EXTRACT_CANDIDATE {
+    // first and last node of the window in the host graph
+    unsigned long entry;
+    unsigned long exit;
+    // non hamiltonian edges minus nodes that look like plain host code (only a
+    // hamiltonian edge in and out, after a node without a backedge), so growing a
+    // watermark window with host code lowers it
+    long score;
+    // same as 'watermark_decode' on the window cut out of the host (to be freed)
+    uint8_t* bits;
+    unsigned long num_bytes;
+    // windows that decoded to the same key (this is the best of them)
+    unsigned long num_windows;
+} EXTRACT_CANDIDATE;
+
+// decode every candidate window with a positive score, in parallel. Windows with the
+// same entry share the decoding of their common nodes. Returns one candidate per
+// distinct key, best score first (then longest window, then first entry), and sets
+// 'num_candidates'. Free with 'watermark_extract_free'
+EXTRACT_CANDIDATE* watermark_extract(GRAPH* host, EXTRACT_OPTS* opts, unsigned long* num_candidates);
+void watermark_extract_free(EXTRACT_CANDIDATE* candidates, unsigned long num_candidates);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef KEYLESS_H
+#define KEYLESS_H
+
+#include "decoder/decoder.h"
+
+// search for the keys a graph holds without knowing them: 'watermark_decode_improved'
+// only looks at the key in a few ambiguous nodes (rules 2.7 and 2.9), so every key
+// 'watermark_decode_improved' decodes back to itself is found by walking the decoder
+// once, with the key bit of each node taken from what the node decodes to, and
+// branching where both bits are consistent
+
+// longest RS codeword, in bytes (255 symbols of 8 bits)
+#define KEYLESS_MAX_CODEWORD_BYTES 255
+// branches of the search that get their own OpenMP task
+#define KEYLESS_MAX_TASKS 1024
+
+typedef struct KEYLESS_OPTS {
+    // if 'num_parity_symbols' isn't zero, keys are RS codewords of 'num_data_symbols'
+    // data symbols (as 'watermark_rs_decode_improved' takes) and only valid codewords
+    // are kept: once the data bits of a branch are known, its parity is too, so the
+    // rest of the branch has no choices left
+    unsigned long num_data_symbols;
+    unsigned long num_parity_symbols;
+    unsigned long symsize;
+    // stop after this many keys (0 for no limit)
+    unsigned long max_keys;
+} KEYLESS_OPTS;
+
+// position of a branch of the search (the rest is in its workspace)
+typedef struct KEYLESS_CURSOR {
+    // significant bits of the key being searched for
+    unsigned long key_bits;
+    unsigned long graph_idx;
+    unsigned long i;
+    unsigned long forward_edges_left;
+    uint8_t forward_destination;
+    uint8_t node_27_was_the_last;
+    uint8_t node_29_was_the_last;
+    // RS codeword this branch must end up with, once its data bits are known
+    uint8_t has_codeword;
+    uint8_t codeword[KEYLESS_MAX_CODEWORD_BYTES];
+} KEYLESS_CURSOR;
+
+// every key (data bits only with RS) that decodes back to itself from 'graph', in no
+// particular order. 'num_keys' holds how many were found. Free each with 'bitvec_free'
+// and the array with 'free'
+BITVEC** watermark_decode_keyless(GRAPH* graph, KEYLESS_OPTS* opts, unsigned long* num_keys);
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include "utils/utils.h"
+
+// flat copy of what the decoders look at in a node, so they don't walk connection lists
+typedef struct VIEW_NODE {
+    // destination of the first backedge in 'out' order, as 'graph_get_backedge' (only
+    // valid if 'num_backedges' isn't zero)
+    unsigned long backedge;
+    unsigned long num_backedges;
+    // edges to v+2 or further, as 'graph_get_forward'
+    unsigned long num_forward;
+    unsigned long num_out;
+    unsigned long num_in;
+    uint8_t flags;
+} VIEW_NODE;
+
+// 'VIEW_NODE.flags'
+#define VIEW_NODE_HAMILTONIAN 0x01 // [v -> v+1]
+#define VIEW_NODE_SKIP 0x02 // [v -> v+2]
+#define VIEW_NODE_SELF_LOOP 0x04 // [v -> v]
+
+// scratch memory for the encoders, decoders and the checker, so they don't need to
+// allocate anything per call. One per thread, it only grows (see 'workspace_reserve')
+typedef struct WORKSPACE {
+    unsigned long max_nodes;
+    // packed decoded bits (same bit order as 'get_bit'), results are returned from here
+    uint8_t* bits;
+    STACK odd_stack;
+    STACK even_stack;
+    unsigned long* history;
+    // per node checker info, indexed by 'graph_idx'
+    UTILS_NODE* nodes;
+    // per node flags and backedge destinations of 'watermark_encode_plan' (twice as
+    // many, since forward edges add nodes)
+    uint8_t* kinds;
+    unsigned long* backedges;
+    // adjacency of the last graph given to 'workspace_load_graph'
+    VIEW_NODE* view;
+    unsigned long view_num_nodes;
+    // index of each node in the stack it was pushed to (only meaningful while it's there)
+    unsigned long* positions;
+} WORKSPACE;
+
+// 'WORKSPACE.kinds' flags
+#define ENCODE_NODE_FORWARD 0x01 // forward edge to node+2 (if-then or while source)
+#define ENCODE_NODE_WHILE 0x02 // the node after it loops back to it
+#define ENCODE_NODE_BACKEDGE 0x04 // origin of a backedge (repeat or while)
+#define ENCODE_NODE_REPEAT 0x08 // destination of a repeat backedge
+
+WORKSPACE* workspace_create(unsigned long max_nodes);
+// make sure 'ws' can handle graphs with 'num_nodes' nodes
+void workspace_reserve(WORKSPACE* ws, unsigned long num_nodes);
+// zero the first 'n_bits' bits and empty the stacks
+void workspace_clear(WORKSPACE* ws, unsigned long n_bits);
+// freeze the adjacency of 'graph' into 'ws->view' (O(V+E))
+void workspace_load_graph(WORKSPACE* ws, GRAPH* graph);
+// remove/add an edge of the loaded view. Disconnect returns 0 if the edge can't be
+// there, or if it's the first backedge of a node with more than one (the next one in
+// 'out' order isn't known). Connecting back what was disconnected restores the view
+uint8_t workspace_view_disconnect(WORKSPACE* ws, unsigned long from, unsigned long to);
+void workspace_view_connect(WORKSPACE* ws, unsigned long from, unsigned long to);
+// throw the first 'n_bits' bits of 'bits' to the right, in place
+uint8_t* workspace_pack_sequence(uint8_t* bits, unsigned long n_bits, unsigned long* num_bytes);
+// throw the first 'n_bits' bits of 'ws->bits' to the right, as 'get_sequence_from_bit_arr' does
+uint8_t* workspace_get_sequence(WORKSPACE* ws, unsigned long n_bits, unsigned long* num_bytes);
+// hand 'ws->bits' over to the caller (to be freed with 'free') and free the rest
+void* workspace_release_bits(WORKSPACE* ws, unsigned long num_bytes);
+void workspace_free(WORKSPACE* ws);
+
+#endif
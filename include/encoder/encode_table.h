@@ -0,0 +1,54 @@
+#ifndef ENCODE_TABLE_H
+#define ENCODE_TABLE_H
+
+#include "encoder/encoder.h"
+
+// precomputed graphs of every key with a given number of bits (from 2^(n_bits-1) to
+// 2^n_bits - 1), each encoded from its 64 bit big endian form with an RNG seeded with
+// 'seed + key' (same graphs as the removal attack in 'watermark.c' when 'seed' is 0)
+
+#define ENCODE_TABLE_MAGIC "WMET"
+#define ENCODE_TABLE_MAX_BITS 24
+
+typedef struct ENCODE_TABLE_HEADER {
+    char magic[4];
+    uint32_t n_bits;
+    uint64_t seed;
+    uint64_t first_key;
+    uint64_t num_keys;
+    // bytes per key
+    uint64_t record_len;
+} ENCODE_TABLE_HEADER;
+
+// a record lists where each graph differs from the hamiltonian path: number of nodes,
+// number of entries, then one (from, to) byte pair per entry, sorted by 'from'. An
+// entry is an edge that isn't [from -> from+1], or [from -> from+1] missing when 'to'
+// is equal to 'from' (inner node of a while block)
+typedef struct ENCODE_TABLE {
+    ENCODE_TABLE_HEADER* header;
+    uint8_t* records;
+    // header and records, either mapped from a file or allocated
+    void* memory;
+    unsigned long memory_len;
+    uint8_t is_mapped;
+    // open addressing reverse index: record hash -> key offset + 1 (0 is empty)
+    unsigned long* index;
+    unsigned long index_len;
+} ENCODE_TABLE;
+
+// encode every key (in parallel) and build the table in memory, NULL if 'n_bits' isn't
+// between 1 and ENCODE_TABLE_MAX_BITS
+ENCODE_TABLE* encode_table_create(unsigned long n_bits, uint64_t seed);
+// write table to file, returns 0 on failure
+uint8_t encode_table_save(ENCODE_TABLE* table, const char* filename);
+// map a table written by 'encode_table_save', NULL if the file can't be read or isn't a table
+ENCODE_TABLE* encode_table_load(const char* filename);
+void encode_table_free(ENCODE_TABLE* table);
+
+// graph of 'key' (same neighbour order as 'watermark_encode_rng'), NULL if the key
+// isn't in the table
+GRAPH* encode_table_get_graph(ENCODE_TABLE* table, unsigned long key, WORKSPACE* ws);
+// reverse lookup: returns 1 and sets 'key' if 'graph' is exactly the graph of a key
+uint8_t encode_table_find_key(ENCODE_TABLE* table, GRAPH* graph, unsigned long* key);
+
+#endif
@@ -2,13 +2,94 @@
 #define ENCODER_H
 
 #include "graph/graph.h"
+#include "decoder/workspace.h"
+
+typedef struct ENCODE_OPTS {
+    // bytes from one key to the next in the 'keys' array
+    unsigned long key_len;
+    // bits of each key used, starting from its first byte (data bits if RS is used)
+    unsigned long n_bits;
+    // if not zero, RS parity is appended to each key before encoding
+    unsigned long num_parity_symbols;
+    unsigned long symsize;
+    // key 'i' is encoded with an RNG seeded with 'seed + i'
+    uint64_t seed;
+    // 0 uses the OpenMP default
+    unsigned long num_threads;
+} ENCODE_OPTS;
+
+// position of a plan (see 'watermark_encode_plan_start')
+typedef struct ENCODE_CURSOR {
+    // next bit and node to be encoded
+    unsigned long bit_idx;
+    unsigned long idx;
+    unsigned long num_nodes;
+} ENCODE_CURSOR;
+
+// called for every graph found by 'watermark_encode_enumerate', which frees it afterwards.
+// Returning non zero stops the enumeration
+typedef int (*ENCODE_CALLBACK)(GRAPH* graph, void* arg);
+
+// branches of the enumeration that get their own OpenMP task
+#define ENUMERATE_MAX_TASKS 1024
 
 GRAPH* watermark2014_encode(void* data, unsigned long data_len);
 GRAPH* watermark_encode8(void* data, unsigned long data_len);
 GRAPH* watermark_encode(void* data, unsigned long n_bits);
 
+// same as above, but backedges are picked with 'rng' (a given key and seed always
+// give the same graph), the versions above seed one from 'rand()'
+GRAPH* watermark2014_encode_rng(void* data, unsigned long data_len, RNG* rng);
+GRAPH* watermark_encode_rng(void* data, unsigned long n_bits, RNG* rng);
+// same as above, using 'ws' for the stacks and history
+GRAPH* watermark_encode_workspace(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws);
+
 GRAPH* watermark2014_rs_encode(void* data, unsigned long data_len, unsigned long num_parity_symbols);
 GRAPH* watermark_rs_encode8(void* data, unsigned long data_len, unsigned long num_parity_symbols);
 GRAPH* watermark_rs_encode(void* data, unsigned long num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize);
+// same as above, with the backedges picked by 'rng' (see 'watermark_encode_rng')
+GRAPH* watermark2014_rs_encode_rng(void* data, unsigned long data_len, unsigned long num_parity_symbols, RNG* rng);
+GRAPH* watermark_rs_encode8_rng(void* data, unsigned long data_len, unsigned long num_parity_symbols, RNG* rng);
+GRAPH* watermark_rs_encode_rng(void* data, unsigned long num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize, RNG* rng);
+
+// BITVEC variants ('bits->n_bits' must be a multiple of 'symsize' for the RS one)
+GRAPH* watermark2014_encode_bitvec(BITVEC* bits);
+GRAPH* watermark_encode_bitvec(BITVEC* bits);
+GRAPH* watermark2014_rs_encode_bitvec(BITVEC* bits, unsigned long num_parity_symbols);
+GRAPH* watermark_rs_encode_bitvec(BITVEC* bits, unsigned long num_parity_symbols, unsigned long symsize);
+
+// encode the 'n' keys of 'keys' in parallel, 'out_graphs' must have room for 'n' graphs
+void watermark_encode_batch(void* keys, unsigned long n, ENCODE_OPTS* opts, GRAPH** out_graphs);
+
+// flags of every node of the graph 'watermark_encode_workspace' would build for the same
+// key and seed, in 'ws->kinds' and 'ws->backedges'. Returns the number of nodes
+unsigned long watermark_encode_plan(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws);
+// the plan above, step by step: 'run' goes on until a repeat block needs a backedge
+// destination and returns the number of options (0 once every bit is encoded), then
+// 'choose' takes one of them (index in the stack of possible destinations)
+void watermark_encode_plan_start(void* data, unsigned long n_bits, WORKSPACE* ws, ENCODE_CURSOR* cursor);
+unsigned long watermark_encode_plan_run(void* data, unsigned long n_bits, WORKSPACE* ws, ENCODE_CURSOR* cursor);
+void watermark_encode_plan_choose(void* data, WORKSPACE* ws, ENCODE_CURSOR* cursor, unsigned long choice);
+// copy the plan state of 'src' at 'cursor' to 'dst'
+void watermark_encode_plan_copy(WORKSPACE* dst, WORKSPACE* src, ENCODE_CURSOR* cursor);
+// build the graph of a finished plan
+GRAPH* watermark_encode_plan_graph(WORKSPACE* ws, unsigned long num_nodes);
+// same graph as 'watermark_encode_rng'/'watermark_encode_workspace', built from the plan
+// above with every node allocated up front, in linear time (for keys with 10^5+ bits)
+GRAPH* watermark_encode_large_rng(void* data, unsigned long n_bits, RNG* rng);
+GRAPH* watermark_encode_large_workspace(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws);
+
+// dijkstra code of the graph 'watermark_encode' would build for the same key and seed,
+// written directly from the bits without building the graph
+char* watermark_encode_dijkstra_code(void* data, unsigned long n_bits);
+char* watermark_encode_dijkstra_code_rng(void* data, unsigned long n_bits, RNG* rng);
+char* watermark_encode_dijkstra_code_workspace(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws);
+// dijkstra code of a finished plan
+char* watermark_encode_plan_dijkstra_code(WORKSPACE* ws, unsigned long num_nodes);
+
+// pass every graph 'watermark_encode' can build for the key (one per combination of
+// repeat backedge destinations) to 'callback', returning how many were passed. Branches
+// are explored in parallel, so 'callback' may be called from several threads at once
+unsigned long watermark_encode_enumerate(void* data, unsigned long n_bits, ENCODE_CALLBACK callback, void* arg);
 
 #endif
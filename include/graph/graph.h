@@ -15,6 +15,11 @@ typedef struct GRAPH {
     struct NODE** nodes;
     unsigned long num_nodes;
     unsigned long num_connections;
+    // nodes with a forward edge (see 'graph_get_forward'), only valid if
+    // 'has_num_forward_edges' is set. Kept up to date by 'graph_oriented_connect' and
+    // 'graph_oriented_disconnect', anything that moves nodes around unsets it
+    unsigned long num_forward_edges;
+    uint8_t has_num_forward_edges;
 } GRAPH;
 
 #include "set/set.h"
@@ -68,6 +73,9 @@ CONNECTION* graph_get_forward(NODE* node);
 // returns true if connection existed
 uint8_t graph_oriented_disconnect(NODE* from, NODE* to);
 
+// number of nodes with a forward edge, counted only if the graph doesn't carry it
+unsigned long graph_count_forward_edges(GRAPH*);
+
 // sort topologically, ignoring back edges
 void graph_topological_sort(GRAPH*);
 
@@ -28,6 +28,7 @@ typedef struct HASHMAP {
 
 #include "utils/utils.h"
 
+unsigned long djb2(uint8_t* key, unsigned long key_len);
 HASHMAP* hashmap_create(uint8_t copy_key, uint8_t copy_data, unsigned long (*hash)(void*, unsigned long));
 HASHMAP_NODE* hashmap_find(HASHMAP* hashmap, void* key, unsigned long key_len);
 void* hashmap_get(HASHMAP* hashmap, void* key, unsigned long* len);
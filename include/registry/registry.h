@@ -0,0 +1,68 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include "checker/checker.h"
+#include "encoder/encoder.h"
+
+// index of every key issued with 'watermark_encode_batch', to find which one a graph
+// carries without checking it against all of them. Keys are indexed by signatures the
+// graph gives away without the key, so a lookup only has to run 'watermark_check' on
+// the few keys with the same signature
+
+// candidates checked by 'registry_find_key'
+#define REGISTRY_MAX_CANDIDATES 64
+
+typedef struct REGISTRY_SIGNATURE {
+    uint32_t num_nodes;
+    // nodes with a forward edge, as counted by 'watermark_check'
+    uint32_t num_forward_edges;
+    // parity of every backedge, in order
+    uint64_t parity_hash;
+    // hash of the dijkstra code (depends on the key and on the backedges picked by the RNG)
+    uint64_t code_hash;
+} REGISTRY_SIGNATURE;
+
+typedef struct REGISTRY_ENTRY {
+    REGISTRY_SIGNATURE signature;
+    // index of the key in the batch (encoded with an RNG seeded with 'seed + key_idx')
+    uint64_t key_idx;
+} REGISTRY_ENTRY;
+
+typedef struct REGISTRY_KEY {
+    // djb2 of the key, as stored in 'REGISTRY.keys'
+    uint64_t hash;
+    uint64_t key_idx;
+} REGISTRY_KEY;
+
+typedef struct REGISTRY {
+    // keys as they are encoded (with RS parity, if any), thrown to the right so they
+    // can be given to 'watermark_check' directly
+    uint8_t* keys;
+    unsigned long key_len;
+    unsigned long num_keys;
+    // sorted by signature
+    REGISTRY_ENTRY* entries;
+    // sorted by hash
+    REGISTRY_KEY* by_key;
+} REGISTRY;
+
+// index the 'n' keys of 'keys', as 'watermark_encode_batch' encodes them with 'opts'
+// (signatures are computed in parallel, from the encoding plans, no graph is built)
+REGISTRY* registry_create(void* keys, unsigned long n, ENCODE_OPTS* opts);
+void registry_free(REGISTRY* registry);
+
+// signature of the graph 'ws' holds the plan of ('watermark_encode_plan'), and of any graph
+void registry_signature_from_plan(WORKSPACE* ws, unsigned long num_nodes, REGISTRY_SIGNATURE* signature);
+void registry_signature_from_graph(GRAPH* graph, WORKSPACE* ws, REGISTRY_SIGNATURE* signature);
+
+// shortlist of keys (indexes in the batch) that may be in 'graph', best first: same
+// dijkstra code, then same backedge parities, then the keys 'watermark_decode' gives
+// (for graphs encoded with another seed), then just the same number of nodes and
+// forward edges. Returns how many were written to 'key_idxs'
+unsigned long registry_lookup(REGISTRY* registry, GRAPH* graph, WORKSPACE* ws, unsigned long* key_idxs, unsigned long max_candidates);
+// run 'watermark_check' on the first REGISTRY_MAX_CANDIDATES keys of the shortlist,
+// returns 1 and sets 'key_idx' to the first one that matches
+uint8_t registry_find_key(REGISTRY* registry, GRAPH* graph, unsigned long* key_idx);
+uint8_t registry_find_key_workspace(REGISTRY* registry, GRAPH* graph, unsigned long* key_idx, WORKSPACE* ws);
+
+#endif
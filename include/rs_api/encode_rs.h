@@ -15,7 +15,7 @@
 
 /* Generic data width independent code which is included by the
  * wrappers.
- * int encode_rsX (struct rs_control *rs, uintX_t *data, int len, uintY_t *par)
+ * int encode_rsX (const struct rs_control *rs, uintX_t *data, int len, uintY_t *par)
  */
 {
 	int i, j, pad;
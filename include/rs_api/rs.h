@@ -12,6 +12,15 @@ int rs_decode(uint8_t* result, int data_len, int number_of_parity_symbols, int s
 void* append_rs_code8(void* data, unsigned long* data_len, unsigned long num_parity_symbols); // return n_bytes
 void* append_rs_code(void* data, unsigned long* num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize); // returns n_bits
 
+// number of keys encoded together by 'append_rs_code_batch' (one bit per key in each machine word)
+#define RS_BATCH_LANES 256
+
+// encode 'num_keys' sequences at once, RS_BATCH_LANES at a time, in bit-sliced form.
+// 'keys' holds the sequences 'key_len' bytes apart, each with 'num_data_symbols' symbols
+// merged like in 'append_rs_code'. Returns all data + parity sequences, 'res_len' bytes
+// apart, ready for 'watermark_encode'. 'num_bits' will hold the number of bits in each one
+void* append_rs_code_batch(void* keys, unsigned long key_len, unsigned long num_keys, unsigned long num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize, unsigned long* res_len, unsigned long* num_bits);
+
 // 'num_parity_symbols' will hold the original data sequence size
 uint8_t* remove_rs_code8(uint8_t* data, unsigned long data_len, unsigned long* num_parity_symbols);
 uint8_t* remove_rs_code(uint8_t* data, unsigned long num_data_symbols, unsigned long num_parity_symbols, int symsize);
@@ -0,0 +1,14 @@
+#ifndef RS_TABLES_H
+#define RS_TABLES_H
+
+#include "rs_api/rslib.h"
+
+#define RS_TABLES_MIN_SYMSIZE 2
+#define RS_TABLES_MAX_SYMSIZE 8
+
+// get precomputed codec for the given symbol size and number of parity symbols,
+// returns NULL if it isn't supported. The tables live in 'src/rs_api/rs_tables.c',
+// generated by 'make rs_tables', and must never be freed or written to
+const struct rs_control* rs_tables_get(int symsize, int nroots);
+
+#endif
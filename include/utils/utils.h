@@ -34,6 +34,18 @@ typedef struct UTILS_NODE {
     unsigned long bit_idx;
 } UTILS_NODE;
 
+// xoshiro256** state, every thread/key gets its own instead of sharing 'rand()'
+typedef struct RNG {
+    uint64_t s[4];
+} RNG;
+
+// 'n_bits' bits, starting at the most significant bit of the first byte of 'words'
+typedef struct BITVEC {
+    uint64_t* words;
+    unsigned long n_bits;
+    unsigned long n_words;
+} BITVEC;
+
 #include "graph/graph.h"
 
 // system
@@ -42,6 +54,12 @@ uint8_t is_little_endian_machine();
 // math
 unsigned long ceil_power_of_2(unsigned long n);
 
+// random numbers
+void rng_seed(RNG*, uint64_t seed);
+uint64_t rng_next(RNG*);
+// uniform in [0, n), n > 0
+unsigned long rng_below(RNG*, unsigned long n);
+
 // stack
 STACK* stack_create(unsigned long max_nodes);
 void stack_push(STACK*, unsigned long);
@@ -72,11 +90,40 @@ unsigned long get_number_of_left_zeros(uint8_t* data, unsigned long data_len);
 unsigned long get_number_of_right_zeros(uint8_t* data, unsigned long data_len);
 void remove_left_zeros(uint8_t* data, unsigned long* data_len);
 void add_left_zeros(uint8_t** data, unsigned long* data_len, unsigned long num_zeros);
+void shift_sequence_left(uint8_t* data, unsigned long data_len, unsigned long n);
+void shift_sequence_right(uint8_t* data, unsigned long data_len, unsigned long n);
 void merge_arr(void* data, unsigned long* data_len, unsigned long element_size, unsigned long symbol_size);
 void unmerge_arr(void* data, unsigned long num_symbols, unsigned long element_size, unsigned long symbol_size, void** res);
+// word-at-a-time packing of symbols kept in the lowest bits of 'element_size' byte elements
+// (uses pext/pdep when compiled with BMI2), 'next_bit' is updated past the last bit written/read
+void pack_symbols(void* from, unsigned long num_symbols, unsigned long element_size, unsigned long symbol_size, uint8_t* to, unsigned long* next_bit);
+void unpack_symbols(uint8_t* from, unsigned long* next_bit, unsigned long num_symbols, unsigned long element_size, unsigned long symbol_size, void* to);
+
+// bit vector
+BITVEC* bitvec_create(unsigned long n_bits);
+// first 'n_bits' of 'data' (same layout 'watermark_encode' takes)
+BITVEC* bitvec_from_bytes(void* data, unsigned long n_bits);
+// sequence that starts at the first positive bit of 'data' (same layout decoders return)
+BITVEC* bitvec_from_sequence(void* data, unsigned long num_bytes);
+// 'num_bytes' byte sequence with the bits thrown to the right
+uint8_t* bitvec_to_sequence(BITVEC*, unsigned long* num_bytes);
+BITVEC* bitvec_copy(BITVEC*);
+void bitvec_free(BITVEC*);
+uint8_t bitvec_get(BITVEC*, unsigned long idx);
+void bitvec_set(BITVEC*, unsigned long idx, uint8_t value);
+uint8_t bitvec_equal(BITVEC*, BITVEC*);
+void bitvec_resize(BITVEC*, unsigned long n_bits);
+unsigned long bitvec_get_first_positive_bit_index(BITVEC*);
+unsigned long bitvec_get_number_of_left_zeros(BITVEC*);
+unsigned long bitvec_get_number_of_right_zeros(BITVEC*);
+void bitvec_shift_left(BITVEC*, unsigned long n);
+void bitvec_shift_right(BITVEC*, unsigned long n);
+void bitvec_remove_left_zeros(BITVEC*);
+void bitvec_add_left_zeros(BITVEC*, unsigned long num_zeros);
+void bitvec_invert(BITVEC*);
 
 // 2017 codec-specific
 uint8_t has_possible_backedge(STACK* possible_backedges, GRAPH* graph, unsigned long current_idx);
-unsigned long get_backedge_index(STACK* possible_backedges, GRAPH* graph, unsigned long current_idx);
+unsigned long get_backedge_index(STACK* possible_backedges, GRAPH* graph, unsigned long current_idx, RNG* rng);
 
 #endif
@@ -1,5 +1,9 @@
 #include "checker/checker.h"
 
+#if defined(_OPENMP)
+  #include <omp.h>
+#endif
+
 uint8_t node_only_has_hamiltonian_edge(NODE* node) {
 
     if(node->graph_idx == node->graph->num_nodes-1) {
@@ -50,31 +54,38 @@ STATUS_BIT watermark_check_get_bit(GRAPH* graph, unsigned long idx, uint8_t bit,
 // return true if it matches
 uint8_t watermark_check(GRAPH* graph, void* data, unsigned long num_bytes) {
 
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    uint8_t result = watermark_check_workspace(graph, data, num_bytes, ws);
+    workspace_free(ws);
+    return result;
+}
+
+uint8_t watermark_check_workspace(GRAPH* graph, void* data, unsigned long num_bytes, WORKSPACE* ws) {
+
     unsigned long total_number_of_bits = num_bytes*8;
     unsigned long starting_idx = get_first_positive_bit_index(data, num_bytes);
     unsigned long n_bits = total_number_of_bits - starting_idx;
     unsigned long max_num_nodes = graph->num_nodes - 2;
 
     // check if number of bits represented by the graph and number of bits in the given sequence match
-    unsigned long num_forward_edges = 0;
-    for(unsigned long i = 0; i < graph->num_nodes; i++) if(graph_get_forward(graph->nodes[i])) num_forward_edges++;
-    if(n_bits != graph->num_nodes - 2 - num_forward_edges) return 0;
-
-    // load UTILS_NODE struct to all nodes
-    UTILS_NODE checker_nodes[graph->num_nodes];
-    for(unsigned long i = 0; i < graph->num_nodes; i++) {
-        checker_nodes[i].backedge_idx = ULONG_MAX;
-        node_load_info(graph->nodes[i], &checker_nodes[i], sizeof(UTILS_NODE));
-    }
+    // (the graph usually carries its number of forward edges, so a wrong key costs
+    // nothing more than the walk up to its first wrong bit)
+    if(n_bits != graph->num_nodes - 2 - graph_count_forward_edges(graph)) return 0;
+
+    // UTILS_NODE of every node, indexed by 'graph_idx'. Nodes behind the walk are the
+    // only ones ever looked at, so 'backedge_idx' is written as the walk goes
+    workspace_reserve(ws, graph->num_nodes);
+    workspace_clear(ws, 0);
+    UTILS_NODE* checker_nodes = ws->nodes;
 
     unsigned long i = starting_idx+1;
 
-    STACK* odd_stack = stack_create(n_bits);
-    STACK* even_stack = stack_create(n_bits);
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
     stack_push(odd_stack, 0);
-    ((UTILS_NODE*)node_get_info(graph->nodes[0]))->backedge_idx = 0;
+    checker_nodes[0].backedge_idx = 0;
 
-    unsigned long history[graph->num_nodes];
+    unsigned long* history = ws->history;
     history[0] = 0;
 
     uint8_t last_four_nodes_only_have_hamiltonian_edges = graph->num_nodes > 3 &&
@@ -102,9 +113,6 @@ uint8_t watermark_check(GRAPH* graph, void* data, unsigned long num_bytes) {
             case BIT_0:
             case BIT_1:
                 if(bit != checker_flag - '0') {
-                    graph_unload_info(graph);
-                    stack_free(odd_stack);
-                    stack_free(even_stack);
                     return 0;
                 }
                 break;
@@ -114,36 +122,25 @@ uint8_t watermark_check(GRAPH* graph, void* data, unsigned long num_bytes) {
             case BIT_0_BACKEDGE:
             case BIT_1_BACKEDGE:
                 if( (checker_flag == BIT_0_BACKEDGE && bit) || (checker_flag == BIT_1_BACKEDGE && !bit)) {
-                    graph_unload_info(graph);
-                    stack_free(odd_stack);
-                    stack_free(even_stack);
                     return 0;
                 }
                 CONNECTION* backedge_conn = graph_get_backedge(graph->nodes[graph_idx]);
                 if( !backedge_conn || (( bit && !((graph_idx - backedge_conn->node->graph_idx) & 1)) ||
                 ( !bit && ((graph_idx - backedge_conn->node->graph_idx) & 1) )) ||
-                ((UTILS_NODE*)node_get_info(backedge_conn->node))->backedge_idx >= possible_backedges->n) {
-                    graph_unload_info(graph);
-                    stack_free(odd_stack);
-                    stack_free(even_stack);
+                checker_nodes[backedge_conn->node->graph_idx].backedge_idx >= possible_backedges->n) {
                     return 0;
                 }
-                stack_pop_until(possible_backedges, ((UTILS_NODE*)node_get_info(backedge_conn->node))->backedge_idx);
+                stack_pop_until(possible_backedges, checker_nodes[backedge_conn->node->graph_idx].backedge_idx);
                 stack_pop_until(other_stack, history[backedge_conn->node->graph_idx]);
+                checker_nodes[graph_idx].backedge_idx = ULONG_MAX;
                 continue;
             case BIT_1_FORWARD_EDGE_AND_BIT_0:
                 if(!bit || ( i != total_number_of_bits-1 && get_bit(data, ++i) )) {
-                    graph_unload_info(graph);
-                    stack_free(odd_stack);
-                    stack_free(even_stack);
                     return 0;
                 }
                 break;
             case BIT_1_FORWARD_EDGE_AND_BIT_1:
                 if(!bit || ( i != total_number_of_bits-1 && !get_bit(data, ++i) )) {
-                    graph_unload_info(graph);
-                    stack_free(odd_stack);
-                    stack_free(even_stack);
                     return 0;
                 }
                 break;
@@ -153,24 +150,234 @@ uint8_t watermark_check(GRAPH* graph, void* data, unsigned long num_bytes) {
         // save stacks
         // odd
         if(is_odd) {
-            ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->backedge_idx = odd_stack->n;
+            checker_nodes[graph_idx].backedge_idx = odd_stack->n;
             stack_push(odd_stack, graph_idx);
             history[graph_idx] = even_stack->n;
         // even
         } else {
-            ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->backedge_idx = even_stack->n;
+            checker_nodes[graph_idx].backedge_idx = even_stack->n;
             stack_push(even_stack, graph_idx);
             history[graph_idx] = odd_stack->n;
         }
         // if this was the origin of a forward node, we already processed the inner forward node
-        if(checker_flag == BIT_1_FORWARD_EDGE_AND_BIT_0 || checker_flag == BIT_1_FORWARD_EDGE_AND_BIT_1) graph_idx++;
+        if(checker_flag == BIT_1_FORWARD_EDGE_AND_BIT_0 || checker_flag == BIT_1_FORWARD_EDGE_AND_BIT_1) {
+            checker_nodes[++graph_idx].backedge_idx = ULONG_MAX;
+        }
     }
     // bit sequence may be smaller than expected due to mute nodes
-    graph_unload_info(graph);
-    stack_free(odd_stack);
-    stack_free(even_stack);
     return 1;
 }
+
+CHECK_PLAN* watermark_check_plan(GRAPH* graph) {
+
+    CHECK_PLAN* plan = malloc(sizeof(CHECK_PLAN));
+    unsigned long num_nodes = graph->num_nodes;
+    plan->num_nodes = num_nodes;
+    plan->nodes = calloc(num_nodes ? num_nodes : 1, 1);
+    plan->ws = workspace_create(num_nodes);
+    workspace_load_graph(plan->ws, graph);
+    VIEW_NODE* view = plan->ws->view;
+
+    unsigned long num_forward_edges = 0;
+    for(unsigned long i = 0; i < num_nodes; i++) if(view[i].num_forward) num_forward_edges++;
+    plan->n_bits = num_nodes - 2 - num_forward_edges;
+    if(num_nodes < 3) return plan;
+
+    // same as 'node_only_has_hamiltonian_edge'
+    #define ONLY_HAMILTONIAN(idx) ( (idx) == num_nodes-1 ? !view[idx].num_out : \
+        view[idx].num_out == 1 && (view[idx].flags & VIEW_NODE_HAMILTONIAN) && (view[idx].num_in == 1 || !(idx)) )
+    uint8_t last_four_nodes_only_have_hamiltonian_edges = num_nodes > 3 &&
+        ONLY_HAMILTONIAN(num_nodes-1) && ONLY_HAMILTONIAN(num_nodes-2) &&
+        ONLY_HAMILTONIAN(num_nodes-3) && ONLY_HAMILTONIAN(num_nodes-4);
+
+    // same order as 'watermark_check_get_bit'
+    for(unsigned long idx = 1; idx < num_nodes - 2; idx++) {
+        uint8_t* node = &plan->nodes[idx];
+        if( idx > 1 && (view[idx-2].flags & VIEW_NODE_SKIP) ) {
+            *node = CHECK_NODE_MUTE;
+        } else if( view[idx].flags & VIEW_NODE_SKIP ) {
+            *node = CHECK_NODE_FORWARD | (view[idx+1].flags & VIEW_NODE_HAMILTONIAN ? 0 : CHECK_NODE_BIT_1);
+        } else if( view[idx].num_backedges ) {
+            *node = CHECK_NODE_BACKEDGE | ((idx - view[idx].backedge) & 1 ? CHECK_NODE_BIT_1 : 0);
+        } else if( !(view[idx+1].flags & VIEW_NODE_HAMILTONIAN) ) {
+            *node = CHECK_NODE_FORWARD | CHECK_NODE_BIT_1;
+        } else {
+            if( last_four_nodes_only_have_hamiltonian_edges && idx == num_nodes-4 ) *node |= CHECK_NODE_FOURTH_LAST;
+            if( ONLY_HAMILTONIAN(idx) && ONLY_HAMILTONIAN(idx+1) && ONLY_HAMILTONIAN(idx+2) ) *node |= CHECK_NODE_RUN_OF_THREE;
+        }
+    }
+    #undef ONLY_HAMILTONIAN
+    return plan;
+}
+
+void watermark_check_plan_free(CHECK_PLAN* plan) {
+
+    if(!plan) return;
+    free(plan->nodes);
+    workspace_free(plan->ws);
+    free(plan);
+}
+
+// keys following the same path through the plan, with the stacks they share
+typedef struct CHECK_GROUP {
+    uint64_t lanes;
+    unsigned long graph_idx;
+    // bit index, counted from each key's first positive bit
+    unsigned long i;
+    // 'positions' holds the 'backedge_idx' of 'watermark_check'
+    WORKSPACE* ws;
+} CHECK_GROUP;
+
+void watermark_check_group_copy(CHECK_GROUP* dst, CHECK_GROUP* src, unsigned long num_nodes) {
+
+    dst->graph_idx = src->graph_idx;
+    dst->i = src->i;
+    WORKSPACE* ws = dst->ws;
+    workspace_reserve(ws, num_nodes);
+    ws->odd_stack.n = src->ws->odd_stack.n;
+    ws->even_stack.n = src->ws->even_stack.n;
+    memcpy(ws->odd_stack.stack, src->ws->odd_stack.stack, ws->odd_stack.n * sizeof(unsigned long));
+    memcpy(ws->even_stack.stack, src->ws->even_stack.stack, ws->even_stack.n * sizeof(unsigned long));
+    memcpy(ws->history, src->ws->history, num_nodes * sizeof(unsigned long));
+    memcpy(ws->positions, src->ws->positions, num_nodes * sizeof(unsigned long));
+}
+
+// save stacks after node 'graph_idx' was accepted
+void watermark_check_group_push(CHECK_GROUP* group) {
+
+    WORKSPACE* ws = group->ws;
+    uint8_t is_odd = !(group->graph_idx&1);
+    STACK* stack = is_odd ? &ws->odd_stack : &ws->even_stack;
+    ws->positions[group->graph_idx] = stack->n;
+    stack_push(stack, group->graph_idx);
+    ws->history[group->graph_idx] = is_odd ? ws->even_stack.n : ws->odd_stack.n;
+}
+
+// a 1 bit at 'graph_idx', followed by the bit of the inner node (0 or 'inner_bit')
+void watermark_check_group_forward(CHECK_PLAN* plan, CHECK_GROUP* group, uint64_t* sliced, uint8_t inner_bit) {
+
+    if(group->i != plan->n_bits - 1) {
+        group->i++;
+        group->lanes &= inner_bit ? sliced[group->i] : ~sliced[group->i];
+    }
+    watermark_check_group_push(group);
+    group->graph_idx += 2;
+    group->i++;
+}
+
+// walk 'group' until its keys all mismatch or the graph ends. Keys that take another
+// path are split into a new group, appended to 'groups'
+void watermark_check_group_walk(CHECK_PLAN* plan, CHECK_GROUP* groups, unsigned long g, unsigned long* num_groups, uint64_t* sliced) {
+
+    CHECK_GROUP* group = &groups[g];
+    VIEW_NODE* view = plan->ws->view;
+    STACK* odd_stack = &group->ws->odd_stack;
+    STACK* even_stack = &group->ws->even_stack;
+    while(group->lanes && group->graph_idx < plan->num_nodes - 2) {
+
+        unsigned long graph_idx = group->graph_idx;
+        uint8_t node = plan->nodes[graph_idx];
+        uint8_t is_odd = !(graph_idx&1);
+        uint64_t ones = group->lanes & sliced[group->i];
+        uint64_t zeros = group->lanes & ~sliced[group->i];
+
+        if( node & CHECK_NODE_MUTE ) {
+            group->i--;
+        } else if( node & CHECK_NODE_FORWARD ) {
+            group->lanes = ones;
+            watermark_check_group_forward(plan, group, sliced, !!(node & CHECK_NODE_BIT_1));
+            continue;
+        } else if( node & CHECK_NODE_BACKEDGE ) {
+            uint8_t bit = !!(node & CHECK_NODE_BIT_1);
+            group->lanes = bit ? ones : zeros;
+            STACK* possible_backedges = (is_odd && bit) || (!is_odd && !bit) ? even_stack : odd_stack;
+            STACK* other_stack = possible_backedges == even_stack ? odd_stack : even_stack;
+            unsigned long backedge = view[graph_idx].backedge;
+            if(group->ws->positions[backedge] >= possible_backedges->n) {
+                group->lanes = 0;
+                break;
+            }
+            stack_pop_until(possible_backedges, group->ws->positions[backedge]);
+            stack_pop_until(other_stack, group->ws->history[backedge]);
+            group->graph_idx++;
+            group->i++;
+            continue;
+        } else {
+            // keys with a 1 bit only match if rule 2.7 or 2.9 makes a forward edge out of it
+            uint64_t forward_lanes = 0;
+            if( (node & CHECK_NODE_FOURTH_LAST) || ((node & CHECK_NODE_RUN_OF_THREE) &&
+                    watermark_decode_view_has_possible_backedge(is_odd ? even_stack : odd_stack, view, graph_idx)) ) {
+                forward_lanes = ones;
+            }
+            if(forward_lanes && !zeros) {
+                watermark_check_group_forward(plan, group, sliced, 0);
+                continue;
+            }
+            if(forward_lanes) {
+                CHECK_GROUP* split = &groups[(*num_groups)++];
+                if(!split->ws) split->ws = workspace_create(plan->num_nodes);
+                watermark_check_group_copy(split, group, plan->num_nodes);
+                split->lanes = forward_lanes;
+                watermark_check_group_forward(plan, split, sliced, 0);
+            }
+            group->lanes = zeros;
+        }
+        watermark_check_group_push(group);
+        group->graph_idx++;
+        group->i++;
+    }
+}
+
+void watermark_check_keys(CHECK_PLAN* plan, void* keys, unsigned long n, unsigned long key_len, uint8_t* results) {
+
+    memset(results, 0x00, n);
+    if(plan->num_nodes < 2) return;
+
+    unsigned long num_nodes = plan->num_nodes;
+    // bit 'i' of every key of the block, past the end of the keys as well (as 0)
+    uint64_t* sliced = malloc((num_nodes + 2) * sizeof(uint64_t));
+    // groups are only split if both halves have keys, so there are at most CHECK_LANES
+    CHECK_GROUP groups[CHECK_LANES];
+    for(unsigned long g = 0; g < CHECK_LANES; g++) groups[g].ws = NULL;
+
+    for(unsigned long first = 0; first < n; first += CHECK_LANES) {
+
+        unsigned long num_lanes = n - first < CHECK_LANES ? n - first : CHECK_LANES;
+        memset(sliced, 0x00, (num_nodes + 2) * sizeof(uint64_t));
+        uint64_t lanes = 0;
+        for(unsigned long lane = 0; lane < num_lanes; lane++) {
+            uint8_t* key = (uint8_t*)keys + (first + lane) * key_len;
+            unsigned long starting_idx = get_first_positive_bit_index(key, key_len);
+            if(starting_idx == ULONG_MAX || key_len * 8 - starting_idx != plan->n_bits) continue;
+            lanes |= (uint64_t)1 << lane;
+            for(unsigned long j = 0; j < plan->n_bits; j++)
+                if(get_bit(key, starting_idx + j)) sliced[j] |= (uint64_t)1 << lane;
+        }
+        if(!lanes) continue;
+
+        if(!groups[0].ws) groups[0].ws = workspace_create(num_nodes);
+        WORKSPACE* ws = groups[0].ws;
+        workspace_reserve(ws, num_nodes);
+        workspace_clear(ws, 0);
+        for(unsigned long i = 0; i < num_nodes; i++) ws->positions[i] = ULONG_MAX;
+        stack_push(&ws->odd_stack, 0);
+        ws->positions[0] = 0;
+        ws->history[0] = 0;
+        groups[0].lanes = lanes;
+        groups[0].graph_idx = 1;
+        groups[0].i = 1;
+
+        unsigned long num_groups = 1;
+        for(unsigned long g = 0; g < num_groups; g++) {
+            watermark_check_group_walk(plan, groups, g, &num_groups, sliced);
+            for(unsigned long lane = 0; lane < num_lanes; lane++)
+                if(groups[g].lanes & ((uint64_t)1 << lane)) results[first + lane] = 1;
+        }
+    }
+    for(unsigned long g = 0; g < CHECK_LANES; g++) workspace_free(groups[g].ws);
+    free(sliced);
+}
+
 uint8_t watermark_rs_check(GRAPH* graph, void* data, unsigned long num_bytes, unsigned long num_parity_symbols) {
 
     unsigned long payload_n_bytes = num_bytes;
@@ -189,7 +396,6 @@ uint8_t watermark_rs_check(GRAPH* graph, void* data, unsigned long num_bytes, un
     // decode using checker
     unsigned long total_n_bits = data_with_parity_n_bits;
     uint8_t* bits = watermark_check_analysis(graph, data_with_parity, &total_n_bits);
-    graph_free_info(graph);
     unsigned long payload_n_bits = total_n_bits - num_parity_symbols*8;
 
     // in the payload, turn 'x' into wrong bit, and ascii numbers into numbers
@@ -225,38 +431,128 @@ uint8_t watermark_rs_check(GRAPH* graph, void* data, unsigned long num_bytes, un
 // return bit array, in which the values can be '1', '0' or 'x' (for unknown)
 void* watermark_check_analysis(GRAPH* graph, void* data, unsigned long* num_bytes) {
 
-    unsigned long total_number_of_bits = (*num_bytes)*8;
-    unsigned long starting_idx = get_first_positive_bit_index(data, *num_bytes);
-    unsigned long n_bits = total_number_of_bits - starting_idx;
-    unsigned long max_num_nodes = graph->num_nodes - 2;
-
-    // check if number of bits represented by the graph and number of bits in the given sequence match
-    unsigned long num_forward_edges = 0;
-    for(unsigned long i = 0; i < graph->num_nodes; i++) if(graph_get_forward(graph->nodes[i])) num_forward_edges++;
-    if(n_bits != graph->num_nodes - 2 - num_forward_edges) return 0;
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    uint8_t* statuses = malloc(CHECK_STATUS_BYTES(8 * *num_bytes));
+    unsigned long n_bits = watermark_check_analysis_workspace(graph, data, *num_bytes, ws, statuses);
+    workspace_free(ws);
+    if(!n_bits) {
+        free(statuses);
+        return 0;
+    }
 
     *num_bytes = n_bits;
     uint8_t* bits = malloc(n_bits);
-    bits[0]='1';
-    unsigned long bit_arr_idx=1;
-
-    // load UTILS_NODE struct to all nodes
-    for(unsigned long i = 0; i < graph->num_nodes; i++) {
-        UTILS_NODE* utils_node = malloc(sizeof(UTILS_NODE));
-        utils_node->backedge_idx = ULONG_MAX;
-        node_load_info(graph->nodes[i], utils_node, sizeof(UTILS_NODE));
+    // positions the walk didn't reach are unknown too
+    static const uint8_t status_chars[CHECK_NUM_STATUS] = { '0', '1', 'x', 'x' };
+    for(unsigned long i = 0; i < n_bits; i++) bits[i] = status_chars[check_status_get(statuses, i)];
+    free(statuses);
+    return bits;
+}
+
+void* watermark_rs_check_analysis(GRAPH* graph, void* data, unsigned long* num_bytes, unsigned long num_parity_symbols) {
+
+    unsigned long payload_n_bytes = *num_bytes;
+    unsigned long data_starting_idx = get_first_positive_bit_index(data, payload_n_bytes);
+
+    // get correct parity numbers
+    uint8_t parity[num_parity_symbols];
+    memset(parity, 0x00, num_parity_symbols);
+    rs_encode(data, *num_bytes, parity, num_parity_symbols, 8);
+
+    unsigned long data_with_parity_n_bits = num_parity_symbols+payload_n_bytes;
+    uint8_t data_with_parity[num_parity_symbols+payload_n_bytes];
+    memcpy(data_with_parity, data, payload_n_bytes);
+    memcpy(data_with_parity+payload_n_bytes, parity, num_parity_symbols);
+
+    // decode using checker
+    unsigned long total_n_bits = data_with_parity_n_bits;
+    uint8_t* bits = watermark_check_analysis(graph, data_with_parity, &total_n_bits);
+    unsigned long payload_n_bits = total_n_bits - num_parity_symbols*8;
+
+    // in the payload, turn 'x' into wrong bit, and ascii numbers into numbers
+    for(unsigned long i = 0; i < payload_n_bits; i++) {
+        switch(bits[i]) {
+            case 'x':
+                bits[i] = !get_bit(data, data_starting_idx+i);
+                break;
+            case '0':
+                bits[i] = 0;
+                break;
+            case '1':
+                bits[i] = 1;
+                break;
+        }
     }
+    // write correct parity to bit arr
+    for(unsigned long i = payload_n_bits; i < total_n_bits; i++) {
+        bits[i] = get_bit((uint8_t*)parity, i-payload_n_bits);
+    }
+
+    // convert bit arr into binary sequence
+    unsigned long final_data_n_bytes = payload_n_bytes;
+    uint8_t* final_data = get_sequence_from_bit_arr(bits, total_n_bits, &final_data_n_bytes);
+    // get correct rs code
+    final_data = remove_rs_code8(final_data, final_data_n_bytes, &num_parity_symbols);
+
+    unsigned long final_data_len = num_parity_symbols;
+
+    // change bits that are not equal in 'final_data' and 'data' to 'x'
+    // starting from the first positive bit in each sequence
+    unsigned long final_data_starting_idx = get_first_positive_bit_index(final_data, final_data_len);
+    unsigned long final_data_n_bits = final_data_len*8 - final_data_starting_idx;
+    unsigned long data_n_bits = payload_n_bytes*8 - data_starting_idx;
+    // cut bit_arr to only contain bits from the payload
+    unsigned long bit_arr_n_bits = data_n_bits > final_data_n_bits ? data_n_bits : final_data_n_bits;
+    bits = realloc(bits, bit_arr_n_bits);
+    for(unsigned long i = 0; i < bit_arr_n_bits; i++) {
+        uint8_t final_data_bit = get_bit(final_data, final_data_starting_idx+i);
+        uint8_t data_bit = get_bit(data, data_starting_idx+i);
+        bits[i] = data_bit == final_data_bit ? data_bit : 'x';
+    }
+    *num_bytes = bit_arr_n_bits;
+    free(final_data);
+    return bits;
+}
+
+CHECK_STATUS check_status_get(uint8_t* statuses, unsigned long idx) {
+
+    return (statuses[idx / 4] >> (6 - 2 * (idx % 4))) & 0x03;
+}
+
+void check_status_set(uint8_t* statuses, unsigned long idx, CHECK_STATUS status) {
+
+    uint8_t shift = 6 - 2 * (idx % 4);
+    statuses[idx / 4] = (statuses[idx / 4] & ~(0x03 << shift)) | (status << shift);
+}
+
+unsigned long watermark_check_analysis_workspace(GRAPH* graph, void* data, unsigned long num_bytes, WORKSPACE* ws, uint8_t* statuses) {
+
+    unsigned long total_number_of_bits = num_bytes*8;
+    unsigned long starting_idx = get_first_positive_bit_index(data, num_bytes);
+    unsigned long n_bits = total_number_of_bits - starting_idx;
+    unsigned long max_num_nodes = graph->num_nodes - 2;
+
+    if(starting_idx == ULONG_MAX || n_bits != graph->num_nodes - 2 - graph_count_forward_edges(graph)) return 0;
+
+    // positions the walk doesn't reach stay CHECK_STATUS_NONE
+    memset(statuses, 0xff, CHECK_STATUS_BYTES(n_bits));
+    check_status_set(statuses, 0, CHECK_STATUS_1);
+    unsigned long status_idx = 1;
+    #define WRITE_STATUS(status) if(status_idx < n_bits) check_status_set(statuses, status_idx++, status)
+
+    workspace_reserve(ws, graph->num_nodes);
+    workspace_clear(ws, 0);
+    UTILS_NODE* checker_nodes = ws->nodes;
+    for(unsigned long i = 0; i < graph->num_nodes; i++) checker_nodes[i].backedge_idx = ULONG_MAX;
 
     unsigned long i = starting_idx+1;
 
-    STACK* odd_stack = stack_create(n_bits);
-    STACK* even_stack = stack_create(n_bits);
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
     stack_push(odd_stack, 0);
-    ((UTILS_NODE*)node_get_info(graph->nodes[0]))->backedge_idx = 0;
-    ((UTILS_NODE*)node_get_info(graph->nodes[0]))->checker_bit = BIT_1;
-    ((UTILS_NODE*)node_get_info(graph->nodes[0]))->bit_idx = 0;
+    checker_nodes[0].backedge_idx = 0;
 
-    unsigned long history[graph->num_nodes];
+    unsigned long* history = ws->history;
     history[0] = 0;
 
     uint8_t last_four_nodes_only_have_hamiltonian_edges = graph->num_nodes > 3 &&
@@ -280,12 +576,10 @@ void* watermark_check_analysis(GRAPH* graph, void* data, unsigned long* num_byte
                 bit,
                 last_four_nodes_only_have_hamiltonian_edges,
                 has_possible_backedge(possible_backedges, graph, graph_idx));
-        ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->checker_bit = checker_flag;
-        ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->bit_idx = i;
         switch(checker_flag) {
             case BIT_0:
             case BIT_1:
-                bits[bit_arr_idx++] = (bit != checker_flag - '0') ? 'x' : checker_flag;
+                WRITE_STATUS(bit != checker_flag - '0' ? CHECK_STATUS_X : checker_flag - '0');
                 break;
             case BIT_MUTE:
                 i--;
@@ -293,33 +587,27 @@ void* watermark_check_analysis(GRAPH* graph, void* data, unsigned long* num_byte
             case BIT_0_BACKEDGE:
             case BIT_1_BACKEDGE:
                 if( (checker_flag == BIT_0_BACKEDGE && bit) || (checker_flag == BIT_1_BACKEDGE && !bit)) {
-                    bits[bit_arr_idx++] = 'x';
+                    WRITE_STATUS(CHECK_STATUS_X);
                     break;
                 }
                 CONNECTION* backedge_conn = graph_get_backedge(graph->nodes[graph_idx]);
                 if( !backedge_conn || (( bit && !((graph_idx - backedge_conn->node->graph_idx) & 1)) ||
                 ( !bit && ((graph_idx - backedge_conn->node->graph_idx) & 1) )) ||
-                ((UTILS_NODE*)node_get_info(backedge_conn->node))->backedge_idx >= possible_backedges->n) {
-                    bits[bit_arr_idx++] = 'x';
+                checker_nodes[backedge_conn->node->graph_idx].backedge_idx >= possible_backedges->n) {
+                    WRITE_STATUS(CHECK_STATUS_X);
                     break;
                 }
-                stack_pop_until(possible_backedges, ((UTILS_NODE*)node_get_info(backedge_conn->node))->backedge_idx);
+                stack_pop_until(possible_backedges, checker_nodes[backedge_conn->node->graph_idx].backedge_idx);
                 stack_pop_until(other_stack, history[backedge_conn->node->graph_idx]);
-                bits[bit_arr_idx++] = (checker_flag == BIT_0_BACKEDGE) ? '0' : '1';
+                WRITE_STATUS(checker_flag == BIT_0_BACKEDGE ? CHECK_STATUS_0 : CHECK_STATUS_1);
                 continue;
             case BIT_1_FORWARD_EDGE_AND_BIT_0:
-                bits[bit_arr_idx++] = !bit ? 'x' : '1';
-                if(i!=total_number_of_bits-1) {
-                    bits[bit_arr_idx++] = get_bit(data, ++i) ? 'x' : '0';
-                    ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx+1]))->checker_bit = BIT_MUTE;
-                }
+                WRITE_STATUS(!bit ? CHECK_STATUS_X : CHECK_STATUS_1);
+                if(i!=total_number_of_bits-1) WRITE_STATUS(get_bit(data, ++i) ? CHECK_STATUS_X : CHECK_STATUS_0);
                 break;
             case BIT_1_FORWARD_EDGE_AND_BIT_1:
-                bits[bit_arr_idx++] = !bit ? 'x' : '1';
-                if(i!=total_number_of_bits-1) {
-                    bits[bit_arr_idx++] = !get_bit(data, ++i) ? 'x' : '1';
-                    ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx+1]))->checker_bit = BIT_MUTE;
-                }
+                WRITE_STATUS(!bit ? CHECK_STATUS_X : CHECK_STATUS_1);
+                if(i!=total_number_of_bits-1) WRITE_STATUS(!get_bit(data, ++i) ? CHECK_STATUS_X : CHECK_STATUS_1);
                 break;
             case BIT_UNKNOWN:
                 break;
@@ -327,85 +615,69 @@ void* watermark_check_analysis(GRAPH* graph, void* data, unsigned long* num_byte
         // save stacks
         // odd
         if(is_odd) {
-            ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->backedge_idx = odd_stack->n;
+            checker_nodes[graph_idx].backedge_idx = odd_stack->n;
             stack_push(odd_stack, graph_idx);
             history[graph_idx] = even_stack->n;
         // even
         } else {
-            ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->backedge_idx = even_stack->n;
+            checker_nodes[graph_idx].backedge_idx = even_stack->n;
             stack_push(even_stack, graph_idx);
             history[graph_idx] = odd_stack->n;
         }
         // if this was the origin of a forward node, we already processed the inner forward node
         if(checker_flag == BIT_1_FORWARD_EDGE_AND_BIT_0 || checker_flag == BIT_1_FORWARD_EDGE_AND_BIT_1) graph_idx++;
     }
-    // bit sequence may be smaller than expected due to mute nodes
-    stack_free(odd_stack);
-    stack_free(even_stack);
-    return bits;
+    #undef WRITE_STATUS
+    return n_bits;
 }
 
-void* watermark_rs_check_analysis(GRAPH* graph, void* data, unsigned long* num_bytes, unsigned long num_parity_symbols) {
-
-    unsigned long payload_n_bytes = *num_bytes;
-    unsigned long data_starting_idx = get_first_positive_bit_index(data, payload_n_bytes);
-
-    // get correct parity numbers
-    uint8_t parity[num_parity_symbols];
-    memset(parity, 0x00, num_parity_symbols);
-    rs_encode(data, *num_bytes, parity, num_parity_symbols, 8);
-
-    unsigned long data_with_parity_n_bits = num_parity_symbols+payload_n_bytes;
-    uint8_t data_with_parity[num_parity_symbols+payload_n_bytes];
-    memcpy(data_with_parity, data, payload_n_bytes);
-    memcpy(data_with_parity+payload_n_bytes, parity, num_parity_symbols);
-
-    // decode using checker
-    unsigned long total_n_bits = data_with_parity_n_bits;
-    uint8_t* bits = watermark_check_analysis(graph, data_with_parity, &total_n_bits);
-    unsigned long payload_n_bits = total_n_bits - num_parity_symbols*8;
-
-    // in the payload, turn 'x' into wrong bit, and ascii numbers into numbers
-    for(unsigned long i = 0; i < payload_n_bits; i++) {
-        switch(bits[i]) {
-            case 'x':
-                bits[i] = !get_bit(data, data_starting_idx+i);
-                break;
-            case '0':
-                bits[i] = 0;
-                break;
-            case '1':
-                bits[i] = 1;
-                break;
+void watermark_check_analysis_batch(GRAPH** graphs, void* keys, unsigned long n, CHECK_ANALYSIS_OPTS* opts, uint8_t* arena, unsigned long* num_positions, unsigned long* histogram) {
+
+    // keys as they were encoded, thrown to the right
+    uint8_t* encoded_keys = keys;
+    unsigned long key_len = opts->key_len;
+    // bytes of each encoded key, including the parity
+    unsigned long codeword_len = key_len;
+    unsigned long n_bits = 8 * key_len;
+    if(opts->num_parity_symbols) {
+        unsigned long res_len;
+        uint8_t* codewords = append_rs_code_batch(keys, key_len, n, n_bits / opts->symsize,
+                opts->num_parity_symbols, opts->symsize, &res_len, &n_bits);
+        codeword_len = n_bits / 8 + !!(n_bits % 8);
+        encoded_keys = malloc(n * codeword_len);
+        for(unsigned long i = 0; i < n; i++) {
+            unsigned long num_bytes;
+            memcpy(encoded_keys + i * codeword_len, codewords + i * res_len, codeword_len);
+            workspace_pack_sequence(encoded_keys + i * codeword_len, n_bits, &num_bytes);
         }
+        free(codewords);
     }
-    // write correct parity to bit arr
-    for(unsigned long i = payload_n_bits; i < total_n_bits; i++) {
-        bits[i] = get_bit((uint8_t*)parity, i-payload_n_bits);
-    }
-
-    // convert bit arr into binary sequence
-    unsigned long final_data_n_bytes = payload_n_bytes;
-    uint8_t* final_data = get_sequence_from_bit_arr(bits, total_n_bits, &final_data_n_bytes);
-    // get correct rs code
-    final_data = remove_rs_code8(final_data, final_data_n_bytes, &num_parity_symbols);
-
-    unsigned long final_data_len = num_parity_symbols;
-
-    // change bits that are not equal in 'final_data' and 'data' to 'x'
-    // starting from the first positive bit in each sequence
-    unsigned long final_data_starting_idx = get_first_positive_bit_index(final_data, final_data_len);
-    unsigned long final_data_n_bits = final_data_len*8 - final_data_starting_idx;
-    unsigned long data_n_bits = payload_n_bytes*8 - data_starting_idx;
-    // cut bit_arr to only contain bits from the payload
-    unsigned long bit_arr_n_bits = data_n_bits > final_data_n_bits ? data_n_bits : final_data_n_bits;
-    bits = realloc(bits, bit_arr_n_bits);
-    for(unsigned long i = 0; i < bit_arr_n_bits; i++) {
-        uint8_t final_data_bit = get_bit(final_data, final_data_starting_idx+i);
-        uint8_t data_bit = get_bit(data, data_starting_idx+i);
-        bits[i] = data_bit == final_data_bit ? data_bit : 'x';
+    unsigned long status_len = CHECK_STATUS_BYTES(8 * codeword_len);
+
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(opts->num_threads ? (int)opts->num_threads : omp_get_max_threads())
+    #endif
+    {
+        WORKSPACE* ws = workspace_create(n_bits + 2);
+        // counted apart and added up at the end, so threads don't fight over the counts
+        unsigned long* local_histogram = histogram ? calloc(CHECK_NUM_STATUS * 8 * codeword_len, sizeof(unsigned long)) : NULL;
+        #if defined(_OPENMP)
+          #pragma omp for schedule(dynamic, 16)
+        #endif
+        for(unsigned long i = 0; i < n; i++) {
+            uint8_t* statuses = arena + i * status_len;
+            num_positions[i] = watermark_check_analysis_workspace(graphs[i], encoded_keys + i * codeword_len, codeword_len, ws, statuses);
+            if(!local_histogram) continue;
+            for(unsigned long j = 0; j < num_positions[i]; j++) local_histogram[CHECK_NUM_STATUS * j + check_status_get(statuses, j)]++;
+        }
+        if(local_histogram) {
+            #if defined(_OPENMP)
+              #pragma omp critical
+            #endif
+            for(unsigned long j = 0; j < CHECK_NUM_STATUS * 8 * codeword_len; j++) histogram[j] += local_histogram[j];
+            free(local_histogram);
+        }
+        workspace_free(ws);
     }
-    *num_bytes = bit_arr_n_bits;
-    free(final_data);
-    return bits;
+    if(encoded_keys != keys) free(encoded_keys);
 }
@@ -53,9 +53,9 @@ const char* code_gen_repeatable_new(GEN_TABLE* table) {
     return table->next < table->len ? table->table[table->next++] : table->table[(table->next=1)-1];
 }
 
-const char* code_gen_try_old(GEN_TABLE* table) {
+const char* code_gen_try_old(GEN_TABLE* table, RNG* rng) {
     // if we didn't consume any item from the table before, get the first one
-    return table->next ? table->table[rand() % table->next] : table->table[(table->next=1)-1];
+    return table->next ? table->table[rng_below(rng, table->next)] : table->table[(table->next=1)-1];
 }
 
 CODE* code_gen_new_identifier(CODE_GEN* code_gen) {
@@ -71,32 +71,32 @@ CODE* code_gen_new_identifier(CODE_GEN* code_gen) {
 
 CODE* code_gen_get_identifier(CODE_GEN* code_gen) {
 
-    if(rand() & 1) {
+    if(rng_next(&code_gen->rng) >> 63) {
         return code_gen_new_identifier(code_gen);
     } else {
-        return code_from((char*)code_gen_try_old(&code_gen->identifiers));
+        return code_from((char*)code_gen_try_old(&code_gen->identifiers, &code_gen->rng));
     }
 }
 
 const char* code_gen_get_value(CODE_GEN* code_gen) {
-    return rand() & 1 ? code_gen_try_old(&code_gen->values) : code_gen_repeatable_new(&code_gen->values);
+    return rng_next(&code_gen->rng) >> 63 ? code_gen_try_old(&code_gen->values, &code_gen->rng) : code_gen_repeatable_new(&code_gen->values);
 }
 const char* code_gen_get_comparison(CODE_GEN* code_gen) {
-    return rand() & 1 ? code_gen_try_old(&code_gen->comparisons) : code_gen_repeatable_new(&code_gen->comparisons);
+    return rng_next(&code_gen->rng) >> 63 ? code_gen_try_old(&code_gen->comparisons, &code_gen->rng) : code_gen_repeatable_new(&code_gen->comparisons);
 }
 const char* code_gen_get_operation(CODE_GEN* code_gen) {
-    return rand() & 1 ? code_gen_try_old(&code_gen->operations) : code_gen_repeatable_new(&code_gen->operations);
+    return rng_next(&code_gen->rng) >> 63 ? code_gen_try_old(&code_gen->operations, &code_gen->rng) : code_gen_repeatable_new(&code_gen->operations);
 }
 const char* code_gen_get_datatype(CODE_GEN* code_gen) {
-    return rand() & 1 ? code_gen_try_old(&code_gen->datatypes) : code_gen_repeatable_new(&code_gen->datatypes);
+    return rng_next(&code_gen->rng) >> 63 ? code_gen_try_old(&code_gen->datatypes, &code_gen->rng) : code_gen_repeatable_new(&code_gen->datatypes);
 }
 
 CODE* code_gen_value_or_variable(CODE_GEN* code_gen) {
 
-    if(rand() & 1) {
+    if(rng_next(&code_gen->rng) >> 63) {
         return code_from((char*)code_gen_get_value(code_gen));
     } else {
-        return code_from((char*)code_gen_try_old(&code_gen->identifiers));
+        return code_from((char*)code_gen_try_old(&code_gen->identifiers, &code_gen->rng));
     }
 }
 
@@ -112,7 +112,7 @@ CODE* code_gen_expression(CODE_GEN* code_gen) {
 
     CODE* identifier = code_gen_get_identifier(code_gen);
     // shorthand operator or not
-    if(rand() & 1) {
+    if(rng_next(&code_gen->rng) >> 63) {
 
         code_append_str(identifier, " = ");
         code_append(identifier, code_gen_value_or_variable(code_gen));
@@ -144,7 +144,7 @@ CODE* code_gen_prefix_with_tabs(const char* str, unsigned long tabs) {
 CODE* code_gen_switch_header(CODE_GEN* code_gen, unsigned long tabs) {
 
     CODE* code = code_from("switch( ");
-    code_append(code, code_from((char*)code_gen_try_old(&code_gen->identifiers)));
+    code_append(code, code_from((char*)code_gen_try_old(&code_gen->identifiers, &code_gen->rng)));
     code_append_str(code, " ) {\n");
     return code_prefix_with_tabs(code, tabs);
 }
@@ -269,9 +269,14 @@ char* watermark_generate_code_recursive(CODE* code, char* dijkstra_code, unsigne
     }
 }
 char* watermark_generate_code(char* dijkstra_code) {
+    return watermark_generate_code_seeded(dijkstra_code, rand());
+}
+
+char* watermark_generate_code_seeded(char* dijkstra_code, uint64_t seed) {
 
     CODE* code = code_from("");
     CODE_GEN code_gen = CODE_GEN_CREATE;
+    rng_seed(&code_gen.rng, seed);
     watermark_generate_code_recursive(code, dijkstra_code, 1, &code_gen);
     code_append_str(code, "}\n");
     CODE* declarations = code_declarations(&code_gen);
@@ -1,5 +1,11 @@
 #include "decoder/decoder.h"
 
+#if defined(_OPENMP)
+  #include <omp.h>
+#else
+  #include <time.h>
+#endif
+
 #define show_bits(bits,len) fprintf(stderr, "%s:%d:" #bits ":", __FILE__, __LINE__);\
   for(unsigned long i = 0; i < len; i++) {\
     fprintf(stderr, "%hhu", get_bit(bits, i));\
@@ -8,9 +14,18 @@
 
 void* watermark2014_decode(GRAPH* graph, unsigned long* num_bytes) {
 
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    watermark2014_decode_workspace(graph, ws, num_bytes);
+    return workspace_release_bits(ws, *num_bytes);
+}
+
+uint8_t* watermark2014_decode_workspace(GRAPH* graph, WORKSPACE* ws, unsigned long* num_bytes) {
+
     unsigned long n_bits = graph->num_nodes-1;
-    uint8_t bits[n_bits];
-    bits[0] = 1;
+    workspace_reserve(ws, graph->num_nodes);
+    workspace_clear(ws, n_bits);
+    uint8_t* bits = ws->bits;
+    set_bit(bits, 0, 1);
     for(unsigned long i = 1; i < n_bits; i++) {
 
         // if this node has two out connections
@@ -18,13 +33,10 @@ void* watermark2014_decode(GRAPH* graph, unsigned long* num_bytes) {
 
             // get backedge
             CONNECTION* conn = graph_get_backedge(graph->nodes[i]);
-            bits[i] = ( graph->nodes[i]->graph_idx - conn->node->graph_idx ) & 1;
-        } else {
-            bits[i] = 0;
+            set_bit(bits, i, ( graph->nodes[i]->graph_idx - conn->node->graph_idx ) & 1);
         }
     }
-    void* data = get_sequence_from_bit_arr(bits, n_bits, num_bytes);
-    return data;
+    return workspace_get_sequence(ws, n_bits, num_bytes);
 }
 
 int watermark_decode_improved_four_last_are_mute(GRAPH* graph) {
@@ -53,19 +65,30 @@ void* watermark_decode_improved8(GRAPH* graph, uint8_t* data, unsigned long* num
 }
 
 void* watermark_decode_improved(GRAPH* graph, uint8_t* data, unsigned long* num_bits) {
+
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    unsigned long num_bytes;
+    watermark_decode_improved_workspace(graph, data, num_bits, ws, &num_bytes);
+    return workspace_release_bits(ws, num_bytes);
+}
+
+uint8_t* watermark_decode_improved_workspace(GRAPH* graph, uint8_t* data, unsigned long* num_bits, WORKSPACE* ws, unsigned long* num_result_bytes) {
     unsigned long data_num_bits = *num_bits;
     unsigned long num_bytes = *num_bits / 8 + !!(*num_bits % 8);
     unsigned long data_begin = get_first_positive_bit_index(data, num_bytes);
 
     unsigned long n_bits = graph->num_nodes-2;
-    uint8_t bits[n_bits];
-    bits[0] = 1;
+    workspace_reserve(ws, graph->num_nodes);
+    workspace_clear(ws, n_bits);
+    uint8_t* bits = ws->bits;
+    set_bit(bits, 0, 1);
     unsigned long i = 1;
 
-    STACK* odd_stack = stack_create(n_bits);
-    STACK* even_stack = stack_create(n_bits);
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
     stack_push(odd_stack, 0);
-    unsigned long* history = calloc(n_bits*2, sizeof(unsigned long));
+    unsigned long* history = ws->history;
+    memset(history, 0x00, n_bits*2*sizeof(unsigned long));
 
     uint8_t four_last_are_mute = watermark_decode_improved_four_last_are_mute(graph);
 
@@ -88,11 +111,11 @@ void* watermark_decode_improved(GRAPH* graph, uint8_t* data, unsigned long* num_
             // 2.2 if it has a forward edge, it encodes a bit 1
             if( graph_idx < n_bits && graph_get_connection(graph->nodes[graph_idx], graph->nodes[graph_idx+2]) ) {
                 forward_edges_left--;
-                bits[i]=1;
+                set_bit(bits, i, 1);
             // 2.1/2.4 encode bit according to backedge
             } else if( graph_get_backedge(graph->nodes[graph_idx]) ){
                 CONNECTION* backedge = graph_get_backedge(graph->nodes[graph_idx]);
-                bits[i] = backedge && (( graph_idx - backedge->node->graph_idx ) & 1);
+                set_bit(bits, i, backedge && (( graph_idx - backedge->node->graph_idx ) & 1));
                 // pop stacks
                 if(backedge) {
                   NODE* backedge_node = backedge->node;
@@ -112,37 +135,37 @@ void* watermark_decode_improved(GRAPH* graph, uint8_t* data, unsigned long* num_
                 continue;
             // 2.5 if hamiltonian edge [v -> v+1] doesn't exist, v encodes 1
             } else if( !graph_get_connection(graph->nodes[graph_idx], graph->nodes[graph_idx+1]) ) {
-              bits[i] = 1;
+              set_bit(bits, i, 1);
             // 2.6 if hamiltonian edge [v+1 -> v+2] doesn't exist, v encodes 1
             } else if( !graph_get_connection(graph->nodes[graph_idx+1], graph->nodes[graph_idx+2]) ) {
-              bits[i] = 1;
+              set_bit(bits, i, 1);
               forward_destination = 3;
               forward_edges_left--;
             // 2.7 if node is fourth to last and four last nodes are mute, v encodes 1
             } else if(four_last_are_mute && graph_idx == graph->num_nodes-4 && forward_edges_left && bit) {
-              bits[i] = 1;
+              set_bit(bits, i, 1);
               node_27_was_the_last = 1;
               forward_destination = 3;
               forward_edges_left--;
               continue;
             // 2.8 if node is third to last and four last nodes are mute, v encodes 0
             } else if(four_last_are_mute && graph_idx == graph->num_nodes-3 && node_27_was_the_last) {
-              bits[i] = 0;
+              set_bit(bits, i, 0);
             // 2.9 v is the first in a sequence of three nodes without back or forward edges, v should encode 1 and
             // it isn't possible to create a backedge in v, v encodes 0
             } else if( watermark_decode_improved_sequence_of_three(graph, graph_idx) && 
                 !has_possible_backedge( possible_backedges, graph, graph_idx) && bit) {
-              bits[i] = 1;
+              set_bit(bits, i, 1);
               node_29_was_the_last = 1;
               forward_destination = 3;
               forward_edges_left--;
               continue;
             // 2.10 if v - 1 is the node above, this one encodes 0
             } else if( node_29_was_the_last ) {
-              bits[i] = 0;
+              set_bit(bits, i, 0);
             // 2.11 if everything above is false, this node encodes 0
             } else {
-              bits[i] = 0;
+              set_bit(bits, i, 0);
             }
         } else {
             i--;
@@ -166,24 +189,169 @@ void* watermark_decode_improved(GRAPH* graph, uint8_t* data, unsigned long* num_
         }
     }
 
-    stack_free(odd_stack);
-    stack_free(even_stack);
-    free(history);
     // if the second last node is a forward edge destination, the
     // third last node also needs to be ignored
     uint8_t is_prev_last_forward_destination = !!( n_bits > 2 && graph_get_connection(graph->nodes[n_bits-2], graph->nodes[n_bits]) && data_begin + i < data_num_bits );
     n_bits = i-is_prev_last_forward_destination;
     // bit sequence may be smaller than expected due to mute nodes
-    void* res = get_sequence_from_bit_arr(bits, n_bits, &num_bytes);
     *num_bits = n_bits;
-    return res;
+    return workspace_get_sequence(ws, n_bits, num_result_bytes);
+}
+
+int watermark_decode_view_four_last_are_mute(VIEW_NODE* view, unsigned long num_nodes) {
+  return num_nodes > 3 &&
+    view[num_nodes-1].num_out == 0 && view[num_nodes-1].num_in == 1 &&
+    view[num_nodes-2].num_out == 1 && view[num_nodes-2].num_in == 1 && (view[num_nodes-2].flags & VIEW_NODE_HAMILTONIAN) &&
+    view[num_nodes-3].num_out == 1 && view[num_nodes-3].num_in == 1 && (view[num_nodes-3].flags & VIEW_NODE_HAMILTONIAN) &&
+    view[num_nodes-4].num_out == 1 && view[num_nodes-4].num_in == 1 && (view[num_nodes-4].flags & VIEW_NODE_HAMILTONIAN);
+}
+
+int watermark_decode_view_sequence_of_three(VIEW_NODE* view, unsigned long num_nodes, unsigned long graph_idx) {
+  return num_nodes - graph_idx - 1 > 3 &&
+  view[graph_idx].num_out == 1 && (view[graph_idx].flags & VIEW_NODE_HAMILTONIAN) &&
+  view[graph_idx+1].num_out == 1 && (view[graph_idx+1].flags & VIEW_NODE_HAMILTONIAN) &&
+  view[graph_idx+2].num_out == 1 && (view[graph_idx+2].flags & VIEW_NODE_HAMILTONIAN);
+}
+
+// same as 'has_possible_backedge': the nodes in the stacks come before 'current_idx', so
+// [current_idx-1 -> stack[0]] is either a backedge or a self loop
+int watermark_decode_view_has_possible_backedge(STACK* possible_backedges, VIEW_NODE* view, unsigned long current_idx) {
+
+    if(view[current_idx-1].num_backedges) return 0;
+
+    return possible_backedges->n && !( possible_backedges->n == 1 &&
+            possible_backedges->stack[0] == current_idx-1 && (view[current_idx-1].flags & VIEW_NODE_SELF_LOOP) );
+}
+
+uint8_t* watermark_decode_improved_view(WORKSPACE* ws, uint8_t* data, unsigned long* num_bits, uint8_t* result, unsigned long* num_result_bytes) {
+    unsigned long data_num_bits = *num_bits;
+    unsigned long num_bytes = *num_bits / 8 + !!(*num_bits % 8);
+    unsigned long data_begin = get_first_positive_bit_index(data, num_bytes);
+
+    VIEW_NODE* view = ws->view;
+    unsigned long num_nodes = ws->view_num_nodes;
+    unsigned long n_bits = num_nodes-2;
+    memset(result, 0x00, n_bits / 8 + 1);
+    set_bit(result, 0, 1);
+    unsigned long i = 1;
+
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
+    odd_stack->n = 0;
+    even_stack->n = 0;
+    unsigned long* positions = ws->positions;
+    positions[0] = 0;
+    stack_push(odd_stack, 0);
+    unsigned long* history = ws->history;
+    memset(history, 0x00, num_nodes*sizeof(unsigned long));
+
+    uint8_t four_last_are_mute = watermark_decode_view_four_last_are_mute(view, num_nodes);
+
+    uint8_t node_29_was_the_last = 0;
+    uint8_t node_27_was_the_last = 0;
+    unsigned long forward_edges_left = num_nodes - 2 - (data_num_bits - data_begin);
+    uint8_t forward_destination = 0;
+    for(unsigned long graph_idx = 1; graph_idx < n_bits; graph_idx++, i++) {
+
+        if(data_begin + i >= data_num_bits) break;
+        uint8_t bit = get_bit(data, data_begin + i);
+        uint8_t is_odd = !(graph_idx&1);
+        STACK* possible_backedges = (is_odd && bit) || (!is_odd && !bit) ? even_stack : odd_stack ;
+        STACK* other_stack = possible_backedges == even_stack ? odd_stack : even_stack;
+
+        if(forward_destination) forward_destination--;
+        // if it isn't a mute node
+        if(!( graph_idx > 1 && (view[graph_idx-2].flags & VIEW_NODE_SKIP) ) && forward_destination != 1 ) {
+
+            // 2.2 if it has a forward edge, it encodes a bit 1
+            if( view[graph_idx].flags & VIEW_NODE_SKIP ) {
+                forward_edges_left--;
+                set_bit(result, i, 1);
+            // 2.1/2.4 encode bit according to backedge
+            } else if( view[graph_idx].num_backedges ){
+                unsigned long backedge = view[graph_idx].backedge;
+                set_bit(result, i, ( graph_idx - backedge ) & 1);
+                // backedge node index in the stack (0 if it isn't there, like the linear search)
+                unsigned long backedge_index = positions[backedge] < possible_backedges->n &&
+                    possible_backedges->stack[positions[backedge]] == backedge ? positions[backedge] : 0;
+                stack_pop_until(possible_backedges, backedge_index); // pop backedge and all nodes on top of it
+                stack_pop_until(other_stack, history[backedge_index]);
+                node_29_was_the_last = 0;
+                node_27_was_the_last = 0;
+                continue;
+            // 2.5 if hamiltonian edge [v -> v+1] doesn't exist, v encodes 1
+            } else if( !(view[graph_idx].flags & VIEW_NODE_HAMILTONIAN) ) {
+              set_bit(result, i, 1);
+            // 2.6 if hamiltonian edge [v+1 -> v+2] doesn't exist, v encodes 1
+            } else if( !(view[graph_idx+1].flags & VIEW_NODE_HAMILTONIAN) ) {
+              set_bit(result, i, 1);
+              forward_destination = 3;
+              forward_edges_left--;
+            // 2.7 if node is fourth to last and four last nodes are mute, v encodes 1
+            } else if(four_last_are_mute && graph_idx == num_nodes-4 && forward_edges_left && bit) {
+              set_bit(result, i, 1);
+              node_27_was_the_last = 1;
+              forward_destination = 3;
+              forward_edges_left--;
+              continue;
+            // 2.8 if node is third to last and four last nodes are mute, v encodes 0
+            } else if(four_last_are_mute && graph_idx == num_nodes-3 && node_27_was_the_last) {
+              set_bit(result, i, 0);
+            // 2.9 v is the first in a sequence of three nodes without back or forward edges, v should encode 1 and
+            // it isn't possible to create a backedge in v, v encodes 0
+            } else if( watermark_decode_view_sequence_of_three(view, num_nodes, graph_idx) &&
+                !watermark_decode_view_has_possible_backedge(possible_backedges, view, graph_idx) && bit) {
+              set_bit(result, i, 1);
+              node_29_was_the_last = 1;
+              forward_destination = 3;
+              forward_edges_left--;
+              continue;
+            // 2.10 if v - 1 is the node above, this one encodes 0
+            } else if( node_29_was_the_last ) {
+              set_bit(result, i, 0);
+            // 2.11 if everything above is false, this node encodes 0
+            } else {
+              set_bit(result, i, 0);
+            }
+        } else {
+            i--;
+        }
+        node_27_was_the_last = 0;
+        node_29_was_the_last = 0;
+
+        // if this is not a inner forward node
+        if(!view[graph_idx-1].num_forward) {
+
+            STACK* stack = is_odd ? odd_stack : even_stack;
+            positions[graph_idx] = stack->n;
+            stack_push(stack, graph_idx);
+            history[graph_idx] = is_odd ? even_stack->n : odd_stack->n;
+        }
+    }
+
+    // if the second last node is a forward edge destination, the
+    // third last node also needs to be ignored
+    uint8_t is_prev_last_forward_destination = !!( n_bits > 2 && (view[n_bits-2].flags & VIEW_NODE_SKIP) && data_begin + i < data_num_bits );
+    n_bits = i-is_prev_last_forward_destination;
+    // bit sequence may be smaller than expected due to mute nodes
+    *num_bits = n_bits;
+    return workspace_pack_sequence(result, n_bits, num_result_bytes);
 }
 
 void* watermark_decode(GRAPH* graph, unsigned long* num_bytes) {
 
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    watermark_decode_workspace(graph, ws, num_bytes);
+    return workspace_release_bits(ws, *num_bytes);
+}
+
+uint8_t* watermark_decode_workspace(GRAPH* graph, WORKSPACE* ws, unsigned long* num_bytes) {
+
     unsigned long n_bits = graph->num_nodes-2;
-    uint8_t bits[n_bits];
-    bits[0] = 1;
+    workspace_reserve(ws, graph->num_nodes);
+    workspace_clear(ws, n_bits);
+    uint8_t* bits = ws->bits;
+    set_bit(bits, 0, 1);
     unsigned long i = 1;
 
     for(unsigned long graph_idx = 1; graph_idx < n_bits; graph_idx++, i++) {
@@ -193,10 +361,10 @@ void* watermark_decode(GRAPH* graph, unsigned long* num_bytes) {
 
             // if it has a forward edge
             if( graph_idx < n_bits && graph_get_connection(graph->nodes[graph_idx], graph->nodes[graph_idx+2]) ) {
-                bits[i]=1;
+                set_bit(bits, i, 1);
             } else {
                 CONNECTION* backedge = graph_get_backedge(graph->nodes[graph_idx]);
-                bits[i] = backedge && (( graph_idx - backedge->node->graph_idx ) & 1);
+                set_bit(bits, i, backedge && (( graph_idx - backedge->node->graph_idx ) & 1));
             }
         } else {
             i--;
@@ -207,8 +375,7 @@ void* watermark_decode(GRAPH* graph, unsigned long* num_bytes) {
     uint8_t is_prev_last_forward_destination = !!( n_bits > 2 && graph_get_connection(graph->nodes[n_bits-2], graph->nodes[n_bits]) );
     n_bits = i-is_prev_last_forward_destination;
     // bit sequence may be smaller than expected due to mute nodes
-    void* data = get_sequence_from_bit_arr(bits, n_bits, num_bytes);
-    return data;
+    return workspace_get_sequence(ws, n_bits, num_bytes);
 }
 
 void* watermark2014_rs_decode(GRAPH* graph, unsigned long* num_parity_symbols) {
@@ -284,17 +451,88 @@ void* watermark_rs_decode_improved(GRAPH* graph, void* key, unsigned long* num_d
   return result_without_rs;
 }
 
-void* _watermark_decode_analysis(GRAPH* graph, unsigned long* num_bytes) {
+DECODE_STATUS watermark_decode_batch_one(GRAPH* graph, void* key, DECODE_OPTS* opts, WORKSPACE* ws, DECODE_RESULT* result) {
+
+    result->bits = NULL;
+    result->num_bytes = 0;
+    if(graph->num_nodes < 3) return DECODE_TOO_SMALL;
+
+    uint8_t* bits = NULL;
+    switch(opts->method) {
+      case ORIGINAL:
+        bits = watermark_decode_workspace(graph, ws, &result->num_bytes);
+        break;
+      case IMPROVED: {
+        unsigned long num_bits = opts->n_bits;
+        bits = watermark_decode_improved_workspace(graph, key, &num_bits, ws, &result->num_bytes);
+        break;
+      }
+      case IMPROVED_WITH_RS:
+        result->num_bytes = opts->n_bits / opts->symsize;
+        result->bits = watermark_rs_decode_improved(graph, key, &result->num_bytes, opts->num_parity_symbols, opts->symsize);
+        if(!result->bits) {
+          result->num_bytes = 0;
+          return DECODE_RS_FAILED;
+        }
+        return DECODE_OK;
+    }
+    // copied out of the workspace, since it is reused by the next graph
+    result->bits = malloc(result->num_bytes ? result->num_bytes : 1);
+    memcpy(result->bits, bits, result->num_bytes);
+    return DECODE_OK;
+}
 
-    // load UTILS_NODE in every node
-    for(unsigned long i = 0; i < graph->num_nodes; i++) {
-        UTILS_NODE* utils_node = malloc(sizeof(UTILS_NODE));
-        node_load_info(graph->nodes[i], utils_node, sizeof(UTILS_NODE));
+void watermark_decode_batch(GRAPH** graphs, unsigned long n, DECODE_OPTS* opts, DECODE_RESULT* results, DECODE_STATS* stats) {
+
+    #if defined(_OPENMP)
+      double start = omp_get_wtime();
+    #else
+      clock_t start = clock();
+    #endif
+    unsigned long num_decoded = 0;
+    unsigned long num_threads = 1;
+
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(opts->num_threads ? (int)opts->num_threads : omp_get_max_threads()) reduction(+:num_decoded)
+    #endif
+    {
+        #if defined(_OPENMP)
+          #pragma omp single
+          num_threads = omp_get_num_threads();
+        #endif
+        // stacks, history and bits are reused by every graph of this thread
+        WORKSPACE* ws = workspace_create(0);
+        #if defined(_OPENMP)
+          #pragma omp for schedule(dynamic, 16)
+        #endif
+        for(unsigned long i = 0; i < n; i++) {
+            void* key = opts->keys ? (uint8_t*)opts->keys + i * opts->key_len : NULL;
+            results[i].status = watermark_decode_batch_one(graphs[i], key, opts, ws, &results[i]);
+            num_decoded += results[i].status == DECODE_OK;
+        }
+        workspace_free(ws);
     }
 
+    if(!stats) return;
+    #if defined(_OPENMP)
+      stats->seconds = omp_get_wtime() - start;
+    #else
+      stats->seconds = (clock() - start) / (double) CLOCKS_PER_SEC;
+    #endif
+    stats->num_decoded = num_decoded;
+    stats->num_threads = num_threads;
+    stats->graphs_per_second = stats->seconds > 0 ? n / stats->seconds : 0;
+}
+
+// the checker bit of every node is left in 'ws->nodes'
+uint8_t* _watermark_decode_analysis_workspace(GRAPH* graph, WORKSPACE* ws, unsigned long* num_bytes) {
+
     unsigned long n_bits = graph->num_nodes-2;
-    uint8_t bits[n_bits];
-    bits[0] = 1;
+    workspace_reserve(ws, graph->num_nodes);
+    workspace_clear(ws, n_bits);
+    UTILS_NODE* checker_nodes = ws->nodes;
+    uint8_t* bits = ws->bits;
+    set_bit(bits, 0, 1);
     unsigned long i = 1;
 
     for(unsigned long graph_idx = 1; graph_idx < n_bits; graph_idx++, i++) {
@@ -304,15 +542,15 @@ void* _watermark_decode_analysis(GRAPH* graph, unsigned long* num_bytes) {
 
             // if it has a forward edge
             if( graph_idx < n_bits && graph_get_connection(graph->nodes[graph_idx], graph->nodes[graph_idx+2]) ) {
-                ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->checker_bit = BIT_1;
-                bits[i]=1;
+                checker_nodes[graph_idx].checker_bit = BIT_1;
+                set_bit(bits, i, 1);
             } else {
                 CONNECTION* backedge = graph_get_backedge(graph->nodes[graph_idx]);
-                bits[i] = backedge && (( graph_idx - backedge->node->graph_idx ) & 1);
-                ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->checker_bit = bits[i] == '1' ? BIT_1 : BIT_0;
+                set_bit(bits, i, backedge && (( graph_idx - backedge->node->graph_idx ) & 1));
+                checker_nodes[graph_idx].checker_bit = get_bit(bits, i) ? BIT_1 : BIT_0;
             }
         } else {
-            ((UTILS_NODE*)node_get_info(graph->nodes[graph_idx]))->checker_bit = BIT_MUTE;
+            checker_nodes[graph_idx].checker_bit = BIT_MUTE;
             i--;
         }
     }
@@ -321,9 +559,16 @@ void* _watermark_decode_analysis(GRAPH* graph, unsigned long* num_bytes) {
     uint8_t is_prev_last_forward_destination = !!( n_bits > 2 && graph_get_connection(graph->nodes[n_bits-2], graph->nodes[n_bits]) );
     n_bits = i-is_prev_last_forward_destination;
     // bit sequence may be smaller than expected due to mute nodes
-    void* data = get_sequence_from_bit_arr(bits, n_bits, num_bytes);
-    return data;
+    return workspace_get_sequence(ws, n_bits, num_bytes);
+}
+
+void* _watermark_decode_analysis(GRAPH* graph, unsigned long* num_bytes) {
+
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    _watermark_decode_analysis_workspace(graph, ws, num_bytes);
+    return workspace_release_bits(ws, *num_bytes);
 }
+
 void* watermark_decode_analysis(GRAPH* graph, unsigned long* num_bytes) {
 
     uint8_t* data = _watermark_decode_analysis(graph, num_bytes);
@@ -354,3 +599,71 @@ void* watermark_rs_decode_analysis(GRAPH* graph, unsigned long* num_parity_symbo
     *num_parity_symbols = n_bits;
     return bits;
 }
+
+BITVEC* watermark2014_decode_bitvec(GRAPH* graph) {
+
+    unsigned long num_bytes;
+    uint8_t* data = watermark2014_decode(graph, &num_bytes);
+    BITVEC* bits = bitvec_from_sequence(data, num_bytes);
+    free(data);
+    return bits;
+}
+
+BITVEC* watermark_decode_bitvec(GRAPH* graph) {
+
+    unsigned long num_bytes;
+    uint8_t* data = watermark_decode(graph, &num_bytes);
+    BITVEC* bits = bitvec_from_sequence(data, num_bytes);
+    free(data);
+    return bits;
+}
+
+BITVEC* watermark_decode_improved_bitvec(GRAPH* graph, BITVEC* key) {
+
+    unsigned long num_bits = key->n_bits;
+    uint8_t* data = watermark_decode_improved(graph, (uint8_t*)key->words, &num_bits);
+    // result is thrown to the right
+    unsigned long num_bytes = num_bits / 8 + !!(num_bits % 8);
+    BITVEC* bits = bitvec_from_bytes(data, num_bytes * 8);
+    bitvec_shift_left(bits, num_bytes * 8 - num_bits);
+    bitvec_resize(bits, num_bits);
+    free(data);
+    return bits;
+}
+
+BITVEC* watermark2014_rs_decode_bitvec(GRAPH* graph, unsigned long num_parity_symbols) {
+
+    uint8_t* data = watermark2014_rs_decode(graph, &num_parity_symbols);
+    if(!data) return NULL;
+    BITVEC* bits = bitvec_from_sequence(data, num_parity_symbols);
+    free(data);
+    return bits;
+}
+
+BITVEC* watermark_rs_decode_bitvec(GRAPH* graph, unsigned long num_parity_symbols) {
+
+    uint8_t* data = watermark_rs_decode(graph, &num_parity_symbols);
+    if(!data) return NULL;
+    BITVEC* bits = bitvec_from_sequence(data, num_parity_symbols);
+    free(data);
+    return bits;
+}
+
+BITVEC* watermark_rs_decode_improved_bitvec(GRAPH* graph, BITVEC* key, unsigned long num_parity_symbols, unsigned long symsize) {
+
+    unsigned long num_data_symbols = key->n_bits / symsize;
+    uint8_t* data = watermark_rs_decode_improved(graph, key->words, &num_data_symbols, num_parity_symbols, symsize);
+    if(!data) return NULL;
+    BITVEC* bits = bitvec_from_bytes(data, key->n_bits - key->n_bits % symsize);
+    free(data);
+    return bits;
+}
+
+BITVEC* watermark_decode_analysis_bitvec(GRAPH* graph) {
+
+    unsigned long num_bytes;
+    uint8_t* data = _watermark_decode_analysis(graph, &num_bytes);
+    BITVEC* bits = bitvec_from_sequence(data, num_bytes);
+    free(data);
+    return bits;
+}
@@ -0,0 +1,203 @@
+#include "decoder/extract.h"
+
+#if defined(_OPENMP)
+  #include <omp.h>
+#endif
+
+// what the windows need to know about a host node, besides its view
+typedef struct EXTRACT_NODE {
+    // lowest and highest node with an edge to it (ULONG_MAX and 0 if none)
+    unsigned long min_in;
+    unsigned long max_in;
+    // lowest and highest destination of its edges (ULONG_MAX and 0 if none)
+    unsigned long min_out;
+    unsigned long max_out;
+    // highest destination that isn't after it (ULONG_MAX if none)
+    unsigned long max_back;
+    // what it adds to the score of the windows it is inside of
+    long score;
+} EXTRACT_NODE;
+
+typedef struct EXTRACT_LIST {
+    EXTRACT_CANDIDATE* candidates;
+    unsigned long n;
+    unsigned long max;
+} EXTRACT_LIST;
+
+void watermark_extract_load_nodes(GRAPH* host, VIEW_NODE* view, EXTRACT_NODE* nodes) {
+
+    for(unsigned long i = 0; i < host->num_nodes; i++) {
+        nodes[i].min_in = ULONG_MAX;
+        nodes[i].max_in = 0;
+        nodes[i].min_out = ULONG_MAX;
+        nodes[i].max_out = 0;
+        nodes[i].max_back = ULONG_MAX;
+    }
+    for(unsigned long i = 0; i < host->num_nodes; i++) {
+        for(CONNECTION* conn = host->nodes[i]->out; conn; conn = conn->next) {
+            unsigned long to = conn->node->graph_idx;
+            if(to < nodes[i].min_out) nodes[i].min_out = to;
+            if(to > nodes[i].max_out) nodes[i].max_out = to;
+            if(to <= i && (nodes[i].max_back == ULONG_MAX || to > nodes[i].max_back)) nodes[i].max_back = to;
+            if(i < nodes[to].min_in) nodes[to].min_in = i;
+            if(i > nodes[to].max_in) nodes[to].max_in = i;
+        }
+    }
+    for(unsigned long i = 0; i < host->num_nodes; i++) {
+        uint8_t has_hamiltonian_edge = !!(view[i].flags & VIEW_NODE_HAMILTONIAN);
+        // a plain node is only expected after a backedge (no repeat can start there) or
+        // as the middle of an if-then
+        uint8_t is_plain = view[i].num_out == 1 && has_hamiltonian_edge && view[i].num_in == 1 &&
+            !( i && (view[i-1].num_backedges || (view[i-1].flags & VIEW_NODE_SKIP)) );
+        nodes[i].score = (long)(view[i].num_out - has_hamiltonian_edge) - is_plain;
+    }
+}
+
+void watermark_extract_add(EXTRACT_LIST* list, unsigned long entry, unsigned long exit, long score, uint8_t* bits, unsigned long n_bits) {
+
+    if(list->n == list->max) {
+        list->max = list->max ? list->max * 2 : 64;
+        list->candidates = realloc(list->candidates, list->max * sizeof(EXTRACT_CANDIDATE));
+    }
+    EXTRACT_CANDIDATE* candidate = &list->candidates[list->n++];
+    candidate->entry = entry;
+    candidate->exit = exit;
+    candidate->score = score;
+    candidate->num_windows = 1;
+    candidate->bits = malloc(n_bits / 8 + 1);
+    memcpy(candidate->bits, bits, n_bits / 8 + 1);
+    workspace_pack_sequence(candidate->bits, n_bits, &candidate->num_bytes);
+}
+
+// every window starting at 'entry': the bits of the nodes that stop being one of the
+// last two are decoded as the exit moves forward, so each node is decoded once
+void watermark_extract_entry(GRAPH* host, VIEW_NODE* view, EXTRACT_NODE* nodes, unsigned long entry,
+        unsigned long min_nodes, unsigned long max_nodes, uint8_t* bits, EXTRACT_LIST* list) {
+
+    if(!(view[entry].flags & VIEW_NODE_HAMILTONIAN)) return;
+
+    set_bit(bits, 0, 1);
+    unsigned long i = 1;
+    unsigned long min_out = nodes[entry].min_out;
+    unsigned long max_out = nodes[entry].max_out;
+    unsigned long max_in = 0;
+    long score = 0;
+    for(unsigned long exit = entry + 1; exit < host->num_nodes && exit - entry < max_nodes; exit++) {
+
+        // an edge leaving the window backwards or coming in from before it stays there
+        if(min_out < entry || nodes[exit].min_in < entry) break;
+        if(nodes[exit].max_in > max_in) max_in = nodes[exit].max_in;
+
+        // same decisions as 'watermark_decode', node 'exit - 2' is 'graph_idx'
+        unsigned long v = exit - 2;
+        if(exit >= entry + 3) {
+            if(v >= entry + 2 && (view[v-2].flags & VIEW_NODE_SKIP)) {
+                // mute node
+            } else if(view[v].flags & VIEW_NODE_SKIP) {
+                set_bit(bits, i++, 1);
+            } else {
+                set_bit(bits, i++, view[v].num_backedges && ((v - view[v].backedge) & 1));
+            }
+        }
+
+        unsigned long num_nodes = exit - entry + 1;
+        if( num_nodes >= min_nodes && score > 0 && max_out <= exit && max_in <= exit &&
+                !view[exit-1].num_backedges && !view[exit-1].num_forward &&
+                (nodes[exit].max_back == ULONG_MAX || nodes[exit].max_back < entry) ) {
+            uint8_t is_prev_last_forward_destination = num_nodes > 4 && (view[exit-3].flags & VIEW_NODE_SKIP);
+            watermark_extract_add(list, entry, exit, score, bits, i - is_prev_last_forward_destination);
+        }
+
+        // the exit is inside the next windows
+        if(!(view[exit].flags & VIEW_NODE_HAMILTONIAN)) break;
+        if(nodes[exit].min_out < min_out) min_out = nodes[exit].min_out;
+        if(nodes[exit].max_out > max_out) max_out = nodes[exit].max_out;
+        score += nodes[exit-1].score;
+    }
+}
+
+int watermark_extract_compare_rank(const void* a, const void* b) {
+
+    const EXTRACT_CANDIDATE* x = a;
+    const EXTRACT_CANDIDATE* y = b;
+    if(x->score != y->score) return x->score > y->score ? -1 : 1;
+    if(x->exit - x->entry != y->exit - y->entry) return x->exit - x->entry > y->exit - y->entry ? -1 : 1;
+    return x->entry < y->entry ? -1 : x->entry > y->entry;
+}
+
+int watermark_extract_compare_key(const void* a, const void* b) {
+
+    const EXTRACT_CANDIDATE* x = a;
+    const EXTRACT_CANDIDATE* y = b;
+    if(x->num_bytes != y->num_bytes) return x->num_bytes < y->num_bytes ? -1 : 1;
+    int cmp = memcmp(x->bits, y->bits, x->num_bytes);
+    return cmp ? cmp : watermark_extract_compare_rank(a, b);
+}
+
+EXTRACT_CANDIDATE* watermark_extract(GRAPH* host, EXTRACT_OPTS* opts, unsigned long* num_candidates) {
+
+    *num_candidates = 0;
+    if(host->num_nodes < 3) return NULL;
+    unsigned long min_nodes = opts->min_nodes > 3 ? opts->min_nodes : 3;
+    unsigned long max_nodes = opts->max_nodes ? opts->max_nodes : host->num_nodes;
+
+    WORKSPACE* ws = workspace_create(host->num_nodes);
+    workspace_load_graph(ws, host);
+    EXTRACT_NODE* nodes = malloc(host->num_nodes * sizeof(EXTRACT_NODE));
+    watermark_extract_load_nodes(host, ws->view, nodes);
+
+    EXTRACT_LIST all = {0};
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(opts->num_threads ? (int)opts->num_threads : omp_get_max_threads())
+    #endif
+    {
+        EXTRACT_LIST list = {0};
+        uint8_t* bits = calloc(max_nodes / 8 + 1, 1);
+        #if defined(_OPENMP)
+          #pragma omp for schedule(dynamic, 64)
+        #endif
+        for(unsigned long entry = 0; entry < host->num_nodes; entry++) {
+            watermark_extract_entry(host, ws->view, nodes, entry, min_nodes, max_nodes, bits, &list);
+        }
+        free(bits);
+        #if defined(_OPENMP)
+          #pragma omp critical
+        #endif
+        {
+            all.candidates = realloc(all.candidates, (all.n + list.n) * sizeof(EXTRACT_CANDIDATE));
+            if(list.n) memcpy(all.candidates + all.n, list.candidates, list.n * sizeof(EXTRACT_CANDIDATE));
+            all.n += list.n;
+        }
+        free(list.candidates);
+    }
+    free(nodes);
+    workspace_free(ws);
+    if(!all.n) {
+        free(all.candidates);
+        return NULL;
+    }
+
+    // keep the best window of every key
+    qsort(all.candidates, all.n, sizeof(EXTRACT_CANDIDATE), watermark_extract_compare_key);
+    unsigned long n = 0;
+    for(unsigned long i = 0; i < all.n; i++) {
+        EXTRACT_CANDIDATE* candidate = &all.candidates[i];
+        if( n && all.candidates[n-1].num_bytes == candidate->num_bytes &&
+                !memcmp(all.candidates[n-1].bits, candidate->bits, candidate->num_bytes) ) {
+            all.candidates[n-1].num_windows++;
+            free(candidate->bits);
+            continue;
+        }
+        all.candidates[n++] = *candidate;
+    }
+    qsort(all.candidates, n, sizeof(EXTRACT_CANDIDATE), watermark_extract_compare_rank);
+
+    *num_candidates = n;
+    return realloc(all.candidates, n * sizeof(EXTRACT_CANDIDATE));
+}
+
+void watermark_extract_free(EXTRACT_CANDIDATE* candidates, unsigned long num_candidates) {
+
+    for(unsigned long i = 0; i < num_candidates; i++) free(candidates[i].bits);
+    free(candidates);
+}
@@ -0,0 +1,299 @@
+#include "decoder/keyless.h"
+
+#if defined(_OPENMP)
+  #include <omp.h>
+#endif
+
+typedef struct KEYLESS {
+    KEYLESS_OPTS* opts;
+    VIEW_NODE* view;
+    unsigned long num_nodes;
+    uint8_t four_last_are_mute;
+    // bits of an RS codeword (0 without RS)
+    unsigned long codeword_bits;
+    BITVEC** keys;
+    unsigned long num_keys;
+    int stop;
+} KEYLESS;
+
+// what 'watermark_decode_improved_view' does with a node, given the key bit
+typedef enum KEYLESS_RULE {
+    KEYLESS_MUTE,
+    KEYLESS_FORWARD, // 2.2
+    KEYLESS_BACKEDGE_0, // 2.1/2.4
+    KEYLESS_BACKEDGE_1,
+    KEYLESS_NO_HAMILTONIAN, // 2.5
+    KEYLESS_NO_NEXT_HAMILTONIAN, // 2.6
+    KEYLESS_27,
+    KEYLESS_28,
+    KEYLESS_29,
+    KEYLESS_0 // 2.10/2.11
+} KEYLESS_RULE;
+
+uint8_t watermark_decode_keyless_rule_bit(KEYLESS_RULE rule) {
+    return rule == KEYLESS_FORWARD || rule == KEYLESS_BACKEDGE_1 || rule == KEYLESS_NO_HAMILTONIAN ||
+        rule == KEYLESS_NO_NEXT_HAMILTONIAN || rule == KEYLESS_27 || rule == KEYLESS_29;
+}
+
+KEYLESS_RULE watermark_decode_keyless_rule(KEYLESS* k, WORKSPACE* ws, KEYLESS_CURSOR* cursor, uint8_t bit) {
+
+    VIEW_NODE* view = k->view;
+    unsigned long graph_idx = cursor->graph_idx;
+    uint8_t forward_destination = cursor->forward_destination ? cursor->forward_destination - 1 : 0;
+    uint8_t is_odd = !(graph_idx&1);
+    STACK* possible_backedges = (is_odd && bit) || (!is_odd && !bit) ? &ws->even_stack : &ws->odd_stack;
+
+    if(( graph_idx > 1 && (view[graph_idx-2].flags & VIEW_NODE_SKIP) ) || forward_destination == 1) return KEYLESS_MUTE;
+    if(view[graph_idx].flags & VIEW_NODE_SKIP) return KEYLESS_FORWARD;
+    if(view[graph_idx].num_backedges) return (graph_idx - view[graph_idx].backedge) & 1 ? KEYLESS_BACKEDGE_1 : KEYLESS_BACKEDGE_0;
+    if(!(view[graph_idx].flags & VIEW_NODE_HAMILTONIAN)) return KEYLESS_NO_HAMILTONIAN;
+    if(!(view[graph_idx+1].flags & VIEW_NODE_HAMILTONIAN)) return KEYLESS_NO_NEXT_HAMILTONIAN;
+    if(k->four_last_are_mute && graph_idx == k->num_nodes-4 && cursor->forward_edges_left && bit) return KEYLESS_27;
+    if(k->four_last_are_mute && graph_idx == k->num_nodes-3 && cursor->node_27_was_the_last) return KEYLESS_28;
+    if( watermark_decode_view_sequence_of_three(view, k->num_nodes, graph_idx) &&
+            !watermark_decode_view_has_possible_backedge(possible_backedges, view, graph_idx) && bit ) return KEYLESS_29;
+    return KEYLESS_0;
+}
+
+// one iteration of 'watermark_decode_improved_view'
+void watermark_decode_keyless_apply(KEYLESS* k, WORKSPACE* ws, KEYLESS_CURSOR* cursor, uint8_t bit, KEYLESS_RULE rule) {
+
+    VIEW_NODE* view = k->view;
+    unsigned long graph_idx = cursor->graph_idx;
+    uint8_t is_odd = !(graph_idx&1);
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
+    STACK* possible_backedges = (is_odd && bit) || (!is_odd && !bit) ? even_stack : odd_stack;
+    STACK* other_stack = possible_backedges == even_stack ? odd_stack : even_stack;
+
+    if(cursor->forward_destination) cursor->forward_destination--;
+    if(rule != KEYLESS_MUTE) set_bit(ws->bits, cursor->i, watermark_decode_keyless_rule_bit(rule));
+    uint8_t push = 1;
+    switch(rule) {
+        case KEYLESS_MUTE:
+            cursor->i--;
+            break;
+        case KEYLESS_FORWARD:
+            cursor->forward_edges_left--;
+            break;
+        case KEYLESS_BACKEDGE_0:
+        case KEYLESS_BACKEDGE_1: {
+            unsigned long backedge = view[graph_idx].backedge;
+            unsigned long backedge_index = ws->positions[backedge] < possible_backedges->n &&
+                possible_backedges->stack[ws->positions[backedge]] == backedge ? ws->positions[backedge] : 0;
+            stack_pop_until(possible_backedges, backedge_index);
+            stack_pop_until(other_stack, ws->history[backedge_index]);
+            push = 0;
+            break;
+        }
+        case KEYLESS_NO_NEXT_HAMILTONIAN:
+            cursor->forward_destination = 3;
+            cursor->forward_edges_left--;
+            break;
+        case KEYLESS_27:
+        case KEYLESS_29:
+            cursor->forward_destination = 3;
+            cursor->forward_edges_left--;
+            cursor->node_27_was_the_last = rule == KEYLESS_27;
+            cursor->node_29_was_the_last = rule == KEYLESS_29;
+            cursor->graph_idx++;
+            cursor->i++;
+            return;
+        default:
+            break;
+    }
+    cursor->node_27_was_the_last = 0;
+    cursor->node_29_was_the_last = 0;
+
+    // if this is not a inner forward node
+    if(push && !view[graph_idx-1].num_forward) {
+        STACK* stack = is_odd ? odd_stack : even_stack;
+        ws->positions[graph_idx] = stack->n;
+        stack_push(stack, graph_idx);
+        ws->history[graph_idx] = is_odd ? even_stack->n : odd_stack->n;
+    }
+    cursor->graph_idx++;
+    cursor->i++;
+}
+
+void watermark_decode_keyless_copy(WORKSPACE* dst, WORKSPACE* src, unsigned long num_nodes) {
+
+    workspace_reserve(dst, num_nodes);
+    memcpy(dst->bits, src->bits, num_nodes / 8 + 1);
+    dst->odd_stack.n = src->odd_stack.n;
+    dst->even_stack.n = src->even_stack.n;
+    memcpy(dst->odd_stack.stack, src->odd_stack.stack, src->odd_stack.n * sizeof(unsigned long));
+    memcpy(dst->even_stack.stack, src->even_stack.stack, src->even_stack.n * sizeof(unsigned long));
+    memcpy(dst->history, src->history, num_nodes * sizeof(unsigned long));
+    memcpy(dst->positions, src->positions, num_nodes * sizeof(unsigned long));
+}
+
+// the codeword position of output bit 'i'
+unsigned long watermark_decode_keyless_codeword_idx(KEYLESS* k, KEYLESS_CURSOR* cursor, unsigned long i) {
+    return k->codeword_bits - cursor->key_bits + i;
+}
+
+// parity of the data bits decoded so far (the key is thrown to the right of the codeword)
+void watermark_decode_keyless_codeword(KEYLESS* k, WORKSPACE* ws, KEYLESS_CURSOR* cursor) {
+
+    unsigned long num_data_symbols = k->opts->num_data_symbols;
+    unsigned long data_bits = num_data_symbols * k->opts->symsize;
+    uint8_t data[KEYLESS_MAX_CODEWORD_BYTES] = {0};
+    for(unsigned long j = k->codeword_bits - cursor->key_bits; j < data_bits; j++) {
+        set_bit(data, j, get_bit(ws->bits, j - (k->codeword_bits - cursor->key_bits)));
+    }
+    uint8_t* codeword = append_rs_code(data, &num_data_symbols, k->opts->num_parity_symbols, k->opts->symsize);
+    memcpy(cursor->codeword, codeword, k->codeword_bits / 8 + !!(k->codeword_bits % 8));
+    free(codeword);
+    cursor->has_codeword = 1;
+}
+
+void watermark_decode_keyless_leaf(KEYLESS* k, WORKSPACE* ws, KEYLESS_CURSOR* cursor) {
+
+    // the decoded sequence is only as long as the key if the walk used all of it
+    if(cursor->i != cursor->key_bits) return;
+
+    BITVEC* key = NULL;
+    if(k->codeword_bits) {
+        if(!cursor->has_codeword) watermark_decode_keyless_codeword(k, ws, cursor);
+        for(unsigned long j = 0; j < k->codeword_bits; j++) {
+            uint8_t bit = j < k->codeword_bits - cursor->key_bits ? 0 : get_bit(ws->bits, j - (k->codeword_bits - cursor->key_bits));
+            if(get_bit(cursor->codeword, j) != bit) return;
+        }
+        key = bitvec_from_bytes(cursor->codeword, k->opts->num_data_symbols * k->opts->symsize);
+    } else {
+        key = bitvec_from_bytes(ws->bits, cursor->key_bits);
+    }
+
+    #if defined(_OPENMP)
+      #pragma omp critical
+    #endif
+    {
+        if(k->stop) {
+            bitvec_free(key);
+        } else {
+            k->keys = realloc(k->keys, (k->num_keys + 1) * sizeof(BITVEC*));
+            k->keys[k->num_keys++] = key;
+            if(k->opts->max_keys && k->num_keys == k->opts->max_keys) k->stop = 1;
+        }
+    }
+}
+
+void watermark_decode_keyless_branch(KEYLESS* k, WORKSPACE* ws, KEYLESS_CURSOR cursor, unsigned long num_branches) {
+
+    int stop;
+    unsigned long n_bits = k->num_nodes - 2;
+    for(;;) {
+
+        #if defined(_OPENMP)
+          #pragma omp atomic read
+        #endif
+        stop = k->stop;
+        if(stop) return;
+
+        if(cursor.i >= cursor.key_bits || cursor.graph_idx >= n_bits) {
+            watermark_decode_keyless_leaf(k, ws, &cursor);
+            return;
+        }
+        // once the data bits are known, so is the rest of the codeword
+        if( k->codeword_bits && !cursor.has_codeword &&
+                watermark_decode_keyless_codeword_idx(k, &cursor, cursor.i) >= k->opts->num_data_symbols * k->opts->symsize ) {
+            watermark_decode_keyless_codeword(k, ws, &cursor);
+        }
+
+        // the key bit of a node is the bit it decodes to
+        KEYLESS_RULE rules[2];
+        uint8_t consistent[2];
+        for(uint8_t bit = 0; bit < 2; bit++) {
+            rules[bit] = watermark_decode_keyless_rule(k, ws, &cursor, bit);
+            consistent[bit] = rules[bit] == KEYLESS_MUTE || watermark_decode_keyless_rule_bit(rules[bit]) == bit;
+            if(cursor.has_codeword && rules[bit] != KEYLESS_MUTE) {
+                consistent[bit] &= get_bit(cursor.codeword, watermark_decode_keyless_codeword_idx(k, &cursor, cursor.i)) == bit;
+            }
+        }
+        if(!consistent[0] && !consistent[1]) return;
+        // a mute node doesn't read the key
+        if(rules[0] == KEYLESS_MUTE || consistent[0] != consistent[1]) {
+            uint8_t bit = rules[0] != KEYLESS_MUTE && consistent[1];
+            watermark_decode_keyless_apply(k, ws, &cursor, bit, rules[bit]);
+            continue;
+        }
+
+        // both bits are possible: near the root the second one becomes a task with its own
+        // copy of the state, deeper it is walked after the first one, from a snapshot
+        WORKSPACE* branch_ws = workspace_create(k->num_nodes);
+        watermark_decode_keyless_copy(branch_ws, ws, k->num_nodes);
+        if(num_branches < KEYLESS_MAX_TASKS) {
+            #if defined(_OPENMP)
+              #pragma omp task firstprivate(branch_ws, cursor)
+            #endif
+            {
+                KEYLESS_CURSOR branch_cursor = cursor;
+                watermark_decode_keyless_apply(k, branch_ws, &branch_cursor, 1, rules[1]);
+                watermark_decode_keyless_branch(k, branch_ws, branch_cursor, num_branches * 2);
+                workspace_free(branch_ws);
+            }
+            watermark_decode_keyless_apply(k, ws, &cursor, 0, rules[0]);
+            num_branches *= 2;
+            continue;
+        }
+        KEYLESS_CURSOR branch_cursor = cursor;
+        watermark_decode_keyless_apply(k, branch_ws, &branch_cursor, 1, rules[1]);
+        watermark_decode_keyless_branch(k, branch_ws, branch_cursor, num_branches);
+        workspace_free(branch_ws);
+        watermark_decode_keyless_apply(k, ws, &cursor, 0, rules[0]);
+    }
+}
+
+BITVEC** watermark_decode_keyless(GRAPH* graph, KEYLESS_OPTS* opts, unsigned long* num_keys) {
+
+    *num_keys = 0;
+    if(graph->num_nodes < 3) return NULL;
+
+    KEYLESS k = { .opts = opts, .num_nodes = graph->num_nodes };
+    unsigned long max_key_bits = graph->num_nodes - 2;
+    if(opts->num_parity_symbols) {
+        k.codeword_bits = (opts->num_data_symbols + opts->num_parity_symbols) * opts->symsize;
+        if(k.codeword_bits > 8 * KEYLESS_MAX_CODEWORD_BYTES) return NULL;
+        if(k.codeword_bits < max_key_bits) max_key_bits = k.codeword_bits;
+    }
+    WORKSPACE* view_ws = workspace_create(graph->num_nodes);
+    workspace_load_graph(view_ws, graph);
+    k.view = view_ws->view;
+    k.four_last_are_mute = watermark_decode_view_four_last_are_mute(k.view, k.num_nodes);
+
+    #if defined(_OPENMP)
+      #pragma omp parallel
+      #pragma omp single
+    #endif
+    {
+        // one search per key length, since it decides where the walk stops
+        for(unsigned long key_bits = 1; key_bits <= max_key_bits; key_bits++) {
+
+            WORKSPACE* ws = workspace_create(graph->num_nodes);
+            workspace_clear(ws, graph->num_nodes);
+            set_bit(ws->bits, 0, 1);
+            ws->positions[0] = 0;
+            stack_push(&ws->odd_stack, 0);
+            memset(ws->history, 0x00, graph->num_nodes * sizeof(unsigned long));
+
+            KEYLESS_CURSOR cursor = {
+                .key_bits = key_bits,
+                .graph_idx = 1,
+                .i = 1,
+                .forward_edges_left = graph->num_nodes - 2 - key_bits
+            };
+            #if defined(_OPENMP)
+              #pragma omp task firstprivate(ws, cursor)
+            #endif
+            {
+                watermark_decode_keyless_branch(&k, ws, cursor, 1);
+                workspace_free(ws);
+            }
+        }
+    }
+
+    workspace_free(view_ws);
+    *num_keys = k.num_keys;
+    return k.keys;
+}
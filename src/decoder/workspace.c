@@ -0,0 +1,138 @@
+#include "decoder/workspace.h"
+#include <string.h>
+
+WORKSPACE* workspace_create(unsigned long max_nodes) {
+
+    WORKSPACE* ws = calloc(1, sizeof(WORKSPACE));
+    workspace_reserve(ws, max_nodes);
+    return ws;
+}
+
+void workspace_reserve(WORKSPACE* ws, unsigned long num_nodes) {
+
+    if(num_nodes <= ws->max_nodes && ws->bits) return;
+    // grow geometrically so a sequence of bigger graphs doesn't realloc every time
+    unsigned long max_nodes = ws->max_nodes * 2 > num_nodes ? ws->max_nodes * 2 : num_nodes;
+    if(!max_nodes) max_nodes = 1;
+
+    ws->bits = realloc(ws->bits, max_nodes / 8 + 1);
+    ws->odd_stack.stack = realloc(ws->odd_stack.stack, max_nodes * sizeof(unsigned long));
+    ws->even_stack.stack = realloc(ws->even_stack.stack, max_nodes * sizeof(unsigned long));
+    ws->history = realloc(ws->history, max_nodes * 2 * sizeof(unsigned long));
+    ws->nodes = realloc(ws->nodes, max_nodes * sizeof(UTILS_NODE));
+    ws->kinds = realloc(ws->kinds, max_nodes * 2);
+    ws->backedges = realloc(ws->backedges, max_nodes * 2 * sizeof(unsigned long));
+    ws->view = realloc(ws->view, max_nodes * sizeof(VIEW_NODE));
+    // stale positions are harmless, but they have to be initialized
+    ws->positions = realloc(ws->positions, max_nodes * sizeof(unsigned long));
+    memset(ws->positions, 0x00, max_nodes * sizeof(unsigned long));
+    ws->max_nodes = max_nodes;
+}
+
+void workspace_clear(WORKSPACE* ws, unsigned long n_bits) {
+
+    memset(ws->bits, 0x00, n_bits / 8 + 1);
+    ws->odd_stack.n = 0;
+    ws->even_stack.n = 0;
+}
+
+void workspace_load_graph(WORKSPACE* ws, GRAPH* graph) {
+
+    workspace_reserve(ws, graph->num_nodes);
+    ws->view_num_nodes = graph->num_nodes;
+    memset(ws->view, 0x00, graph->num_nodes * sizeof(VIEW_NODE));
+    for(unsigned long i = 0; i < graph->num_nodes; i++) {
+
+        NODE* node = graph->nodes[i];
+        VIEW_NODE* view = &ws->view[i];
+        view->num_out = node->num_out_neighbours;
+        view->num_in = node->num_in_neighbours;
+        for(CONNECTION* conn = node->out; conn; conn = conn->next) {
+
+            unsigned long to = conn->node->graph_idx;
+            if(to < i) {
+                if(!view->num_backedges++) view->backedge = to;
+            } else if(to == i) {
+                view->flags |= VIEW_NODE_SELF_LOOP;
+            } else if(to == i + 1) {
+                view->flags |= VIEW_NODE_HAMILTONIAN;
+            } else {
+                if(to == i + 2) view->flags |= VIEW_NODE_SKIP;
+                view->num_forward++;
+            }
+        }
+    }
+}
+
+uint8_t workspace_view_disconnect(WORKSPACE* ws, unsigned long from, unsigned long to) {
+
+    if(from >= ws->view_num_nodes || to >= ws->view_num_nodes) return 0;
+    VIEW_NODE* view = &ws->view[from];
+    if(to < from) {
+        if(!view->num_backedges || (view->backedge == to && view->num_backedges > 1)) return 0;
+        view->num_backedges--;
+    } else {
+        uint8_t flag = to == from ? VIEW_NODE_SELF_LOOP : to == from + 1 ? VIEW_NODE_HAMILTONIAN : to == from + 2 ? VIEW_NODE_SKIP : 0;
+        if(flag && !(view->flags & flag)) return 0;
+        if(to > from + 1 && !view->num_forward) return 0;
+        view->flags &= ~flag;
+        if(to > from + 1) view->num_forward--;
+    }
+    view->num_out--;
+    ws->view[to].num_in--;
+    return 1;
+}
+
+void workspace_view_connect(WORKSPACE* ws, unsigned long from, unsigned long to) {
+
+    VIEW_NODE* view = &ws->view[from];
+    if(to < from) {
+        if(!view->num_backedges++) view->backedge = to;
+    } else if(to == from) {
+        view->flags |= VIEW_NODE_SELF_LOOP;
+    } else if(to == from + 1) {
+        view->flags |= VIEW_NODE_HAMILTONIAN;
+    } else {
+        if(to == from + 2) view->flags |= VIEW_NODE_SKIP;
+        view->num_forward++;
+    }
+    view->num_out++;
+    ws->view[to].num_in++;
+}
+
+uint8_t* workspace_pack_sequence(uint8_t* bits, unsigned long n_bits, unsigned long* num_bytes) {
+
+    *num_bytes = n_bits / 8 + !!(n_bits % 8);
+    // bits past 'n_bits' may have been written before the sequence was cut
+    if(n_bits % 8) bits[n_bits / 8] &= 0xff << (8 - n_bits % 8);
+    shift_sequence_right(bits, *num_bytes, (*num_bytes) * 8 - n_bits);
+    return bits;
+}
+
+uint8_t* workspace_get_sequence(WORKSPACE* ws, unsigned long n_bits, unsigned long* num_bytes) {
+
+    return workspace_pack_sequence(ws->bits, n_bits, num_bytes);
+}
+
+void* workspace_release_bits(WORKSPACE* ws, unsigned long num_bytes) {
+
+    void* bits = realloc(ws->bits, num_bytes ? num_bytes : 1);
+    ws->bits = NULL;
+    workspace_free(ws);
+    return bits;
+}
+
+void workspace_free(WORKSPACE* ws) {
+
+    if(!ws) return;
+    free(ws->bits);
+    free(ws->odd_stack.stack);
+    free(ws->even_stack.stack);
+    free(ws->history);
+    free(ws->nodes);
+    free(ws->kinds);
+    free(ws->backedges);
+    free(ws->view);
+    free(ws->positions);
+    free(ws);
+}
@@ -0,0 +1,251 @@
+#define _POSIX_C_SOURCE 200809L
+#include "encoder/encode_table.h"
+#include "hashmap/hashmap.h"
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(_OPENMP)
+  #include <omp.h>
+#endif
+
+unsigned long encode_table_record_len(unsigned long n_bits) {
+
+    // a while block takes two bits and gives three entries, anything else gives at most one per bit
+    return 2 + 2 * (n_bits + n_bits / 2 + 1);
+}
+
+// used part of a record
+unsigned long encode_table_record_used_len(uint8_t* record) {
+    return 2 + 2 * (unsigned long)record[1];
+}
+
+// write the record of a finished plan
+void encode_table_record_from_plan(WORKSPACE* ws, unsigned long num_nodes, uint8_t* record) {
+
+    uint8_t* kinds = ws->kinds;
+    unsigned long n = 0;
+    uint8_t* entries = record + 2;
+    for(unsigned long i = 0; i < num_nodes; i++) {
+
+        uint8_t is_while_inner = i && (kinds[i-1] & ENCODE_NODE_WHILE);
+        if( kinds[i] & ENCODE_NODE_BACKEDGE ) {
+            entries[2*n] = i;
+            entries[2*n+1] = ws->backedges[i];
+            n++;
+        } else if( kinds[i] & ENCODE_NODE_FORWARD ) {
+            entries[2*n] = i;
+            entries[2*n+1] = i+2;
+            n++;
+        }
+        if( is_while_inner ) {
+            entries[2*n] = i;
+            entries[2*n+1] = i;
+            n++;
+        }
+    }
+    record[0] = num_nodes;
+    record[1] = n;
+}
+
+// write the record of any graph, returns 0 if it can't have one (too many nodes or entries)
+uint8_t encode_table_record_from_graph(GRAPH* graph, uint8_t* record, unsigned long record_len) {
+
+    if(graph->num_nodes > UINT8_MAX) return 0;
+    unsigned long max_entries = (record_len - 2) / 2;
+    unsigned long n = 0;
+    uint8_t* entries = record + 2;
+    for(unsigned long i = 0; i < graph->num_nodes; i++) {
+
+        NODE* node = graph->nodes[i];
+        uint8_t has_hamiltonian_edge = 0;
+        // non hamiltonian edges, sorted by destination
+        unsigned long first = n;
+        for(CONNECTION* conn = node->out; conn; conn = conn->next) {
+            if(conn->node->graph_idx == i+1) {
+                has_hamiltonian_edge = 1;
+                continue;
+            }
+            if(n == max_entries) return 0;
+            unsigned long j = n++;
+            for(; j > first && entries[2*(j-1)+1] > conn->node->graph_idx; j--) {
+                entries[2*j] = entries[2*(j-1)];
+                entries[2*j+1] = entries[2*(j-1)+1];
+            }
+            entries[2*j] = i;
+            entries[2*j+1] = conn->node->graph_idx;
+        }
+        if( !has_hamiltonian_edge && i+1 < graph->num_nodes ) {
+            if(n == max_entries) return 0;
+            entries[2*n] = i;
+            entries[2*n+1] = i;
+            n++;
+        }
+    }
+    record[0] = graph->num_nodes;
+    record[1] = n;
+    return 1;
+}
+
+void encode_table_build_index(ENCODE_TABLE* table) {
+
+    unsigned long num_keys = table->header->num_keys;
+    unsigned long record_len = table->header->record_len;
+    // power of two, at most half full
+    table->index_len = 2;
+    while(table->index_len < 2 * num_keys) table->index_len <<= 1;
+    table->index = calloc(table->index_len, sizeof(unsigned long));
+
+    for(unsigned long k = 0; k < num_keys; k++) {
+        uint8_t* record = table->records + k * record_len;
+        unsigned long slot = djb2(record, encode_table_record_used_len(record)) & (table->index_len - 1);
+        while(table->index[slot]) slot = (slot + 1) & (table->index_len - 1);
+        table->index[slot] = k + 1;
+    }
+}
+
+ENCODE_TABLE* encode_table_create(unsigned long n_bits, uint64_t seed) {
+
+    if(!n_bits || n_bits > ENCODE_TABLE_MAX_BITS) return NULL;
+
+    ENCODE_TABLE* table = calloc(1, sizeof(ENCODE_TABLE));
+    unsigned long num_keys = 1UL << (n_bits - 1);
+    unsigned long record_len = encode_table_record_len(n_bits);
+    table->memory_len = sizeof(ENCODE_TABLE_HEADER) + num_keys * record_len;
+    table->memory = calloc(table->memory_len, 1);
+    table->header = table->memory;
+    table->records = (uint8_t*)table->memory + sizeof(ENCODE_TABLE_HEADER);
+
+    memcpy(table->header->magic, ENCODE_TABLE_MAGIC, sizeof(table->header->magic));
+    table->header->n_bits = n_bits;
+    table->header->seed = seed;
+    table->header->first_key = num_keys;
+    table->header->num_keys = num_keys;
+    table->header->record_len = record_len;
+
+    #if defined(_OPENMP)
+      #pragma omp parallel
+    #endif
+    {
+        WORKSPACE* ws = workspace_create(66);
+        #if defined(_OPENMP)
+          #pragma omp for schedule(dynamic, 1024)
+        #endif
+        for(unsigned long k = 0; k < num_keys; k++) {
+
+            unsigned long key = num_keys + k;
+            uint8_t data[sizeof(uint64_t)];
+            for(unsigned long i = 0; i < sizeof(data); i++) data[i] = (uint64_t)key >> (8 * (sizeof(data) - 1 - i));
+            RNG rng;
+            rng_seed(&rng, seed + key);
+            unsigned long num_nodes = watermark_encode_plan(data, 8 * sizeof(data), &rng, ws);
+            encode_table_record_from_plan(ws, num_nodes, table->records + k * record_len);
+        }
+        workspace_free(ws);
+    }
+
+    encode_table_build_index(table);
+    return table;
+}
+
+uint8_t encode_table_save(ENCODE_TABLE* table, const char* filename) {
+
+    FILE* file = fopen(filename, "wb");
+    if(!file) return 0;
+    uint8_t result = fwrite(table->memory, 1, table->memory_len, file) == table->memory_len;
+    return !fclose(file) && result;
+}
+
+ENCODE_TABLE* encode_table_load(const char* filename) {
+
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0) return NULL;
+    struct stat st;
+    if(fstat(fd, &st) || (unsigned long)st.st_size < sizeof(ENCODE_TABLE_HEADER)) {
+        close(fd);
+        return NULL;
+    }
+    void* memory = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(memory == MAP_FAILED) return NULL;
+
+    ENCODE_TABLE_HEADER* header = memory;
+    if( memcmp(header->magic, ENCODE_TABLE_MAGIC, sizeof(header->magic)) ||
+        !header->n_bits || header->n_bits > ENCODE_TABLE_MAX_BITS ||
+        header->record_len != encode_table_record_len(header->n_bits) ||
+        header->num_keys != 1UL << (header->n_bits - 1) ||
+        (unsigned long)st.st_size != sizeof(ENCODE_TABLE_HEADER) + header->num_keys * header->record_len ) {
+        munmap(memory, st.st_size);
+        return NULL;
+    }
+
+    ENCODE_TABLE* table = calloc(1, sizeof(ENCODE_TABLE));
+    table->memory = memory;
+    table->memory_len = st.st_size;
+    table->is_mapped = 1;
+    table->header = header;
+    table->records = (uint8_t*)memory + sizeof(ENCODE_TABLE_HEADER);
+    encode_table_build_index(table);
+    return table;
+}
+
+void encode_table_free(ENCODE_TABLE* table) {
+
+    if(!table) return;
+    if(table->is_mapped) {
+        munmap(table->memory, table->memory_len);
+    } else {
+        free(table->memory);
+    }
+    free(table->index);
+    free(table);
+}
+
+GRAPH* encode_table_get_graph(ENCODE_TABLE* table, unsigned long key, WORKSPACE* ws) {
+
+    if(key < table->header->first_key || key - table->header->first_key >= table->header->num_keys) return NULL;
+    uint8_t* record = table->records + (key - table->header->first_key) * table->header->record_len;
+    unsigned long num_nodes = record[0];
+    uint8_t* entries = record + 2;
+
+    // rebuild the plan, so the graph is built exactly like the encoder does
+    workspace_reserve(ws, num_nodes);
+    memset(ws->kinds, 0x00, num_nodes);
+    for(unsigned long i = 0; i < record[1]; i++) {
+
+        unsigned long from = entries[2*i];
+        unsigned long to = entries[2*i+1];
+        if(to == from + 2) {
+            ws->kinds[from] |= ENCODE_NODE_FORWARD;
+        } else if(to < from) {
+            ws->kinds[from] |= ENCODE_NODE_BACKEDGE;
+            ws->backedges[from] = to;
+            if( to == from - 1 && (ws->kinds[to] & ENCODE_NODE_FORWARD) ) {
+                ws->kinds[to] |= ENCODE_NODE_WHILE;
+            } else {
+                ws->kinds[to] |= ENCODE_NODE_REPEAT;
+            }
+        }
+    }
+    return watermark_encode_plan_graph(ws, num_nodes);
+}
+
+uint8_t encode_table_find_key(ENCODE_TABLE* table, GRAPH* graph, unsigned long* key) {
+
+    unsigned long record_len = table->header->record_len;
+    uint8_t record[record_len];
+    if(!encode_table_record_from_graph(graph, record, record_len)) return 0;
+
+    unsigned long used_len = encode_table_record_used_len(record);
+    unsigned long slot = djb2(record, used_len) & (table->index_len - 1);
+    for(; table->index[slot]; slot = (slot + 1) & (table->index_len - 1)) {
+        unsigned long k = table->index[slot] - 1;
+        if( !memcmp(table->records + k * record_len, record, used_len) ) {
+            *key = table->header->first_key + k;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -1,8 +1,19 @@
 #include "encoder/encoder.h"
 #include "rs_api/rs.h"
 
+#if defined(_OPENMP)
+  #include <omp.h>
+#endif
+
 GRAPH* watermark2014_encode(void* data, unsigned long data_len) {
 
+    RNG rng;
+    rng_seed(&rng, rand());
+    return watermark2014_encode_rng(data, data_len, &rng);
+}
+
+GRAPH* watermark2014_encode_rng(void* data, unsigned long data_len, RNG* rng) {
+
     // get index of first positive bit
     unsigned long total_number_of_bits = data_len*8;
     unsigned long starting_idx = get_first_positive_bit_index(data, data_len);
@@ -30,7 +41,7 @@ GRAPH* watermark2014_encode(void* data, unsigned long data_len) {
         STACK* other_stack = possible_backedges == even_stack ? odd_stack : even_stack;
         if( possible_backedges->n ) {
 
-            unsigned long idx_of_backedge = rand() % possible_backedges->n;
+            unsigned long idx_of_backedge = rng_below(rng, possible_backedges->n);
             NODE* backedge_node = graph->nodes[possible_backedges->stack[idx_of_backedge]];
             graph_oriented_connect(graph->nodes[idx], backedge_node);
             stack_pop_until(possible_backedges, idx_of_backedge+1); // add +1 since we want the size, not the index
@@ -61,6 +72,21 @@ GRAPH* watermark_encode8(void* data, unsigned long data_len) {
 
 GRAPH* watermark_encode(void* data, unsigned long n_bits) {
 
+    RNG rng;
+    rng_seed(&rng, rand());
+    return watermark_encode_rng(data, n_bits, &rng);
+}
+
+GRAPH* watermark_encode_rng(void* data, unsigned long n_bits, RNG* rng) {
+
+    WORKSPACE* ws = workspace_create(n_bits + 2);
+    GRAPH* graph = watermark_encode_workspace(data, n_bits, rng, ws);
+    workspace_free(ws);
+    return graph;
+}
+
+GRAPH* watermark_encode_workspace(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws) {
+
     // get index of first positive bit
     unsigned long data_len = n_bits/8 + !!(n_bits%8);
     unsigned long total_number_of_bits = n_bits;
@@ -72,10 +98,13 @@ GRAPH* watermark_encode(void* data, unsigned long n_bits) {
     // construct hamiltonian path
     for(unsigned long i = 1; i < graph->num_nodes; i++) graph_oriented_connect(graph->nodes[i-1], graph->nodes[i]);
 
-    STACK* odd_stack = stack_create(n);
-    STACK* even_stack = stack_create(n);
+    workspace_reserve(ws, n + 2);
+    workspace_clear(ws, 0);
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
     stack_push(odd_stack, 0);
-    unsigned long* history = calloc(n*2, sizeof(unsigned long));
+    unsigned long* history = ws->history;
+    memset(history, 0x00, n*2*sizeof(unsigned long));
 
     // iterate over the bits
     unsigned long idx = 1;
@@ -112,7 +141,7 @@ GRAPH* watermark_encode(void* data, unsigned long n_bits) {
             } else {
 
                 // connect to backedge
-                unsigned long backedge_idx = get_backedge_index(possible_backedges, graph, idx);
+                unsigned long backedge_idx = get_backedge_index(possible_backedges, graph, idx, rng);
                 NODE* backedge_node = graph->nodes[possible_backedges->stack[backedge_idx]];
                 graph_oriented_connect(graph->nodes[idx], backedge_node);
                 // pop stacks
@@ -149,35 +178,411 @@ GRAPH* watermark_encode(void* data, unsigned long n_bits) {
         }
     }
 
-    stack_free(odd_stack);
-    stack_free(even_stack);
-    free(history);
     return graph;
 
 }
 
 GRAPH* watermark2014_rs_encode(void* data, unsigned long data_len, unsigned long num_parity_symbols) {
 
+    RNG rng;
+    rng_seed(&rng, rand());
+    return watermark2014_rs_encode_rng(data, data_len, num_parity_symbols, &rng);
+}
+
+GRAPH* watermark2014_rs_encode_rng(void* data, unsigned long data_len, unsigned long num_parity_symbols, RNG* rng) {
+
     uint8_t* data_with_parity = append_rs_code8(data, &data_len, num_parity_symbols);
-    GRAPH* graph = watermark2014_encode(data_with_parity, data_len);
+    GRAPH* graph = watermark2014_encode_rng(data_with_parity, data_len, rng);
     free(data_with_parity);
     return graph;
 }
 
 GRAPH* watermark_rs_encode8(void* data, unsigned long data_len, unsigned long num_parity_symbols) {
 
+    RNG rng;
+    rng_seed(&rng, rand());
+    return watermark_rs_encode8_rng(data, data_len, num_parity_symbols, &rng);
+}
+
+GRAPH* watermark_rs_encode8_rng(void* data, unsigned long data_len, unsigned long num_parity_symbols, RNG* rng) {
+
     uint8_t* data_with_parity = append_rs_code8(data, &data_len, num_parity_symbols);
-    GRAPH* graph = watermark_encode8(data_with_parity, data_len);
+    GRAPH* graph = watermark_encode_rng(data_with_parity, data_len * 8, rng);
     free(data_with_parity);
     return graph;
 }
 
 GRAPH* watermark_rs_encode(void* data, unsigned long num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize) {
 
+    RNG rng;
+    rng_seed(&rng, rand());
+    return watermark_rs_encode_rng(data, num_data_symbols, num_parity_symbols, symsize, &rng);
+}
+
+GRAPH* watermark_rs_encode_rng(void* data, unsigned long num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize, RNG* rng) {
+
     unsigned long n_bits = num_data_symbols;
     uint8_t* data_with_parity = append_rs_code(data, &n_bits, num_parity_symbols, symsize);
     if(!data_with_parity) return NULL;
-    GRAPH* graph = watermark_encode(data_with_parity, n_bits); // num_data_symbols == n_bits
+    GRAPH* graph = watermark_encode_rng(data_with_parity, n_bits, rng); // num_data_symbols == n_bits
     free(data_with_parity);
     return graph;
 }
+
+GRAPH* watermark2014_encode_bitvec(BITVEC* bits) {
+
+    unsigned long data_len;
+    uint8_t* data = bitvec_to_sequence(bits, &data_len);
+    GRAPH* graph = watermark2014_encode(data, data_len);
+    free(data);
+    return graph;
+}
+
+GRAPH* watermark_encode_bitvec(BITVEC* bits) {
+    return watermark_encode(bits->words, bits->n_bits);
+}
+
+GRAPH* watermark2014_rs_encode_bitvec(BITVEC* bits, unsigned long num_parity_symbols) {
+
+    unsigned long data_len;
+    uint8_t* data = bitvec_to_sequence(bits, &data_len);
+    GRAPH* graph = watermark2014_rs_encode(data, data_len, num_parity_symbols);
+    free(data);
+    return graph;
+}
+
+GRAPH* watermark_rs_encode_bitvec(BITVEC* bits, unsigned long num_parity_symbols, unsigned long symsize) {
+    return watermark_rs_encode(bits->words, bits->n_bits / symsize, num_parity_symbols, symsize);
+}
+
+void watermark_encode_batch(void* keys, unsigned long n, ENCODE_OPTS* opts, GRAPH** out_graphs) {
+
+    // parity of the whole batch is computed together, bit-sliced
+    uint8_t* encoded_keys = keys;
+    unsigned long key_len = opts->key_len;
+    unsigned long n_bits = opts->n_bits;
+    if(opts->num_parity_symbols) {
+        encoded_keys = append_rs_code_batch(keys, opts->key_len, n, opts->n_bits / opts->symsize,
+                opts->num_parity_symbols, opts->symsize, &key_len, &n_bits);
+    }
+
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(opts->num_threads ? (int)opts->num_threads : omp_get_max_threads())
+    #endif
+    {
+        // scratch stacks and history are reused by every key of this thread
+        WORKSPACE* ws = workspace_create(n_bits + 2);
+        #if defined(_OPENMP)
+          #pragma omp for schedule(dynamic, 64)
+        #endif
+        for(unsigned long i = 0; i < n; i++) {
+            RNG rng;
+            rng_seed(&rng, opts->seed + i);
+            out_graphs[i] = watermark_encode_workspace(encoded_keys + i * key_len, n_bits, &rng, ws);
+        }
+        workspace_free(ws);
+    }
+    if(encoded_keys != keys) free(encoded_keys);
+}
+
+void watermark_encode_plan_start(void* data, unsigned long n_bits, WORKSPACE* ws, ENCODE_CURSOR* cursor) {
+
+    // get index of first positive bit
+    unsigned long data_len = n_bits/8 + !!(n_bits%8);
+    unsigned long starting_idx = get_first_positive_bit_index(data, data_len);
+    unsigned long n = n_bits - starting_idx;
+
+    cursor->bit_idx = starting_idx+1;
+    cursor->idx = 1;
+    cursor->num_nodes = n + 2;
+    workspace_reserve(ws, n + 2);
+    workspace_clear(ws, 0);
+    // every forward edge adds a node, and there is at most one per bit
+    memset(ws->kinds, 0x00, 2 * cursor->num_nodes);
+    stack_push(&ws->odd_stack, 0);
+    // history is only read for nodes that were pushed
+    ws->history[0] = 0;
+}
+
+unsigned long watermark_encode_plan_run(void* data, unsigned long n_bits, WORKSPACE* ws, ENCODE_CURSOR* cursor) {
+
+    uint8_t* kinds = ws->kinds;
+    unsigned long* history = ws->history;
+    STACK* odd_stack = &ws->odd_stack;
+    STACK* even_stack = &ws->even_stack;
+
+    // same decisions as 'watermark_encode_workspace', with the connection lookups
+    // replaced by the flags of the previous nodes
+    for(; cursor->bit_idx < n_bits; cursor->bit_idx++, cursor->idx++) {
+
+        unsigned long idx = cursor->idx;
+        uint8_t bit = get_bit(data, cursor->bit_idx);
+        uint8_t is_odd = !(idx&1);
+
+        STACK* possible_backedges = (is_odd && bit) || (!is_odd && !bit) ? even_stack : odd_stack ;
+        // sink of a forward edge doesn't take a bit
+        if( idx > 1 && (kinds[idx-2] & ENCODE_NODE_FORWARD) ) {
+            cursor->bit_idx--;
+        // no backedge right after another one
+        } else if( !(kinds[idx-1] & ENCODE_NODE_BACKEDGE) && possible_backedges->n ) {
+
+            // inside a forward edge: while block if the bit is set, else if block
+            if( kinds[idx-1] & ENCODE_NODE_FORWARD ) {
+                if(bit) {
+                    kinds[idx] |= ENCODE_NODE_BACKEDGE;
+                    ws->backedges[idx] = idx-1;
+                    kinds[idx-1] |= ENCODE_NODE_WHILE;
+                }
+                continue;
+            }
+
+            // repeat block, its destination is left to 'watermark_encode_plan_choose'
+            return possible_backedges->n;
+        } else if(bit) {
+            cursor->num_nodes++;
+            kinds[idx] |= ENCODE_NODE_FORWARD;
+        }
+
+        // if this is not a inner forward node
+        if(!(kinds[idx-1] & ENCODE_NODE_FORWARD)) {
+            if(is_odd) {
+                stack_push(odd_stack, idx);
+                history[idx] = even_stack->n;
+            } else {
+                stack_push(even_stack, idx);
+                history[idx] = odd_stack->n;
+            }
+        }
+    }
+    return 0;
+}
+
+void watermark_encode_plan_choose(void* data, WORKSPACE* ws, ENCODE_CURSOR* cursor, unsigned long choice) {
+
+    unsigned long idx = cursor->idx;
+    uint8_t bit = get_bit(data, cursor->bit_idx);
+    uint8_t is_odd = !(idx&1);
+    STACK* possible_backedges = (is_odd && bit) || (!is_odd && !bit) ? &ws->even_stack : &ws->odd_stack ;
+    STACK* other_stack = possible_backedges == &ws->even_stack ? &ws->odd_stack : &ws->even_stack;
+
+    unsigned long backedge_node = possible_backedges->stack[choice];
+    ws->kinds[idx] |= ENCODE_NODE_BACKEDGE;
+    ws->backedges[idx] = backedge_node;
+    ws->kinds[backedge_node] |= ENCODE_NODE_REPEAT;
+    stack_pop_until(possible_backedges, choice);
+    stack_pop_until(other_stack, ws->history[backedge_node]);
+    // this node is now the origin of a backedge, so it isn't pushed
+    cursor->bit_idx++;
+    cursor->idx++;
+}
+
+void watermark_encode_plan_copy(WORKSPACE* dst, WORKSPACE* src, ENCODE_CURSOR* cursor) {
+
+    workspace_reserve(dst, src->max_nodes);
+    // nothing at or after 'cursor->idx' has been written yet, except for zeroed flags
+    memcpy(dst->odd_stack.stack, src->odd_stack.stack, src->odd_stack.n * sizeof(unsigned long));
+    memcpy(dst->even_stack.stack, src->even_stack.stack, src->even_stack.n * sizeof(unsigned long));
+    dst->odd_stack.n = src->odd_stack.n;
+    dst->even_stack.n = src->even_stack.n;
+    memcpy(dst->history, src->history, cursor->idx * sizeof(unsigned long));
+    memcpy(dst->backedges, src->backedges, cursor->idx * sizeof(unsigned long));
+    memcpy(dst->kinds, src->kinds, 2 * src->max_nodes);
+}
+
+unsigned long watermark_encode_plan(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws) {
+
+    ENCODE_CURSOR cursor;
+    watermark_encode_plan_start(data, n_bits, ws, &cursor);
+    unsigned long options;
+    while(( options = watermark_encode_plan_run(data, n_bits, ws, &cursor) )) {
+        watermark_encode_plan_choose(data, ws, &cursor, rng_below(rng, options));
+    }
+    return cursor.num_nodes;
+}
+
+GRAPH* watermark_encode_plan_graph(WORKSPACE* ws, unsigned long num_nodes) {
+
+    uint8_t* kinds = ws->kinds;
+    unsigned long* backedges = ws->backedges;
+
+    // nodes that exist before the first forward edge is added
+    unsigned long n = num_nodes;
+    for(unsigned long i = 0; i < num_nodes; i++) n -= !!(kinds[i] & ENCODE_NODE_FORWARD);
+
+    GRAPH* graph = graph_create(num_nodes);
+
+    // connections are made in the same order as 'watermark_encode_workspace', so
+    // every neighbour list comes out the same. The hamiltonian edge of the inner
+    // node of a while block is removed there, so it is never made here
+    for(unsigned long i = 1; i < n; i++) {
+        if( i < 2 || !(kinds[i-2] & ENCODE_NODE_WHILE) ) graph_oriented_connect(graph->nodes[i-1], graph->nodes[i]);
+    }
+    for(unsigned long idx = 1, last = n; idx < num_nodes; idx++) {
+
+        if( kinds[idx] & ENCODE_NODE_BACKEDGE ) {
+            graph_oriented_connect(graph->nodes[idx], graph->nodes[backedges[idx]]);
+        } else if( kinds[idx] & ENCODE_NODE_FORWARD ) {
+            if( !(kinds[last-2] & ENCODE_NODE_WHILE) ) graph_oriented_connect(graph->nodes[last-1], graph->nodes[last]);
+            last++;
+            graph_oriented_connect(graph->nodes[idx], graph->nodes[idx+2]);
+        }
+    }
+    return graph;
+}
+
+GRAPH* watermark_encode_large_rng(void* data, unsigned long n_bits, RNG* rng) {
+
+    WORKSPACE* ws = workspace_create(n_bits + 2);
+    GRAPH* graph = watermark_encode_large_workspace(data, n_bits, rng, ws);
+    workspace_free(ws);
+    return graph;
+}
+
+GRAPH* watermark_encode_large_workspace(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws) {
+
+    unsigned long num_nodes = watermark_encode_plan(data, n_bits, rng, ws);
+    return watermark_encode_plan_graph(ws, num_nodes);
+}
+
+typedef struct ENUMERATION {
+    void* data;
+    unsigned long n_bits;
+    ENCODE_CALLBACK callback;
+    void* arg;
+    unsigned long num_graphs;
+    int stop;
+} ENUMERATION;
+
+void watermark_encode_enumerate_branch(ENUMERATION* e, WORKSPACE* ws, ENCODE_CURSOR cursor, unsigned long num_branches) {
+
+    int stop;
+    unsigned long options = watermark_encode_plan_run(e->data, e->n_bits, ws, &cursor);
+    if(!options) {
+        #if defined(_OPENMP)
+          #pragma omp atomic read
+        #endif
+        stop = e->stop;
+        if(stop) return;
+
+        GRAPH* graph = watermark_encode_plan_graph(ws, cursor.num_nodes);
+        int result = e->callback(graph, e->arg);
+        graph_free(graph);
+        #if defined(_OPENMP)
+          #pragma omp atomic
+        #endif
+        e->num_graphs++;
+        if(result) {
+            #if defined(_OPENMP)
+              #pragma omp atomic write
+            #endif
+            e->stop = 1;
+        }
+        return;
+    }
+
+    // near the root every branch becomes a task with its own copy of the state, and
+    // idle threads steal them
+    if(num_branches < ENUMERATE_MAX_TASKS) {
+        for(unsigned long choice = 0; choice < options; choice++) {
+            WORKSPACE* branch_ws = workspace_create(ws->max_nodes);
+            watermark_encode_plan_copy(branch_ws, ws, &cursor);
+            #if defined(_OPENMP)
+              #pragma omp task firstprivate(branch_ws, choice, cursor)
+            #endif
+            {
+                ENCODE_CURSOR branch_cursor = cursor;
+                watermark_encode_plan_choose(e->data, branch_ws, &branch_cursor, choice);
+                watermark_encode_enumerate_branch(e, branch_ws, branch_cursor, num_branches * options);
+                workspace_free(branch_ws);
+            }
+        }
+        return;
+    }
+
+    // deeper, branches are walked one after the other on 'ws', from a snapshot taken here
+    WORKSPACE* saved = workspace_create(ws->max_nodes);
+    watermark_encode_plan_copy(saved, ws, &cursor);
+    for(unsigned long choice = 0; choice < options; choice++) {
+
+        #if defined(_OPENMP)
+          #pragma omp atomic read
+        #endif
+        stop = e->stop;
+        if(stop) break;
+
+        if(choice) watermark_encode_plan_copy(ws, saved, &cursor);
+        ENCODE_CURSOR branch_cursor = cursor;
+        watermark_encode_plan_choose(e->data, ws, &branch_cursor, choice);
+        watermark_encode_enumerate_branch(e, ws, branch_cursor, num_branches);
+    }
+    workspace_free(saved);
+}
+
+unsigned long watermark_encode_enumerate(void* data, unsigned long n_bits, ENCODE_CALLBACK callback, void* arg) {
+
+    ENUMERATION e = { .data = data, .n_bits = n_bits, .callback = callback, .arg = arg, .num_graphs = 0, .stop = 0 };
+    WORKSPACE* ws = workspace_create(n_bits + 2);
+    ENCODE_CURSOR cursor;
+    watermark_encode_plan_start(data, n_bits, ws, &cursor);
+
+    #if defined(_OPENMP)
+      #pragma omp parallel
+      #pragma omp single
+    #endif
+    watermark_encode_enumerate_branch(&e, ws, cursor, 1);
+
+    workspace_free(ws);
+    return e.num_graphs;
+}
+
+char* watermark_encode_dijkstra_code(void* data, unsigned long n_bits) {
+
+    RNG rng;
+    rng_seed(&rng, rand());
+    return watermark_encode_dijkstra_code_rng(data, n_bits, &rng);
+}
+
+char* watermark_encode_dijkstra_code_rng(void* data, unsigned long n_bits, RNG* rng) {
+
+    WORKSPACE* ws = workspace_create(n_bits + 2);
+    char* code = watermark_encode_dijkstra_code_workspace(data, n_bits, rng, ws);
+    workspace_free(ws);
+    return code;
+}
+
+char* watermark_encode_dijkstra_code_workspace(void* data, unsigned long n_bits, RNG* rng, WORKSPACE* ws) {
+
+    unsigned long num_nodes = watermark_encode_plan(data, n_bits, rng, ws);
+    return watermark_encode_plan_dijkstra_code(ws, num_nodes);
+}
+
+char* watermark_encode_plan_dijkstra_code(WORKSPACE* ws, unsigned long num_nodes) {
+
+    uint8_t* kinds = ws->kinds;
+
+    // blocks are properly nested along the hamiltonian path, so the code is written in
+    // node order: "15" opens a repeat at its destination (its origin is implicit), "13"
+    // and "14" open if and while blocks, whose inner node is a plain "1", "12" continues
+    // the current sequence and a lone "1" ends it
+    char* code = malloc(4 * num_nodes + 1);
+    unsigned long len = 0;
+    for(unsigned long i = 0; i < num_nodes; i++) {
+
+        uint8_t is_inner = i && (kinds[i-1] & ENCODE_NODE_FORWARD);
+        if( !is_inner && (kinds[i] & ENCODE_NODE_BACKEDGE) ) continue;
+
+        if( kinds[i] & ENCODE_NODE_REPEAT ) {
+            code[len++] = '1';
+            code[len++] = '0' + REPEAT;
+        }
+        code[len++] = '1';
+        if( kinds[i] & ENCODE_NODE_FORWARD ) {
+            code[len++] = '0' + ( kinds[i] & ENCODE_NODE_WHILE ? WHILE : IF_THEN );
+        } else if( !is_inner && i+1 < num_nodes && !(kinds[i+1] & ENCODE_NODE_BACKEDGE) ) {
+            code[len++] = '0' + SEQUENCE;
+        }
+    }
+    code[len] = '\0';
+
+    return realloc(code, len + 1);
+}
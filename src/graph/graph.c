@@ -12,6 +12,9 @@ GRAPH* graph_create(unsigned long num_nodes) {
     graph->nodes = calloc(num_nodes, sizeof(NODE*));
     graph->num_nodes = num_nodes;
     graph->num_connections = 0;
+    // no edges, no forward edges
+    graph->num_forward_edges = 0;
+    graph->has_num_forward_edges = 1;
 
     for(unsigned long i = 0; i < graph->num_nodes; i++) graph->nodes[i] = node_empty(graph, i);
 
@@ -73,6 +76,7 @@ void graph_insert(GRAPH* graph, unsigned long idx) {
         graph->nodes[current_node_idx]->graph_idx++;
     }
     graph->nodes[idx] = node_empty(graph, idx);
+    graph->has_num_forward_edges = 0;
 }
 
 // swap the index of two nodes
@@ -84,6 +88,7 @@ void graph_swap(NODE* a, NODE* b) {
     b->graph_idx = tmp;
     a->graph->nodes[a->graph_idx] = a;
     b->graph->nodes[b->graph_idx] = b;
+    a->graph->has_num_forward_edges = 0;
 }
 
 // remove all connections that this node is a part of
@@ -107,6 +112,7 @@ void graph_delete(NODE* node) {
     }
     // update number of nodes
     graph->num_nodes--;
+    graph->has_num_forward_edges = 0;
     // free node
     node_free(node);
 }
@@ -114,8 +120,10 @@ void graph_delete(NODE* node) {
 // connect node to another
 void graph_oriented_connect(NODE* from, NODE* to) {
 
+    GRAPH* graph = from->graph;
+    if( graph->has_num_forward_edges && to->graph_idx > from->graph_idx+1 && !graph_get_forward(from) ) graph->num_forward_edges++;
     node_oriented_connect(from, to);
-    from->graph->num_connections++;
+    graph->num_connections++;
 }
 
 // disconnect node from another
@@ -123,7 +131,9 @@ void graph_oriented_connect(NODE* from, NODE* to) {
 uint8_t graph_oriented_disconnect(NODE* from, NODE* to) {
 
     if( node_oriented_disconnect(from, to) ) {
-        from->graph->num_connections--;
+        GRAPH* graph = from->graph;
+        graph->num_connections--;
+        if( graph->has_num_forward_edges && to->graph_idx > from->graph_idx+1 && !graph_get_forward(from) ) graph->num_forward_edges--;
         return 1;
     }
     return 0;
@@ -150,6 +160,16 @@ CONNECTION* graph_get_forward(NODE* node) {
     return NULL;
 }
 
+unsigned long graph_count_forward_edges(GRAPH* graph) {
+
+    if(!graph->has_num_forward_edges) {
+        graph->num_forward_edges = 0;
+        for(unsigned long i = 0; i < graph->num_nodes; i++) if(graph_get_forward(graph->nodes[i])) graph->num_forward_edges++;
+        graph->has_num_forward_edges = 1;
+    }
+    return graph->num_forward_edges;
+}
+
 typedef struct TOPO_NODE {
     uint8_t mark;
     CONNECTION* check_next;
@@ -201,6 +221,7 @@ void graph_topological_sort(GRAPH* graph) {
     stack_free(stack);
     // update indexes
     for(unsigned long i = 0; i < graph->num_nodes; i++) graph->nodes[i]->graph_idx = i;
+    graph->has_num_forward_edges = 0;
 }
 
 // unload info from all nodes
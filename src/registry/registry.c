@@ -0,0 +1,230 @@
+#include "registry/registry.h"
+#include "hashmap/hashmap.h"
+
+#if defined(_OPENMP)
+  #include <omp.h>
+#endif
+
+void registry_signature_from_plan(WORKSPACE* ws, unsigned long num_nodes, REGISTRY_SIGNATURE* signature) {
+
+    uint8_t* kinds = ws->kinds;
+    signature->num_nodes = num_nodes;
+    signature->num_forward_edges = 0;
+    // djb2 over the parity of each backedge
+    uint64_t parity_hash = 5381;
+    for(unsigned long i = 0; i < num_nodes; i++) {
+        if( kinds[i] & ENCODE_NODE_FORWARD ) signature->num_forward_edges++;
+        if( kinds[i] & ENCODE_NODE_BACKEDGE ) parity_hash = (parity_hash << 5) + parity_hash + ((i - ws->backedges[i]) & 1);
+    }
+    signature->parity_hash = parity_hash;
+
+    char* code = watermark_encode_plan_dijkstra_code(ws, num_nodes);
+    signature->code_hash = djb2((uint8_t*)code, strlen(code));
+    free(code);
+}
+
+void registry_signature_from_graph(GRAPH* graph, WORKSPACE* ws, REGISTRY_SIGNATURE* signature) {
+
+    // rebuild the plan the graph would have come from, as 'encode_table_get_graph' does
+    workspace_load_graph(ws, graph);
+    VIEW_NODE* view = ws->view;
+    memset(ws->kinds, 0x00, graph->num_nodes);
+    for(unsigned long i = 0; i < graph->num_nodes; i++) {
+
+        if( view[i].flags & VIEW_NODE_SKIP ) ws->kinds[i] |= ENCODE_NODE_FORWARD;
+        if( view[i].num_backedges ) {
+            unsigned long to = view[i].backedge;
+            ws->kinds[i] |= ENCODE_NODE_BACKEDGE;
+            ws->backedges[i] = to;
+            if( to == i - 1 && (ws->kinds[to] & ENCODE_NODE_FORWARD) ) {
+                ws->kinds[to] |= ENCODE_NODE_WHILE;
+            } else {
+                ws->kinds[to] |= ENCODE_NODE_REPEAT;
+            }
+        }
+    }
+    registry_signature_from_plan(ws, graph->num_nodes, signature);
+    // 'watermark_check' counts any edge that skips a node
+    signature->num_forward_edges = 0;
+    for(unsigned long i = 0; i < graph->num_nodes; i++) if(view[i].num_forward) signature->num_forward_edges++;
+}
+
+// compare the first 'depth' fields of two signatures (2 compares the number of nodes and
+// forward edges, 3 adds the parity profile and 4 the dijkstra code)
+int registry_signature_compare(const REGISTRY_SIGNATURE* x, const REGISTRY_SIGNATURE* y, uint8_t depth) {
+
+    if(x->num_nodes != y->num_nodes) return x->num_nodes < y->num_nodes ? -1 : 1;
+    if(x->num_forward_edges != y->num_forward_edges) return x->num_forward_edges < y->num_forward_edges ? -1 : 1;
+    if(depth > 2 && x->parity_hash != y->parity_hash) return x->parity_hash < y->parity_hash ? -1 : 1;
+    if(depth > 3 && x->code_hash != y->code_hash) return x->code_hash < y->code_hash ? -1 : 1;
+    return 0;
+}
+
+int registry_key_compare(const void* a, const void* b) {
+
+    const REGISTRY_KEY* x = a;
+    const REGISTRY_KEY* y = b;
+    if(x->hash != y->hash) return x->hash < y->hash ? -1 : 1;
+    return x->key_idx < y->key_idx ? -1 : x->key_idx > y->key_idx;
+}
+
+int registry_entry_compare(const void* a, const void* b) {
+
+    const REGISTRY_ENTRY* x = a;
+    const REGISTRY_ENTRY* y = b;
+    int cmp = registry_signature_compare(&x->signature, &y->signature, 4);
+    if(cmp) return cmp;
+    return x->key_idx < y->key_idx ? -1 : x->key_idx > y->key_idx;
+}
+
+REGISTRY* registry_create(void* keys, unsigned long n, ENCODE_OPTS* opts) {
+
+    // same keys 'watermark_encode_batch' encodes
+    uint8_t* encoded_keys = keys;
+    unsigned long key_len = opts->key_len;
+    unsigned long n_bits = opts->n_bits;
+    if(opts->num_parity_symbols) {
+        encoded_keys = append_rs_code_batch(keys, opts->key_len, n, opts->n_bits / opts->symsize,
+                opts->num_parity_symbols, opts->symsize, &key_len, &n_bits);
+    }
+
+    REGISTRY* registry = malloc(sizeof(REGISTRY));
+    registry->key_len = n_bits / 8 + !!(n_bits % 8);
+    registry->num_keys = n;
+    registry->keys = calloc(n * registry->key_len + 1, 1);
+    registry->entries = malloc((n ? n : 1) * sizeof(REGISTRY_ENTRY));
+    registry->by_key = malloc((n ? n : 1) * sizeof(REGISTRY_KEY));
+
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(opts->num_threads ? (int)opts->num_threads : omp_get_max_threads())
+    #endif
+    {
+        WORKSPACE* ws = workspace_create(n_bits + 2);
+        #if defined(_OPENMP)
+          #pragma omp for schedule(dynamic, 64)
+        #endif
+        for(unsigned long i = 0; i < n; i++) {
+            uint8_t* key = encoded_keys + i * key_len;
+            RNG rng;
+            rng_seed(&rng, opts->seed + i);
+            unsigned long num_nodes = watermark_encode_plan(key, n_bits, &rng, ws);
+            registry_signature_from_plan(ws, num_nodes, &registry->entries[i].signature);
+            registry->entries[i].key_idx = i;
+
+            unsigned long num_bytes;
+            uint8_t* packed = registry->keys + i * registry->key_len;
+            memcpy(packed, key, registry->key_len);
+            workspace_pack_sequence(packed, n_bits, &num_bytes);
+            registry->by_key[i].hash = djb2(packed, registry->key_len);
+            registry->by_key[i].key_idx = i;
+        }
+        workspace_free(ws);
+    }
+    if(encoded_keys != keys) free(encoded_keys);
+
+    qsort(registry->entries, n, sizeof(REGISTRY_ENTRY), registry_entry_compare);
+    qsort(registry->by_key, n, sizeof(REGISTRY_KEY), registry_key_compare);
+    return registry;
+}
+
+void registry_free(REGISTRY* registry) {
+
+    if(!registry) return;
+    free(registry->keys);
+    free(registry->entries);
+    free(registry->by_key);
+    free(registry);
+}
+
+// first entry in [begin, end) not before 'signature' (or after it, if 'upper' is set)
+unsigned long registry_bound(REGISTRY* registry, unsigned long begin, unsigned long end, REGISTRY_SIGNATURE* signature, uint8_t depth, uint8_t upper) {
+
+    while(begin < end) {
+        unsigned long middle = begin + (end - begin) / 2;
+        int cmp = registry_signature_compare(&registry->entries[middle].signature, signature, depth);
+        if(cmp < 0 || (upper && !cmp)) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+    return begin;
+}
+
+// append 'key_idx' to the shortlist, unless it's already there or it's full
+void registry_shortlist_add(unsigned long* key_idxs, unsigned long* n, unsigned long max_candidates, unsigned long key_idx) {
+
+    if(*n == max_candidates) return;
+    for(unsigned long i = 0; i < *n; i++) if(key_idxs[i] == key_idx) return;
+    key_idxs[(*n)++] = key_idx;
+}
+
+unsigned long registry_lookup(REGISTRY* registry, GRAPH* graph, WORKSPACE* ws, unsigned long* key_idxs, unsigned long max_candidates) {
+
+    REGISTRY_SIGNATURE signature;
+    registry_signature_from_graph(graph, ws, &signature);
+
+    // nested ranges of entries matching more and more of the signature
+    unsigned long begin[3], end[3];
+    begin[0] = registry_bound(registry, 0, registry->num_keys, &signature, 2, 0);
+    end[0] = registry_bound(registry, begin[0], registry->num_keys, &signature, 2, 1);
+    for(uint8_t depth = 1; depth < 3; depth++) {
+        begin[depth] = registry_bound(registry, begin[depth-1], end[depth-1], &signature, depth + 2, 0);
+        end[depth] = registry_bound(registry, begin[depth], end[depth-1], &signature, depth + 2, 1);
+    }
+
+    unsigned long n = 0;
+    for(unsigned long j = begin[2]; j < end[2]; j++) registry_shortlist_add(key_idxs, &n, max_candidates, registry->entries[j].key_idx);
+    for(unsigned long j = begin[1]; j < end[1]; j++) registry_shortlist_add(key_idxs, &n, max_candidates, registry->entries[j].key_idx);
+
+    // the parities (and so the dijkstra code) change with the backedges the RNG picked,
+    // so next come the keys the graph decodes to
+    unsigned long num_bytes;
+    uint8_t* decoded = watermark_decode_workspace(graph, ws, &num_bytes);
+    if(num_bytes <= registry->key_len) {
+        uint8_t key[registry->key_len];
+        memset(key, 0x00, registry->key_len - num_bytes);
+        memcpy(key + registry->key_len - num_bytes, decoded, num_bytes);
+        unsigned long hash = djb2(key, registry->key_len);
+        unsigned long lo = 0, hi = registry->num_keys;
+        while(lo < hi) {
+            unsigned long middle = lo + (hi - lo) / 2;
+            if(registry->by_key[middle].hash < hash) {
+                lo = middle + 1;
+            } else {
+                hi = middle;
+            }
+        }
+        for(; lo < registry->num_keys && registry->by_key[lo].hash == hash; lo++) {
+            unsigned long key_idx = registry->by_key[lo].key_idx;
+            if( !memcmp(registry->keys + key_idx * registry->key_len, key, registry->key_len) )
+                registry_shortlist_add(key_idxs, &n, max_candidates, key_idx);
+        }
+    }
+
+    // then anything with as many bits
+    for(unsigned long j = begin[0]; j < end[0]; j++) registry_shortlist_add(key_idxs, &n, max_candidates, registry->entries[j].key_idx);
+    return n;
+}
+
+uint8_t registry_find_key(REGISTRY* registry, GRAPH* graph, unsigned long* key_idx) {
+
+    WORKSPACE* ws = workspace_create(graph->num_nodes);
+    uint8_t result = registry_find_key_workspace(registry, graph, key_idx, ws);
+    workspace_free(ws);
+    return result;
+}
+
+uint8_t registry_find_key_workspace(REGISTRY* registry, GRAPH* graph, unsigned long* key_idx, WORKSPACE* ws) {
+
+    if(graph->num_nodes < 3) return 0;
+    unsigned long key_idxs[REGISTRY_MAX_CANDIDATES];
+    unsigned long n = registry_lookup(registry, graph, ws, key_idxs, REGISTRY_MAX_CANDIDATES);
+    for(unsigned long i = 0; i < n; i++) {
+        if( watermark_check_workspace(graph, registry->keys + key_idxs[i] * registry->key_len, registry->key_len, ws) ) {
+            *key_idx = key_idxs[i];
+            return 1;
+        }
+    }
+    return 0;
+}
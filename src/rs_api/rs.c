@@ -1,5 +1,6 @@
 #include "utils/utils.h"
-#include <fec.h>
+#include "rs_api/rs.h"
+#include "rs_api/rs_tables.h"
 
 #define XOR_MASK 0x00
 
@@ -9,98 +10,52 @@
   }\
   fprintf(stderr, "\n");
 
-struct rs_control* get_rs_struct(int symsize, int num_parity, int data_len) {
+// codecs are precomputed for every (symsize, num_parity) pair, see 'rs_api/rs_tables.h'
+const struct rs_control* get_rs_struct(int symsize, int num_parity, int data_len) {
 
   int n = (1 << symsize) - 1;
-  int pad = n - num_parity - data_len;
-  int gfpoly, fcr, prim;
-  switch(symsize) {
-    case 2:
-    case 3:
-    case 4:
-    case 6:
-    case 7:
-      gfpoly = 0x3;
-      fcr = 1;
-      prim = 1;
-      break;
-    case 5:
-      gfpoly = 0x5;
-      fcr = 1;
-      prim = 1;
-      break;
-    default:
-    case 8:
-      gfpoly = 0x187;
-      fcr = 0;
-      prim = 1;
-      break;
-  }
-
-	// parity_len == nroots
-  #if defined(_OPENMP)
-    #pragma omp critical
-    {
-  #endif
-  void* rs = init_rs_char(symsize, gfpoly, fcr, prim, num_parity, pad);
-  if(!rs) {
-    fprintf(stderr, "'init_rs' returned %p for symbol_size: %d and parity_len: %d\n", rs, symsize, num_parity);
+  const struct rs_control* rs = rs_tables_get(symsize, num_parity);
+  if(!rs || data_len < 1 || num_parity + data_len > n) {
+    fprintf(stderr, "'rs_tables_get' returned %p for symbol_size: %d and parity_len: %d\n", (void*)rs, symsize, num_parity);
     if(num_parity + data_len > n) {
       fprintf(stderr, "cause: num_parity + data_len > n. (%d + %d > %d)\n", num_parity, data_len, n);
     }
     exit(EXIT_FAILURE);
   }
   return rs;
-  # if defined(_OPENMP)
-    }
-  #endif
 }
 
 void rs_encode(uint8_t* data, int data_len, uint8_t* parity, int num_parity, int symsize) {
-  void* rs = get_rs_struct(symsize, num_parity, data_len);
+  const struct rs_control* rs = get_rs_struct(symsize, num_parity, data_len);
 
   memset(parity, 0x00, num_parity * sizeof(uint8_t));
-  #if defined(_OPENMP)
-    #pragma omp critical
-  #endif
-  encode_rs_char(rs, data, parity);
+  if(!num_parity) return;
 
-  #if defined(_OPENMP)
-    #pragma omp critical
-  #endif
-  free_rs_char(rs);
+  uint16_t par[num_parity];
+  memset(par, 0x00, num_parity * sizeof(uint16_t));
+  encode_rs8(rs, data, data_len, par, XOR_MASK);
+  for(int i = 0; i < num_parity; i++) parity[i] = par[i];
 }
 
-#define return_defer(value) do { numerr = value; goto defer; } while(0);
-
 int rs_decode(uint8_t* result, int num_data, int num_parity, int symsize) {
 
-  void* rs = get_rs_struct(symsize, num_parity, num_data);
+  const struct rs_control* rs = get_rs_struct(symsize, num_parity, num_data);
 
   int numerr;
-  // #if defined(_OPENMP)
-  //   #pragma omp critical
-  // #endif
+  if(!num_parity) return 0;
 
   // 1. make copy of data
   unsigned long num_symbols = num_data + num_parity;
   uint8_t best_decoded_data[num_symbols];
   memcpy(best_decoded_data, result, num_symbols);
+  uint16_t par[num_parity];
+  for(int i = 0; i < num_parity; i++) par[i] = best_decoded_data[num_data + i];
 
   // 2. try decoding with no erasures
-  #if defined(_OPENMP)
-    #pragma omp critical
-  #endif
-  numerr = decode_rs_char(rs, best_decoded_data, NULL, 0);
+  numerr = decode_rs8(rs, best_decoded_data, par, num_data, NULL, 0, NULL, XOR_MASK, NULL);
 
-  // 3. unless it is just a matter of using erasure decoding, return
-  if(numerr != -2) return_defer(numerr);
-
-defer:
-  #if defined(_OPENMP)
-    #pragma omp critical
-  #endif
-	  free_rs_char(rs);
+  // 3. uncorrectable codewords are reported as -1
+  if(numerr < 0) numerr = -1;
 
   memcpy(result, best_decoded_data, num_data);
 
@@ -121,26 +76,11 @@ void* append_rs_code8(void* data, unsigned long* data_len, unsigned long num_par
 }
 
 void copy_unmerged_arr_to_merged_arr(void* from, void* to, unsigned long num_symbols, unsigned long symbol_size, unsigned long num_from_element_bytes, unsigned long* next_bit) {
-  unsigned long offset = num_from_element_bytes * 8 - symbol_size;
-  for(unsigned long i = 0; i < num_symbols; i++) {
-    void* from_element = ((uint8_t*)from) + ( num_from_element_bytes * i );
-    for(unsigned long j = 0; j < symbol_size; j++) {
-      set_bit(to, *next_bit, get_bit(from_element, offset + j));
-      (*next_bit)++;
-    }
-  }
+  pack_symbols(from, num_symbols, num_from_element_bytes, symbol_size, to, next_bit);
 }
 
 void copy_merged_arr_to_unmerged_arr(void* from, void* to, unsigned long num_symbols, unsigned long symbol_size, unsigned long num_to_element_bytes, unsigned long* next_bit) {
-
-    unsigned long offset = num_to_element_bytes * 8 - symbol_size;
-    for(unsigned long i = 0; i < num_symbols; i++) {
-      void* to_element = ((uint8_t*)to) + ( num_to_element_bytes * i );
-      for(unsigned long j = 0; j < symbol_size; j++) {
-        set_bit(to_element, offset + j, get_bit(from, *next_bit));
-        (*next_bit)++;
-      }
-    }
+  unpack_symbols(from, next_bit, num_symbols, num_to_element_bytes, symbol_size, to);
 }
 
 void* append_rs_code(void* data, unsigned long* num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize) {
@@ -172,6 +112,121 @@ void* append_rs_code(void* data, unsigned long* num_data_symbols, unsigned long
   return data_with_parity; 
 }
 
+#define RS_BATCH_WORDS (RS_BATCH_LANES / 64)
+
+uint16_t gf_mul(const struct rs_control* rs, uint16_t a, uint16_t b) {
+  if(!a || !b) return 0;
+  return rs->alpha_to[rs_modnn(rs, rs->index_of[a] + rs->index_of[b])];
+}
+
+// multiplying a symbol by a constant is linear over GF(2), so it can be written as a
+// symsize x symsize bit matrix. Bit 's' of 'rows[r]' tells if input bit 's' is xored into output bit 'r'
+void gf_mul_matrix(const struct rs_control* rs, uint16_t c, uint16_t* rows) {
+  memset(rows, 0x00, rs->mm * sizeof(uint16_t));
+  for(int s = 0; s < rs->mm; s++) {
+    uint16_t column = gf_mul(rs, c, 1 << s);
+    for(int r = 0; r < rs->mm; r++) {
+      if((column >> r) & 1) rows[r] |= 1 << s;
+    }
+  }
+}
+
+// out = acc ^ (matrix * in), where each symbol is 'symsize' slices of RS_BATCH_WORDS words
+void gf_sliced_mul_add(uint64_t* out, uint64_t* acc, uint64_t* in, uint16_t* rows, int symsize) {
+  for(int r = 0; r < symsize; r++) {
+    uint64_t res[RS_BATCH_WORDS];
+    for(int w = 0; w < RS_BATCH_WORDS; w++) res[w] = acc ? acc[r * RS_BATCH_WORDS + w] : 0;
+    for(int s = 0; s < symsize; s++) {
+      if(!((rows[r] >> s) & 1)) continue;
+      for(int w = 0; w < RS_BATCH_WORDS; w++) res[w] ^= in[s * RS_BATCH_WORDS + w];
+    }
+    memcpy(&out[r * RS_BATCH_WORDS], res, sizeof(res));
+  }
+}
+
+// same LFSR as 'encode_rs8', but every xor processes RS_BATCH_LANES keys
+void rs_encode_sliced(uint64_t* data, int num_data, uint64_t* parity, int num_parity, int symsize, uint16_t* genpoly_rows) {
+  unsigned long symbol_words = symsize * RS_BATCH_WORDS;
+  uint64_t feedback[symbol_words];
+  memset(parity, 0x00, num_parity * symbol_words * sizeof(uint64_t));
+  if(!num_parity) return;
+  for(int i = 0; i < num_data; i++) {
+    for(unsigned long k = 0; k < symbol_words; k++) feedback[k] = data[i * symbol_words + k] ^ parity[k];
+    // shift parity, adding feedback * genpoly[num_parity - j - 1] to each symbol
+    for(int j = 0; j < num_parity - 1; j++) {
+      gf_sliced_mul_add(&parity[j * symbol_words], &parity[(j + 1) * symbol_words], feedback, &genpoly_rows[(num_parity - j - 1) * symsize], symsize);
+    }
+    gf_sliced_mul_add(&parity[(num_parity - 1) * symbol_words], NULL, feedback, &genpoly_rows[0], symsize);
+  }
+}
+
+void* append_rs_code_batch(void* keys, unsigned long key_len, unsigned long num_keys, unsigned long num_data_symbols, unsigned long num_parity_symbols, unsigned long symsize, unsigned long* res_len, unsigned long* num_bits) {
+
+  // 0. initialize variables
+  const struct rs_control* rs = get_rs_struct(symsize, num_parity_symbols, num_data_symbols);
+  unsigned long data_bits = num_data_symbols * symsize;
+  unsigned long total_bits = data_bits + num_parity_symbols * symsize;
+  unsigned long total_bytes = total_bits / 8 + !!(total_bits % 8);
+  unsigned long symbol_words = symsize * RS_BATCH_WORDS;
+
+  // 1. get multiplication matrix of every generator polynomial coefficient
+  uint16_t* genpoly_rows = malloc((num_parity_symbols + 1) * symsize * sizeof(uint16_t));
+  for(unsigned long i = 0; i <= num_parity_symbols; i++) {
+    gf_mul_matrix(rs, rs->alpha_to[rs->genpoly[i]], &genpoly_rows[i * symsize]);
+  }
+
+  uint8_t* data_with_parity = calloc(num_keys, total_bytes);
+  unsigned long num_groups = num_keys / RS_BATCH_LANES + !!(num_keys % RS_BATCH_LANES);
+
+  #if defined(_OPENMP)
+    #pragma omp parallel for schedule(dynamic)
+  #endif
+  for(unsigned long group = 0; group < num_groups; group++) {
+
+    unsigned long first_key = group * RS_BATCH_LANES;
+    unsigned long group_len = num_keys - first_key < RS_BATCH_LANES ? num_keys - first_key : RS_BATCH_LANES;
+    uint64_t* data = calloc(num_data_symbols * symbol_words, sizeof(uint64_t));
+    uint64_t* parity = calloc(num_parity_symbols * symbol_words, sizeof(uint64_t));
+
+    // 2. transpose keys into bit slices: slice 'b' of a symbol holds its bit 'b' for every key
+    for(unsigned long k = 0; k < group_len; k++) {
+      uint8_t* key = (uint8_t*)keys + (first_key + k) * key_len;
+      for(unsigned long i = 0; i < num_data_symbols; i++) {
+        for(unsigned long b = 0; b < symsize; b++) {
+          if(get_bit(key, i * symsize + symsize - b - 1)) data[i * symbol_words + b * RS_BATCH_WORDS + k / 64] |= 1ULL << (k % 64);
+        }
+      }
+    }
+
+    // 3. encode
+    rs_encode_sliced(data, num_data_symbols, parity, num_parity_symbols, symsize, genpoly_rows);
+
+    // 4. write data bits followed by parity bits of each key
+    for(unsigned long k = 0; k < group_len; k++) {
+      uint8_t* key = (uint8_t*)keys + (first_key + k) * key_len;
+      uint8_t* res = data_with_parity + (first_key + k) * total_bytes;
+      uint8_t key_parity[num_parity_symbols + 1];
+      memset(key_parity, 0x00, num_parity_symbols);
+      for(unsigned long j = 0; j < num_parity_symbols; j++) {
+        for(unsigned long b = 0; b < symsize; b++) {
+          key_parity[j] |= ((parity[j * symbol_words + b * RS_BATCH_WORDS + k / 64] >> (k % 64)) & 1) << b;
+        }
+      }
+      unsigned long next_bit = data_bits;
+      memcpy(res, key, data_bits / 8 + !!(data_bits % 8));
+      if(data_bits % 8) res[data_bits / 8] &= ~(0xff >> (data_bits % 8));
+      pack_symbols(key_parity, num_parity_symbols, sizeof(uint8_t), symsize, res, &next_bit);
+    }
+    free(data);
+    free(parity);
+  }
+  free(genpoly_rows);
+
+  *res_len = total_bytes;
+  *num_bits = total_bits;
+  return data_with_parity;
+}
+
 // 'num_parity_symbols' will hold the original data sequence size
 uint8_t* remove_rs_code8(uint8_t* data, unsigned long data_len, unsigned long* num_parity_symbols) {
 
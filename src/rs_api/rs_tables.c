@@ -0,0 +1,4601 @@
+// generated by tools/gen_rs_tables.c ('make rs_tables'), do not edit
+#include "rs_api/rs_tables.h"
+
+// symbol size 2
+static uint16_t alpha_to_2[4] = {
+    1, 2, 3, 0
+};
+static uint16_t index_of_2[4] = {
+    3, 0, 1, 2
+};
+static uint16_t genpoly_2_0[1] = {
+    0
+};
+static uint16_t genpoly_2_1[2] = {
+    1, 0
+};
+static uint16_t genpoly_2_2[3] = {
+    0, 0, 0
+};
+static const struct rs_control rs_codecs_2[3] = {
+    { .mm = 2, .nn = 3, .alpha_to = alpha_to_2, .index_of = index_of_2, .genpoly = genpoly_2_0, .nroots = 0, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 2, .nn = 3, .alpha_to = alpha_to_2, .index_of = index_of_2, .genpoly = genpoly_2_1, .nroots = 1, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 2, .nn = 3, .alpha_to = alpha_to_2, .index_of = index_of_2, .genpoly = genpoly_2_2, .nroots = 2, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+};
+
+// symbol size 3
+static uint16_t alpha_to_3[8] = {
+    1, 2, 4, 3, 6, 7, 5, 0
+};
+static uint16_t index_of_3[8] = {
+    7, 0, 1, 3, 2, 6, 4, 5
+};
+static uint16_t genpoly_3_0[1] = {
+    0
+};
+static uint16_t genpoly_3_1[2] = {
+    1, 0
+};
+static uint16_t genpoly_3_2[3] = {
+    3, 4, 0
+};
+static uint16_t genpoly_3_3[4] = {
+    6, 1, 6, 0
+};
+static uint16_t genpoly_3_4[5] = {
+    3, 1, 0, 3, 0
+};
+static uint16_t genpoly_3_5[6] = {
+    1, 4, 6, 3, 2, 0
+};
+static uint16_t genpoly_3_6[7] = {
+    0, 0, 0, 0, 0, 0, 0
+};
+static const struct rs_control rs_codecs_3[7] = {
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_0, .nroots = 0, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_1, .nroots = 1, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_2, .nroots = 2, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_3, .nroots = 3, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_4, .nroots = 4, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_5, .nroots = 5, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 3, .nn = 7, .alpha_to = alpha_to_3, .index_of = index_of_3, .genpoly = genpoly_3_6, .nroots = 6, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+};
+
+// symbol size 4
+static uint16_t alpha_to_4[16] = {
+    1, 2, 4, 8, 3, 6, 12, 11, 5, 10, 7, 14, 15, 13, 9, 0
+};
+static uint16_t index_of_4[16] = {
+    15, 0, 1, 4, 2, 8, 5, 10, 3, 14, 9, 7, 6, 13, 11, 12
+};
+static uint16_t genpoly_4_0[1] = {
+    0
+};
+static uint16_t genpoly_4_1[2] = {
+    1, 0
+};
+static uint16_t genpoly_4_2[3] = {
+    3, 5, 0
+};
+static uint16_t genpoly_4_3[4] = {
+    6, 13, 11, 0
+};
+static uint16_t genpoly_4_4[5] = {
+    10, 3, 6, 13, 0
+};
+static uint16_t genpoly_4_5[6] = {
+    0, 1, 5, 2, 7, 0
+};
+static uint16_t genpoly_4_6[7] = {
+    6, 9, 6, 4, 14, 10, 0
+};
+static uint16_t genpoly_4_7[8] = {
+    13, 11, 10, 1, 12, 13, 6, 0
+};
+static uint16_t genpoly_4_8[9] = {
+    6, 11, 5, 13, 2, 4, 2, 14, 0
+};
+static uint16_t genpoly_4_9[10] = {
+    0, 9, 10, 13, 4, 14, 13, 0, 4, 0
+};
+static uint16_t genpoly_4_10[11] = {
+    10, 1, 6, 1, 2, 14, 6, 9, 3, 2, 0
+};
+static uint16_t genpoly_4_11[12] = {
+    6, 3, 5, 4, 12, 4, 13, 9, 4, 8, 9, 0
+};
+static uint16_t genpoly_4_12[13] = {
+    3, 13, 6, 2, 14, 13, 2, 0, 3, 8, 14, 8, 0
+};
+static uint16_t genpoly_4_13[14] = {
+    1, 5, 11, 13, 7, 10, 6, 14, 4, 2, 9, 8, 3, 0
+};
+static uint16_t genpoly_4_14[15] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const struct rs_control rs_codecs_4[15] = {
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_0, .nroots = 0, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_1, .nroots = 1, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_2, .nroots = 2, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_3, .nroots = 3, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_4, .nroots = 4, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_5, .nroots = 5, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_6, .nroots = 6, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_7, .nroots = 7, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_8, .nroots = 8, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_9, .nroots = 9, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_10, .nroots = 10, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_11, .nroots = 11, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_12, .nroots = 12, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_13, .nroots = 13, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 4, .nn = 15, .alpha_to = alpha_to_4, .index_of = index_of_4, .genpoly = genpoly_4_14, .nroots = 14, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+};
+
+// symbol size 5
+static uint16_t alpha_to_5[32] = {
+    1, 2, 4, 8, 16, 5, 10, 20, 13, 26, 17, 7, 14, 28, 29, 31, 
+    27, 19, 3, 6, 12, 24, 21, 15, 30, 25, 23, 11, 22, 9, 18, 0
+};
+static uint16_t index_of_5[32] = {
+    31, 0, 1, 18, 2, 5, 19, 11, 3, 29, 6, 27, 20, 8, 12, 23, 
+    4, 10, 30, 17, 7, 22, 28, 26, 21, 25, 9, 16, 13, 14, 24, 15
+};
+static uint16_t genpoly_5_0[1] = {
+    0
+};
+static uint16_t genpoly_5_1[2] = {
+    1, 0
+};
+static uint16_t genpoly_5_2[3] = {
+    3, 19, 0
+};
+static uint16_t genpoly_5_3[4] = {
+    6, 14, 12, 0
+};
+static uint16_t genpoly_5_4[5] = {
+    10, 29, 19, 24, 0
+};
+static uint16_t genpoly_5_5[6] = {
+    15, 25, 26, 23, 16, 0
+};
+static uint16_t genpoly_5_6[7] = {
+    21, 24, 16, 24, 9, 10, 0
+};
+static uint16_t genpoly_5_7[8] = {
+    28, 25, 10, 9, 5, 29, 5, 0
+};
+static uint16_t genpoly_5_8[9] = {
+    5, 30, 9, 1, 19, 23, 22, 3, 0
+};
+static uint16_t genpoly_5_9[10] = {
+    14, 3, 10, 27, 7, 2, 12, 16, 30, 0
+};
+static uint16_t genpoly_5_10[11] = {
+    24, 0, 2, 16, 21, 9, 10, 25, 0, 18, 0
+};
+static uint16_t genpoly_5_11[12] = {
+    4, 25, 14, 23, 25, 7, 1, 7, 24, 3, 2, 0
+};
+static uint16_t genpoly_5_12[13] = {
+    16, 9, 12, 8, 5, 15, 3, 2, 10, 0, 22, 6, 0
+};
+static uint16_t genpoly_5_13[14] = {
+    29, 12, 18, 28, 12, 17, 2, 26, 27, 8, 10, 17, 28, 0
+};
+static uint16_t genpoly_5_14[15] = {
+    12, 24, 20, 2, 0, 23, 3, 24, 19, 24, 17, 4, 7, 27, 0
+};
+static uint16_t genpoly_5_15[16] = {
+    27, 18, 12, 15, 16, 22, 20, 5, 28, 27, 13, 22, 5, 17, 7, 0
+};
+static uint16_t genpoly_5_16[17] = {
+    12, 18, 22, 23, 14, 23, 4, 7, 25, 21, 1, 3, 8, 0, 13, 23, 
+    0
+};
+static uint16_t genpoly_5_17[18] = {
+    29, 24, 12, 23, 12, 11, 26, 12, 17, 8, 16, 12, 10, 24, 17, 19, 
+    13, 0
+};
+static uint16_t genpoly_5_18[19] = {
+    16, 12, 20, 15, 14, 11, 16, 5, 24, 2, 5, 29, 21, 28, 12, 25, 
+    11, 15, 0
+};
+static uint16_t genpoly_5_19[20] = {
+    4, 9, 18, 2, 16, 23, 26, 5, 27, 19, 9, 28, 17, 18, 26, 30, 
+    27, 23, 25, 0
+};
+static uint16_t genpoly_5_20[21] = {
+    24, 25, 12, 28, 0, 22, 4, 12, 24, 19, 23, 29, 13, 11, 13, 10, 
+    29, 5, 30, 22, 0
+};
+static uint16_t genpoly_5_21[22] = {
+    14, 0, 14, 8, 12, 23, 20, 7, 17, 2, 9, 29, 0, 24, 23, 14, 
+    26, 24, 29, 13, 8, 0
+};
+static uint16_t genpoly_5_22[23] = {
+    5, 3, 2, 23, 5, 17, 3, 5, 25, 8, 5, 28, 13, 24, 18, 6, 
+    12, 3, 30, 25, 12, 21, 0
+};
+static uint16_t genpoly_5_23[24] = {
+    28, 30, 10, 16, 25, 15, 2, 24, 28, 21, 16, 29, 17, 11, 23, 6, 
+    9, 25, 14, 0, 29, 30, 26, 0
+};
+static uint16_t genpoly_5_24[25] = {
+    21, 25, 9, 27, 21, 7, 3, 26, 19, 27, 1, 12, 21, 18, 13, 14, 
+    12, 25, 8, 18, 7, 19, 7, 29, 0
+};
+static uint16_t genpoly_5_25[26] = {
+    15, 24, 10, 1, 7, 9, 1, 2, 27, 24, 13, 3, 10, 28, 26, 10, 
+    26, 3, 14, 18, 0, 3, 2, 16, 4, 0
+};
+static uint16_t genpoly_5_26[27] = {
+    10, 25, 16, 9, 19, 2, 10, 7, 10, 8, 17, 22, 8, 24, 12, 30, 
+    29, 24, 30, 0, 7, 3, 24, 18, 29, 11, 0
+};
+static uint16_t genpoly_5_27[28] = {
+    6, 29, 26, 24, 5, 23, 12, 25, 24, 0, 10, 4, 5, 0, 17, 25, 
+    27, 5, 29, 25, 29, 19, 2, 18, 9, 14, 20, 0
+};
+static uint16_t genpoly_5_28[29] = {
+    3, 14, 19, 23, 9, 29, 22, 16, 0, 3, 22, 17, 7, 17, 13, 19, 
+    11, 23, 30, 13, 12, 30, 7, 16, 29, 14, 12, 9, 0
+};
+static uint16_t genpoly_5_29[30] = {
+    1, 19, 12, 24, 16, 10, 5, 3, 30, 18, 2, 6, 28, 27, 7, 23, 
+    13, 15, 25, 22, 8, 21, 26, 29, 4, 11, 20, 9, 17, 0
+};
+static uint16_t genpoly_5_30[31] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const struct rs_control rs_codecs_5[31] = {
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_0, .nroots = 0, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_1, .nroots = 1, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_2, .nroots = 2, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_3, .nroots = 3, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_4, .nroots = 4, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_5, .nroots = 5, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_6, .nroots = 6, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_7, .nroots = 7, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_8, .nroots = 8, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_9, .nroots = 9, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_10, .nroots = 10, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_11, .nroots = 11, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_12, .nroots = 12, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_13, .nroots = 13, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_14, .nroots = 14, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_15, .nroots = 15, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_16, .nroots = 16, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_17, .nroots = 17, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_18, .nroots = 18, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_19, .nroots = 19, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_20, .nroots = 20, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_21, .nroots = 21, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_22, .nroots = 22, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_23, .nroots = 23, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_24, .nroots = 24, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_25, .nroots = 25, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_26, .nroots = 26, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_27, .nroots = 27, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_28, .nroots = 28, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_29, .nroots = 29, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+    { .mm = 5, .nn = 31, .alpha_to = alpha_to_5, .index_of = index_of_5, .genpoly = genpoly_5_30, .nroots = 30, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 5 },
+};
+
+// symbol size 6
+static uint16_t alpha_to_6[64] = {
+    1, 2, 4, 8, 16, 32, 3, 6, 12, 24, 48, 35, 5, 10, 20, 40, 
+    19, 38, 15, 30, 60, 59, 53, 41, 17, 34, 7, 14, 28, 56, 51, 37, 
+    9, 18, 36, 11, 22, 44, 27, 54, 47, 29, 58, 55, 45, 25, 50, 39, 
+    13, 26, 52, 43, 21, 42, 23, 46, 31, 62, 63, 61, 57, 49, 33, 0
+};
+static uint16_t index_of_6[64] = {
+    63, 0, 1, 6, 2, 12, 7, 26, 3, 32, 13, 35, 8, 48, 27, 18, 
+    4, 24, 33, 16, 14, 52, 36, 54, 9, 45, 49, 38, 28, 41, 19, 56, 
+    5, 62, 25, 11, 34, 31, 17, 47, 15, 23, 53, 51, 37, 44, 55, 40, 
+    10, 61, 46, 30, 50, 22, 39, 43, 29, 60, 42, 21, 20, 59, 57, 58
+};
+static uint16_t genpoly_6_0[1] = {
+    0
+};
+static uint16_t genpoly_6_1[2] = {
+    1, 0
+};
+static uint16_t genpoly_6_2[3] = {
+    3, 7, 0
+};
+static uint16_t genpoly_6_3[4] = {
+    6, 29, 27, 0
+};
+static uint16_t genpoly_6_4[5] = {
+    10, 24, 41, 19, 0
+};
+static uint16_t genpoly_6_5[6] = {
+    15, 3, 11, 8, 57, 0
+};
+static uint16_t genpoly_6_6[7] = {
+    21, 10, 55, 43, 48, 59, 0
+};
+static uint16_t genpoly_6_7[8] = {
+    28, 41, 24, 49, 45, 12, 21, 0
+};
+static uint16_t genpoly_6_8[9] = {
+    36, 7, 14, 40, 10, 31, 59, 43, 0
+};
+static uint16_t genpoly_6_9[10] = {
+    45, 12, 40, 27, 61, 56, 12, 15, 40, 0
+};
+static uint16_t genpoly_6_10[11] = {
+    55, 37, 61, 6, 1, 60, 53, 47, 28, 56, 0
+};
+static uint16_t genpoly_6_11[12] = {
+    3, 11, 50, 54, 7, 27, 21, 52, 24, 8, 20, 0
+};
+static uint16_t genpoly_6_12[13] = {
+    15, 62, 1, 20, 32, 10, 28, 60, 6, 44, 12, 60, 0
+};
+static uint16_t genpoly_6_13[14] = {
+    28, 44, 22, 4, 31, 5, 44, 37, 47, 59, 18, 22, 30, 0
+};
+static uint16_t genpoly_6_14[15] = {
+    42, 11, 21, 42, 32, 21, 56, 7, 41, 54, 50, 45, 9, 47, 0
+};
+static uint16_t genpoly_6_15[16] = {
+    57, 59, 22, 12, 41, 56, 43, 53, 45, 19, 16, 48, 3, 60, 18, 0
+};
+static uint16_t genpoly_6_16[17] = {
+    10, 21, 17, 23, 21, 12, 25, 50, 38, 33, 54, 24, 16, 1, 41, 28, 
+    0
+};
+static uint16_t genpoly_6_17[18] = {
+    27, 51, 56, 32, 46, 6, 58, 46, 49, 40, 19, 13, 6, 28, 59, 2, 
+    42, 0
+};
+static uint16_t genpoly_6_18[19] = {
+    45, 48, 3, 51, 35, 11, 32, 59, 25, 31, 6, 21, 38, 61, 3, 0, 
+    59, 22, 0
+};
+static uint16_t genpoly_6_19[20] = {
+    1, 32, 29, 27, 20, 29, 3, 62, 4, 36, 26, 37, 12, 59, 2, 36, 
+    23, 5, 51, 0
+};
+static uint16_t genpoly_6_20[21] = {
+    21, 54, 16, 56, 62, 17, 24, 36, 10, 18, 34, 60, 31, 36, 3, 38, 
+    62, 35, 37, 54, 0
+};
+static uint16_t genpoly_6_21[22] = {
+    42, 57, 21, 26, 11, 42, 58, 40, 30, 7, 62, 51, 37, 38, 26, 22, 
+    47, 57, 50, 23, 37, 0
+};
+static uint16_t genpoly_6_22[23] = {
+    1, 23, 32, 39, 52, 62, 28, 19, 42, 35, 59, 24, 36, 52, 36, 53, 
+    39, 50, 17, 44, 14, 45, 0
+};
+static uint16_t genpoly_6_23[24] = {
+    24, 10, 26, 15, 30, 5, 13, 17, 49, 12, 52, 49, 37, 16, 15, 28, 
+    35, 7, 38, 39, 0, 50, 10, 0
+};
+static uint16_t genpoly_6_24[25] = {
+    48, 22, 2, 61, 58, 35, 8, 54, 36, 8, 18, 31, 51, 6, 31, 59, 
+    62, 55, 47, 49, 47, 25, 4, 62, 0
+};
+static uint16_t genpoly_6_25[26] = {
+    10, 53, 21, 44, 48, 7, 45, 56, 17, 2, 21, 4, 40, 27, 28, 19, 
+    37, 26, 39, 2, 1, 16, 49, 0, 6, 0
+};
+static uint16_t genpoly_6_26[27] = {
+    36, 11, 48, 59, 27, 56, 13, 26, 15, 42, 11, 3, 9, 12, 45, 12, 
+    56, 60, 6, 53, 13, 29, 36, 41, 3, 2, 0
+};
+static uint16_t genpoly_6_27[28] = {
+    0, 48, 17, 34, 53, 46, 10, 5, 59, 51, 62, 4, 19, 55, 41, 40, 
+    60, 27, 51, 31, 12, 52, 60, 39, 55, 10, 13, 0
+};
+static uint16_t genpoly_6_28[29] = {
+    28, 35, 14, 26, 51, 32, 23, 25, 61, 55, 31, 15, 43, 25, 44, 59, 
+    48, 54, 41, 36, 13, 11, 43, 23, 13, 22, 44, 36, 0
+};
+static uint16_t genpoly_6_29[30] = {
+    57, 19, 20, 42, 62, 49, 28, 57, 37, 13, 54, 3, 10, 5, 33, 18, 
+    23, 61, 24, 45, 37, 31, 21, 25, 16, 62, 12, 23, 55, 0
+};
+static uint16_t genpoly_6_30[31] = {
+    24, 34, 53, 34, 1, 46, 31, 48, 55, 38, 61, 12, 47, 21, 62, 56, 
+    31, 22, 17, 14, 32, 41, 27, 52, 4, 51, 38, 40, 28, 41, 0
+};
+static uint16_t genpoly_6_31[32] = {
+    55, 52, 56, 55, 44, 36, 16, 39, 34, 44, 11, 7, 44, 46, 3, 10, 
+    57, 18, 29, 58, 52, 24, 25, 46, 19, 27, 15, 54, 33, 2, 29, 0
+};
+static uint16_t genpoly_6_32[33] = {
+    24, 52, 43, 27, 34, 48, 38, 56, 57, 55, 49, 52, 8, 12, 60, 46, 
+    43, 13, 57, 39, 2, 13, 40, 13, 45, 11, 23, 0, 16, 39, 22, 61, 
+    0
+};
+static uint16_t genpoly_6_33[34] = {
+    57, 34, 56, 27, 19, 51, 0, 28, 24, 28, 10, 40, 3, 52, 39, 53, 
+    29, 12, 2, 17, 59, 39, 42, 41, 25, 50, 20, 21, 38, 35, 9, 4, 
+    11, 0
+};
+static uint16_t genpoly_6_34[35] = {
+    28, 19, 53, 55, 34, 51, 18, 5, 11, 10, 61, 16, 6, 62, 31, 47, 
+    51, 13, 16, 40, 52, 48, 20, 58, 5, 45, 11, 33, 11, 9, 20, 6, 
+    32, 26, 0
+};
+static uint16_t genpoly_6_35[36] = {
+    0, 35, 20, 34, 44, 48, 0, 5, 33, 42, 25, 49, 27, 47, 23, 21, 
+    27, 17, 62, 36, 57, 23, 11, 18, 4, 7, 51, 6, 5, 27, 39, 62, 
+    16, 29, 8, 0
+};
+static uint16_t genpoly_6_36[37] = {
+    36, 48, 14, 42, 1, 36, 38, 28, 11, 42, 35, 54, 38, 46, 49, 54, 
+    42, 34, 44, 60, 31, 6, 27, 50, 5, 47, 54, 24, 19, 62, 35, 59, 
+    50, 54, 52, 49, 0
+};
+static uint16_t genpoly_6_37[38] = {
+    10, 11, 17, 26, 62, 46, 16, 56, 24, 10, 25, 54, 33, 47, 38, 7, 
+    2, 39, 51, 32, 45, 33, 0, 56, 27, 38, 21, 17, 27, 3, 60, 45, 
+    37, 15, 4, 20, 39, 0
+};
+static uint16_t genpoly_6_38[39] = {
+    48, 53, 48, 34, 51, 49, 31, 39, 57, 28, 61, 49, 38, 47, 44, 1, 
+    23, 4, 61, 44, 22, 52, 32, 34, 38, 2, 17, 52, 25, 16, 6, 12, 
+    28, 7, 33, 40, 15, 44, 0
+};
+static uint16_t genpoly_6_39[40] = {
+    24, 22, 21, 59, 53, 32, 28, 48, 34, 55, 10, 16, 27, 46, 38, 1, 
+    11, 19, 20, 48, 28, 23, 45, 60, 10, 7, 38, 42, 54, 8, 13, 15, 
+    52, 55, 19, 0, 29, 14, 38, 0
+};
+static uint16_t genpoly_6_40[41] = {
+    1, 10, 2, 44, 27, 46, 23, 57, 55, 44, 49, 40, 6, 47, 49, 7, 
+    23, 19, 47, 19, 44, 41, 28, 22, 48, 54, 55, 12, 56, 49, 17, 34, 
+    4, 28, 16, 61, 1, 40, 20, 50, 0
+};
+static uint16_t genpoly_6_41[42] = {
+    42, 23, 26, 61, 48, 56, 10, 25, 37, 38, 11, 52, 3, 62, 23, 54, 
+    2, 4, 20, 19, 51, 30, 19, 41, 46, 2, 12, 2, 62, 24, 31, 11, 
+    59, 16, 25, 31, 35, 48, 19, 5, 23, 0
+};
+static uint16_t genpoly_6_42[43] = {
+    21, 57, 32, 15, 58, 7, 13, 5, 61, 13, 61, 7, 8, 52, 31, 21, 
+    42, 39, 61, 48, 44, 30, 1, 25, 58, 56, 16, 15, 45, 23, 62, 18, 
+    29, 1, 6, 33, 61, 12, 20, 60, 34, 16, 0
+};
+static uint16_t genpoly_6_43[44] = {
+    1, 54, 21, 39, 30, 35, 45, 26, 59, 55, 54, 12, 44, 12, 39, 47, 
+    27, 34, 51, 44, 28, 41, 19, 25, 60, 23, 25, 37, 13, 24, 16, 4, 
+    54, 52, 9, 32, 18, 56, 2, 16, 44, 45, 34, 0
+};
+static uint16_t genpoly_6_44[45] = {
+    45, 32, 16, 26, 52, 5, 8, 56, 15, 51, 31, 3, 47, 46, 60, 53, 
+    51, 17, 44, 32, 22, 23, 28, 41, 58, 23, 53, 44, 33, 53, 15, 19, 
+    38, 12, 58, 33, 15, 11, 44, 59, 61, 53, 61, 32, 0
+};
+static uint16_t genpoly_6_45[46] = {
+    27, 48, 29, 56, 11, 62, 13, 54, 17, 42, 62, 15, 10, 21, 3, 46, 
+    29, 13, 62, 60, 45, 52, 45, 22, 46, 56, 25, 44, 12, 45, 16, 53, 
+    25, 31, 53, 54, 51, 43, 34, 10, 13, 42, 41, 31, 4, 0
+};
+static uint16_t genpoly_6_46[47] = {
+    10, 51, 3, 27, 62, 42, 28, 17, 36, 2, 11, 4, 43, 5, 62, 10, 
+    43, 12, 16, 36, 31, 33, 32, 60, 48, 2, 16, 37, 33, 45, 29, 12, 
+    17, 39, 30, 7, 30, 37, 24, 21, 48, 15, 51, 32, 24, 25, 0
+};
+static uint16_t genpoly_6_47[48] = {
+    57, 21, 56, 51, 20, 17, 58, 19, 49, 8, 21, 3, 19, 25, 33, 56, 
+    57, 13, 2, 40, 57, 6, 0, 34, 10, 54, 12, 15, 13, 53, 16, 12, 
+    26, 18, 25, 34, 33, 3, 5, 61, 46, 37, 11, 29, 12, 32, 12, 0
+};
+static uint16_t genpoly_6_48[49] = {
+    42, 59, 17, 32, 35, 29, 24, 40, 42, 12, 18, 4, 9, 55, 44, 18, 
+    31, 18, 57, 17, 52, 23, 27, 56, 38, 7, 55, 2, 45, 24, 15, 53, 
+    17, 18, 58, 20, 51, 60, 25, 33, 14, 26, 24, 43, 0, 11, 10, 3, 
+    0
+};
+static uint16_t genpoly_6_49[50] = {
+    28, 11, 22, 23, 46, 11, 3, 36, 30, 35, 52, 31, 40, 12, 41, 59, 
+    23, 22, 29, 39, 59, 48, 11, 50, 27, 2, 38, 12, 62, 23, 16, 19, 
+    25, 39, 25, 20, 4, 45, 49, 20, 16, 24, 43, 23, 44, 29, 19, 31, 
+    33, 0
+};
+static uint16_t genpoly_6_50[51] = {
+    15, 44, 21, 12, 21, 6, 32, 62, 10, 7, 59, 49, 51, 27, 45, 40, 
+    48, 61, 17, 58, 2, 39, 20, 18, 5, 38, 17, 42, 56, 24, 62, 4, 
+    38, 31, 30, 34, 51, 45, 18, 28, 50, 10, 25, 26, 8, 57, 21, 24, 
+    45, 17, 0
+};
+static uint16_t genpoly_6_51[52] = {
+    3, 62, 22, 42, 41, 12, 58, 59, 4, 18, 62, 24, 37, 6, 28, 12, 
+    60, 54, 24, 14, 52, 13, 42, 58, 4, 47, 21, 52, 54, 49, 31, 18, 
+    54, 12, 53, 7, 33, 60, 49, 28, 26, 12, 42, 39, 42, 52, 17, 57, 
+    6, 60, 48, 0
+};
+static uint16_t genpoly_6_52[53] = {
+    55, 11, 1, 4, 32, 56, 25, 46, 25, 36, 34, 51, 36, 16, 31, 19, 
+    56, 27, 41, 45, 32, 24, 40, 41, 5, 7, 54, 17, 25, 8, 17, 11, 
+    29, 52, 58, 54, 30, 3, 25, 20, 50, 12, 5, 17, 16, 47, 36, 14, 
+    0, 45, 52, 9, 0
+};
+static uint16_t genpoly_6_53[54] = {
+    45, 37, 50, 20, 31, 21, 43, 50, 49, 31, 26, 60, 37, 52, 15, 59, 
+    37, 60, 51, 36, 37, 41, 25, 13, 25, 45, 51, 24, 27, 16, 13, 34, 
+    59, 1, 9, 33, 51, 37, 5, 33, 16, 10, 42, 17, 31, 58, 5, 7, 
+    57, 13, 11, 50, 46, 0
+};
+static uint16_t genpoly_6_54[55] = {
+    36, 12, 61, 54, 32, 5, 56, 53, 38, 40, 6, 37, 31, 38, 36, 28, 
+    62, 26, 6, 31, 13, 31, 27, 46, 45, 50, 11, 6, 19, 3, 6, 15, 
+    4, 16, 6, 32, 15, 43, 24, 61, 14, 24, 25, 39, 16, 58, 1, 24, 
+    35, 55, 27, 57, 9, 31, 0
+};
+static uint16_t genpoly_6_55[56] = {
+    28, 7, 40, 6, 7, 10, 44, 7, 45, 33, 19, 21, 12, 36, 26, 53, 
+    35, 55, 39, 53, 12, 11, 21, 52, 19, 11, 20, 33, 5, 62, 60, 12, 
+    52, 28, 25, 33, 18, 11, 34, 21, 46, 26, 43, 26, 42, 47, 5, 24, 
+    56, 37, 10, 14, 20, 61, 35, 0
+};
+static uint16_t genpoly_6_56[57] = {
+    21, 41, 14, 27, 1, 27, 28, 37, 41, 19, 54, 13, 38, 59, 3, 22, 
+    39, 7, 47, 2, 13, 52, 43, 25, 4, 27, 23, 21, 11, 27, 35, 45, 
+    28, 55, 16, 31, 61, 56, 44, 10, 48, 37, 24, 23, 8, 52, 36, 7, 
+    35, 37, 34, 39, 19, 51, 44, 14, 0
+};
+static uint16_t genpoly_6_57[58] = {
+    15, 10, 24, 40, 61, 60, 21, 60, 47, 54, 16, 24, 6, 61, 2, 38, 
+    47, 50, 38, 49, 1, 29, 60, 23, 16, 51, 15, 0, 38, 9, 39, 59, 
+    37, 7, 19, 61, 35, 12, 2, 59, 13, 15, 11, 43, 44, 57, 17, 14, 
+    57, 55, 10, 39, 20, 26, 10, 62, 53, 0
+};
+static uint16_t genpoly_6_58[59] = {
+    10, 3, 55, 49, 10, 56, 53, 52, 6, 59, 50, 48, 16, 28, 3, 36, 
+    62, 57, 17, 39, 47, 16, 36, 39, 13, 62, 38, 54, 16, 35, 20, 62, 
+    50, 15, 33, 0, 1, 48, 20, 16, 61, 42, 51, 29, 0, 29, 21, 57, 
+    0, 13, 27, 14, 19, 26, 47, 27, 37, 52, 0
+};
+static uint16_t genpoly_6_59[60] = {
+    6, 24, 11, 43, 45, 31, 12, 47, 24, 44, 18, 45, 3, 1, 59, 0, 
+    23, 35, 50, 44, 0, 25, 49, 41, 55, 22, 12, 40, 33, 39, 9, 6, 
+    16, 54, 4, 40, 29, 40, 19, 60, 44, 53, 41, 32, 12, 11, 19, 24, 
+    6, 45, 11, 57, 20, 51, 10, 27, 28, 62, 15, 0
+};
+static uint16_t genpoly_6_60[61] = {
+    3, 29, 41, 8, 48, 12, 59, 15, 28, 8, 12, 22, 9, 60, 41, 2, 
+    59, 5, 37, 23, 14, 50, 4, 0, 3, 10, 44, 23, 28, 2, 22, 4, 
+    32, 29, 52, 20, 15, 14, 20, 5, 34, 45, 61, 31, 24, 32, 10, 31, 
+    45, 60, 52, 50, 9, 61, 44, 62, 37, 62, 34, 24, 0
+};
+static uint16_t genpoly_6_61[62] = {
+    1, 7, 27, 19, 57, 59, 21, 43, 40, 56, 20, 60, 30, 47, 18, 28, 
+    42, 22, 51, 54, 37, 45, 10, 62, 6, 2, 13, 36, 55, 41, 29, 61, 
+    11, 26, 8, 49, 39, 44, 38, 50, 23, 16, 34, 32, 4, 25, 12, 3, 
+    33, 17, 48, 9, 46, 31, 35, 14, 53, 52, 15, 24, 5, 0
+};
+static uint16_t genpoly_6_62[63] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const struct rs_control rs_codecs_6[63] = {
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_0, .nroots = 0, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_1, .nroots = 1, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_2, .nroots = 2, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_3, .nroots = 3, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_4, .nroots = 4, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_5, .nroots = 5, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_6, .nroots = 6, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_7, .nroots = 7, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_8, .nroots = 8, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_9, .nroots = 9, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_10, .nroots = 10, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_11, .nroots = 11, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_12, .nroots = 12, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_13, .nroots = 13, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_14, .nroots = 14, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_15, .nroots = 15, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_16, .nroots = 16, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_17, .nroots = 17, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_18, .nroots = 18, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_19, .nroots = 19, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_20, .nroots = 20, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_21, .nroots = 21, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_22, .nroots = 22, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_23, .nroots = 23, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_24, .nroots = 24, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_25, .nroots = 25, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_26, .nroots = 26, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_27, .nroots = 27, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_28, .nroots = 28, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_29, .nroots = 29, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_30, .nroots = 30, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_31, .nroots = 31, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_32, .nroots = 32, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_33, .nroots = 33, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_34, .nroots = 34, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_35, .nroots = 35, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_36, .nroots = 36, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_37, .nroots = 37, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_38, .nroots = 38, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_39, .nroots = 39, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_40, .nroots = 40, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_41, .nroots = 41, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_42, .nroots = 42, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_43, .nroots = 43, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_44, .nroots = 44, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_45, .nroots = 45, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_46, .nroots = 46, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_47, .nroots = 47, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_48, .nroots = 48, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_49, .nroots = 49, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_50, .nroots = 50, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_51, .nroots = 51, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_52, .nroots = 52, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_53, .nroots = 53, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_54, .nroots = 54, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_55, .nroots = 55, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_56, .nroots = 56, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_57, .nroots = 57, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_58, .nroots = 58, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_59, .nroots = 59, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_60, .nroots = 60, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_61, .nroots = 61, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 6, .nn = 63, .alpha_to = alpha_to_6, .index_of = index_of_6, .genpoly = genpoly_6_62, .nroots = 62, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+};
+
+// symbol size 7
+static uint16_t alpha_to_7[128] = {
+    1, 2, 4, 8, 16, 32, 64, 3, 6, 12, 24, 48, 96, 67, 5, 10, 
+    20, 40, 80, 35, 70, 15, 30, 60, 120, 115, 101, 73, 17, 34, 68, 11, 
+    22, 44, 88, 51, 102, 79, 29, 58, 116, 107, 85, 41, 82, 39, 78, 31, 
+    62, 124, 123, 117, 105, 81, 33, 66, 7, 14, 28, 56, 112, 99, 69, 9, 
+    18, 36, 72, 19, 38, 76, 27, 54, 108, 91, 53, 106, 87, 45, 90, 55, 
+    110, 95, 61, 122, 119, 109, 89, 49, 98, 71, 13, 26, 52, 104, 83, 37, 
+    74, 23, 46, 92, 59, 118, 111, 93, 57, 114, 103, 77, 25, 50, 100, 75, 
+    21, 42, 84, 43, 86, 47, 94, 63, 126, 127, 125, 121, 113, 97, 65, 0
+};
+static uint16_t index_of_7[128] = {
+    127, 0, 1, 7, 2, 14, 8, 56, 3, 63, 15, 31, 9, 90, 57, 21, 
+    4, 28, 64, 67, 16, 112, 32, 97, 10, 108, 91, 70, 58, 38, 22, 47, 
+    5, 54, 29, 19, 65, 95, 68, 45, 17, 43, 113, 115, 33, 77, 98, 117, 
+    11, 87, 109, 35, 92, 74, 71, 79, 59, 104, 39, 100, 23, 82, 48, 119, 
+    6, 126, 55, 13, 30, 62, 20, 89, 66, 27, 96, 111, 69, 107, 46, 37, 
+    18, 53, 44, 94, 114, 42, 116, 76, 34, 86, 78, 73, 99, 103, 118, 81, 
+    12, 125, 88, 61, 110, 26, 36, 106, 93, 52, 75, 41, 72, 85, 80, 102, 
+    60, 124, 105, 25, 40, 51, 101, 84, 24, 123, 83, 50, 49, 122, 120, 121
+};
+static uint16_t genpoly_7_0[1] = {
+    0
+};
+static uint16_t genpoly_7_1[2] = {
+    1, 0
+};
+static uint16_t genpoly_7_2[3] = {
+    3, 8, 0
+};
+static uint16_t genpoly_7_3[4] = {
+    6, 59, 57, 0
+};
+static uint16_t genpoly_7_4[5] = {
+    10, 27, 73, 22, 0
+};
+static uint16_t genpoly_7_5[6] = {
+    15, 57, 67, 64, 48, 0
+};
+static uint16_t genpoly_7_6[7] = {
+    21, 7, 42, 3, 35, 120, 0
+};
+static uint16_t genpoly_7_7[8] = {
+    28, 15, 121, 107, 103, 109, 122, 0
+};
+static uint16_t genpoly_7_8[9] = {
+    36, 77, 57, 114, 8, 105, 39, 50, 0
+};
+static uint16_t genpoly_7_9[10] = {
+    45, 119, 26, 84, 49, 44, 69, 1, 84, 0
+};
+static uint16_t genpoly_7_10[11] = {
+    55, 19, 86, 71, 37, 103, 26, 49, 53, 102, 0
+};
+static uint16_t genpoly_7_11[12] = {
+    66, 8, 92, 110, 3, 70, 64, 112, 80, 50, 81, 0
+};
+static uint16_t genpoly_7_12[13] = {
+    78, 57, 119, 27, 80, 74, 69, 61, 54, 115, 67, 119, 0
+};
+static uint16_t genpoly_7_13[14] = {
+    91, 126, 98, 111, 54, 81, 3, 123, 60, 19, 62, 35, 49, 0
+};
+static uint16_t genpoly_7_14[15] = {
+    105, 86, 114, 37, 85, 2, 84, 4, 69, 99, 40, 104, 39, 123, 0
+};
+static uint16_t genpoly_7_15[16] = {
+    120, 2, 103, 82, 40, 62, 34, 114, 106, 10, 22, 111, 10, 15, 25, 0
+};
+static uint16_t genpoly_7_16[17] = {
+    9, 98, 100, 25, 39, 98, 48, 18, 43, 1, 14, 47, 98, 67, 125, 106, 
+    0
+};
+static uint16_t genpoly_7_17[18] = {
+    26, 45, 0, 80, 40, 28, 15, 90, 5, 123, 63, 97, 92, 86, 108, 10, 
+    37, 0
+};
+static uint16_t genpoly_7_18[19] = {
+    44, 72, 84, 117, 105, 39, 82, 67, 87, 95, 68, 29, 25, 90, 10, 3, 
+    78, 47, 0
+};
+static uint16_t genpoly_7_19[20] = {
+    63, 66, 87, 50, 118, 80, 69, 110, 40, 26, 16, 10, 60, 126, 117, 8, 
+    47, 64, 23, 0
+};
+static uint16_t genpoly_7_20[21] = {
+    83, 18, 14, 113, 111, 26, 43, 30, 16, 39, 7, 18, 101, 94, 86, 48, 
+    112, 93, 100, 83, 0
+};
+static uint16_t genpoly_7_21[22] = {
+    104, 6, 61, 8, 15, 114, 84, 99, 31, 110, 115, 104, 77, 103, 22, 112, 
+    120, 126, 97, 1, 51, 0
+};
+static uint16_t genpoly_7_22[23] = {
+    126, 17, 39, 45, 27, 8, 35, 3, 90, 115, 49, 75, 26, 69, 21, 38, 
+    47, 124, 120, 115, 86, 41, 0
+};
+static uint16_t genpoly_7_23[24] = {
+    22, 74, 85, 58, 99, 55, 91, 116, 29, 82, 89, 44, 32, 53, 22, 72, 
+    8, 86, 26, 46, 108, 111, 76, 0
+};
+static uint16_t genpoly_7_24[25] = {
+    46, 11, 56, 18, 26, 41, 52, 86, 56, 62, 97, 125, 42, 100, 47, 114, 
+    83, 88, 29, 120, 80, 47, 60, 117, 0
+};
+static uint16_t genpoly_7_25[26] = {
+    71, 17, 102, 98, 95, 77, 20, 29, 8, 71, 59, 115, 105, 92, 76, 121, 
+    107, 18, 13, 105, 9, 1, 105, 83, 99, 0
+};
+static uint16_t genpoly_7_26[27] = {
+    97, 47, 113, 22, 53, 24, 61, 2, 83, 28, 73, 82, 100, 33, 73, 28, 
+    119, 47, 75, 94, 126, 62, 64, 6, 70, 104, 0
+};
+static uint16_t genpoly_7_27[28] = {
+    124, 29, 99, 116, 60, 65, 91, 126, 12, 59, 113, 52, 23, 111, 97, 108, 
+    109, 15, 60, 112, 71, 8, 81, 48, 76, 31, 60, 0
+};
+static uint16_t genpoly_7_28[29] = {
+    25, 121, 19, 40, 92, 10, 70, 94, 74, 53, 82, 30, 58, 99, 113, 70, 
+    0, 70, 93, 35, 27, 18, 92, 3, 56, 102, 52, 125, 0
+};
+static uint16_t genpoly_7_29[30] = {
+    54, 37, 126, 102, 31, 57, 30, 88, 57, 3, 91, 14, 51, 22, 116, 101, 
+    104, 103, 36, 83, 92, 116, 117, 29, 26, 97, 11, 5, 13, 0
+};
+static uint16_t genpoly_7_30[31] = {
+    84, 109, 85, 125, 9, 39, 120, 91, 94, 29, 84, 66, 78, 58, 82, 20, 
+    51, 123, 112, 69, 56, 97, 4, 97, 95, 110, 49, 7, 63, 56, 0
+};
+static uint16_t genpoly_7_31[32] = {
+    115, 92, 110, 37, 112, 97, 55, 7, 50, 19, 63, 12, 83, 38, 71, 66, 
+    50, 23, 85, 98, 122, 14, 65, 64, 116, 5, 15, 125, 18, 59, 9, 0
+};
+static uint16_t genpoly_7_32[33] = {
+    20, 78, 48, 17, 106, 28, 68, 24, 48, 57, 8, 73, 111, 125, 6, 10, 
+    51, 104, 67, 26, 106, 35, 64, 80, 38, 108, 119, 46, 91, 96, 94, 91, 
+    0
+};
+static uint16_t genpoly_7_33[34] = {
+    53, 90, 14, 62, 66, 2, 106, 17, 45, 35, 26, 125, 25, 6, 73, 52, 
+    102, 85, 1, 115, 14, 126, 65, 59, 34, 10, 75, 3, 119, 22, 111, 29, 
+    71, 0
+};
+static uint16_t genpoly_7_34[35] = {
+    87, 5, 35, 37, 120, 98, 89, 64, 47, 41, 13, 25, 86, 56, 90, 1, 
+    26, 18, 118, 58, 112, 43, 38, 69, 22, 15, 113, 95, 85, 59, 46, 55, 
+    18, 80, 0
+};
+static uint16_t genpoly_7_35[36] = {
+    122, 62, 100, 81, 118, 48, 81, 70, 117, 66, 42, 35, 9, 13, 36, 41, 
+    125, 92, 74, 71, 78, 37, 105, 65, 55, 26, 14, 29, 73, 48, 106, 13, 
+    67, 50, 103, 0
+};
+static uint16_t genpoly_7_36[37] = {
+    31, 94, 27, 16, 32, 43, 28, 59, 120, 6, 64, 61, 16, 60, 117, 111, 
+    35, 61, 18, 24, 88, 0, 96, 2, 48, 56, 22, 54, 4, 33, 92, 70, 
+    22, 96, 70, 100, 0
+};
+static uint16_t genpoly_7_37[38] = {
+    68, 70, 126, 10, 34, 24, 90, 73, 49, 76, 71, 23, 109, 7, 104, 5, 
+    45, 38, 54, 35, 108, 77, 126, 60, 52, 116, 119, 2, 96, 31, 17, 123, 
+    19, 118, 56, 7, 40, 0
+};
+static uint16_t genpoly_7_38[39] = {
+    106, 119, 114, 121, 40, 38, 83, 20, 75, 17, 26, 42, 83, 112, 63, 4, 
+    78, 60, 43, 83, 4, 109, 88, 102, 122, 5, 64, 111, 56, 8, 27, 60, 
+    84, 0, 90, 5, 86, 52, 0
+};
+static uint16_t genpoly_7_39[40] = {
+    18, 72, 78, 24, 66, 86, 12, 55, 64, 85, 9, 39, 17, 1, 83, 5, 
+    119, 8, 107, 114, 94, 47, 35, 106, 79, 117, 122, 98, 80, 10, 46, 112, 
+    63, 107, 14, 81, 126, 13, 94, 0
+};
+static uint16_t genpoly_7_40[41] = {
+    58, 62, 109, 66, 47, 63, 11, 62, 50, 25, 28, 100, 92, 13, 50, 103, 
+    71, 0, 6, 2, 76, 88, 51, 4, 34, 25, 58, 107, 18, 112, 126, 82, 
+    66, 37, 72, 83, 26, 4, 6, 45, 0
+};
+static uint16_t genpoly_7_41[42] = {
+    99, 126, 123, 121, 113, 68, 12, 85, 81, 35, 119, 16, 50, 112, 86, 94, 
+    66, 103, 22, 52, 115, 94, 116, 44, 83, 4, 117, 67, 51, 74, 125, 59, 
+    60, 64, 26, 38, 52, 55, 21, 108, 69, 0
+};
+static uint16_t genpoly_7_42[43] = {
+    14, 79, 99, 47, 80, 46, 56, 125, 16, 105, 41, 19, 5, 109, 97, 42, 
+    96, 10, 37, 107, 77, 45, 34, 21, 35, 92, 8, 38, 50, 19, 126, 97, 
+    76, 97, 92, 31, 46, 120, 111, 35, 44, 108, 0
+};
+static uint16_t genpoly_7_43[44] = {
+    57, 24, 82, 53, 36, 43, 64, 72, 86, 70, 14, 98, 38, 94, 124, 83, 
+    74, 70, 101, 25, 35, 37, 15, 96, 42, 74, 126, 86, 51, 48, 101, 1, 
+    17, 16, 28, 0, 69, 17, 79, 28, 1, 113, 11, 0
+};
+static uint16_t genpoly_7_44[45] = {
+    101, 17, 104, 113, 119, 76, 11, 30, 110, 90, 56, 21, 67, 77, 59, 60, 
+    65, 125, 111, 39, 30, 72, 84, 27, 67, 31, 58, 27, 49, 126, 80, 53, 
+    125, 34, 24, 13, 115, 117, 53, 73, 71, 20, 93, 88, 0
+};
+static uint16_t genpoly_7_45[46] = {
+    19, 35, 71, 109, 26, 6, 18, 78, 42, 88, 50, 37, 91, 80, 16, 96, 
+    16, 90, 13, 23, 18, 41, 93, 70, 99, 30, 116, 60, 91, 98, 5, 6, 
+    24, 116, 16, 110, 102, 10, 0, 21, 90, 64, 101, 17, 62, 0
+};
+static uint16_t genpoly_7_46[47] = {
+    65, 49, 58, 45, 118, 9, 44, 54, 59, 116, 17, 0, 76, 73, 115, 22, 
+    21, 10, 74, 21, 98, 125, 31, 48, 111, 31, 84, 87, 93, 109, 73, 27, 
+    73, 111, 67, 71, 41, 93, 116, 64, 7, 52, 114, 121, 87, 31, 0
+};
+static uint16_t genpoly_7_47[48] = {
+    112, 80, 57, 17, 39, 86, 32, 65, 20, 118, 30, 79, 24, 43, 93, 106, 
+    59, 0, 106, 67, 81, 63, 100, 98, 74, 28, 70, 40, 105, 96, 69, 80, 
+    79, 18, 47, 107, 114, 17, 57, 38, 35, 81, 87, 119, 49, 41, 16, 0
+};
+static uint16_t genpoly_7_48[49] = {
+    33, 97, 58, 113, 108, 104, 79, 23, 1, 49, 2, 62, 73, 88, 33, 54, 
+    113, 8, 66, 69, 97, 16, 8, 10, 94, 88, 37, 123, 28, 78, 26, 46, 
+    102, 121, 51, 57, 120, 60, 78, 76, 106, 79, 86, 62, 17, 100, 123, 113, 
+    0
+};
+static uint16_t genpoly_7_49[50] = {
+    82, 21, 78, 117, 80, 49, 100, 73, 89, 33, 63, 37, 59, 13, 81, 124, 
+    64, 65, 77, 32, 102, 35, 91, 48, 9, 111, 100, 93, 114, 4, 11, 6, 
+    71, 20, 30, 64, 73, 69, 124, 100, 20, 26, 87, 64, 90, 71, 58, 96, 
+    116, 0
+};
+static uint16_t genpoly_7_50[51] = {
+    5, 31, 90, 98, 45, 109, 6, 55, 100, 82, 8, 59, 122, 87, 94, 6, 
+    95, 104, 95, 4, 26, 1, 71, 92, 8, 114, 84, 117, 45, 51, 25, 79, 
+    119, 77, 17, 4, 41, 110, 94, 107, 5, 28, 122, 26, 53, 105, 117, 119, 
+    60, 77, 0
+};
+static uint16_t genpoly_7_51[52] = {
+    56, 38, 57, 67, 110, 31, 23, 45, 39, 50, 14, 88, 101, 107, 125, 103, 
+    61, 92, 91, 106, 82, 9, 121, 29, 9, 70, 44, 58, 26, 66, 29, 50, 
+    22, 82, 31, 75, 65, 35, 92, 34, 96, 97, 81, 18, 99, 25, 108, 8, 
+    40, 105, 34, 0
+};
+static uint16_t genpoly_7_52[53] = {
+    108, 15, 117, 87, 5, 22, 125, 115, 82, 42, 35, 20, 56, 12, 71, 60, 
+    84, 111, 5, 28, 110, 118, 55, 5, 126, 124, 53, 71, 20, 100, 97, 107, 
+    46, 38, 89, 15, 62, 112, 70, 85, 76, 114, 76, 30, 17, 124, 81, 52, 
+    109, 11, 115, 87, 0
+};
+static uint16_t genpoly_7_53[54] = {
+    34, 119, 19, 72, 77, 96, 41, 15, 77, 10, 79, 93, 40, 19, 28, 58, 
+    93, 59, 76, 121, 84, 71, 89, 118, 27, 39, 32, 5, 85, 19, 56, 100, 
+    28, 114, 97, 125, 54, 34, 72, 115, 52, 19, 18, 77, 81, 94, 105, 77, 
+    78, 5, 73, 93, 12, 0
+};
+static uint16_t genpoly_7_54[55] = {
+    88, 32, 110, 88, 49, 28, 102, 45, 91, 119, 34, 124, 100, 117, 22, 2, 
+    78, 55, 11, 52, 37, 32, 29, 12, 0, 54, 61, 98, 6, 71, 89, 46, 
+    8, 83, 33, 120, 24, 13, 108, 104, 69, 109, 37, 6, 115, 18, 62, 88, 
+    90, 88, 54, 38, 5, 126, 0
+};
+static uint16_t genpoly_7_55[56] = {
+    16, 94, 31, 60, 73, 8, 42, 114, 2, 14, 24, 87, 12, 58, 1, 4, 
+    30, 48, 15, 122, 103, 120, 125, 87, 29, 35, 84, 8, 107, 0, 22, 87, 
+    89, 71, 10, 64, 27, 118, 95, 21, 66, 7, 8, 33, 52, 60, 121, 53, 
+    109, 108, 18, 27, 85, 0, 7, 0
+};
+static uint16_t genpoly_7_56[57] = {
+    72, 17, 88, 103, 40, 27, 17, 49, 66, 47, 41, 72, 97, 92, 64, 105, 
+    27, 122, 3, 121, 41, 54, 81, 51, 99, 59, 60, 26, 12, 96, 73, 15, 
+    125, 20, 120, 36, 93, 116, 68, 3, 105, 126, 28, 126, 74, 119, 31, 107, 
+    69, 122, 33, 113, 69, 75, 3, 2, 0
+};
+static uint16_t genpoly_7_57[58] = {
+    2, 86, 24, 46, 96, 7, 49, 37, 14, 124, 87, 102, 95, 63, 111, 54, 
+    14, 5, 90, 122, 53, 5, 28, 20, 76, 15, 97, 15, 43, 14, 55, 79, 
+    66, 69, 82, 32, 78, 68, 79, 116, 100, 51, 33, 32, 53, 27, 103, 30, 
+    9, 95, 60, 14, 41, 72, 91, 11, 15, 0
+};
+static uint16_t genpoly_7_58[59] = {
+    60, 33, 110, 126, 56, 80, 46, 86, 19, 89, 54, 38, 15, 78, 99, 118, 
+    107, 9, 117, 99, 71, 34, 123, 111, 62, 9, 70, 69, 49, 62, 117, 78, 
+    20, 27, 21, 11, 91, 70, 48, 17, 103, 63, 102, 54, 103, 23, 28, 119, 
+    76, 52, 50, 58, 86, 61, 105, 116, 41, 32, 0
+};
+static uint16_t genpoly_7_59[60] = {
+    119, 30, 123, 24, 75, 106, 58, 22, 7, 33, 85, 71, 17, 64, 53, 45, 
+    110, 41, 60, 65, 114, 118, 91, 18, 92, 61, 3, 108, 42, 7, 104, 79, 
+    85, 47, 45, 16, 9, 22, 116, 52, 70, 5, 53, 62, 64, 12, 90, 110, 
+    104, 58, 73, 114, 69, 45, 33, 69, 85, 124, 98, 0
+};
+static uint16_t genpoly_7_60[61] = {
+    52, 109, 13, 57, 120, 18, 104, 54, 90, 41, 49, 122, 70, 86, 59, 19, 
+    57, 64, 112, 28, 100, 54, 68, 6, 19, 111, 75, 61, 101, 20, 69, 86, 
+    106, 5, 85, 60, 34, 87, 88, 13, 125, 119, 15, 33, 92, 120, 99, 65, 
+    115, 106, 99, 30, 18, 48, 37, 17, 58, 61, 83, 118, 0
+};
+static uint16_t genpoly_7_61[62] = {
+    113, 6, 56, 38, 117, 27, 107, 64, 86, 88, 21, 50, 85, 103, 45, 116, 
+    122, 102, 99, 44, 27, 4, 95, 74, 98, 2, 89, 97, 18, 43, 46, 15, 
+    77, 117, 7, 64, 42, 76, 117, 76, 50, 11, 93, 86, 27, 112, 44, 38, 
+    34, 81, 111, 20, 25, 88, 4, 112, 97, 125, 111, 67, 82, 0
+};
+static uint16_t genpoly_7_62[63] = {
+    48, 9, 22, 23, 40, 93, 58, 9, 38, 26, 10, 91, 82, 60, 4, 44, 
+    34, 109, 79, 100, 112, 0, 114, 43, 108, 23, 49, 53, 123, 29, 11, 61, 
+    75, 30, 61, 55, 115, 26, 48, 47, 55, 5, 54, 106, 22, 116, 105, 52, 
+    76, 69, 28, 101, 84, 37, 113, 21, 7, 106, 117, 37, 100, 24, 0
+};
+static uint16_t genpoly_7_63[64] = {
+    111, 44, 125, 89, 125, 116, 97, 60, 83, 78, 48, 53, 96, 30, 61, 103, 
+    62, 121, 59, 53, 14, 58, 83, 35, 50, 6, 43, 113, 52, 107, 97, 126, 
+    94, 1, 74, 82, 79, 72, 98, 78, 126, 110, 21, 40, 15, 84, 82, 86, 
+    63, 84, 116, 118, 11, 69, 35, 103, 16, 116, 71, 16, 43, 15, 124, 0
+};
+static uint16_t genpoly_7_64[65] = {
+    48, 44, 97, 2, 1, 11, 57, 36, 71, 60, 37, 28, 122, 108, 95, 97, 
+    58, 86, 8, 97, 31, 24, 78, 68, 106, 12, 90, 44, 49, 100, 112, 22, 
+    96, 84, 109, 32, 43, 100, 81, 65, 94, 118, 63, 71, 13, 14, 114, 0, 
+    34, 8, 68, 16, 92, 60, 4, 89, 35, 62, 18, 34, 86, 22, 52, 61, 
+    0
+};
+static uint16_t genpoly_7_65[66] = {
+    113, 9, 125, 2, 69, 42, 107, 24, 75, 76, 47, 45, 125, 35, 74, 32, 
+    80, 110, 1, 74, 103, 69, 72, 91, 40, 96, 124, 119, 8, 125, 6, 65, 
+    20, 114, 93, 95, 21, 92, 10, 76, 109, 114, 99, 14, 72, 40, 72, 60, 
+    103, 7, 20, 123, 18, 42, 23, 86, 49, 109, 119, 9, 5, 93, 87, 17, 
+    89, 0
+};
+static uint16_t genpoly_7_66[67] = {
+    52, 6, 22, 89, 1, 42, 70, 6, 122, 12, 122, 114, 74, 97, 60, 70, 
+    74, 64, 84, 126, 12, 73, 49, 17, 122, 89, 13, 85, 15, 16, 90, 18, 
+    122, 97, 55, 11, 16, 2, 61, 64, 52, 61, 27, 109, 74, 31, 30, 77, 
+    95, 8, 78, 7, 57, 27, 64, 37, 105, 55, 98, 42, 39, 71, 90, 111, 
+    104, 21, 0
+};
+static uint16_t genpoly_7_67[68] = {
+    119, 109, 56, 23, 125, 11, 107, 6, 14, 96, 95, 99, 53, 83, 32, 93, 
+    22, 95, 75, 119, 101, 19, 90, 31, 85, 81, 43, 11, 18, 60, 18, 12, 
+    112, 109, 75, 10, 96, 34, 8, 25, 77, 41, 11, 74, 79, 70, 58, 72, 
+    22, 37, 116, 102, 105, 103, 86, 115, 93, 21, 81, 58, 109, 15, 105, 24, 
+    108, 73, 58, 0
+};
+static uint16_t genpoly_7_68[69] = {
+    60, 30, 13, 38, 40, 116, 57, 24, 122, 96, 33, 53, 19, 43, 126, 46, 
+    26, 24, 87, 91, 75, 89, 17, 53, 80, 25, 16, 22, 52, 44, 43, 48, 
+    87, 80, 68, 11, 76, 95, 21, 80, 19, 47, 99, 39, 25, 56, 78, 81, 
+    125, 72, 126, 121, 54, 5, 16, 118, 25, 117, 28, 22, 106, 66, 30, 20, 
+    2, 58, 91, 39, 0
+};
+static uint16_t genpoly_7_69[70] = {
+    2, 33, 123, 57, 117, 93, 97, 36, 75, 12, 95, 53, 35, 71, 21, 75, 
+    41, 90, 78, 38, 109, 125, 22, 42, 37, 82, 22, 57, 125, 13, 89, 8, 
+    58, 117, 101, 66, 12, 10, 17, 28, 9, 51, 40, 62, 52, 64, 126, 36, 
+    69, 110, 96, 66, 8, 16, 107, 110, 90, 111, 59, 31, 5, 125, 16, 7, 
+    60, 14, 11, 7, 101, 0
+};
+static uint16_t genpoly_7_70[71] = {
+    72, 86, 110, 24, 120, 27, 58, 60, 71, 76, 122, 99, 19, 71, 33, 81, 
+    54, 89, 1, 13, 40, 16, 42, 31, 10, 23, 63, 47, 17, 70, 42, 38, 
+    2, 72, 122, 83, 51, 57, 43, 8, 68, 25, 28, 114, 59, 75, 118, 68, 
+    8, 38, 118, 20, 64, 81, 102, 58, 66, 33, 37, 46, 125, 8, 59, 104, 
+    31, 56, 78, 38, 53, 85, 0
+};
+static uint16_t genpoly_7_71[72] = {
+    16, 17, 24, 126, 75, 18, 107, 9, 83, 60, 47, 114, 53, 43, 21, 81, 
+    48, 90, 115, 51, 3, 62, 48, 39, 114, 111, 119, 76, 122, 77, 87, 106, 
+    20, 4, 65, 92, 56, 84, 78, 22, 36, 72, 117, 90, 99, 70, 117, 48, 
+    28, 92, 34, 30, 6, 125, 28, 41, 2, 124, 74, 12, 1, 116, 57, 8, 
+    116, 15, 108, 93, 72, 25, 73, 0
+};
+static uint16_t genpoly_7_72[73] = {
+    88, 94, 88, 46, 56, 106, 104, 64, 38, 78, 37, 45, 74, 83, 126, 75, 
+    54, 90, 122, 44, 47, 31, 100, 51, 1, 94, 86, 11, 30, 61, 100, 30, 
+    94, 28, 3, 41, 71, 95, 111, 63, 56, 46, 43, 58, 81, 116, 118, 53, 
+    14, 118, 94, 79, 22, 73, 78, 100, 118, 66, 44, 55, 100, 125, 44, 12, 
+    26, 106, 73, 2, 6, 50, 19, 79, 0
+};
+static uint16_t genpoly_7_73[74] = {
+    34, 32, 31, 103, 96, 80, 58, 54, 86, 26, 48, 28, 125, 97, 32, 46, 
+    41, 89, 115, 44, 33, 68, 62, 96, 6, 101, 62, 98, 85, 89, 77, 36, 
+    11, 95, 20, 99, 13, 103, 115, 89, 90, 59, 10, 104, 42, 91, 30, 47, 
+    12, 97, 113, 5, 64, 82, 19, 16, 43, 48, 106, 18, 9, 90, 46, 119, 
+    23, 9, 30, 87, 35, 104, 37, 18, 72, 0
+};
+static uint16_t genpoly_7_74[75] = {
+    108, 119, 110, 60, 40, 7, 46, 22, 90, 88, 10, 53, 122, 35, 60, 93, 
+    26, 90, 1, 51, 47, 68, 113, 72, 65, 120, 83, 88, 59, 31, 119, 27, 
+    31, 26, 101, 3, 85, 59, 10, 107, 3, 107, 37, 85, 102, 66, 19, 100, 
+    20, 109, 106, 38, 4, 11, 42, 98, 100, 114, 102, 94, 113, 13, 25, 8, 
+    17, 20, 74, 58, 7, 20, 105, 50, 25, 86, 0
+};
+static uint16_t genpoly_7_75[76] = {
+    56, 15, 19, 88, 73, 27, 49, 86, 7, 41, 21, 91, 96, 108, 74, 70, 
+    22, 24, 78, 13, 3, 31, 62, 72, 117, 1, 51, 58, 125, 81, 10, 18, 
+    98, 122, 108, 33, 65, 80, 42, 78, 97, 96, 34, 61, 32, 75, 70, 38, 
+    22, 66, 67, 107, 113, 27, 47, 70, 4, 120, 117, 39, 11, 66, 24, 63, 
+    109, 90, 34, 51, 54, 68, 97, 67, 6, 115, 35, 0
+};
+static uint16_t genpoly_7_76[77] = {
+    5, 38, 117, 72, 49, 8, 17, 37, 19, 33, 49, 50, 82, 30, 95, 32, 
+    74, 95, 87, 38, 40, 62, 100, 96, 65, 1, 7, 101, 43, 95, 8, 111, 
+    37, 10, 25, 115, 43, 8, 11, 58, 16, 11, 98, 6, 83, 80, 27, 37, 
+    35, 16, 99, 16, 3, 84, 11, 23, 51, 99, 71, 2, 31, 39, 25, 10, 
+    112, 3, 52, 86, 122, 63, 93, 7, 98, 44, 12, 110, 0
+};
+static uint16_t genpoly_7_77[78] = {
+    82, 31, 57, 87, 77, 28, 42, 49, 14, 89, 85, 122, 85, 60, 61, 97, 
+    80, 64, 75, 91, 109, 16, 48, 51, 6, 120, 51, 101, 3, 57, 66, 26, 
+    47, 120, 84, 76, 42, 30, 110, 71, 40, 101, 57, 114, 72, 48, 76, 38, 
+    78, 73, 93, 92, 83, 18, 112, 31, 48, 63, 94, 0, 38, 103, 42, 55, 
+    103, 50, 9, 21, 74, 48, 5, 47, 82, 53, 112, 4, 27, 0
+};
+static uint16_t genpoly_7_78[79] = {
+    33, 21, 90, 67, 5, 96, 102, 114, 66, 124, 54, 71, 70, 103, 4, 103, 
+    58, 110, 84, 119, 75, 125, 42, 39, 1, 101, 83, 58, 43, 57, 68, 124, 
+    2, 43, 107, 48, 43, 69, 45, 83, 93, 38, 60, 113, 93, 77, 84, 0, 
+    119, 29, 63, 126, 72, 11, 86, 45, 96, 100, 98, 63, 76, 23, 19, 112, 
+    61, 81, 96, 18, 49, 40, 30, 126, 35, 77, 34, 17, 88, 67, 0
+};
+static uint16_t genpoly_7_79[80] = {
+    112, 97, 78, 98, 110, 22, 41, 45, 2, 47, 87, 38, 17, 86, 45, 44, 
+    62, 86, 1, 126, 101, 89, 22, 31, 114, 94, 62, 88, 125, 95, 66, 124, 
+    98, 123, 28, 69, 13, 68, 82, 16, 103, 89, 122, 114, 90, 96, 111, 6, 
+    79, 68, 17, 94, 104, 125, 77, 17, 108, 19, 6, 65, 10, 59, 64, 87, 
+    116, 37, 125, 103, 44, 13, 20, 22, 112, 28, 56, 64, 99, 126, 65, 0
+};
+static uint16_t genpoly_7_80[81] = {
+    65, 80, 58, 117, 45, 31, 125, 15, 91, 14, 41, 102, 15, 64, 59, 116, 
+    34, 121, 8, 74, 12, 19, 17, 42, 10, 111, 86, 98, 59, 81, 8, 26, 
+    2, 123, 12, 21, 65, 69, 112, 84, 67, 3, 77, 80, 122, 124, 34, 64, 
+    116, 59, 87, 79, 103, 61, 95, 39, 111, 62, 83, 4, 43, 24, 4, 36, 
+    122, 123, 112, 36, 33, 39, 24, 43, 39, 9, 38, 117, 50, 41, 28, 96, 
+    0
+};
+static uint16_t genpoly_7_81[82] = {
+    19, 49, 57, 113, 80, 109, 23, 115, 77, 119, 24, 72, 95, 78, 53, 19, 
+    122, 109, 59, 97, 103, 73, 90, 53, 37, 23, 119, 11, 85, 31, 10, 111, 
+    47, 43, 28, 21, 33, 10, 2, 3, 24, 110, 7, 51, 104, 45, 78, 3, 
+    63, 112, 94, 38, 104, 76, 47, 73, 22, 81, 15, 97, 125, 73, 112, 119, 
+    87, 18, 87, 39, 109, 44, 66, 63, 76, 79, 35, 115, 119, 8, 86, 75, 
+    112, 0
+};
+static uint16_t genpoly_7_82[83] = {
+    101, 35, 58, 17, 108, 49, 6, 45, 82, 10, 34, 87, 97, 63, 99, 45, 
+    57, 102, 79, 53, 31, 69, 49, 31, 80, 82, 63, 76, 30, 89, 119, 18, 
+    37, 120, 107, 69, 65, 10, 102, 52, 102, 99, 19, 13, 107, 59, 31, 79, 
+    34, 91, 52, 77, 95, 109, 94, 57, 88, 24, 66, 61, 123, 60, 66, 5, 
+    75, 15, 14, 46, 17, 25, 103, 10, 1, 21, 10, 17, 22, 109, 85, 38, 
+    123, 17, 0
+};
+static uint16_t genpoly_7_83[84] = {
+    57, 17, 71, 45, 39, 104, 100, 55, 39, 42, 79, 124, 12, 92, 111, 118, 
+    110, 64, 99, 100, 14, 24, 72, 17, 85, 25, 22, 47, 122, 61, 77, 27, 
+    98, 10, 84, 48, 13, 69, 2, 52, 51, 77, 35, 52, 96, 89, 72, 59, 
+    10, 89, 58, 62, 34, 0, 27, 4, 99, 117, 36, 12, 114, 85, 80, 113, 
+    115, 30, 38, 0, 51, 87, 111, 74, 102, 100, 106, 19, 78, 39, 86, 64, 
+    113, 55, 44, 0
+};
+static uint16_t genpoly_7_84[85] = {
+    14, 24, 104, 109, 118, 86, 79, 73, 100, 50, 35, 93, 100, 58, 64, 54, 
+    107, 41, 112, 44, 112, 58, 78, 91, 122, 81, 16, 57, 17, 77, 100, 36, 
+    31, 122, 25, 76, 43, 68, 112, 3, 102, 77, 64, 119, 59, 2, 26, 24, 
+    41, 116, 107, 119, 70, 117, 96, 115, 97, 52, 53, 33, 116, 0, 29, 51, 
+    20, 121, 104, 75, 56, 45, 97, 6, 90, 125, 109, 39, 4, 19, 67, 116, 
+    63, 96, 6, 95, 0
+};
+static uint16_t genpoly_7_85[86] = {
+    99, 79, 82, 113, 26, 9, 32, 23, 89, 82, 14, 20, 40, 117, 1, 105, 
+    14, 9, 60, 28, 27, 0, 83, 68, 40, 89, 43, 22, 125, 70, 87, 30, 
+    11, 26, 108, 115, 42, 69, 82, 84, 24, 99, 35, 119, 97, 63, 37, 76, 
+    104, 118, 105, 12, 98, 124, 57, 28, 52, 21, 86, 21, 108, 100, 42, 98, 
+    56, 124, 39, 112, 102, 21, 26, 90, 120, 84, 105, 13, 122, 43, 18, 68, 
+    86, 17, 18, 28, 66, 0
+};
+static uint16_t genpoly_7_86[87] = {
+    58, 126, 99, 53, 119, 6, 44, 65, 1, 33, 8, 88, 56, 19, 22, 4, 
+    27, 5, 117, 65, 100, 4, 114, 35, 106, 96, 13, 11, 52, 13, 42, 106, 
+    94, 95, 101, 33, 43, 30, 45, 16, 67, 110, 19, 52, 59, 63, 60, 49, 
+    118, 16, 69, 99, 80, 114, 26, 78, 54, 65, 17, 16, 58, 54, 104, 73, 
+    65, 122, 4, 9, 101, 29, 91, 108, 39, 76, 26, 98, 58, 123, 4, 108, 
+    0, 2, 28, 2, 88, 28, 0
+};
+static uint16_t genpoly_7_87[88] = {
+    18, 62, 123, 47, 36, 76, 18, 54, 20, 49, 63, 59, 101, 12, 28, 2, 
+    30, 122, 90, 99, 114, 54, 95, 43, 50, 12, 124, 85, 18, 44, 89, 38, 
+    20, 28, 20, 3, 65, 8, 110, 83, 103, 3, 7, 13, 96, 2, 37, 49, 
+    68, 7, 71, 40, 17, 73, 120, 24, 81, 44, 38, 51, 30, 108, 35, 112, 
+    17, 108, 106, 78, 102, 5, 76, 23, 34, 99, 122, 123, 120, 36, 61, 71, 
+    17, 20, 117, 116, 39, 27, 5, 0
+};
+static uint16_t genpoly_7_88[89] = {
+    106, 72, 109, 121, 80, 43, 11, 78, 59, 118, 2, 37, 122, 107, 71, 58, 
+    78, 48, 3, 122, 71, 118, 68, 74, 108, 6, 90, 119, 15, 60, 43, 8, 
+    2, 4, 3, 99, 85, 80, 11, 71, 93, 89, 77, 51, 107, 89, 26, 76, 
+    118, 7, 112, 92, 8, 60, 2, 41, 77, 121, 67, 122, 115, 3, 12, 93, 
+    106, 110, 15, 103, 94, 56, 102, 58, 126, 17, 68, 15, 68, 21, 24, 51, 
+    30, 87, 58, 1, 76, 28, 54, 55, 0
+};
+static uint16_t genpoly_7_89[90] = {
+    68, 119, 78, 66, 113, 46, 64, 30, 42, 116, 30, 62, 59, 87, 125, 60, 
+    93, 55, 15, 121, 53, 34, 91, 6, 98, 23, 43, 44, 8, 16, 18, 48, 
+    58, 72, 65, 41, 13, 59, 42, 58, 40, 38, 122, 80, 104, 59, 72, 24, 
+    104, 16, 71, 92, 19, 10, 75, 9, 53, 76, 103, 110, 18, 47, 120, 29, 
+    46, 31, 103, 98, 78, 7, 112, 43, 120, 68, 72, 47, 46, 55, 95, 100, 
+    96, 59, 84, 28, 47, 24, 14, 63, 14, 0
+};
+static uint16_t genpoly_7_90[91] = {
+    31, 70, 114, 24, 47, 68, 56, 72, 110, 88, 17, 79, 73, 13, 94, 103, 
+    84, 59, 11, 122, 41, 5, 123, 18, 19, 2, 49, 113, 49, 125, 90, 12, 
+    87, 117, 122, 92, 71, 103, 10, 78, 16, 101, 60, 114, 122, 45, 31, 59, 
+    41, 118, 69, 40, 8, 10, 14, 71, 10, 41, 47, 8, 122, 66, 26, 126, 
+    98, 87, 13, 48, 62, 107, 52, 42, 94, 51, 112, 40, 67, 22, 118, 33, 
+    7, 114, 45, 43, 63, 111, 126, 12, 11, 3, 0
+};
+static uint16_t genpoly_7_91[92] = {
+    122, 94, 126, 121, 66, 63, 12, 125, 86, 90, 50, 0, 24, 88, 81, 6, 
+    61, 111, 76, 52, 103, 54, 28, 111, 92, 111, 89, 53, 52, 100, 6, 18, 
+    112, 80, 101, 83, 56, 95, 115, 107, 97, 11, 57, 113, 90, 124, 78, 79, 
+    10, 116, 105, 99, 17, 60, 75, 71, 6, 59, 73, 13, 81, 104, 106, 93, 
+    2, 73, 3, 19, 73, 25, 86, 43, 27, 86, 29, 14, 121, 104, 19, 117, 
+    1, 86, 34, 65, 12, 61, 20, 58, 21, 61, 64, 0
+};
+static uint16_t genpoly_7_92[93] = {
+    87, 62, 27, 10, 40, 86, 11, 85, 16, 70, 56, 37, 76, 43, 33, 124, 
+    95, 92, 5, 121, 37, 120, 81, 20, 62, 61, 75, 97, 123, 107, 112, 65, 
+    122, 109, 68, 66, 51, 84, 111, 89, 3, 96, 98, 114, 93, 96, 34, 3, 
+    34, 89, 107, 12, 80, 73, 2, 9, 10, 59, 95, 43, 90, 67, 21, 50, 
+    100, 108, 120, 13, 48, 40, 8, 81, 32, 23, 68, 62, 99, 35, 105, 22, 
+    89, 84, 10, 58, 38, 14, 101, 83, 71, 75, 126, 68, 0
+};
+static uint16_t genpoly_7_93[94] = {
+    53, 5, 100, 16, 34, 38, 12, 62, 81, 105, 14, 21, 91, 73, 93, 54, 
+    64, 104, 91, 28, 84, 32, 125, 51, 76, 9, 3, 61, 18, 29, 97, 22, 
+    20, 97, 75, 11, 12, 57, 78, 63, 90, 107, 34, 6, 72, 77, 111, 64, 
+    63, 91, 58, 119, 98, 114, 120, 41, 53, 41, 73, 43, 98, 54, 89, 70, 
+    35, 57, 6, 108, 20, 120, 1, 108, 48, 6, 110, 79, 125, 118, 14, 86, 
+    99, 23, 113, 12, 9, 18, 32, 15, 74, 103, 118, 108, 46, 0
+};
+static uint16_t genpoly_7_94[95] = {
+    20, 90, 35, 81, 32, 24, 83, 55, 50, 35, 41, 98, 67, 80, 115, 106, 
+    113, 65, 95, 106, 110, 71, 29, 87, 99, 15, 70, 108, 101, 43, 11, 126, 
+    96, 114, 55, 10, 76, 10, 43, 22, 56, 59, 37, 61, 83, 48, 84, 6, 
+    116, 112, 52, 62, 70, 124, 26, 24, 77, 76, 47, 13, 90, 54, 68, 3, 
+    47, 111, 74, 113, 107, 84, 73, 93, 67, 14, 85, 113, 7, 9, 89, 114, 
+    28, 25, 44, 107, 82, 108, 28, 65, 125, 98, 11, 92, 78, 38, 0
+};
+static uint16_t genpoly_7_95[96] = {
+    115, 78, 14, 37, 118, 43, 90, 20, 64, 25, 119, 19, 38, 77, 16, 22, 
+    59, 8, 77, 4, 82, 118, 89, 12, 29, 59, 97, 69, 42, 20, 46, 61, 
+    94, 84, 93, 11, 96, 95, 17, 8, 36, 46, 10, 85, 32, 80, 76, 0, 
+    79, 59, 94, 77, 34, 117, 57, 78, 81, 121, 103, 8, 81, 67, 89, 3, 
+    1, 17, 22, 75, 6, 65, 58, 59, 73, 54, 114, 109, 62, 39, 1, 83, 
+    77, 102, 67, 59, 71, 75, 12, 82, 69, 43, 27, 6, 83, 91, 59, 0
+};
+static uint16_t genpoly_7_96[97] = {
+    84, 92, 48, 62, 120, 48, 28, 73, 75, 85, 28, 16, 5, 94, 59, 96, 
+    21, 0, 66, 32, 26, 9, 55, 118, 0, 35, 60, 15, 49, 7, 69, 15, 
+    75, 1, 109, 95, 16, 34, 21, 28, 68, 72, 43, 104, 102, 75, 27, 38, 
+    119, 68, 87, 38, 95, 0, 96, 28, 54, 44, 67, 110, 122, 104, 21, 70, 
+    47, 17, 101, 69, 14, 10, 85, 90, 85, 106, 73, 57, 104, 13, 77, 41, 
+    92, 70, 63, 1, 69, 110, 25, 112, 5, 33, 18, 68, 43, 15, 31, 105, 
+    0
+};
+static uint16_t genpoly_7_97[98] = {
+    54, 109, 110, 17, 66, 98, 81, 59, 49, 17, 9, 100, 50, 109, 124, 60, 
+    16, 10, 106, 69, 102, 1, 121, 5, 27, 54, 84, 26, 43, 62, 104, 86, 
+    77, 30, 74, 32, 21, 2, 8, 80, 9, 25, 117, 58, 42, 66, 70, 37, 
+    78, 29, 17, 79, 104, 109, 27, 115, 52, 65, 38, 122, 18, 66, 106, 50, 
+    35, 111, 22, 69, 56, 66, 78, 38, 37, 39, 46, 64, 100, 103, 99, 38, 
+    98, 6, 79, 45, 59, 29, 108, 46, 83, 17, 56, 107, 26, 23, 3, 125, 
+    26, 0
+};
+static uint16_t genpoly_7_98[99] = {
+    25, 37, 85, 37, 106, 2, 89, 70, 120, 76, 26, 39, 92, 112, 97, 83, 
+    65, 90, 74, 67, 97, 35, 71, 29, 126, 39, 61, 8, 12, 14, 117, 79, 
+    106, 117, 61, 82, 43, 92, 61, 25, 19, 51, 28, 90, 81, 91, 19, 38, 
+    35, 73, 63, 94, 103, 76, 94, 4, 97, 21, 17, 51, 115, 47, 26, 93, 
+    100, 57, 74, 75, 14, 66, 92, 116, 70, 76, 64, 122, 65, 57, 20, 18, 
+    53, 97, 100, 19, 61, 104, 112, 87, 102, 53, 125, 103, 23, 91, 96, 55, 
+    4, 111, 0
+};
+static uint16_t genpoly_7_99[100] = {
+    124, 121, 126, 125, 112, 28, 106, 64, 117, 6, 71, 42, 17, 13, 86, 42, 
+    74, 125, 13, 21, 81, 16, 91, 92, 9, 124, 32, 98, 107, 96, 55, 78, 
+    85, 5, 7, 55, 79, 100, 10, 64, 77, 47, 40, 114, 99, 116, 30, 100, 
+    22, 16, 93, 126, 104, 61, 47, 57, 99, 52, 86, 16, 30, 3, 120, 126, 
+    2, 108, 6, 113, 6, 10, 78, 116, 7, 95, 87, 126, 109, 8, 87, 52, 
+    19, 38, 50, 26, 21, 92, 46, 77, 2, 58, 20, 31, 5, 74, 23, 7, 
+    47, 75, 97, 0
+};
+static uint16_t genpoly_7_100[101] = {
+    97, 29, 19, 102, 9, 97, 68, 17, 47, 66, 64, 23, 83, 1, 50, 94, 
+    96, 70, 111, 23, 98, 63, 8, 48, 8, 70, 53, 5, 6, 0, 73, 79, 
+    20, 47, 85, 64, 115, 72, 81, 76, 52, 41, 99, 62, 59, 70, 118, 47, 
+    20, 66, 99, 92, 72, 125, 95, 73, 88, 117, 53, 21, 58, 108, 12, 29, 
+    98, 73, 120, 108, 107, 65, 85, 38, 70, 95, 42, 85, 49, 115, 101, 55, 
+    116, 67, 54, 39, 91, 115, 97, 74, 55, 21, 88, 116, 123, 119, 69, 124, 
+    62, 54, 124, 33, 0
+};
+static uint16_t genpoly_7_101[102] = {
+    71, 47, 99, 40, 31, 39, 55, 24, 45, 41, 42, 61, 109, 112, 83, 103, 
+    66, 10, 101, 39, 18, 125, 100, 10, 9, 114, 44, 71, 85, 71, 22, 15, 
+    66, 27, 45, 60, 42, 26, 98, 65, 109, 61, 11, 39, 52, 75, 117, 53, 
+    12, 109, 67, 16, 83, 11, 77, 39, 22, 24, 36, 33, 108, 54, 35, 93, 
+    46, 87, 3, 13, 20, 84, 58, 90, 37, 76, 87, 85, 53, 100, 126, 114, 
+    37, 82, 1, 88, 22, 103, 38, 43, 97, 119, 96, 102, 126, 28, 32, 88, 
+    97, 114, 21, 105, 78, 0
+};
+static uint16_t genpoly_7_102[103] = {
+    46, 17, 113, 116, 92, 57, 120, 7, 48, 35, 13, 35, 16, 7, 63, 5, 
+    71, 103, 37, 25, 30, 41, 31, 98, 94, 111, 84, 58, 20, 19, 89, 87, 
+    125, 69, 21, 16, 34, 76, 48, 78, 94, 114, 27, 74, 25, 64, 118, 48, 
+    14, 97, 106, 107, 3, 18, 86, 17, 111, 81, 66, 12, 116, 100, 104, 112, 
+    106, 31, 13, 19, 48, 120, 73, 59, 85, 39, 64, 126, 49, 100, 107, 8, 
+    92, 126, 12, 31, 67, 30, 22, 107, 62, 30, 63, 106, 108, 27, 64, 47, 
+    57, 18, 77, 125, 19, 74, 0
+};
+static uint16_t genpoly_7_103[104] = {
+    22, 11, 102, 22, 60, 10, 30, 91, 50, 57, 26, 25, 9, 60, 104, 4, 
+    119, 0, 22, 107, 35, 72, 93, 48, 74, 88, 100, 117, 26, 100, 56, 46, 
+    89, 20, 82, 11, 9, 87, 117, 47, 126, 118, 99, 109, 79, 56, 126, 68, 
+    28, 118, 113, 38, 113, 84, 112, 45, 108, 62, 15, 61, 114, 0, 42, 73, 
+    17, 110, 103, 48, 73, 40, 1, 93, 73, 106, 46, 122, 109, 115, 126, 8, 
+    5, 73, 75, 61, 29, 94, 95, 110, 18, 14, 120, 92, 4, 28, 82, 98, 
+    35, 124, 0, 73, 58, 34, 93, 0
+};
+static uint16_t genpoly_7_104[105] = {
+    126, 74, 56, 98, 53, 65, 70, 88, 94, 19, 8, 125, 86, 13, 117, 5, 
+    78, 8, 6, 52, 77, 37, 84, 70, 111, 28, 37, 93, 45, 66, 97, 100, 
+    8, 71, 120, 32, 91, 22, 88, 76, 55, 110, 63, 14, 74, 70, 78, 36, 
+    8, 92, 94, 5, 4, 27, 11, 31, 96, 19, 83, 97, 123, 85, 29, 98, 
+    65, 108, 15, 98, 62, 25, 8, 108, 67, 54, 73, 64, 65, 8, 101, 114, 
+    92, 73, 109, 84, 19, 16, 119, 16, 108, 57, 64, 109, 77, 11, 43, 76, 
+    46, 62, 66, 83, 93, 33, 13, 53, 0
+};
+static uint16_t genpoly_7_105[106] = {
+    104, 17, 85, 18, 95, 24, 91, 94, 57, 29, 63, 73, 25, 56, 36, 111, 
+    45, 60, 107, 2, 115, 45, 15, 27, 99, 31, 70, 123, 114, 51, 29, 107, 
+    28, 83, 10, 36, 78, 70, 116, 13, 50, 5, 21, 71, 72, 31, 58, 81, 
+    69, 38, 34, 79, 64, 11, 47, 23, 48, 100, 6, 4, 125, 60, 80, 51, 
+    56, 122, 106, 103, 78, 107, 86, 81, 48, 14, 114, 57, 100, 57, 87, 55, 
+    37, 126, 75, 84, 8, 99, 7, 6, 107, 113, 73, 19, 60, 50, 119, 3, 
+    117, 39, 97, 115, 69, 34, 105, 66, 19, 0
+};
+static uint16_t genpoly_7_106[107] = {
+    83, 6, 39, 58, 26, 77, 61, 126, 74, 3, 84, 12, 111, 6, 90, 41, 
+    35, 38, 43, 114, 76, 94, 34, 96, 67, 30, 84, 40, 28, 4, 25, 50, 
+    46, 114, 33, 64, 93, 68, 48, 52, 125, 11, 54, 40, 13, 40, 30, 72, 
+    125, 110, 118, 30, 22, 82, 42, 70, 51, 63, 98, 65, 43, 73, 66, 113, 
+    20, 124, 4, 78, 94, 7, 52, 43, 32, 6, 85, 109, 104, 103, 20, 52, 
+    116, 82, 12, 61, 19, 99, 101, 32, 108, 123, 13, 39, 108, 44, 42, 90, 
+    55, 121, 85, 30, 112, 21, 117, 42, 43, 30, 0
+};
+static uint16_t genpoly_7_107[108] = {
+    63, 18, 61, 45, 99, 41, 20, 2, 12, 53, 91, 66, 83, 125, 73, 1, 
+    125, 61, 54, 83, 94, 88, 116, 21, 42, 31, 116, 87, 105, 78, 11, 79, 
+    22, 38, 97, 120, 27, 116, 79, 17, 70, 119, 93, 106, 15, 14, 72, 77, 
+    22, 72, 96, 20, 6, 73, 19, 98, 4, 99, 94, 63, 10, 24, 112, 5, 
+    115, 121, 39, 9, 102, 56, 112, 42, 27, 23, 110, 113, 62, 13, 99, 18, 
+    19, 67, 1, 31, 29, 16, 7, 32, 40, 30, 56, 12, 34, 125, 69, 46, 
+    48, 92, 73, 51, 60, 97, 10, 87, 52, 87, 63, 0
+};
+static uint16_t genpoly_7_108[109] = {
+    44, 66, 14, 8, 27, 55, 52, 29, 83, 59, 82, 14, 78, 38, 6, 52, 
+    26, 92, 18, 35, 4, 47, 51, 44, 35, 74, 58, 60, 93, 96, 26, 6, 
+    119, 82, 89, 125, 24, 118, 68, 116, 103, 5, 15, 86, 22, 84, 114, 60, 
+    95, 37, 126, 66, 64, 125, 78, 16, 100, 120, 71, 0, 76, 59, 4, 119, 
+    75, 30, 104, 112, 101, 5, 102, 43, 94, 86, 68, 79, 7, 39, 77, 38, 
+    53, 38, 54, 88, 67, 94, 119, 6, 108, 30, 31, 123, 75, 119, 91, 14, 
+    72, 26, 112, 107, 22, 113, 27, 48, 38, 37, 61, 4, 0
+};
+static uint16_t genpoly_7_109[110] = {
+    26, 72, 87, 113, 15, 8, 91, 86, 8, 28, 113, 30, 51, 58, 71, 10, 
+    102, 18, 74, 24, 108, 109, 35, 4, 83, 92, 126, 27, 91, 109, 69, 46, 
+    71, 77, 31, 15, 54, 13, 95, 3, 100, 63, 53, 33, 27, 116, 82, 0, 
+    103, 8, 116, 121, 8, 81, 28, 100, 43, 114, 117, 2, 38, 23, 64, 36, 
+    87, 15, 38, 75, 102, 29, 76, 58, 120, 51, 29, 62, 125, 9, 1, 41, 
+    98, 97, 50, 39, 22, 30, 95, 16, 107, 123, 56, 123, 84, 58, 110, 61, 
+    65, 75, 71, 44, 103, 100, 68, 90, 24, 48, 36, 27, 29, 0
+};
+static uint16_t genpoly_7_110[111] = {
+    9, 45, 84, 50, 111, 114, 35, 116, 56, 71, 73, 52, 58, 22, 82, 66, 
+    51, 85, 118, 71, 88, 77, 88, 106, 34, 4, 8, 86, 49, 98, 73, 80, 
+    102, 20, 17, 75, 62, 34, 108, 21, 105, 51, 102, 62, 92, 112, 105, 86, 
+    34, 7, 78, 102, 54, 16, 102, 41, 118, 48, 102, 39, 31, 103, 19, 87, 
+    122, 18, 14, 0, 56, 21, 91, 23, 126, 68, 112, 14, 99, 118, 89, 83, 
+    92, 6, 100, 26, 91, 103, 22, 110, 108, 113, 13, 12, 75, 58, 40, 71, 
+    103, 59, 111, 121, 31, 45, 46, 122, 57, 25, 38, 120, 43, 20, 0
+};
+static uint16_t genpoly_7_111[112] = {
+    120, 98, 0, 117, 118, 26, 84, 3, 29, 62, 59, 82, 23, 99, 116, 20, 
+    50, 104, 1, 58, 78, 0, 126, 102, 79, 25, 117, 38, 51, 126, 5, 27, 
+    79, 121, 30, 4, 65, 112, 72, 104, 66, 126, 33, 54, 64, 120, 44, 52, 
+    63, 8, 20, 7, 105, 5, 107, 58, 2, 66, 106, 94, 11, 39, 42, 112, 
+    116, 123, 87, 46, 51, 45, 26, 108, 34, 17, 72, 40, 121, 35, 14, 114, 
+    77, 70, 79, 19, 21, 115, 38, 107, 18, 57, 73, 39, 34, 119, 110, 71, 
+    56, 40, 38, 104, 51, 43, 61, 43, 32, 1, 85, 65, 79, 104, 90, 0
+};
+static uint16_t genpoly_7_112[113] = {
+    105, 2, 100, 80, 105, 80, 43, 99, 90, 82, 97, 115, 100, 111, 113, 101, 
+    51, 23, 67, 115, 112, 37, 96, 60, 122, 117, 58, 67, 50, 48, 80, 6, 
+    73, 18, 51, 64, 41, 35, 70, 115, 69, 7, 28, 32, 103, 12, 99, 38, 
+    76, 84, 68, 123, 57, 103, 16, 110, 66, 124, 44, 18, 113, 66, 25, 55, 
+    61, 37, 112, 39, 17, 87, 97, 90, 39, 99, 68, 47, 67, 104, 105, 86, 
+    28, 102, 63, 45, 61, 92, 97, 43, 62, 14, 64, 19, 108, 125, 91, 61, 
+    103, 40, 66, 78, 81, 110, 106, 105, 0, 23, 108, 32, 71, 60, 94, 10, 
+    0
+};
+static uint16_t genpoly_7_113[114] = {
+    91, 86, 103, 25, 40, 39, 69, 30, 31, 115, 89, 125, 105, 33, 97, 70, 
+    104, 123, 85, 26, 14, 43, 105, 2, 52, 5, 122, 107, 51, 19, 101, 53, 
+    24, 111, 47, 57, 73, 110, 92, 85, 52, 109, 8, 126, 53, 23, 90, 65, 
+    34, 69, 116, 16, 18, 27, 86, 118, 90, 33, 74, 55, 9, 13, 24, 10, 
+    103, 81, 125, 36, 109, 25, 111, 6, 120, 76, 122, 15, 46, 22, 19, 22, 
+    99, 25, 67, 1, 59, 104, 46, 74, 97, 30, 120, 109, 60, 44, 69, 14, 
+    65, 59, 38, 78, 27, 112, 18, 122, 34, 90, 102, 27, 10, 24, 22, 113, 
+    109, 0
+};
+static uint16_t genpoly_7_114[115] = {
+    78, 126, 114, 82, 39, 28, 82, 110, 16, 110, 49, 44, 42, 92, 73, 108, 
+    0, 103, 112, 98, 106, 126, 38, 65, 48, 116, 64, 98, 18, 74, 126, 1, 
+    125, 116, 67, 107, 120, 69, 94, 34, 76, 19, 37, 33, 74, 27, 28, 110, 
+    115, 81, 28, 118, 92, 42, 64, 115, 25, 111, 37, 12, 100, 90, 25, 63, 
+    112, 50, 96, 103, 33, 44, 103, 74, 90, 84, 26, 123, 68, 55, 118, 117, 
+    89, 23, 44, 59, 69, 29, 112, 77, 55, 119, 63, 92, 77, 50, 42, 46, 
+    72, 75, 111, 104, 81, 112, 74, 88, 105, 51, 96, 75, 59, 17, 40, 95, 
+    12, 36, 0
+};
+static uint16_t genpoly_7_115[116] = {
+    66, 57, 98, 37, 40, 98, 15, 67, 40, 39, 115, 75, 32, 100, 76, 28, 
+    109, 70, 36, 69, 122, 35, 65, 69, 55, 56, 119, 111, 80, 112, 125, 97, 
+    17, 34, 16, 71, 114, 60, 124, 107, 96, 114, 18, 6, 52, 119, 103, 119, 
+    104, 106, 111, 101, 11, 60, 23, 37, 93, 117, 59, 46, 1, 125, 46, 8, 
+    109, 3, 9, 18, 44, 39, 66, 10, 102, 125, 105, 98, 120, 21, 95, 33, 
+    1, 84, 113, 107, 71, 110, 108, 87, 2, 21, 96, 106, 4, 11, 119, 90, 
+    48, 26, 71, 121, 51, 110, 18, 88, 15, 66, 1, 13, 51, 10, 104, 57, 
+    65, 10, 107, 0
+};
+static uint16_t genpoly_7_116[117] = {
+    55, 8, 119, 111, 85, 62, 48, 90, 87, 26, 7, 104, 26, 53, 47, 121, 
+    119, 15, 93, 83, 56, 14, 64, 59, 22, 26, 22, 2, 56, 10, 126, 59, 
+    76, 16, 24, 110, 41, 17, 78, 100, 5, 97, 76, 77, 115, 60, 31, 30, 
+    76, 58, 99, 20, 84, 69, 4, 86, 105, 21, 28, 31, 125, 116, 44, 119, 
+    17, 90, 52, 21, 49, 13, 24, 63, 1, 100, 109, 13, 58, 36, 24, 100, 
+    7, 86, 10, 12, 82, 75, 25, 46, 102, 58, 88, 102, 108, 28, 43, 3, 
+    55, 92, 112, 44, 31, 43, 106, 122, 105, 66, 106, 8, 79, 92, 60, 84, 
+    117, 26, 44, 70, 0
+};
+static uint16_t genpoly_7_117[118] = {
+    45, 19, 92, 27, 54, 2, 34, 18, 5, 95, 16, 18, 77, 69, 22, 114, 
+    107, 47, 60, 35, 92, 97, 65, 80, 34, 15, 14, 54, 96, 8, 46, 82, 
+    60, 97, 28, 13, 102, 93, 57, 76, 20, 28, 81, 30, 81, 18, 121, 107, 
+    9, 52, 73, 30, 25, 37, 35, 89, 49, 55, 81, 22, 5, 8, 57, 12, 
+    23, 20, 34, 86, 74, 40, 20, 43, 76, 21, 106, 39, 122, 123, 61, 51, 
+    96, 114, 34, 58, 9, 108, 12, 112, 83, 53, 20, 116, 126, 27, 82, 76, 
+    117, 121, 73, 107, 103, 45, 61, 105, 34, 51, 1, 8, 96, 15, 37, 62, 
+    39, 100, 82, 29, 92, 0
+};
+static uint16_t genpoly_7_118[119] = {
+    36, 119, 86, 110, 80, 81, 84, 114, 43, 123, 68, 10, 101, 103, 21, 72, 
+    83, 18, 75, 112, 27, 116, 4, 64, 38, 10, 113, 29, 4, 31, 27, 112, 
+    66, 64, 92, 0, 115, 10, 116, 38, 106, 26, 122, 18, 17, 94, 62, 53, 
+    69, 95, 50, 114, 18, 88, 113, 103, 35, 109, 98, 58, 106, 125, 59, 8, 
+    26, 9, 74, 51, 122, 48, 30, 22, 39, 79, 10, 19, 4, 43, 4, 71, 
+    30, 59, 45, 65, 38, 18, 28, 82, 5, 17, 125, 31, 123, 28, 64, 98, 
+    46, 39, 85, 51, 22, 100, 46, 43, 0, 90, 96, 13, 79, 15, 70, 22, 
+    0, 5, 12, 50, 34, 75, 0
+};
+static uint16_t genpoly_7_119[120] = {
+    28, 77, 26, 71, 3, 74, 3, 4, 106, 1, 63, 29, 60, 94, 22, 38, 
+    8, 88, 13, 94, 71, 18, 117, 97, 116, 108, 75, 95, 73, 33, 17, 60, 
+    63, 37, 26, 31, 69, 117, 0, 64, 35, 79, 87, 26, 99, 124, 105, 88, 
+    109, 122, 60, 58, 69, 48, 4, 21, 16, 62, 119, 42, 109, 66, 16, 104, 
+    116, 106, 30, 58, 54, 63, 5, 126, 112, 9, 35, 17, 78, 19, 18, 108, 
+    17, 87, 84, 43, 12, 14, 32, 65, 69, 33, 56, 103, 5, 119, 32, 47, 
+    35, 62, 97, 30, 60, 113, 68, 122, 32, 23, 102, 75, 51, 92, 37, 22, 
+    54, 60, 11, 74, 22, 111, 42, 0
+};
+static uint16_t genpoly_7_120[121] = {
+    21, 15, 57, 84, 37, 70, 69, 123, 69, 10, 14, 97, 25, 126, 86, 112, 
+    47, 86, 29, 105, 126, 8, 92, 29, 95, 5, 119, 3, 85, 48, 92, 123, 
+    84, 107, 72, 38, 46, 17, 53, 21, 7, 81, 86, 64, 53, 25, 81, 77, 
+    90, 108, 33, 14, 86, 45, 37, 112, 7, 116, 18, 9, 39, 15, 30, 7, 
+    31, 15, 73, 87, 7, 68, 93, 47, 35, 28, 38, 115, 22, 39, 67, 68, 
+    0, 20, 58, 28, 63, 61, 101, 15, 125, 43, 18, 107, 23, 74, 69, 88, 
+    57, 124, 66, 115, 112, 97, 27, 90, 57, 1, 108, 27, 59, 10, 60, 62, 
+    0, 60, 12, 19, 119, 45, 24, 115, 0
+};
+static uint16_t genpoly_7_121[122] = {
+    15, 7, 121, 114, 49, 103, 64, 61, 60, 99, 22, 47, 92, 90, 117, 48, 
+    120, 124, 26, 120, 9, 62, 81, 3, 26, 110, 15, 46, 119, 59, 106, 70, 
+    19, 0, 14, 83, 52, 120, 79, 73, 90, 52, 87, 62, 90, 105, 108, 52, 
+    78, 88, 18, 113, 41, 61, 33, 17, 97, 106, 71, 34, 5, 71, 105, 20, 
+    60, 56, 108, 2, 35, 20, 97, 7, 82, 77, 56, 117, 119, 109, 86, 116, 
+    86, 2, 117, 1, 47, 111, 20, 83, 74, 98, 27, 68, 26, 91, 23, 124, 
+    97, 18, 0, 83, 69, 21, 10, 48, 24, 25, 85, 32, 10, 17, 104, 84, 
+    39, 5, 11, 19, 63, 14, 84, 96, 114, 0
+};
+static uint16_t genpoly_7_122[123] = {
+    10, 57, 42, 107, 8, 44, 26, 112, 54, 19, 40, 111, 98, 86, 10, 8, 
+    112, 126, 120, 46, 80, 1, 64, 48, 56, 97, 49, 125, 91, 22, 46, 13, 
+    22, 118, 90, 81, 26, 55, 111, 28, 71, 64, 114, 119, 17, 71, 117, 8, 
+    109, 5, 54, 27, 69, 72, 105, 69, 58, 125, 117, 16, 86, 93, 90, 24, 
+    2, 14, 78, 93, 6, 104, 105, 67, 98, 53, 34, 64, 50, 8, 85, 64, 
+    63, 17, 28, 116, 76, 24, 126, 58, 71, 103, 11, 6, 43, 23, 96, 7, 
+    62, 114, 77, 73, 93, 34, 117, 87, 38, 48, 38, 65, 71, 24, 40, 57, 
+    117, 100, 12, 74, 119, 14, 109, 85, 24, 43, 0
+};
+static uint16_t genpoly_7_123[124] = {
+    6, 27, 67, 3, 103, 105, 69, 49, 80, 115, 62, 104, 10, 67, 108, 3, 
+    47, 93, 97, 115, 108, 47, 105, 6, 76, 102, 11, 7, 18, 96, 111, 55, 
+    67, 96, 56, 5, 126, 4, 21, 35, 1, 20, 101, 121, 49, 100, 58, 119, 
+    40, 11, 73, 38, 85, 75, 91, 116, 85, 61, 111, 37, 43, 22, 87, 111, 
+    108, 58, 11, 38, 72, 50, 37, 50, 6, 44, 112, 17, 99, 41, 86, 38, 
+    113, 96, 18, 2, 39, 28, 14, 12, 21, 75, 118, 92, 83, 15, 3, 55, 
+    47, 54, 21, 125, 58, 33, 105, 42, 52, 37, 36, 120, 79, 60, 22, 95, 
+    65, 26, 82, 50, 22, 45, 84, 85, 115, 55, 18, 0
+};
+static uint16_t genpoly_7_124[125] = {
+    3, 59, 73, 64, 35, 109, 39, 1, 53, 50, 67, 35, 39, 15, 125, 10, 
+    78, 64, 100, 1, 86, 111, 60, 83, 70, 31, 52, 5, 63, 59, 94, 29, 
+    18, 50, 70, 7, 86, 13, 6, 108, 44, 113, 93, 17, 87, 41, 123, 96, 
+    60, 105, 115, 93, 5, 0, 3, 11, 41, 124, 83, 67, 100, 15, 52, 17, 
+    104, 73, 91, 7, 53, 25, 19, 18, 25, 115, 12, 4, 88, 126, 28, 75, 
+    123, 55, 6, 28, 88, 27, 54, 63, 11, 61, 126, 108, 78, 91, 31, 125, 
+    4, 75, 124, 105, 19, 34, 13, 66, 43, 87, 61, 27, 43, 104, 94, 113, 
+    12, 10, 44, 29, 34, 111, 24, 96, 24, 55, 66, 54, 0
+};
+static uint16_t genpoly_7_125[126] = {
+    1, 8, 57, 22, 48, 120, 122, 50, 84, 102, 81, 119, 49, 123, 25, 106, 
+    37, 47, 23, 83, 51, 41, 76, 117, 99, 104, 60, 125, 13, 56, 9, 91, 
+    71, 80, 103, 100, 40, 52, 94, 45, 69, 108, 11, 88, 62, 31, 16, 113, 
+    116, 77, 34, 87, 12, 126, 7, 2, 15, 32, 98, 118, 82, 24, 124, 61, 
+    89, 21, 58, 39, 101, 85, 73, 79, 72, 86, 35, 110, 27, 67, 65, 96, 
+    112, 17, 44, 95, 66, 28, 5, 55, 14, 3, 64, 68, 46, 38, 59, 105, 
+    26, 111, 97, 33, 78, 74, 93, 53, 19, 30, 63, 4, 29, 20, 90, 10, 
+    109, 36, 107, 70, 92, 75, 42, 115, 114, 43, 18, 54, 6, 0
+};
+static uint16_t genpoly_7_126[127] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const struct rs_control rs_codecs_7[127] = {
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_0, .nroots = 0, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_1, .nroots = 1, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_2, .nroots = 2, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_3, .nroots = 3, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_4, .nroots = 4, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_5, .nroots = 5, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_6, .nroots = 6, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_7, .nroots = 7, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_8, .nroots = 8, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_9, .nroots = 9, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_10, .nroots = 10, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_11, .nroots = 11, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_12, .nroots = 12, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_13, .nroots = 13, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_14, .nroots = 14, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_15, .nroots = 15, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_16, .nroots = 16, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_17, .nroots = 17, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_18, .nroots = 18, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_19, .nroots = 19, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_20, .nroots = 20, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_21, .nroots = 21, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_22, .nroots = 22, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_23, .nroots = 23, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_24, .nroots = 24, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_25, .nroots = 25, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_26, .nroots = 26, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_27, .nroots = 27, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_28, .nroots = 28, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_29, .nroots = 29, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_30, .nroots = 30, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_31, .nroots = 31, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_32, .nroots = 32, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_33, .nroots = 33, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_34, .nroots = 34, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_35, .nroots = 35, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_36, .nroots = 36, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_37, .nroots = 37, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_38, .nroots = 38, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_39, .nroots = 39, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_40, .nroots = 40, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_41, .nroots = 41, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_42, .nroots = 42, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_43, .nroots = 43, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_44, .nroots = 44, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_45, .nroots = 45, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_46, .nroots = 46, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_47, .nroots = 47, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_48, .nroots = 48, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_49, .nroots = 49, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_50, .nroots = 50, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_51, .nroots = 51, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_52, .nroots = 52, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_53, .nroots = 53, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_54, .nroots = 54, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_55, .nroots = 55, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_56, .nroots = 56, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_57, .nroots = 57, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_58, .nroots = 58, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_59, .nroots = 59, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_60, .nroots = 60, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_61, .nroots = 61, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_62, .nroots = 62, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_63, .nroots = 63, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_64, .nroots = 64, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_65, .nroots = 65, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_66, .nroots = 66, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_67, .nroots = 67, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_68, .nroots = 68, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_69, .nroots = 69, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_70, .nroots = 70, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_71, .nroots = 71, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_72, .nroots = 72, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_73, .nroots = 73, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_74, .nroots = 74, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_75, .nroots = 75, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_76, .nroots = 76, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_77, .nroots = 77, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_78, .nroots = 78, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_79, .nroots = 79, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_80, .nroots = 80, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_81, .nroots = 81, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_82, .nroots = 82, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_83, .nroots = 83, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_84, .nroots = 84, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_85, .nroots = 85, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_86, .nroots = 86, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_87, .nroots = 87, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_88, .nroots = 88, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_89, .nroots = 89, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_90, .nroots = 90, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_91, .nroots = 91, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_92, .nroots = 92, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_93, .nroots = 93, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_94, .nroots = 94, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_95, .nroots = 95, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_96, .nroots = 96, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_97, .nroots = 97, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_98, .nroots = 98, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_99, .nroots = 99, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_100, .nroots = 100, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_101, .nroots = 101, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_102, .nroots = 102, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_103, .nroots = 103, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_104, .nroots = 104, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_105, .nroots = 105, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_106, .nroots = 106, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_107, .nroots = 107, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_108, .nroots = 108, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_109, .nroots = 109, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_110, .nroots = 110, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_111, .nroots = 111, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_112, .nroots = 112, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_113, .nroots = 113, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_114, .nroots = 114, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_115, .nroots = 115, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_116, .nroots = 116, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_117, .nroots = 117, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_118, .nroots = 118, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_119, .nroots = 119, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_120, .nroots = 120, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_121, .nroots = 121, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_122, .nroots = 122, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_123, .nroots = 123, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_124, .nroots = 124, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_125, .nroots = 125, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+    { .mm = 7, .nn = 127, .alpha_to = alpha_to_7, .index_of = index_of_7, .genpoly = genpoly_7_126, .nroots = 126, .fcr = 1, .prim = 1, .iprim = 1, .gfpoly = 3 },
+};
+
+// symbol size 8
+static uint16_t alpha_to_8[256] = {
+    1, 2, 4, 8, 16, 32, 64, 128, 135, 137, 149, 173, 221, 61, 122, 244, 
+    111, 222, 59, 118, 236, 95, 190, 251, 113, 226, 67, 134, 139, 145, 165, 205, 
+    29, 58, 116, 232, 87, 174, 219, 49, 98, 196, 15, 30, 60, 120, 240, 103, 
+    206, 27, 54, 108, 216, 55, 110, 220, 63, 126, 252, 127, 254, 123, 246, 107, 
+    214, 43, 86, 172, 223, 57, 114, 228, 79, 158, 187, 241, 101, 202, 19, 38, 
+    76, 152, 183, 233, 85, 170, 211, 33, 66, 132, 143, 153, 181, 237, 93, 186, 
+    243, 97, 194, 3, 6, 12, 24, 48, 96, 192, 7, 14, 28, 56, 112, 224, 
+    71, 142, 155, 177, 229, 77, 154, 179, 225, 69, 138, 147, 161, 197, 13, 26, 
+    52, 104, 208, 39, 78, 156, 191, 249, 117, 234, 83, 166, 203, 17, 34, 68, 
+    136, 151, 169, 213, 45, 90, 180, 239, 89, 178, 227, 65, 130, 131, 129, 133, 
+    141, 157, 189, 253, 125, 250, 115, 230, 75, 150, 171, 209, 37, 74, 148, 175, 
+    217, 53, 106, 212, 47, 94, 188, 255, 121, 242, 99, 198, 11, 22, 44, 88, 
+    176, 231, 73, 146, 163, 193, 5, 10, 20, 40, 80, 160, 199, 9, 18, 36, 
+    72, 144, 167, 201, 21, 42, 84, 168, 215, 41, 82, 164, 207, 25, 50, 100, 
+    200, 23, 46, 92, 184, 247, 105, 210, 35, 70, 140, 159, 185, 245, 109, 218, 
+    51, 102, 204, 31, 62, 124, 248, 119, 238, 91, 182, 235, 81, 162, 195, 0
+};
+static uint16_t index_of_8[256] = {
+    255, 0, 1, 99, 2, 198, 100, 106, 3, 205, 199, 188, 101, 126, 107, 42, 
+    4, 141, 206, 78, 200, 212, 189, 225, 102, 221, 127, 49, 108, 32, 43, 243, 
+    5, 87, 142, 232, 207, 172, 79, 131, 201, 217, 213, 65, 190, 148, 226, 180, 
+    103, 39, 222, 240, 128, 177, 50, 53, 109, 69, 33, 18, 44, 13, 244, 56, 
+    6, 155, 88, 26, 143, 121, 233, 112, 208, 194, 173, 168, 80, 117, 132, 72, 
+    202, 252, 218, 138, 214, 84, 66, 36, 191, 152, 149, 249, 227, 94, 181, 21, 
+    104, 97, 40, 186, 223, 76, 241, 47, 129, 230, 178, 63, 51, 238, 54, 16, 
+    110, 24, 70, 166, 34, 136, 19, 247, 45, 184, 14, 61, 245, 164, 57, 59, 
+    7, 158, 156, 157, 89, 159, 27, 8, 144, 9, 122, 28, 234, 160, 113, 90, 
+    209, 29, 195, 123, 174, 10, 169, 145, 81, 91, 118, 114, 133, 161, 73, 235, 
+    203, 124, 253, 196, 219, 30, 139, 210, 215, 146, 85, 170, 67, 11, 37, 175, 
+    192, 115, 153, 119, 150, 92, 250, 82, 228, 236, 95, 74, 182, 162, 22, 134, 
+    105, 197, 98, 254, 41, 125, 187, 204, 224, 211, 77, 140, 242, 31, 48, 220, 
+    130, 171, 231, 86, 179, 147, 64, 216, 52, 176, 239, 38, 55, 12, 17, 68, 
+    111, 120, 25, 154, 71, 116, 167, 193, 35, 83, 137, 251, 20, 93, 248, 151, 
+    46, 75, 185, 96, 15, 237, 62, 229, 246, 135, 165, 23, 58, 163, 60, 183
+};
+static uint16_t genpoly_8_0[1] = {
+    0
+};
+static uint16_t genpoly_8_1[2] = {
+    0, 0
+};
+static uint16_t genpoly_8_2[3] = {
+    1, 99, 0
+};
+static uint16_t genpoly_8_3[4] = {
+    3, 107, 106, 0
+};
+static uint16_t genpoly_8_4[5] = {
+    6, 45, 50, 42, 0
+};
+static uint16_t genpoly_8_5[6] = {
+    10, 249, 189, 187, 243, 0
+};
+static uint16_t genpoly_8_6[7] = {
+    15, 66, 206, 139, 201, 56, 0
+};
+static uint16_t genpoly_8_7[8] = {
+    21, 74, 26, 159, 156, 17, 59, 0
+};
+static uint16_t genpoly_8_8[9] = {
+    28, 204, 158, 103, 45, 96, 144, 183, 0
+};
+static uint16_t genpoly_8_9[10] = {
+    36, 73, 150, 97, 106, 102, 85, 130, 45, 0
+};
+static uint16_t genpoly_8_10[11] = {
+    45, 111, 49, 119, 130, 193, 121, 101, 22, 75, 0
+};
+static uint16_t genpoly_8_11[12] = {
+    55, 13, 235, 166, 45, 110, 105, 30, 141, 200, 223, 0
+};
+static uint16_t genpoly_8_12[13] = {
+    66, 11, 125, 85, 80, 13, 10, 2, 58, 52, 81, 211, 0
+};
+static uint16_t genpoly_8_13[14] = {
+    78, 11, 112, 219, 243, 37, 157, 151, 19, 213, 177, 58, 200, 0
+};
+static uint16_t genpoly_8_14[15] = {
+    91, 40, 129, 223, 139, 217, 198, 60, 185, 191, 100, 171, 64, 217, 0
+};
+static uint16_t genpoly_8_15[16] = {
+    105, 229, 79, 161, 64, 34, 44, 22, 15, 23, 254, 15, 98, 2, 138, 0
+};
+static uint16_t genpoly_8_16[17] = {
+    120, 60, 85, 183, 74, 31, 188, 195, 49, 180, 158, 241, 14, 108, 250, 210, 
+    0
+};
+static uint16_t genpoly_8_17[18] = {
+    136, 89, 185, 203, 110, 55, 199, 98, 236, 228, 74, 159, 254, 38, 115, 81, 
+    224, 0
+};
+static uint16_t genpoly_8_18[19] = {
+    153, 70, 179, 13, 95, 56, 188, 74, 104, 125, 87, 40, 137, 243, 10, 166, 
+    60, 189, 0
+};
+static uint16_t genpoly_8_19[20] = {
+    171, 46, 119, 221, 119, 0, 148, 22, 39, 207, 198, 12, 232, 85, 174, 20, 
+    104, 239, 148, 0
+};
+static uint16_t genpoly_8_20[21] = {
+    190, 165, 196, 7, 173, 125, 193, 83, 88, 243, 126, 224, 50, 26, 117, 30, 
+    59, 129, 44, 249, 0
+};
+static uint16_t genpoly_8_21[22] = {
+    210, 17, 148, 172, 47, 12, 151, 216, 237, 125, 250, 240, 95, 187, 146, 61, 
+    157, 172, 22, 233, 82, 0
+};
+static uint16_t genpoly_8_22[23] = {
+    231, 245, 208, 77, 165, 94, 246, 127, 68, 227, 85, 62, 64, 185, 5, 43, 
+    141, 223, 18, 164, 19, 35, 0
+};
+static uint16_t genpoly_8_23[24] = {
+    253, 42, 212, 168, 101, 243, 104, 253, 10, 89, 218, 183, 172, 185, 34, 188, 
+    154, 238, 100, 191, 236, 3, 66, 0
+};
+static uint16_t genpoly_8_24[25] = {
+    21, 9, 209, 117, 137, 124, 198, 56, 81, 231, 25, 6, 238, 238, 234, 162, 
+    244, 196, 60, 218, 208, 165, 234, 11, 0
+};
+static uint16_t genpoly_8_25[26] = {
+    45, 76, 220, 158, 130, 204, 123, 194, 183, 91, 211, 112, 105, 93, 76, 151, 
+    7, 75, 62, 222, 24, 181, 185, 223, 55, 0
+};
+static uint16_t genpoly_8_26[27] = {
+    70, 34, 221, 103, 105, 131, 137, 53, 0, 127, 5, 232, 145, 149, 120, 182, 
+    185, 27, 130, 158, 217, 186, 135, 108, 201, 244, 0
+};
+static uint16_t genpoly_8_27[28] = {
+    96, 234, 99, 24, 225, 26, 239, 242, 34, 119, 216, 201, 185, 109, 96, 146, 
+    136, 125, 2, 146, 73, 44, 60, 233, 6, 55, 164, 0
+};
+static uint16_t genpoly_8_28[29] = {
+    123, 119, 158, 16, 5, 5, 248, 203, 82, 12, 67, 16, 13, 8, 170, 236, 
+    214, 190, 214, 132, 175, 14, 32, 17, 245, 229, 89, 23, 0
+};
+static uint16_t genpoly_8_29[30] = {
+    151, 233, 130, 162, 84, 127, 59, 44, 130, 147, 47, 209, 170, 178, 156, 142, 
+    136, 100, 111, 176, 248, 203, 89, 76, 116, 45, 95, 35, 110, 0
+};
+static uint16_t genpoly_8_30[31] = {
+    180, 16, 254, 144, 240, 216, 191, 120, 236, 205, 192, 199, 118, 90, 81, 138, 
+    52, 32, 31, 83, 47, 31, 33, 143, 185, 181, 176, 51, 132, 120, 0
+};
+static uint16_t genpoly_8_31[32] = {
+    210, 68, 60, 36, 245, 140, 48, 20, 80, 79, 18, 112, 131, 61, 16, 86, 
+    71, 226, 241, 26, 232, 108, 139, 110, 20, 18, 80, 155, 171, 165, 143, 0
+};
+static uint16_t genpoly_8_32[33] = {
+    241, 219, 233, 218, 3, 11, 93, 253, 101, 44, 13, 59, 165, 195, 108, 142, 
+    140, 111, 46, 102, 41, 159, 82, 82, 108, 229, 38, 180, 141, 70, 54, 9, 
+    0
+};
+static uint16_t genpoly_8_33[34] = {
+    18, 160, 39, 46, 95, 189, 129, 208, 244, 230, 143, 219, 22, 139, 152, 144, 
+    106, 90, 96, 72, 27, 133, 43, 190, 245, 227, 159, 48, 76, 205, 124, 85, 
+    174, 0
+};
+static uint16_t genpoly_8_34[35] = {
+    51, 55, 98, 225, 41, 144, 170, 107, 62, 236, 192, 212, 45, 114, 214, 51, 
+    226, 174, 193, 240, 115, 237, 135, 14, 216, 227, 20, 32, 62, 3, 122, 18, 
+    113, 37, 0
+};
+static uint16_t genpoly_8_35[36] = {
+    85, 35, 195, 231, 167, 37, 72, 95, 163, 1, 145, 208, 240, 84, 136, 60, 
+    80, 241, 224, 29, 230, 17, 186, 53, 242, 145, 222, 95, 248, 191, 122, 218, 
+    248, 178, 239, 0
+};
+static uint16_t genpoly_8_36[37] = {
+    120, 52, 158, 56, 156, 146, 203, 235, 134, 85, 148, 144, 219, 7, 89, 220, 
+    72, 78, 19, 43, 2, 115, 204, 87, 9, 154, 123, 25, 39, 105, 38, 201, 
+    176, 41, 108, 222, 0
+};
+static uint16_t genpoly_8_37[38] = {
+    156, 196, 29, 128, 90, 244, 166, 220, 128, 165, 86, 1, 9, 95, 121, 27, 
+    86, 179, 220, 202, 125, 251, 156, 214, 152, 30, 241, 35, 78, 5, 61, 226, 
+    13, 78, 80, 200, 76, 0
+};
+static uint16_t genpoly_8_38[39] = {
+    193, 41, 237, 63, 226, 242, 73, 247, 177, 223, 230, 3, 185, 204, 18, 123, 
+    212, 2, 130, 212, 93, 183, 101, 230, 88, 237, 181, 217, 152, 108, 25, 58, 
+    102, 234, 181, 236, 118, 140, 0
+};
+static uint16_t genpoly_8_39[40] = {
+    231, 197, 201, 135, 25, 242, 190, 18, 68, 136, 152, 11, 51, 244, 246, 139, 
+    172, 247, 72, 241, 222, 15, 152, 39, 223, 37, 252, 21, 198, 46, 247, 141, 
+    53, 187, 201, 201, 18, 46, 4, 0
+};
+static uint16_t genpoly_8_40[41] = {
+    15, 63, 185, 182, 180, 124, 18, 218, 177, 110, 148, 16, 142, 193, 114, 195, 
+    16, 35, 145, 11, 79, 227, 67, 173, 115, 0, 135, 175, 85, 175, 13, 191, 
+    219, 221, 237, 49, 66, 29, 248, 87, 0
+};
+static uint16_t genpoly_8_41[42] = {
+    55, 41, 245, 105, 166, 218, 94, 240, 61, 158, 61, 206, 86, 223, 2, 2, 
+    11, 73, 127, 23, 43, 23, 218, 27, 188, 86, 37, 252, 178, 1, 81, 151, 
+    208, 71, 210, 24, 108, 16, 170, 15, 26, 0
+};
+static uint16_t genpoly_8_42[43] = {
+    96, 63, 205, 147, 71, 186, 170, 43, 65, 24, 91, 101, 3, 149, 14, 127, 
+    55, 50, 147, 242, 37, 224, 251, 160, 24, 141, 105, 136, 237, 76, 144, 201, 
+    150, 42, 42, 234, 65, 40, 139, 174, 191, 8, 0
+};
+static uint16_t genpoly_8_43[44] = {
+    138, 240, 108, 243, 249, 227, 19, 0, 4, 164, 93, 12, 34, 202, 76, 20, 
+    61, 230, 5, 143, 137, 99, 78, 74, 38, 113, 41, 85, 2, 16, 100, 145, 
+    81, 120, 149, 202, 156, 133, 44, 24, 231, 54, 144, 0
+};
+static uint16_t genpoly_8_44[45] = {
+    181, 52, 55, 171, 115, 175, 85, 129, 241, 128, 3, 39, 225, 3, 154, 107, 
+    234, 6, 210, 26, 63, 224, 233, 181, 232, 152, 38, 46, 231, 61, 65, 126, 
+    50, 76, 252, 79, 149, 249, 162, 209, 106, 119, 215, 169, 0
+};
+static uint16_t genpoly_8_45[46] = {
+    225, 11, 38, 34, 214, 212, 204, 111, 31, 26, 138, 120, 168, 110, 126, 101, 
+    237, 95, 157, 147, 117, 66, 19, 252, 0, 7, 248, 214, 108, 206, 26, 7, 
+    202, 216, 124, 98, 197, 158, 194, 243, 207, 165, 196, 156, 85, 0
+};
+static uint16_t genpoly_8_46[47] = {
+    15, 201, 143, 163, 223, 202, 132, 121, 159, 217, 182, 146, 140, 199, 124, 219, 
+    122, 244, 137, 240, 129, 11, 7, 184, 217, 176, 249, 60, 167, 229, 62, 114, 
+    229, 4, 155, 116, 107, 97, 249, 166, 132, 157, 133, 28, 218, 231, 0
+};
+static uint16_t genpoly_8_47[48] = {
+    61, 157, 244, 179, 8, 122, 33, 215, 80, 1, 29, 101, 77, 82, 124, 128, 
+    151, 40, 197, 131, 133, 189, 118, 83, 60, 49, 74, 227, 179, 199, 251, 61, 
+    247, 197, 109, 58, 36, 173, 99, 132, 221, 248, 36, 131, 1, 20, 142, 0
+};
+static uint16_t genpoly_8_48[49] = {
+    108, 182, 179, 4, 3, 141, 187, 95, 153, 156, 47, 182, 11, 253, 241, 107, 
+    39, 48, 227, 170, 3, 172, 20, 173, 193, 126, 181, 31, 70, 190, 200, 229, 
+    173, 194, 26, 246, 212, 81, 154, 216, 166, 61, 106, 13, 83, 37, 165, 121, 
+    0
+};
+static uint16_t genpoly_8_49[50] = {
+    156, 136, 111, 101, 245, 43, 113, 156, 195, 136, 109, 107, 254, 94, 64, 131, 
+    180, 98, 142, 107, 204, 204, 165, 237, 190, 166, 165, 45, 36, 243, 98, 85, 
+    248, 27, 185, 70, 52, 164, 224, 178, 157, 168, 81, 245, 127, 26, 89, 51, 
+    28, 0
+};
+static uint16_t genpoly_8_50[51] = {
+    205, 110, 246, 214, 13, 211, 196, 8, 182, 104, 15, 95, 105, 8, 86, 135, 
+    130, 165, 118, 203, 67, 76, 123, 53, 180, 89, 131, 210, 231, 135, 77, 164, 
+    30, 28, 199, 155, 57, 185, 233, 174, 45, 85, 114, 146, 30, 251, 4, 156, 
+    139, 209, 0
+};
+static uint16_t genpoly_8_51[52] = {
+    0, 89, 150, 24, 56, 164, 39, 21, 219, 21, 168, 186, 23, 44, 185, 87, 
+    64, 45, 115, 109, 93, 124, 180, 196, 181, 9, 239, 106, 71, 5, 154, 73, 
+    39, 250, 130, 99, 72, 120, 184, 113, 226, 158, 216, 109, 116, 84, 159, 1, 
+    174, 250, 139, 0
+};
+static uint16_t genpoly_8_52[53] = {
+    51, 77, 67, 121, 59, 145, 185, 57, 170, 251, 23, 22, 52, 155, 159, 124, 
+    209, 172, 188, 44, 192, 88, 166, 191, 7, 203, 97, 152, 160, 38, 217, 88, 
+    141, 197, 35, 223, 209, 73, 57, 2, 103, 22, 227, 149, 17, 108, 185, 94, 
+    212, 223, 118, 77, 0
+};
+static uint16_t genpoly_8_53[54] = {
+    103, 2, 184, 167, 30, 22, 40, 77, 80, 76, 127, 6, 17, 58, 144, 227, 
+    120, 191, 189, 246, 1, 61, 4, 51, 131, 158, 165, 139, 80, 1, 124, 25, 
+    30, 173, 111, 2, 207, 84, 139, 4, 121, 28, 220, 34, 186, 138, 83, 249, 
+    179, 135, 220, 185, 206, 0
+};
+static uint16_t genpoly_8_54[55] = {
+    156, 20, 75, 250, 42, 214, 138, 153, 66, 207, 173, 76, 222, 244, 13, 178, 
+    189, 68, 174, 213, 169, 91, 198, 110, 212, 248, 86, 173, 33, 142, 53, 153, 
+    188, 28, 53, 44, 207, 48, 116, 52, 89, 12, 192, 248, 37, 18, 79, 113, 
+    45, 68, 98, 253, 25, 172, 0
+};
+static uint16_t genpoly_8_55[56] = {
+    210, 69, 89, 137, 121, 222, 71, 247, 138, 189, 45, 118, 33, 190, 195, 43, 
+    136, 133, 47, 194, 132, 0, 224, 45, 12, 70, 172, 90, 63, 91, 190, 78, 
+    57, 182, 159, 237, 245, 44, 76, 25, 133, 231, 172, 216, 247, 120, 210, 105, 
+    160, 185, 27, 127, 89, 242, 168, 0
+};
+static uint16_t genpoly_8_56[57] = {
+    10, 100, 115, 128, 240, 23, 56, 157, 209, 238, 4, 222, 52, 233, 118, 202, 
+    233, 57, 89, 44, 90, 195, 110, 48, 179, 102, 226, 153, 212, 98, 116, 192, 
+    214, 28, 35, 65, 160, 59, 49, 217, 83, 252, 113, 173, 192, 52, 34, 213, 
+    129, 22, 121, 33, 195, 28, 215, 145, 0
+};
+static uint16_t genpoly_8_57[58] = {
+    66, 225, 216, 224, 46, 212, 182, 212, 189, 124, 123, 251, 226, 67, 231, 195, 
+    207, 224, 83, 156, 10, 223, 120, 4, 252, 84, 73, 22, 90, 62, 193, 188, 
+    143, 0, 206, 11, 58, 44, 134, 5, 90, 17, 204, 184, 219, 67, 36, 107, 
+    52, 61, 28, 197, 171, 204, 71, 7, 215, 0
+};
+static uint16_t genpoly_8_58[59] = {
+    123, 130, 190, 174, 246, 122, 220, 187, 93, 208, 113, 219, 104, 90, 169, 157, 
+    49, 47, 99, 254, 226, 247, 252, 118, 57, 6, 159, 228, 63, 44, 6, 114, 
+    243, 33, 27, 31, 108, 46, 223, 194, 237, 128, 73, 124, 79, 198, 155, 213, 
+    50, 88, 171, 208, 184, 29, 96, 222, 181, 64, 0
+};
+static uint16_t genpoly_8_59[60] = {
+    181, 81, 244, 42, 90, 216, 24, 119, 217, 6, 91, 103, 221, 117, 86, 244, 
+    160, 38, 71, 164, 218, 102, 170, 144, 65, 215, 230, 208, 163, 166, 137, 76, 
+    63, 27, 209, 1, 22, 245, 119, 177, 65, 169, 78, 142, 168, 207, 180, 226, 
+    50, 235, 92, 245, 89, 191, 70, 141, 35, 179, 213, 0
+};
+static uint16_t genpoly_8_60[61] = {
+    240, 10, 66, 222, 84, 186, 244, 49, 20, 1, 15, 207, 231, 105, 239, 32, 
+    118, 20, 188, 7, 254, 220, 151, 188, 217, 94, 55, 150, 14, 137, 130, 78, 
+    151, 228, 74, 54, 118, 30, 189, 199, 174, 123, 245, 18, 57, 167, 60, 122, 
+    189, 106, 110, 37, 252, 222, 103, 241, 80, 159, 199, 84, 0
+};
+static uint16_t genpoly_8_61[62] = {
+    45, 155, 81, 130, 95, 11, 45, 100, 36, 145, 96, 217, 166, 201, 58, 16, 
+    247, 64, 1, 210, 183, 87, 100, 0, 92, 77, 20, 61, 42, 74, 187, 157, 
+    239, 147, 106, 5, 2, 212, 60, 100, 27, 63, 30, 16, 19, 142, 106, 88, 
+    171, 76, 67, 141, 130, 216, 220, 105, 11, 35, 10, 156, 170, 0
+};
+static uint16_t genpoly_8_62[63] = {
+    106, 175, 186, 105, 218, 237, 85, 116, 47, 121, 200, 3, 136, 96, 114, 50, 
+    191, 153, 5, 238, 91, 231, 182, 164, 119, 167, 218, 241, 168, 62, 84, 174, 
+    23, 195, 240, 252, 168, 56, 202, 186, 143, 131, 185, 16, 232, 64, 41, 94, 
+    97, 18, 252, 58, 194, 54, 174, 182, 90, 181, 101, 182, 202, 130, 0
+};
+static uint16_t genpoly_8_63[64] = {
+    168, 185, 155, 159, 142, 54, 5, 105, 12, 81, 125, 56, 126, 15, 213, 55, 
+    174, 46, 43, 191, 68, 88, 20, 195, 232, 143, 2, 133, 42, 137, 21, 20, 
+    244, 183, 237, 80, 109, 171, 250, 22, 178, 196, 202, 120, 181, 226, 167, 233, 
+    52, 148, 143, 192, 60, 67, 216, 85, 116, 209, 196, 222, 177, 111, 79, 0
+};
+static uint16_t genpoly_8_64[65] = {
+    231, 30, 203, 166, 234, 16, 115, 63, 39, 84, 123, 19, 217, 43, 170, 192, 
+    217, 67, 229, 12, 59, 103, 170, 71, 46, 39, 16, 210, 227, 49, 134, 250, 
+    128, 187, 8, 115, 230, 150, 148, 108, 52, 14, 50, 175, 68, 213, 112, 142, 
+    229, 141, 56, 121, 232, 226, 12, 165, 57, 18, 7, 100, 0, 124, 98, 117, 
+    0
+};
+static uint16_t genpoly_8_65[66] = {
+    40, 90, 45, 211, 238, 105, 74, 170, 249, 108, 123, 14, 177, 131, 195, 146, 
+    96, 107, 247, 195, 132, 91, 182, 218, 174, 105, 164, 221, 46, 231, 43, 105, 
+    100, 68, 9, 138, 7, 13, 124, 3, 135, 140, 120, 20, 120, 97, 96, 84, 
+    135, 60, 46, 31, 158, 140, 168, 213, 134, 211, 68, 163, 130, 199, 108, 133, 
+    114, 0
+};
+static uint16_t genpoly_8_66[67] = {
+    105, 232, 183, 131, 106, 187, 241, 207, 179, 141, 225, 92, 250, 169, 106, 249, 
+    128, 64, 110, 36, 138, 242, 248, 53, 144, 56, 53, 192, 135, 128, 48, 92, 
+    33, 118, 223, 217, 108, 123, 65, 57, 108, 46, 69, 168, 43, 227, 58, 146, 
+    155, 44, 43, 99, 146, 144, 160, 192, 5, 111, 84, 47, 16, 152, 6, 221, 
+    208, 192, 0
+};
+static uint16_t genpoly_8_67[68] = {
+    171, 17, 45, 244, 1, 30, 43, 94, 191, 46, 233, 169, 48, 217, 119, 135, 
+    206, 71, 42, 129, 209, 223, 119, 94, 209, 1, 234, 56, 81, 192, 175, 72, 
+    250, 26, 248, 151, 162, 199, 150, 228, 137, 249, 205, 92, 166, 125, 163, 83, 
+    192, 39, 2, 71, 189, 107, 139, 159, 214, 212, 214, 38, 130, 13, 189, 94, 
+    16, 6, 167, 0
+};
+static uint16_t genpoly_8_68[69] = {
+    238, 89, 91, 112, 120, 186, 147, 157, 84, 64, 144, 183, 131, 21, 173, 154, 
+    98, 155, 55, 67, 53, 45, 106, 226, 1, 72, 185, 243, 206, 144, 245, 205, 
+    236, 249, 162, 182, 102, 4, 232, 64, 59, 29, 159, 234, 96, 254, 67, 194, 
+    135, 82, 3, 36, 167, 156, 108, 144, 187, 172, 66, 174, 127, 133, 56, 28, 
+    150, 75, 242, 173, 0
+};
+static uint16_t genpoly_8_69[70] = {
+    51, 248, 0, 250, 80, 142, 140, 98, 239, 49, 254, 186, 237, 196, 69, 45, 
+    209, 139, 231, 172, 83, 236, 20, 50, 225, 211, 93, 31, 230, 106, 34, 112, 
+    206, 72, 222, 188, 225, 36, 129, 238, 242, 43, 31, 25, 75, 21, 33, 190, 
+    83, 117, 138, 129, 224, 226, 249, 205, 9, 237, 118, 118, 100, 222, 13, 242, 
+    176, 46, 148, 85, 10, 0
+};
+static uint16_t genpoly_8_70[71] = {
+    120, 118, 216, 216, 20, 159, 153, 148, 237, 6, 41, 98, 42, 104, 46, 253, 
+    157, 52, 17, 150, 245, 68, 13, 21, 106, 237, 34, 251, 75, 187, 53, 213, 
+    170, 99, 102, 50, 33, 216, 218, 192, 218, 28, 102, 209, 178, 57, 112, 213, 
+    136, 122, 230, 66, 119, 85, 121, 148, 127, 116, 240, 227, 101, 252, 159, 1, 
+    192, 129, 176, 48, 234, 67, 0
+};
+static uint16_t genpoly_8_71[72] = {
+    190, 137, 36, 127, 191, 49, 120, 111, 237, 209, 203, 90, 159, 114, 159, 180, 
+    60, 205, 135, 141, 173, 180, 50, 219, 27, 68, 10, 142, 245, 237, 84, 182, 
+    221, 13, 79, 135, 100, 229, 93, 231, 122, 209, 37, 230, 57, 110, 98, 242, 
+    109, 125, 185, 108, 6, 185, 185, 225, 20, 184, 69, 44, 160, 203, 139, 97, 
+    156, 95, 209, 26, 147, 241, 17, 0
+};
+static uint16_t genpoly_8_72[73] = {
+    6, 223, 71, 218, 118, 236, 26, 94, 216, 225, 167, 13, 167, 247, 185, 54, 
+    3, 124, 49, 20, 180, 124, 178, 17, 241, 5, 112, 134, 152, 168, 150, 229, 
+    206, 80, 9, 128, 201, 57, 122, 122, 177, 129, 234, 181, 94, 5, 167, 244, 
+    154, 114, 204, 79, 64, 88, 46, 50, 113, 93, 153, 144, 248, 23, 106, 93, 
+    13, 75, 191, 75, 141, 170, 207, 33, 0
+};
+static uint16_t genpoly_8_73[74] = {
+    78, 142, 5, 101, 57, 11, 61, 103, 47, 52, 31, 80, 193, 103, 166, 183, 
+    235, 170, 71, 37, 162, 234, 225, 248, 142, 67, 152, 84, 247, 178, 184, 143, 
+    101, 168, 179, 161, 42, 6, 53, 254, 171, 32, 2, 226, 148, 145, 165, 161, 
+    4, 7, 41, 201, 138, 249, 52, 14, 41, 34, 165, 76, 196, 214, 29, 163, 
+    112, 35, 19, 160, 38, 12, 239, 71, 136, 0
+};
+static uint16_t genpoly_8_74[75] = {
+    151, 74, 39, 150, 55, 65, 206, 253, 171, 253, 228, 59, 120, 244, 137, 24, 
+    224, 7, 232, 174, 39, 76, 195, 155, 233, 83, 74, 239, 57, 133, 54, 37, 
+    130, 178, 127, 191, 190, 217, 117, 45, 163, 141, 20, 109, 53, 59, 165, 19, 
+    36, 227, 49, 153, 120, 183, 73, 135, 120, 77, 221, 203, 243, 22, 80, 201, 
+    42, 249, 94, 103, 238, 24, 196, 218, 34, 251, 0
+};
+static uint16_t genpoly_8_75[76] = {
+    225, 98, 177, 135, 55, 14, 211, 94, 17, 73, 125, 207, 50, 122, 229, 201, 
+    16, 202, 20, 31, 127, 159, 243, 76, 91, 125, 41, 112, 163, 149, 215, 113, 
+    230, 158, 88, 90, 171, 61, 24, 60, 160, 84, 80, 78, 142, 170, 30, 225, 
+    100, 210, 220, 112, 23, 116, 213, 107, 192, 107, 215, 210, 66, 20, 94, 203, 
+    31, 130, 4, 129, 132, 175, 159, 126, 132, 100, 202, 0
+};
+static uint16_t genpoly_8_76[77] = {
+    45, 94, 123, 195, 217, 191, 82, 21, 35, 96, 122, 26, 120, 229, 29, 215, 
+    115, 171, 137, 251, 161, 169, 248, 46, 189, 160, 5, 1, 213, 177, 153, 196, 
+    228, 180, 245, 228, 247, 219, 45, 144, 97, 3, 200, 60, 33, 181, 63, 12, 
+    228, 196, 125, 205, 159, 196, 68, 169, 86, 101, 167, 126, 250, 20, 14, 139, 
+    210, 41, 62, 216, 80, 246, 232, 11, 217, 120, 228, 124, 0
+};
+static uint16_t genpoly_8_77[78] = {
+    121, 86, 36, 58, 194, 15, 176, 64, 134, 31, 62, 195, 111, 216, 53, 187, 
+    46, 187, 23, 30, 43, 120, 175, 223, 76, 175, 212, 137, 19, 144, 98, 51, 
+    228, 95, 184, 47, 47, 212, 120, 82, 98, 112, 36, 97, 187, 244, 246, 217, 
+    187, 241, 28, 27, 169, 249, 65, 196, 65, 167, 78, 250, 83, 121, 186, 231, 
+    63, 137, 145, 191, 84, 111, 220, 1, 19, 122, 165, 67, 41, 0
+};
+static uint16_t genpoly_8_78[79] = {
+    198, 228, 94, 37, 123, 58, 66, 224, 243, 196, 63, 201, 91, 18, 106, 22, 
+    84, 184, 105, 237, 143, 68, 192, 216, 64, 128, 38, 155, 221, 16, 131, 62, 
+    149, 161, 165, 52, 187, 78, 179, 223, 102, 179, 211, 254, 35, 209, 120, 211, 
+    203, 11, 139, 251, 57, 70, 184, 4, 158, 212, 210, 227, 18, 20, 98, 214, 
+    221, 56, 52, 85, 125, 181, 151, 55, 75, 245, 233, 70, 50, 107, 0
+};
+static uint16_t genpoly_8_79[80] = {
+    21, 230, 161, 20, 27, 167, 34, 39, 73, 230, 153, 127, 22, 178, 88, 0, 
+    99, 147, 27, 244, 20, 93, 65, 158, 237, 41, 171, 161, 164, 143, 183, 20, 
+    85, 7, 156, 213, 117, 143, 225, 207, 168, 108, 203, 99, 117, 237, 10, 10, 
+    122, 207, 89, 32, 206, 138, 185, 48, 146, 230, 180, 29, 175, 135, 177, 51, 
+    129, 139, 151, 172, 199, 147, 146, 166, 54, 226, 26, 63, 233, 41, 32, 0
+};
+static uint16_t genpoly_8_80[81] = {
+    100, 39, 149, 73, 251, 57, 129, 248, 129, 46, 173, 203, 189, 95, 234, 223, 
+    63, 148, 231, 152, 13, 211, 76, 17, 165, 200, 70, 25, 156, 72, 41, 58, 
+    29, 184, 243, 190, 9, 59, 21, 239, 138, 160, 118, 77, 203, 50, 24, 141, 
+    162, 112, 16, 223, 228, 18, 239, 35, 176, 204, 184, 240, 218, 23, 23, 116, 
+    207, 33, 220, 2, 17, 207, 98, 147, 151, 191, 248, 97, 212, 210, 207, 18, 
+    0
+};
+static uint16_t genpoly_8_81[82] = {
+    180, 92, 187, 35, 23, 0, 248, 62, 57, 76, 218, 197, 239, 236, 125, 88, 
+    5, 86, 206, 75, 150, 178, 168, 2, 253, 102, 203, 153, 249, 38, 199, 145, 
+    41, 102, 139, 251, 215, 180, 166, 9, 144, 104, 144, 221, 155, 110, 66, 129, 
+    12, 126, 150, 124, 138, 14, 93, 63, 137, 208, 132, 218, 148, 40, 140, 191, 
+    246, 85, 88, 45, 76, 254, 132, 73, 106, 7, 187, 38, 220, 163, 95, 167, 
+    247, 0
+};
+static uint16_t genpoly_8_82[83] = {
+    6, 76, 144, 232, 144, 186, 95, 85, 30, 163, 152, 146, 137, 190, 170, 138, 
+    29, 187, 48, 209, 232, 219, 39, 253, 142, 94, 9, 190, 26, 35, 69, 207, 
+    32, 18, 216, 51, 180, 35, 191, 58, 73, 14, 247, 151, 203, 221, 30, 75, 
+    159, 135, 68, 162, 198, 83, 248, 76, 69, 73, 40, 70, 30, 129, 61, 212, 
+    225, 28, 44, 72, 23, 217, 83, 11, 191, 121, 162, 136, 65, 75, 207, 214, 
+    45, 151, 0
+};
+static uint16_t genpoly_8_83[84] = {
+    88, 197, 168, 229, 126, 92, 66, 227, 93, 176, 24, 120, 126, 128, 164, 223, 
+    119, 251, 189, 91, 151, 86, 120, 164, 178, 23, 41, 36, 103, 107, 106, 117, 
+    134, 49, 172, 168, 20, 40, 86, 123, 162, 238, 197, 39, 173, 54, 181, 79, 
+    145, 67, 117, 120, 21, 183, 102, 16, 122, 45, 200, 18, 177, 51, 190, 173, 
+    31, 47, 27, 68, 90, 204, 86, 2, 169, 246, 61, 151, 203, 215, 159, 111, 
+    132, 244, 191, 0
+};
+static uint16_t genpoly_8_84[85] = {
+    171, 203, 213, 177, 47, 253, 151, 122, 159, 163, 216, 171, 24, 41, 26, 141, 
+    128, 10, 177, 156, 212, 184, 166, 169, 13, 238, 149, 247, 128, 108, 102, 78, 
+    223, 75, 127, 48, 61, 59, 15, 197, 151, 251, 90, 168, 240, 203, 193, 154, 
+    73, 232, 228, 93, 158, 185, 126, 49, 241, 22, 96, 102, 49, 122, 36, 226, 
+    171, 32, 225, 230, 10, 195, 252, 184, 84, 148, 110, 229, 142, 22, 223, 242, 
+    208, 0, 208, 115, 0
+};
+static uint16_t genpoly_8_85[86] = {
+    0, 242, 175, 178, 206, 130, 13, 163, 10, 185, 159, 64, 31, 150, 150, 214, 
+    2, 230, 147, 100, 233, 201, 220, 171, 229, 29, 65, 56, 40, 89, 59, 30, 
+    140, 120, 109, 214, 152, 56, 245, 82, 181, 196, 59, 17, 70, 226, 43, 122, 
+    104, 116, 94, 160, 87, 23, 84, 29, 230, 97, 29, 209, 89, 205, 63, 28, 
+    180, 128, 166, 129, 128, 71, 199, 51, 222, 19, 223, 234, 176, 172, 241, 7, 
+    40, 32, 175, 88, 71, 0
+};
+static uint16_t genpoly_8_86[87] = {
+    85, 132, 20, 201, 13, 95, 206, 86, 112, 97, 242, 68, 240, 218, 65, 144, 
+    136, 165, 173, 131, 238, 28, 43, 31, 37, 51, 172, 33, 165, 62, 101, 48, 
+    153, 98, 215, 2, 124, 208, 48, 118, 127, 32, 65, 47, 235, 117, 127, 33, 
+    133, 208, 39, 87, 215, 13, 238, 48, 16, 147, 165, 203, 2, 51, 207, 116, 
+    43, 198, 68, 131, 88, 250, 136, 59, 150, 218, 155, 153, 242, 12, 197, 86, 
+    121, 180, 13, 116, 105, 132, 0
+};
+static uint16_t genpoly_8_87[88] = {
+    171, 246, 194, 75, 65, 186, 200, 53, 64, 228, 183, 180, 18, 201, 162, 88, 
+    95, 73, 137, 186, 43, 62, 154, 138, 181, 143, 223, 169, 171, 216, 103, 119, 
+    200, 140, 222, 137, 196, 209, 229, 205, 192, 7, 185, 82, 39, 56, 47, 146, 
+    73, 11, 160, 61, 171, 170, 2, 231, 64, 217, 244, 113, 25, 248, 82, 34, 
+    160, 90, 167, 62, 119, 239, 89, 25, 187, 175, 128, 114, 190, 107, 66, 71, 
+    229, 35, 190, 238, 162, 195, 161, 0
+};
+static uint16_t genpoly_8_88[89] = {
+    3, 98, 74, 15, 215, 4, 57, 68, 52, 201, 80, 142, 151, 0, 166, 206, 
+    60, 53, 66, 171, 119, 143, 209, 15, 54, 53, 81, 241, 73, 243, 23, 142, 
+    37, 208, 30, 165, 97, 47, 251, 152, 45, 93, 181, 223, 95, 136, 7, 87, 
+    207, 227, 239, 203, 166, 147, 180, 16, 13, 31, 80, 213, 211, 37, 45, 185, 
+    99, 228, 80, 182, 71, 36, 99, 254, 174, 233, 106, 108, 172, 76, 182, 216, 
+    235, 164, 66, 181, 50, 18, 245, 182, 0
+};
+static uint16_t genpoly_8_89[90] = {
+    91, 63, 59, 28, 33, 32, 8, 58, 200, 67, 186, 172, 246, 11, 98, 88, 
+    56, 151, 179, 233, 237, 97, 168, 203, 64, 59, 124, 232, 23, 23, 183, 195, 
+    193, 178, 231, 106, 3, 81, 222, 52, 125, 79, 145, 97, 114, 70, 220, 180, 
+    26, 239, 78, 160, 186, 20, 35, 72, 186, 113, 27, 182, 189, 101, 222, 26, 
+    128, 45, 96, 228, 69, 121, 29, 142, 26, 98, 42, 219, 44, 191, 29, 210, 
+    3, 48, 73, 190, 126, 39, 201, 144, 60, 0
+};
+static uint16_t genpoly_8_90[91] = {
+    180, 105, 233, 222, 0, 59, 245, 218, 144, 169, 6, 232, 230, 60, 63, 229, 
+    147, 101, 231, 45, 253, 169, 76, 116, 206, 23, 84, 229, 223, 182, 172, 54, 
+    200, 33, 155, 6, 153, 196, 210, 232, 234, 113, 85, 15, 197, 43, 108, 92, 
+    73, 12, 44, 208, 97, 249, 117, 136, 196, 240, 63, 83, 112, 33, 240, 157, 
+    178, 28, 122, 198, 69, 73, 68, 26, 123, 159, 116, 109, 109, 17, 98, 11, 
+    206, 25, 166, 151, 89, 69, 176, 54, 231, 14, 0
+};
+static uint16_t genpoly_8_91[92] = {
+    15, 162, 243, 109, 162, 249, 240, 168, 17, 81, 76, 20, 3, 12, 80, 162, 
+    1, 160, 149, 65, 33, 153, 116, 247, 87, 133, 16, 157, 188, 95, 44, 11, 
+    27, 8, 233, 153, 21, 59, 38, 188, 127, 190, 87, 178, 83, 94, 49, 203, 
+    208, 27, 40, 142, 113, 128, 59, 186, 228, 218, 158, 87, 236, 179, 140, 143, 
+    22, 46, 73, 192, 7, 41, 243, 33, 230, 224, 145, 151, 222, 50, 147, 48, 
+    230, 196, 111, 212, 18, 0, 174, 252, 109, 153, 237, 0
+};
+static uint16_t genpoly_8_92[93] = {
+    106, 66, 114, 188, 118, 225, 244, 232, 36, 23, 57, 159, 115, 109, 101, 248, 
+    3, 83, 22, 52, 122, 2, 169, 101, 32, 83, 195, 158, 185, 129, 26, 207, 
+    53, 159, 22, 45, 237, 251, 225, 85, 152, 152, 233, 249, 60, 49, 169, 213, 
+    133, 231, 124, 207, 116, 213, 7, 197, 92, 64, 205, 251, 54, 117, 100, 112, 
+    77, 214, 160, 212, 70, 48, 25, 22, 51, 145, 24, 249, 78, 232, 249, 166, 
+    81, 34, 96, 226, 148, 253, 174, 64, 121, 100, 190, 51, 0
+};
+static uint16_t genpoly_8_93[94] = {
+    198, 27, 143, 184, 67, 51, 90, 106, 225, 167, 124, 10, 124, 91, 68, 139, 
+    214, 210, 70, 50, 234, 216, 143, 24, 11, 153, 15, 207, 56, 251, 185, 59, 
+    119, 55, 43, 214, 254, 82, 32, 142, 174, 47, 65, 10, 1, 151, 249, 203, 
+    13, 26, 198, 161, 51, 86, 217, 15, 228, 53, 176, 168, 88, 60, 163, 197, 
+    171, 139, 198, 169, 215, 236, 157, 184, 165, 91, 70, 253, 46, 213, 46, 138, 
+    69, 10, 59, 81, 32, 253, 42, 189, 58, 237, 7, 129, 176, 0
+};
+static uint16_t genpoly_8_94[95] = {
+    36, 71, 56, 165, 15, 207, 123, 159, 51, 53, 220, 29, 182, 52, 2, 58, 
+    57, 118, 149, 50, 184, 25, 54, 205, 141, 84, 37, 234, 57, 74, 4, 170, 
+    178, 73, 146, 187, 120, 51, 70, 156, 183, 21, 167, 49, 224, 44, 48, 235, 
+    210, 113, 200, 187, 212, 228, 42, 177, 253, 141, 117, 91, 212, 46, 58, 212, 
+    208, 185, 75, 159, 124, 78, 42, 13, 24, 157, 223, 251, 2, 133, 234, 142, 
+    248, 205, 242, 251, 94, 89, 249, 9, 135, 126, 96, 153, 206, 128, 0
+};
+static uint16_t genpoly_8_95[96] = {
+    130, 11, 202, 180, 98, 2, 126, 39, 206, 236, 208, 227, 48, 212, 65, 94, 
+    78, 63, 159, 231, 31, 77, 220, 218, 169, 61, 70, 103, 186, 177, 184, 91, 
+    136, 234, 11, 137, 195, 19, 141, 41, 44, 132, 243, 253, 110, 114, 43, 136, 
+    89, 157, 134, 36, 85, 236, 31, 104, 7, 13, 52, 134, 237, 17, 146, 209, 
+    70, 69, 223, 138, 216, 89, 241, 0, 210, 118, 136, 251, 102, 191, 1, 177, 
+    99, 231, 29, 26, 111, 253, 187, 63, 57, 50, 87, 89, 77, 5, 230, 0
+};
+static uint16_t genpoly_8_96[97] = {
+    225, 216, 253, 182, 224, 196, 32, 153, 197, 247, 247, 71, 102, 189, 81, 13, 
+    225, 195, 215, 97, 68, 35, 128, 240, 38, 200, 158, 247, 166, 162, 143, 127, 
+    168, 48, 28, 113, 1, 205, 220, 223, 40, 104, 210, 185, 170, 111, 224, 242, 
+    101, 147, 34, 81, 45, 220, 150, 204, 45, 133, 35, 180, 136, 153, 228, 153, 
+    178, 42, 218, 142, 51, 37, 108, 55, 53, 160, 208, 20, 213, 147, 170, 55, 
+    245, 193, 166, 179, 252, 126, 207, 112, 222, 83, 122, 191, 124, 242, 218, 86, 
+    0
+};
+static uint16_t genpoly_8_97[98] = {
+    66, 230, 122, 152, 145, 241, 145, 233, 230, 157, 177, 29, 120, 162, 232, 203, 
+    63, 6, 11, 72, 108, 246, 5, 67, 234, 243, 216, 254, 229, 61, 47, 5, 
+    123, 254, 16, 49, 151, 185, 70, 221, 141, 19, 101, 71, 21, 90, 140, 87, 
+    126, 78, 198, 155, 9, 99, 53, 242, 64, 90, 74, 82, 101, 226, 28, 154, 
+    41, 69, 110, 56, 229, 46, 230, 96, 27, 177, 169, 11, 156, 177, 45, 143, 
+    42, 3, 47, 235, 69, 186, 254, 51, 190, 167, 74, 145, 145, 208, 119, 248, 
+    5, 0
+};
+static uint16_t genpoly_8_98[99] = {
+    163, 221, 31, 171, 10, 57, 85, 241, 205, 85, 237, 109, 228, 75, 100, 249, 
+    148, 249, 227, 18, 233, 181, 111, 94, 211, 79, 154, 207, 131, 19, 96, 59, 
+    151, 104, 117, 187, 237, 230, 200, 221, 34, 15, 166, 112, 57, 91, 14, 153, 
+    121, 253, 24, 214, 233, 213, 82, 40, 252, 4, 181, 16, 153, 86, 251, 104, 
+    192, 82, 32, 98, 38, 119, 134, 113, 218, 46, 81, 122, 42, 15, 225, 168, 
+    25, 205, 7, 11, 20, 153, 209, 248, 24, 30, 53, 247, 249, 124, 235, 44, 
+    62, 155, 0
+};
+static uint16_t genpoly_8_99[100] = {
+    6, 65, 24, 82, 31, 179, 158, 183, 215, 62, 167, 171, 55, 185, 15, 119, 
+    196, 81, 217, 236, 181, 53, 48, 202, 240, 58, 247, 147, 86, 178, 56, 110, 
+    207, 134, 224, 35, 122, 63, 247, 98, 36, 165, 164, 179, 100, 129, 17, 29, 
+    189, 250, 201, 42, 39, 184, 198, 71, 52, 194, 97, 125, 89, 140, 113, 74, 
+    144, 235, 47, 22, 82, 185, 209, 19, 237, 239, 207, 36, 155, 158, 65, 95, 
+    52, 190, 211, 228, 53, 106, 178, 205, 223, 121, 173, 228, 98, 230, 153, 162, 
+    115, 214, 157, 0
+};
+static uint16_t genpoly_8_100[101] = {
+    105, 13, 228, 180, 47, 50, 130, 106, 7, 177, 249, 206, 222, 117, 230, 139, 
+    171, 234, 154, 76, 249, 106, 25, 244, 198, 192, 76, 90, 131, 238, 65, 175, 
+    108, 40, 104, 247, 75, 53, 185, 250, 18, 17, 164, 27, 17, 22, 160, 137, 
+    170, 168, 48, 69, 227, 95, 19, 37, 188, 99, 137, 146, 48, 181, 17, 41, 
+    219, 37, 50, 142, 111, 79, 125, 199, 248, 108, 250, 12, 174, 121, 58, 40, 
+    84, 67, 46, 27, 120, 244, 236, 24, 30, 170, 114, 198, 184, 184, 109, 185, 
+    83, 117, 66, 7, 0
+};
+static uint16_t genpoly_8_101[102] = {
+    205, 132, 196, 149, 165, 86, 21, 98, 205, 244, 129, 53, 22, 49, 182, 119, 
+    211, 229, 72, 33, 109, 194, 98, 241, 5, 170, 230, 194, 94, 48, 145, 204, 
+    193, 216, 30, 147, 52, 26, 195, 208, 190, 19, 36, 47, 140, 214, 73, 45, 
+    43, 169, 241, 191, 19, 48, 205, 133, 174, 0, 62, 206, 89, 160, 78, 220, 
+    206, 132, 127, 165, 251, 128, 39, 135, 193, 139, 139, 75, 170, 160, 41, 53, 
+    49, 119, 198, 137, 194, 76, 139, 102, 124, 252, 183, 159, 174, 35, 83, 161, 
+    126, 105, 244, 191, 27, 0
+};
+static uint16_t genpoly_8_102[103] = {
+    51, 72, 155, 212, 229, 44, 152, 84, 37, 27, 36, 28, 219, 199, 209, 166, 
+    31, 109, 162, 46, 161, 149, 26, 154, 97, 72, 48, 188, 38, 106, 50, 124, 
+    62, 141, 46, 168, 47, 98, 8, 58, 243, 31, 133, 14, 0, 177, 105, 53, 
+    46, 137, 82, 224, 236, 190, 253, 159, 110, 81, 58, 226, 244, 41, 152, 121, 
+    225, 214, 62, 82, 114, 108, 183, 144, 224, 179, 10, 59, 73, 251, 175, 131, 
+    157, 179, 90, 129, 144, 245, 66, 100, 42, 186, 105, 68, 230, 120, 29, 230, 
+    197, 243, 72, 209, 51, 122, 0
+};
+static uint16_t genpoly_8_103[104] = {
+    153, 246, 168, 244, 110, 181, 183, 33, 96, 187, 147, 8, 12, 214, 177, 11, 
+    151, 2, 115, 209, 247, 19, 54, 155, 83, 237, 23, 79, 105, 123, 181, 102, 
+    55, 83, 44, 2, 141, 166, 153, 199, 166, 157, 218, 184, 40, 110, 141, 158, 
+    127, 213, 123, 138, 87, 225, 213, 25, 209, 90, 212, 40, 82, 14, 106, 13, 
+    199, 51, 217, 90, 104, 44, 236, 106, 51, 28, 123, 3, 130, 227, 84, 83, 
+    53, 105, 223, 94, 209, 13, 53, 100, 113, 177, 112, 63, 212, 249, 187, 249, 
+    84, 132, 28, 110, 142, 219, 195, 0
+};
+static uint16_t genpoly_8_104[105] = {
+    1, 151, 145, 60, 200, 120, 123, 122, 103, 49, 110, 177, 50, 65, 250, 37, 
+    54, 180, 66, 220, 213, 163, 237, 241, 142, 26, 246, 112, 54, 248, 1, 36, 
+    91, 134, 44, 58, 33, 63, 24, 147, 110, 138, 147, 72, 13, 208, 132, 252, 
+    35, 97, 2, 237, 59, 134, 51, 43, 133, 247, 24, 252, 209, 165, 137, 25, 
+    149, 83, 112, 48, 170, 92, 230, 217, 71, 168, 30, 174, 132, 87, 118, 50, 
+    63, 59, 207, 30, 232, 136, 134, 145, 171, 51, 161, 128, 10, 34, 119, 210, 
+    161, 77, 230, 124, 101, 113, 95, 253, 0
+};
+static uint16_t genpoly_8_105[106] = {
+    105, 99, 150, 137, 116, 55, 162, 162, 37, 156, 72, 240, 64, 203, 201, 210, 
+    180, 183, 89, 16, 69, 229, 226, 14, 73, 185, 135, 180, 187, 42, 226, 211, 
+    125, 15, 195, 158, 189, 55, 21, 118, 158, 182, 228, 101, 1, 26, 75, 88, 
+    229, 105, 241, 216, 3, 206, 60, 236, 251, 16, 26, 164, 11, 137, 133, 156, 
+    6, 133, 244, 43, 228, 3, 123, 56, 27, 33, 15, 181, 148, 189, 78, 184, 
+    130, 169, 6, 114, 13, 4, 102, 71, 61, 209, 135, 22, 175, 187, 4, 242, 
+    222, 254, 20, 171, 215, 172, 89, 253, 98, 0
+};
+static uint16_t genpoly_8_106[107] = {
+    210, 106, 1, 45, 96, 129, 0, 104, 235, 248, 82, 105, 30, 120, 242, 64, 
+    1, 212, 250, 197, 23, 243, 195, 161, 4, 19, 197, 227, 158, 78, 178, 84, 
+    203, 207, 234, 212, 192, 114, 171, 18, 32, 133, 175, 85, 188, 172, 51, 189, 
+    223, 202, 152, 103, 140, 53, 35, 148, 92, 37, 208, 69, 81, 97, 8, 55, 
+    40, 148, 197, 78, 126, 219, 192, 107, 24, 147, 38, 69, 58, 108, 83, 47, 
+    167, 139, 19, 71, 0, 198, 128, 197, 145, 2, 196, 154, 227, 0, 60, 30, 
+    157, 218, 100, 119, 165, 189, 51, 150, 1, 1, 0
+};
+static uint16_t genpoly_8_107[108] = {
+    61, 153, 205, 93, 201, 51, 16, 139, 119, 133, 116, 57, 92, 28, 101, 47, 
+    52, 230, 221, 45, 146, 139, 151, 72, 93, 147, 228, 231, 147, 246, 156, 233, 
+    18, 227, 113, 193, 188, 59, 172, 110, 129, 204, 68, 229, 114, 46, 139, 107, 
+    11, 138, 191, 211, 224, 132, 79, 65, 201, 75, 171, 193, 183, 109, 165, 127, 
+    136, 124, 154, 228, 103, 59, 95, 118, 17, 86, 94, 34, 143, 215, 199, 249, 
+    227, 118, 186, 26, 154, 127, 9, 165, 213, 28, 186, 157, 46, 249, 70, 28, 
+    142, 95, 6, 141, 55, 81, 10, 54, 95, 101, 198, 0
+};
+static uint16_t genpoly_8_108[109] = {
+    168, 249, 242, 32, 239, 146, 183, 145, 144, 7, 246, 81, 34, 80, 254, 151, 
+    25, 16, 229, 6, 239, 252, 37, 18, 249, 226, 91, 252, 141, 225, 59, 201, 
+    157, 32, 123, 62, 159, 45, 107, 101, 211, 36, 129, 112, 248, 217, 3, 185, 
+    174, 171, 117, 240, 67, 206, 148, 99, 108, 174, 199, 146, 42, 201, 167, 19, 
+    198, 210, 120, 175, 243, 26, 180, 11, 18, 69, 23, 80, 98, 35, 41, 100, 
+    164, 168, 155, 183, 99, 16, 183, 36, 171, 86, 202, 137, 39, 58, 54, 28, 
+    130, 70, 128, 37, 67, 216, 147, 3, 244, 185, 33, 188, 0
+};
+static uint16_t genpoly_8_109[110] = {
+    21, 138, 120, 106, 215, 221, 60, 94, 187, 69, 157, 248, 95, 59, 88, 86, 
+    166, 26, 52, 51, 237, 127, 187, 196, 232, 164, 207, 152, 199, 1, 75, 141, 
+    162, 208, 220, 109, 65, 53, 130, 73, 239, 155, 253, 210, 168, 133, 211, 86, 
+    34, 116, 187, 203, 133, 86, 4, 205, 179, 118, 80, 211, 32, 97, 41, 58, 
+    127, 54, 243, 178, 227, 203, 184, 133, 203, 107, 43, 46, 181, 27, 153, 234, 
+    52, 142, 242, 189, 38, 253, 109, 247, 79, 81, 42, 190, 56, 88, 155, 49, 
+    167, 95, 140, 196, 0, 10, 64, 177, 230, 116, 154, 60, 225, 0
+};
+static uint16_t genpoly_8_110[111] = {
+    130, 201, 219, 194, 244, 152, 90, 181, 91, 67, 174, 114, 217, 75, 22, 130, 
+    56, 122, 17, 84, 237, 80, 17, 46, 110, 102, 100, 223, 54, 14, 61, 112, 
+    57, 168, 96, 161, 67, 169, 93, 51, 166, 138, 72, 34, 221, 8, 82, 249, 
+    145, 186, 87, 228, 51, 107, 94, 16, 240, 144, 234, 47, 52, 42, 147, 142, 
+    121, 193, 42, 1, 185, 142, 61, 92, 25, 247, 36, 21, 102, 65, 100, 46, 
+    141, 240, 171, 231, 254, 147, 46, 128, 245, 199, 247, 240, 64, 60, 140, 105, 
+    143, 87, 120, 163, 114, 153, 68, 49, 104, 57, 40, 136, 52, 180, 0
+};
+static uint16_t genpoly_8_111[112] = {
+    240, 151, 123, 134, 173, 22, 117, 52, 19, 67, 13, 227, 179, 38, 134, 160, 
+    196, 108, 209, 145, 111, 176, 66, 227, 56, 76, 134, 212, 221, 220, 170, 194, 
+    124, 159, 152, 133, 215, 12, 50, 110, 240, 161, 151, 204, 141, 157, 53, 216, 
+    149, 138, 253, 224, 172, 121, 211, 202, 147, 46, 101, 42, 239, 158, 188, 89, 
+    46, 28, 22, 151, 104, 196, 96, 65, 80, 165, 17, 110, 173, 82, 234, 89, 
+    49, 170, 110, 1, 137, 204, 36, 161, 222, 206, 206, 31, 210, 164, 208, 186, 
+    40, 159, 208, 239, 177, 108, 52, 149, 72, 27, 77, 118, 224, 103, 21, 0
+};
+static uint16_t genpoly_8_112[113] = {
+    96, 119, 186, 151, 226, 64, 100, 192, 3, 108, 126, 179, 150, 113, 210, 130, 
+    84, 106, 53, 195, 30, 163, 20, 134, 95, 135, 221, 104, 68, 245, 234, 161, 
+    64, 84, 1, 47, 45, 18, 6, 180, 157, 93, 32, 141, 169, 190, 60, 45, 
+    229, 0, 63, 248, 26, 100, 83, 177, 191, 66, 116, 22, 92, 203, 162, 243, 
+    106, 66, 225, 244, 112, 228, 8, 213, 166, 78, 48, 204, 120, 11, 109, 81, 
+    205, 191, 153, 53, 20, 200, 206, 9, 113, 41, 71, 103, 114, 168, 170, 112, 
+    234, 169, 138, 185, 111, 29, 120, 246, 30, 108, 160, 13, 64, 133, 57, 134, 
+    0
+};
+static uint16_t genpoly_8_113[114] = {
+    208, 87, 11, 71, 100, 229, 254, 32, 0, 204, 24, 149, 214, 196, 142, 63, 
+    166, 106, 163, 151, 192, 194, 119, 200, 114, 31, 137, 48, 72, 204, 116, 82, 
+    143, 136, 38, 8, 71, 215, 124, 248, 84, 122, 76, 134, 218, 75, 205, 164, 
+    170, 192, 37, 170, 162, 66, 174, 161, 23, 222, 248, 149, 184, 168, 64, 74, 
+    117, 238, 120, 49, 62, 93, 152, 237, 171, 21, 73, 92, 71, 70, 150, 68, 
+    54, 204, 31, 208, 184, 195, 59, 36, 73, 44, 18, 80, 43, 184, 31, 186, 
+    17, 220, 5, 227, 169, 75, 153, 171, 239, 178, 98, 208, 71, 85, 199, 27, 
+    246, 0
+};
+static uint16_t genpoly_8_114[115] = {
+    66, 227, 7, 179, 48, 131, 192, 214, 123, 229, 148, 75, 212, 33, 253, 23, 
+    127, 216, 191, 34, 176, 129, 178, 72, 208, 78, 61, 247, 44, 236, 103, 247, 
+    92, 243, 118, 73, 60, 14, 94, 139, 180, 77, 133, 206, 239, 152, 118, 82, 
+    62, 161, 2, 172, 112, 230, 168, 25, 35, 82, 177, 54, 84, 33, 57, 4, 
+    231, 22, 65, 227, 150, 71, 45, 154, 223, 54, 44, 145, 242, 49, 237, 137, 
+    69, 81, 72, 114, 112, 132, 82, 172, 128, 32, 49, 55, 48, 141, 75, 75, 
+    119, 31, 84, 122, 239, 161, 227, 232, 192, 160, 196, 174, 39, 120, 179, 197, 
+    167, 19, 0
+};
+static uint16_t genpoly_8_115[116] = {
+    180, 159, 221, 249, 230, 153, 168, 226, 124, 171, 247, 18, 212, 105, 164, 208, 
+    161, 251, 120, 136, 133, 187, 187, 205, 154, 246, 182, 245, 62, 27, 209, 53, 
+    76, 11, 44, 227, 199, 77, 222, 183, 145, 247, 162, 82, 130, 247, 14, 69, 
+    54, 127, 45, 211, 188, 254, 151, 93, 228, 168, 111, 57, 63, 7, 251, 71, 
+    235, 210, 178, 246, 147, 233, 97, 121, 214, 180, 151, 190, 114, 39, 35, 43, 
+    212, 170, 23, 229, 92, 134, 93, 14, 83, 161, 111, 160, 97, 220, 106, 193, 
+    82, 207, 224, 20, 208, 50, 132, 125, 72, 187, 252, 91, 79, 162, 33, 251, 
+    156, 14, 93, 0
+};
+static uint16_t genpoly_8_116[117] = {
+    40, 152, 32, 87, 179, 214, 69, 81, 15, 51, 68, 251, 34, 239, 115, 253, 
+    225, 164, 34, 199, 114, 23, 124, 93, 166, 71, 229, 245, 194, 179, 134, 38, 
+    16, 129, 201, 32, 232, 95, 164, 190, 68, 91, 211, 245, 140, 17, 243, 99, 
+    175, 253, 145, 133, 106, 209, 54, 210, 175, 240, 76, 125, 200, 120, 104, 144, 
+    181, 93, 245, 238, 45, 109, 138, 52, 60, 50, 156, 176, 38, 45, 159, 230, 
+    252, 192, 246, 59, 86, 248, 229, 159, 59, 250, 119, 101, 81, 148, 64, 103, 
+    79, 49, 24, 39, 240, 153, 155, 164, 99, 201, 158, 26, 130, 81, 209, 239, 
+    89, 137, 222, 227, 0
+};
+static uint16_t genpoly_8_117[118] = {
+    156, 21, 34, 162, 26, 172, 139, 246, 134, 206, 212, 81, 21, 70, 3, 213, 
+    24, 237, 211, 122, 186, 13, 224, 39, 63, 92, 63, 46, 203, 65, 40, 227, 
+    10, 78, 73, 198, 46, 137, 191, 141, 84, 23, 64, 48, 57, 36, 22, 82, 
+    214, 128, 25, 242, 37, 136, 18, 122, 46, 196, 157, 99, 22, 11, 226, 6, 
+    8, 48, 137, 59, 46, 16, 23, 102, 0, 160, 35, 190, 33, 233, 174, 108, 
+    193, 241, 22, 36, 180, 251, 97, 49, 213, 235, 217, 118, 31, 141, 1, 70, 
+    253, 55, 130, 103, 13, 194, 12, 196, 147, 237, 181, 196, 74, 141, 137, 169, 
+    86, 79, 99, 110, 236, 0
+};
+static uint16_t genpoly_8_118[119] = {
+    18, 171, 192, 198, 135, 53, 131, 95, 78, 104, 146, 4, 140, 91, 123, 135, 
+    18, 70, 63, 78, 143, 119, 248, 173, 43, 23, 118, 169, 38, 108, 215, 167, 
+    233, 106, 56, 104, 246, 240, 12, 202, 69, 73, 30, 190, 149, 242, 75, 150, 
+    231, 201, 189, 156, 180, 101, 234, 120, 247, 101, 147, 214, 30, 122, 151, 162, 
+    159, 164, 126, 240, 156, 51, 219, 21, 84, 134, 179, 103, 81, 7, 141, 157, 
+    105, 216, 105, 101, 191, 124, 134, 206, 137, 168, 236, 250, 82, 125, 28, 41, 
+    254, 8, 170, 243, 111, 1, 87, 87, 213, 64, 251, 253, 23, 119, 231, 131, 
+    50, 110, 75, 21, 153, 15, 0
+};
+static uint16_t genpoly_8_119[120] = {
+    136, 72, 126, 140, 210, 201, 51, 126, 221, 87, 83, 232, 102, 249, 183, 39, 
+    234, 103, 190, 224, 138, 115, 138, 236, 216, 42, 88, 8, 200, 237, 42, 126, 
+    212, 113, 123, 126, 191, 224, 154, 62, 169, 97, 119, 195, 75, 118, 65, 242, 
+    83, 2, 46, 104, 133, 28, 238, 120, 29, 86, 91, 243, 184, 169, 46, 126, 
+    99, 99, 26, 13, 121, 200, 38, 1, 42, 2, 192, 31, 33, 94, 209, 163, 
+    193, 167, 119, 223, 40, 174, 46, 27, 78, 131, 208, 53, 253, 215, 51, 107, 
+    9, 48, 162, 67, 35, 138, 188, 201, 143, 169, 117, 107, 119, 107, 248, 9, 
+    51, 113, 145, 36, 103, 226, 54, 0
+};
+static uint16_t genpoly_8_120[121] = {
+    0, 148, 240, 32, 110, 234, 157, 4, 210, 188, 24, 127, 33, 169, 44, 57, 
+    96, 22, 181, 54, 242, 68, 92, 84, 237, 173, 65, 191, 252, 102, 129, 166, 
+    129, 50, 88, 151, 171, 127, 96, 162, 242, 155, 101, 242, 38, 2, 154, 190, 
+    133, 67, 60, 174, 39, 194, 123, 82, 242, 81, 34, 145, 171, 26, 51, 234, 
+    21, 252, 174, 126, 107, 123, 145, 33, 235, 173, 18, 2, 174, 4, 254, 189, 
+    157, 213, 28, 195, 120, 236, 54, 152, 112, 30, 129, 238, 14, 89, 99, 88, 
+    33, 16, 160, 17, 72, 20, 28, 5, 215, 57, 180, 186, 186, 161, 194, 239, 
+    142, 72, 106, 64, 76, 134, 223, 12, 0
+};
+static uint16_t genpoly_8_121[122] = {
+    120, 44, 93, 178, 34, 166, 222, 142, 120, 209, 157, 100, 215, 132, 251, 205, 
+    146, 171, 132, 77, 104, 204, 77, 70, 117, 226, 228, 200, 212, 186, 26, 30, 
+    201, 254, 57, 148, 228, 139, 31, 136, 119, 5, 191, 1, 117, 252, 70, 56, 
+    113, 149, 157, 220, 141, 132, 66, 254, 236, 71, 61, 120, 105, 45, 195, 16, 
+    161, 206, 104, 51, 252, 141, 100, 172, 44, 143, 221, 115, 177, 177, 196, 11, 
+    215, 209, 106, 136, 124, 93, 148, 192, 14, 96, 60, 191, 231, 137, 5, 168, 
+    46, 72, 160, 47, 54, 89, 197, 132, 51, 161, 100, 26, 42, 5, 25, 217, 
+    149, 195, 97, 57, 136, 139, 163, 213, 44, 0
+};
+static uint16_t genpoly_8_122[123] = {
+    241, 49, 129, 171, 65, 230, 39, 92, 143, 4, 63, 118, 73, 199, 99, 42, 
+    179, 106, 166, 168, 12, 206, 98, 195, 243, 246, 166, 248, 106, 31, 250, 67, 
+    205, 211, 146, 2, 110, 81, 183, 211, 233, 22, 181, 231, 16, 216, 205, 112, 
+    119, 14, 124, 202, 72, 119, 144, 82, 38, 205, 191, 32, 220, 119, 99, 45, 
+    83, 231, 198, 121, 62, 171, 3, 12, 68, 92, 76, 203, 175, 65, 254, 93, 
+    177, 152, 242, 99, 205, 237, 145, 171, 194, 138, 11, 7, 69, 239, 193, 214, 
+    11, 225, 101, 187, 224, 211, 151, 186, 63, 137, 89, 86, 22, 1, 9, 188, 
+    12, 87, 105, 188, 14, 84, 53, 38, 130, 184, 0
+};
+static uint16_t genpoly_8_123[124] = {
+    108, 82, 46, 119, 225, 173, 15, 76, 5, 194, 25, 191, 3, 224, 78, 57, 
+    183, 51, 13, 114, 15, 26, 12, 128, 25, 29, 98, 98, 66, 92, 7, 203, 
+    154, 127, 15, 3, 131, 130, 37, 20, 220, 48, 110, 133, 158, 27, 81, 159, 
+    87, 187, 156, 81, 221, 217, 43, 72, 33, 174, 237, 74, 44, 146, 85, 116, 
+    24, 65, 135, 127, 44, 148, 200, 82, 75, 28, 192, 225, 175, 230, 54, 63, 
+    171, 26, 97, 147, 80, 230, 201, 80, 85, 230, 220, 125, 52, 244, 207, 59, 
+    224, 102, 166, 40, 21, 38, 185, 52, 29, 61, 232, 242, 249, 148, 172, 84, 
+    150, 117, 164, 108, 57, 129, 165, 95, 122, 182, 96, 0
+};
+static uint16_t genpoly_8_124[125] = {
+    231, 212, 87, 44, 181, 86, 221, 60, 252, 64, 223, 161, 84, 162, 111, 44, 
+    206, 63, 221, 224, 224, 37, 95, 50, 221, 74, 144, 38, 179, 60, 76, 223, 
+    43, 84, 194, 135, 140, 159, 94, 137, 37, 43, 144, 70, 68, 177, 155, 43, 
+    142, 163, 82, 121, 108, 119, 149, 234, 31, 177, 214, 128, 94, 233, 120, 110, 
+    103, 14, 232, 72, 58, 138, 185, 32, 153, 43, 136, 94, 205, 238, 227, 126, 
+    149, 28, 234, 10, 136, 113, 202, 144, 2, 129, 65, 87, 178, 235, 220, 81, 
+    77, 68, 51, 113, 137, 98, 20, 94, 158, 35, 164, 138, 158, 128, 72, 0, 
+    54, 8, 202, 175, 240, 180, 218, 215, 187, 182, 102, 104, 0
+};
+static uint16_t genpoly_8_125[126] = {
+    100, 173, 55, 178, 199, 135, 227, 104, 74, 149, 186, 197, 147, 81, 142, 170, 
+    31, 179, 71, 15, 172, 84, 199, 226, 236, 108, 27, 177, 212, 11, 137, 130, 
+    156, 66, 244, 152, 110, 6, 216, 32, 247, 208, 232, 197, 98, 180, 143, 210, 
+    119, 56, 151, 140, 241, 99, 144, 178, 31, 13, 55, 198, 241, 121, 45, 238, 
+    190, 186, 19, 7, 96, 245, 13, 110, 196, 214, 244, 131, 167, 106, 73, 137, 
+    50, 99, 74, 240, 92, 7, 178, 238, 159, 139, 57, 25, 233, 199, 49, 187, 
+    192, 14, 110, 91, 48, 52, 173, 22, 38, 2, 231, 163, 147, 130, 145, 248, 
+    63, 5, 186, 51, 145, 201, 107, 106, 145, 85, 195, 203, 197, 0
+};
+static uint16_t genpoly_8_126[127] = {
+    225, 102, 76, 206, 138, 213, 81, 170, 178, 31, 76, 220, 243, 204, 121, 6, 
+    217, 64, 247, 180, 23, 92, 51, 135, 217, 183, 121, 120, 156, 104, 148, 251, 
+    123, 239, 31, 7, 187, 36, 123, 214, 202, 223, 202, 90, 30, 15, 206, 3, 
+    91, 93, 104, 14, 65, 37, 184, 233, 35, 73, 206, 99, 116, 73, 248, 223, 
+    123, 78, 251, 109, 91, 88, 180, 253, 79, 62, 220, 44, 9, 128, 1, 43, 
+    121, 60, 205, 140, 127, 23, 132, 19, 58, 101, 127, 77, 231, 59, 73, 76, 
+    103, 189, 116, 210, 86, 23, 187, 235, 26, 197, 3, 35, 232, 179, 207, 126, 
+    116, 74, 243, 95, 81, 166, 188, 55, 96, 103, 158, 101, 101, 2, 0
+};
+static uint16_t genpoly_8_127[128] = {
+    96, 175, 208, 175, 114, 100, 107, 227, 192, 83, 161, 58, 214, 248, 192, 188, 
+    1, 198, 80, 49, 136, 146, 7, 190, 74, 112, 144, 162, 47, 251, 189, 210, 
+    192, 154, 152, 252, 245, 61, 101, 69, 77, 126, 165, 8, 126, 150, 244, 14, 
+    87, 13, 89, 170, 142, 64, 70, 221, 38, 25, 214, 198, 220, 151, 148, 119, 
+    56, 214, 91, 34, 141, 31, 226, 113, 170, 148, 16, 223, 125, 173, 226, 174, 
+    230, 79, 114, 219, 230, 6, 96, 176, 42, 203, 37, 95, 231, 5, 136, 48, 
+    195, 48, 239, 164, 153, 9, 106, 197, 187, 133, 146, 10, 52, 212, 204, 136, 
+    197, 75, 5, 100, 73, 50, 101, 84, 248, 2, 124, 12, 202, 109, 205, 0
+};
+static uint16_t genpoly_8_128[129] = {
+    223, 174, 154, 180, 211, 204, 122, 126, 122, 225, 86, 16, 180, 92, 109, 132, 
+    56, 110, 87, 10, 133, 132, 189, 19, 2, 97, 201, 58, 217, 15, 209, 124, 
+    24, 96, 195, 246, 108, 247, 254, 175, 60, 129, 196, 99, 172, 119, 252, 180, 
+    226, 137, 137, 28, 171, 14, 225, 235, 154, 156, 39, 79, 192, 128, 99, 147, 
+    80, 20, 100, 2, 194, 209, 42, 32, 158, 112, 230, 147, 177, 162, 144, 17, 
+    234, 61, 6, 1, 182, 237, 207, 13, 72, 60, 12, 133, 122, 133, 210, 239, 
+    40, 13, 226, 160, 235, 204, 220, 244, 22, 167, 210, 26, 155, 160, 110, 6, 
+    80, 29, 134, 245, 206, 170, 113, 125, 150, 27, 151, 106, 241, 83, 185, 78, 
+    0
+};
+static uint16_t genpoly_8_129[130] = {
+    96, 99, 206, 179, 14, 99, 24, 194, 74, 208, 26, 249, 191, 111, 6, 102, 
+    53, 218, 52, 70, 147, 182, 228, 254, 139, 78, 239, 168, 166, 238, 26, 197, 
+    246, 236, 190, 87, 155, 163, 238, 126, 219, 165, 252, 183, 61, 218, 19, 241, 
+    190, 74, 59, 129, 82, 96, 228, 188, 221, 70, 223, 212, 126, 153, 129, 151, 
+    161, 97, 214, 64, 215, 60, 18, 156, 130, 153, 247, 159, 154, 12, 186, 243, 
+    130, 118, 41, 201, 17, 242, 236, 177, 217, 143, 177, 161, 213, 77, 136, 111, 
+    29, 166, 244, 200, 29, 84, 213, 156, 122, 55, 42, 143, 224, 61, 111, 220, 
+    3, 220, 141, 172, 149, 101, 31, 190, 244, 237, 229, 186, 133, 175, 212, 111, 
+    131, 0
+};
+static uint16_t genpoly_8_130[131] = {
+    225, 168, 72, 172, 209, 98, 115, 37, 83, 101, 205, 130, 110, 63, 221, 195, 
+    219, 156, 101, 231, 148, 137, 219, 234, 60, 156, 161, 147, 217, 128, 190, 210, 
+    5, 144, 16, 23, 192, 151, 95, 51, 111, 10, 229, 180, 86, 48, 59, 204, 
+    192, 234, 192, 247, 124, 203, 251, 132, 115, 78, 78, 82, 200, 28, 95, 122, 
+    106, 119, 232, 119, 218, 22, 65, 73, 195, 66, 229, 117, 107, 185, 232, 226, 
+    42, 210, 39, 177, 158, 18, 182, 147, 67, 229, 201, 12, 182, 109, 21, 233, 
+    97, 96, 83, 159, 10, 74, 34, 90, 230, 96, 126, 171, 27, 71, 208, 162, 
+    158, 84, 18, 120, 17, 240, 158, 49, 250, 17, 125, 205, 154, 8, 245, 79, 
+    105, 72, 0
+};
+static uint16_t genpoly_8_131[132] = {
+    100, 205, 49, 201, 110, 201, 22, 36, 89, 18, 6, 217, 154, 145, 81, 63, 
+    220, 230, 202, 188, 217, 46, 82, 133, 203, 240, 147, 232, 104, 87, 243, 27, 
+    181, 66, 87, 12, 36, 96, 246, 71, 199, 65, 237, 65, 246, 236, 52, 152, 
+    63, 144, 5, 33, 150, 153, 11, 63, 222, 135, 249, 100, 233, 10, 133, 251, 
+    240, 227, 162, 45, 181, 188, 190, 28, 20, 39, 50, 7, 228, 46, 58, 180, 
+    188, 30, 39, 83, 42, 67, 121, 1, 200, 242, 195, 199, 196, 241, 216, 26, 
+    127, 72, 176, 161, 132, 218, 187, 74, 72, 112, 75, 163, 218, 37, 126, 167, 
+    8, 147, 45, 160, 128, 16, 205, 84, 17, 186, 68, 9, 81, 192, 241, 20, 
+    236, 209, 235, 0
+};
+static uint16_t genpoly_8_132[133] = {
+    231, 73, 79, 171, 132, 95, 118, 191, 81, 17, 171, 11, 234, 182, 156, 171, 
+    81, 224, 14, 27, 167, 108, 239, 244, 95, 121, 224, 211, 182, 222, 195, 73, 
+    246, 235, 2, 76, 18, 188, 184, 215, 212, 146, 30, 66, 124, 134, 233, 138, 
+    4, 8, 163, 94, 184, 172, 209, 71, 146, 235, 44, 9, 244, 36, 108, 27, 
+    107, 99, 8, 223, 100, 144, 94, 146, 223, 112, 16, 76, 111, 160, 167, 254, 
+    135, 169, 107, 76, 196, 199, 163, 188, 47, 113, 201, 186, 121, 248, 86, 214, 
+    168, 95, 145, 247, 127, 78, 69, 220, 49, 202, 84, 105, 203, 221, 85, 78, 
+    6, 245, 101, 180, 161, 120, 229, 124, 45, 201, 230, 200, 133, 112, 163, 9, 
+    170, 78, 110, 228, 0
+};
+static uint16_t genpoly_8_133[134] = {
+    108, 38, 36, 35, 191, 206, 101, 121, 70, 98, 4, 10, 117, 96, 27, 80, 
+    23, 174, 97, 183, 95, 147, 135, 235, 40, 102, 194, 122, 250, 134, 164, 114, 
+    126, 134, 5, 80, 171, 4, 110, 242, 190, 248, 200, 203, 214, 101, 220, 153, 
+    79, 38, 116, 86, 79, 40, 62, 103, 243, 248, 233, 148, 242, 136, 223, 91, 
+    227, 55, 224, 158, 112, 152, 139, 139, 175, 149, 178, 131, 14, 132, 115, 197, 
+    43, 205, 80, 233, 23, 187, 129, 64, 68, 49, 161, 26, 197, 7, 182, 173, 
+    190, 225, 2, 50, 47, 162, 18, 191, 29, 13, 8, 203, 234, 40, 103, 126, 
+    6, 77, 33, 70, 15, 242, 167, 237, 174, 63, 79, 196, 158, 253, 172, 20, 
+    248, 101, 68, 192, 62, 0
+};
+static uint16_t genpoly_8_134[135] = {
+    241, 31, 117, 108, 171, 126, 73, 220, 116, 203, 201, 214, 232, 95, 57, 67, 
+    48, 232, 163, 127, 112, 191, 35, 247, 147, 163, 36, 208, 22, 63, 192, 199, 
+    28, 130, 20, 199, 36, 18, 42, 29, 78, 87, 163, 234, 212, 52, 48, 1, 
+    210, 229, 7, 155, 187, 51, 46, 72, 136, 206, 107, 198, 242, 250, 184, 67, 
+    152, 36, 41, 235, 163, 25, 8, 45, 29, 217, 76, 154, 185, 151, 203, 6, 
+    102, 229, 232, 67, 41, 130, 233, 146, 60, 186, 213, 102, 153, 199, 57, 130, 
+    10, 108, 248, 23, 221, 198, 218, 1, 116, 109, 190, 243, 193, 187, 38, 5, 
+    170, 193, 236, 118, 21, 212, 150, 36, 148, 53, 57, 161, 15, 139, 174, 145, 
+    120, 40, 207, 11, 142, 178, 0
+};
+static uint16_t genpoly_8_135[136] = {
+    120, 133, 79, 158, 213, 75, 217, 161, 184, 218, 20, 125, 150, 179, 25, 66, 
+    4, 226, 190, 162, 25, 177, 48, 116, 128, 239, 66, 19, 77, 59, 90, 196, 
+    82, 1, 240, 183, 124, 107, 25, 185, 89, 199, 226, 166, 212, 19, 223, 53, 
+    27, 74, 167, 15, 225, 128, 26, 25, 74, 68, 34, 41, 6, 219, 12, 252, 
+    97, 185, 246, 21, 209, 45, 105, 138, 159, 40, 113, 21, 177, 36, 191, 63, 
+    135, 2, 225, 188, 99, 117, 145, 219, 111, 147, 64, 123, 198, 124, 218, 229, 
+    191, 152, 100, 238, 163, 86, 223, 170, 150, 165, 0, 139, 202, 115, 154, 164, 
+    18, 71, 66, 35, 38, 187, 89, 243, 171, 251, 16, 108, 204, 220, 29, 116, 
+    214, 136, 115, 119, 185, 227, 147, 0
+};
+static uint16_t genpoly_8_136[137] = {
+    0, 55, 224, 163, 51, 160, 209, 93, 168, 74, 78, 242, 104, 140, 152, 77, 
+    46, 225, 227, 232, 103, 133, 77, 172, 40, 8, 185, 92, 186, 157, 129, 137, 
+    122, 98, 154, 191, 151, 238, 157, 211, 33, 253, 126, 17, 187, 62, 233, 16, 
+    122, 189, 55, 218, 128, 209, 146, 48, 70, 49, 194, 11, 147, 26, 24, 123, 
+    70, 173, 183, 14, 38, 134, 168, 23, 40, 213, 234, 101, 87, 71, 119, 94, 
+    235, 78, 41, 224, 8, 218, 175, 174, 227, 241, 68, 17, 7, 212, 186, 178, 
+    78, 121, 187, 133, 166, 71, 154, 218, 107, 242, 99, 247, 141, 167, 125, 68, 
+    220, 217, 242, 163, 253, 247, 107, 225, 166, 62, 2, 110, 194, 197, 153, 14, 
+    228, 18, 254, 70, 81, 58, 239, 190, 0
+};
+static uint16_t genpoly_8_137[138] = {
+    136, 152, 108, 15, 18, 215, 1, 47, 62, 20, 151, 7, 183, 56, 75, 166, 
+    19, 229, 188, 231, 135, 173, 250, 163, 58, 137, 171, 173, 221, 228, 189, 138, 
+    25, 100, 213, 67, 121, 227, 250, 50, 21, 159, 142, 134, 0, 254, 238, 243, 
+    47, 246, 132, 68, 38, 74, 189, 130, 55, 7, 137, 133, 79, 129, 48, 97, 
+    158, 108, 133, 168, 248, 180, 219, 48, 142, 56, 114, 184, 129, 198, 116, 239, 
+    228, 140, 79, 2, 6, 89, 238, 166, 144, 64, 124, 238, 118, 238, 236, 108, 
+    244, 225, 118, 182, 23, 36, 101, 111, 117, 161, 138, 53, 211, 68, 139, 1, 
+    86, 126, 95, 46, 88, 169, 129, 205, 110, 19, 30, 58, 158, 149, 92, 100, 
+    88, 249, 98, 171, 249, 171, 32, 244, 152, 0
+};
+static uint16_t genpoly_8_138[139] = {
+    18, 0, 172, 121, 92, 149, 23, 61, 238, 136, 64, 47, 170, 102, 213, 56, 
+    75, 169, 159, 159, 101, 172, 2, 48, 16, 122, 12, 126, 14, 230, 227, 165, 
+    248, 225, 182, 93, 219, 164, 206, 110, 82, 114, 15, 117, 84, 34, 142, 215, 
+    241, 138, 156, 112, 110, 206, 21, 140, 104, 214, 62, 43, 168, 28, 118, 88, 
+    99, 163, 35, 85, 114, 102, 232, 66, 134, 125, 179, 31, 179, 207, 210, 203, 
+    85, 100, 108, 7, 6, 54, 76, 196, 103, 203, 169, 6, 51, 61, 229, 125, 
+    141, 103, 189, 80, 39, 115, 33, 25, 232, 138, 24, 59, 239, 105, 7, 237, 
+    241, 214, 226, 121, 193, 226, 18, 194, 57, 185, 209, 53, 73, 80, 11, 6, 
+    141, 76, 41, 237, 62, 51, 112, 4, 173, 119, 0
+};
+static uint16_t genpoly_8_139[140] = {
+    156, 129, 12, 177, 190, 215, 204, 75, 244, 49, 172, 207, 202, 81, 251, 186, 
+    212, 217, 91, 122, 21, 130, 248, 47, 148, 72, 244, 214, 214, 15, 221, 195, 
+    12, 185, 44, 54, 237, 254, 135, 58, 134, 167, 217, 237, 59, 110, 169, 111, 
+    205, 69, 40, 128, 146, 15, 145, 219, 106, 0, 6, 215, 70, 109, 9, 150, 
+    82, 96, 82, 234, 23, 215, 146, 71, 144, 109, 240, 88, 18, 249, 211, 34, 
+    41, 204, 60, 28, 3, 46, 33, 26, 125, 154, 45, 43, 66, 241, 44, 110, 
+    150, 247, 59, 143, 184, 123, 104, 204, 138, 245, 248, 192, 237, 125, 36, 97, 
+    214, 106, 51, 244, 5, 68, 67, 75, 38, 124, 112, 224, 60, 242, 189, 172, 
+    39, 121, 115, 172, 120, 111, 239, 76, 180, 132, 111, 0
+};
+static uint16_t genpoly_8_140[141] = {
+    40, 134, 8, 139, 113, 180, 137, 123, 125, 177, 207, 182, 229, 235, 97, 91, 
+    209, 221, 6, 176, 106, 172, 73, 160, 14, 71, 61, 58, 169, 82, 128, 56, 
+    164, 71, 126, 38, 65, 139, 92, 109, 204, 86, 137, 51, 46, 207, 112, 5, 
+    223, 155, 93, 134, 29, 173, 76, 210, 52, 124, 169, 26, 109, 133, 212, 163, 
+    11, 201, 137, 148, 39, 246, 126, 107, 16, 241, 91, 16, 197, 210, 120, 157, 
+    249, 27, 31, 102, 146, 165, 147, 105, 77, 43, 118, 41, 225, 123, 91, 47, 
+    2, 123, 70, 135, 114, 135, 234, 142, 184, 18, 222, 28, 237, 245, 178, 248, 
+    196, 201, 65, 191, 250, 2, 31, 246, 41, 227, 173, 249, 98, 96, 218, 217, 
+    72, 141, 27, 113, 177, 36, 166, 70, 119, 6, 246, 233, 0
+};
+static uint16_t genpoly_8_141[142] = {
+    180, 200, 195, 62, 2, 30, 29, 238, 100, 240, 7, 144, 131, 189, 178, 119, 
+    41, 145, 192, 18, 87, 184, 42, 167, 54, 119, 242, 57, 195, 219, 122, 145, 
+    207, 150, 194, 47, 231, 149, 159, 248, 182, 83, 238, 153, 42, 121, 136, 130, 
+    44, 100, 106, 114, 217, 238, 161, 68, 225, 252, 220, 116, 102, 99, 163, 38, 
+    206, 57, 169, 130, 135, 189, 84, 14, 234, 40, 150, 49, 52, 61, 8, 248, 
+    44, 162, 36, 0, 147, 235, 193, 146, 83, 177, 189, 41, 150, 209, 155, 21, 
+    121, 157, 128, 73, 33, 247, 173, 199, 49, 246, 177, 184, 0, 172, 225, 62, 
+    19, 110, 87, 132, 124, 174, 147, 137, 139, 157, 203, 237, 50, 61, 254, 173, 
+    44, 101, 229, 207, 45, 20, 18, 179, 40, 127, 47, 40, 160, 0
+};
+static uint16_t genpoly_8_142[143] = {
+    66, 58, 234, 222, 153, 147, 107, 103, 188, 188, 43, 172, 66, 64, 105, 173, 
+    42, 205, 89, 177, 157, 138, 27, 109, 34, 132, 8, 211, 167, 218, 232, 112, 
+    14, 166, 246, 88, 213, 33, 142, 33, 39, 34, 208, 227, 117, 90, 23, 127, 
+    142, 149, 24, 100, 170, 144, 199, 126, 56, 143, 66, 140, 165, 65, 102, 217, 
+    54, 225, 253, 135, 90, 3, 0, 200, 114, 231, 177, 81, 58, 144, 87, 109, 
+    108, 185, 144, 233, 18, 209, 236, 165, 97, 156, 41, 85, 123, 107, 214, 58, 
+    68, 249, 135, 104, 199, 139, 3, 111, 79, 84, 123, 112, 129, 163, 125, 82, 
+    61, 161, 224, 127, 38, 21, 37, 226, 3, 228, 106, 240, 11, 241, 192, 182, 
+    228, 46, 162, 127, 112, 116, 230, 4, 122, 21, 141, 69, 195, 133, 0
+};
+static uint16_t genpoly_8_143[144] = {
+    208, 88, 236, 150, 202, 187, 113, 70, 197, 165, 135, 97, 238, 143, 124, 244, 
+    240, 95, 38, 218, 205, 97, 125, 238, 120, 1, 165, 121, 210, 79, 120, 111, 
+    125, 117, 151, 29, 143, 159, 170, 160, 223, 35, 48, 86, 80, 54, 136, 158, 
+    28, 136, 217, 162, 45, 241, 249, 53, 3, 118, 101, 130, 78, 17, 212, 45, 
+    122, 217, 55, 108, 239, 102, 213, 5, 189, 0, 2, 252, 234, 39, 59, 77, 
+    113, 138, 56, 230, 140, 224, 99, 97, 5, 59, 164, 81, 56, 224, 1, 6, 
+    249, 85, 116, 0, 119, 194, 39, 85, 135, 3, 105, 202, 201, 181, 5, 126, 
+    225, 92, 164, 153, 177, 79, 28, 5, 236, 236, 66, 32, 158, 91, 6, 9, 
+    126, 119, 251, 204, 176, 72, 215, 105, 91, 247, 179, 52, 113, 57, 22, 0
+};
+static uint16_t genpoly_8_144[145] = {
+    96, 118, 154, 40, 18, 124, 41, 219, 52, 62, 0, 77, 51, 203, 91, 151, 
+    199, 181, 71, 55, 134, 33, 227, 224, 137, 230, 177, 166, 8, 10, 124, 142, 
+    12, 116, 245, 77, 227, 232, 184, 76, 238, 107, 192, 69, 82, 160, 243, 159, 
+    202, 165, 92, 243, 250, 4, 234, 246, 73, 208, 219, 53, 211, 73, 52, 43, 
+    93, 173, 190, 53, 100, 139, 200, 106, 137, 218, 169, 220, 38, 103, 97, 192, 
+    224, 31, 152, 30, 25, 234, 2, 103, 80, 110, 210, 92, 195, 45, 6, 191, 
+    85, 154, 95, 124, 158, 2, 237, 9, 252, 202, 167, 72, 179, 141, 166, 149, 
+    157, 144, 238, 236, 91, 106, 229, 139, 158, 102, 217, 135, 93, 126, 254, 221, 
+    96, 160, 212, 181, 141, 24, 59, 233, 80, 104, 38, 233, 239, 118, 89, 165, 
+    0
+};
+static uint16_t genpoly_8_145[146] = {
+    240, 166, 89, 118, 68, 100, 138, 52, 106, 77, 57, 102, 191, 176, 56, 23, 
+    11, 45, 62, 248, 131, 122, 68, 231, 28, 152, 56, 83, 213, 223, 215, 51, 
+    203, 163, 149, 76, 180, 221, 162, 250, 59, 27, 169, 118, 225, 67, 254, 171, 
+    108, 244, 26, 23, 236, 114, 157, 136, 171, 183, 214, 76, 39, 111, 13, 43, 
+    251, 49, 51, 93, 205, 160, 142, 253, 143, 71, 37, 37, 166, 67, 66, 135, 
+    244, 47, 205, 31, 240, 24, 172, 166, 246, 90, 166, 43, 111, 89, 242, 101, 
+    175, 150, 69, 8, 187, 201, 205, 112, 81, 224, 16, 39, 209, 24, 31, 215, 
+    85, 236, 195, 215, 79, 180, 161, 245, 197, 184, 243, 191, 101, 221, 194, 119, 
+    213, 35, 158, 47, 23, 149, 171, 237, 113, 253, 55, 252, 70, 149, 55, 137, 
+    70, 0
+};
+static uint16_t genpoly_8_146[147] = {
+    130, 101, 183, 99, 192, 196, 160, 195, 240, 177, 118, 205, 7, 107, 75, 34, 
+    184, 158, 227, 30, 115, 165, 203, 118, 81, 89, 24, 8, 176, 219, 219, 188, 
+    158, 145, 242, 26, 225, 220, 197, 19, 24, 149, 135, 141, 65, 1, 207, 228, 
+    166, 196, 151, 3, 62, 146, 58, 105, 107, 72, 235, 117, 108, 240, 97, 50, 
+    42, 253, 228, 0, 36, 56, 209, 241, 81, 123, 191, 206, 29, 241, 76, 150, 
+    233, 113, 12, 130, 32, 30, 8, 127, 100, 47, 192, 45, 108, 51, 77, 128, 
+    131, 31, 111, 28, 117, 21, 195, 126, 230, 99, 84, 189, 222, 100, 215, 126, 
+    197, 210, 78, 218, 104, 214, 26, 223, 94, 14, 116, 8, 203, 20, 80, 105, 
+    157, 198, 79, 39, 190, 77, 87, 140, 163, 77, 250, 60, 135, 26, 132, 149, 
+    88, 116, 0
+};
+static uint16_t genpoly_8_147[148] = {
+    21, 210, 82, 157, 137, 29, 220, 181, 92, 20, 182, 230, 74, 142, 225, 17, 
+    159, 40, 49, 159, 116, 113, 210, 217, 187, 106, 180, 195, 65, 146, 179, 156, 
+    4, 64, 188, 83, 139, 229, 160, 18, 12, 78, 221, 71, 52, 60, 105, 145, 
+    187, 218, 67, 92, 6, 191, 54, 225, 40, 227, 88, 102, 113, 18, 190, 98, 
+    13, 8, 141, 141, 162, 106, 69, 17, 33, 25, 207, 69, 162, 68, 214, 124, 
+    212, 66, 42, 156, 95, 41, 233, 182, 25, 120, 113, 35, 74, 12, 3, 182, 
+    122, 206, 211, 34, 101, 170, 234, 80, 208, 212, 178, 221, 81, 77, 0, 19, 
+    72, 31, 16, 65, 71, 203, 24, 52, 36, 130, 165, 100, 239, 86, 98, 210, 
+    107, 106, 206, 179, 146, 208, 234, 20, 30, 91, 38, 219, 162, 55, 228, 190, 
+    64, 98, 80, 0
+};
+static uint16_t genpoly_8_148[149] = {
+    168, 112, 202, 67, 206, 240, 64, 252, 89, 138, 36, 50, 110, 220, 16, 178, 
+    153, 26, 197, 247, 1, 125, 169, 235, 42, 223, 208, 107, 8, 46, 117, 127, 
+    238, 176, 118, 40, 207, 154, 180, 247, 22, 77, 161, 168, 248, 58, 175, 54, 
+    115, 250, 100, 19, 106, 146, 110, 232, 171, 171, 254, 221, 109, 34, 234, 202, 
+    72, 245, 162, 65, 59, 243, 130, 143, 75, 243, 120, 96, 36, 212, 52, 18, 
+    197, 56, 6, 197, 132, 115, 0, 163, 91, 56, 197, 222, 75, 244, 230, 119, 
+    187, 208, 142, 145, 118, 165, 139, 130, 173, 201, 47, 71, 124, 202, 243, 70, 
+    231, 172, 103, 14, 184, 181, 24, 61, 131, 83, 37, 160, 87, 133, 175, 239, 
+    223, 67, 125, 62, 42, 175, 121, 178, 176, 224, 63, 18, 77, 93, 13, 42, 
+    116, 85, 73, 91, 0
+};
+static uint16_t genpoly_8_149[150] = {
+    61, 63, 163, 246, 175, 113, 79, 155, 219, 194, 213, 218, 244, 60, 153, 28, 
+    118, 79, 242, 199, 148, 69, 240, 253, 119, 137, 129, 194, 234, 48, 76, 124, 
+    13, 214, 34, 29, 223, 26, 164, 71, 55, 146, 219, 167, 149, 58, 232, 183, 
+    83, 237, 191, 111, 92, 50, 124, 92, 237, 106, 2, 191, 32, 89, 54, 50, 
+    235, 108, 203, 145, 42, 199, 71, 8, 5, 89, 142, 68, 122, 145, 0, 170, 
+    150, 100, 55, 220, 232, 211, 133, 244, 131, 181, 192, 110, 66, 49, 11, 150, 
+    183, 77, 203, 135, 33, 241, 193, 94, 27, 225, 95, 254, 33, 49, 172, 117, 
+    86, 135, 48, 160, 192, 98, 61, 120, 199, 237, 49, 91, 206, 40, 26, 120, 
+    56, 242, 145, 40, 239, 130, 147, 124, 138, 174, 0, 102, 190, 67, 110, 141, 
+    27, 196, 119, 143, 150, 0
+};
+static uint16_t genpoly_8_150[151] = {
+    210, 54, 212, 50, 197, 180, 50, 13, 220, 167, 112, 238, 0, 37, 91, 8, 
+    66, 142, 138, 87, 198, 59, 27, 167, 235, 57, 141, 213, 164, 117, 176, 181, 
+    108, 87, 170, 43, 55, 140, 134, 153, 232, 22, 131, 68, 246, 57, 75, 83, 
+    55, 48, 21, 45, 27, 134, 126, 204, 195, 15, 35, 37, 100, 110, 207, 223, 
+    181, 114, 164, 29, 220, 25, 125, 47, 223, 117, 86, 188, 192, 74, 31, 216, 
+    145, 151, 197, 112, 98, 154, 72, 220, 55, 64, 160, 203, 52, 138, 169, 29, 
+    57, 171, 170, 39, 121, 254, 112, 246, 89, 177, 217, 145, 59, 56, 117, 144, 
+    231, 88, 109, 203, 181, 204, 76, 0, 101, 148, 46, 201, 235, 2, 31, 69, 
+    35, 173, 163, 158, 60, 170, 200, 248, 182, 234, 48, 137, 117, 23, 182, 81, 
+    224, 205, 73, 32, 45, 248, 0
+};
+static uint16_t genpoly_8_151[152] = {
+    105, 104, 104, 0, 157, 103, 18, 140, 234, 69, 241, 38, 176, 204, 224, 102, 
+    202, 246, 102, 139, 242, 10, 173, 110, 50, 74, 217, 126, 84, 203, 146, 182, 
+    66, 83, 199, 80, 225, 128, 149, 24, 215, 100, 163, 136, 48, 55, 230, 82, 
+    111, 176, 243, 31, 117, 225, 111, 107, 208, 129, 100, 226, 102, 79, 129, 22, 
+    0, 216, 71, 146, 5, 104, 107, 2, 163, 236, 15, 33, 213, 45, 116, 148, 
+    92, 47, 149, 155, 146, 176, 171, 60, 187, 144, 199, 72, 46, 25, 159, 88, 
+    92, 201, 165, 162, 181, 243, 26, 66, 142, 140, 70, 168, 106, 238, 25, 245, 
+    159, 134, 218, 165, 125, 94, 83, 171, 137, 206, 113, 99, 246, 187, 149, 230, 
+    140, 53, 250, 77, 79, 147, 141, 202, 207, 179, 9, 86, 53, 106, 39, 54, 
+    65, 48, 238, 142, 90, 44, 149, 0
+};
+static uint16_t genpoly_8_152[153] = {
+    1, 197, 97, 90, 50, 6, 139, 51, 49, 26, 86, 110, 174, 68, 79, 178, 
+    239, 70, 149, 46, 237, 252, 67, 199, 191, 87, 177, 145, 195, 66, 175, 95, 
+    10, 239, 138, 52, 205, 241, 80, 237, 29, 26, 184, 111, 59, 55, 171, 180, 
+    53, 175, 59, 196, 46, 3, 145, 35, 54, 85, 157, 234, 234, 24, 41, 142, 
+    252, 233, 116, 251, 65, 87, 129, 182, 61, 119, 77, 160, 1, 9, 30, 176, 
+    222, 192, 243, 50, 132, 167, 136, 102, 225, 219, 222, 54, 113, 217, 244, 21, 
+    94, 179, 138, 100, 247, 246, 213, 178, 160, 136, 231, 219, 72, 228, 150, 96, 
+    203, 5, 207, 217, 30, 236, 171, 121, 251, 185, 114, 109, 87, 141, 22, 36, 
+    244, 101, 73, 107, 196, 109, 61, 86, 104, 147, 152, 245, 200, 240, 65, 109, 
+    236, 87, 24, 250, 143, 32, 143, 92, 0
+};
+static uint16_t genpoly_8_153[154] = {
+    153, 21, 118, 11, 68, 82, 225, 100, 143, 24, 226, 138, 174, 249, 126, 216, 
+    243, 35, 156, 21, 72, 175, 237, 21, 208, 156, 118, 33, 142, 105, 221, 52, 
+    106, 111, 222, 174, 105, 149, 121, 96, 170, 23, 38, 60, 217, 249, 99, 49, 
+    79, 45, 241, 195, 139, 115, 106, 252, 165, 114, 41, 219, 170, 84, 169, 237, 
+    45, 158, 61, 224, 98, 75, 40, 132, 169, 200, 143, 150, 56, 235, 177, 18, 
+    178, 250, 61, 72, 210, 81, 55, 250, 195, 185, 225, 5, 23, 212, 109, 34, 
+    210, 109, 44, 1, 113, 240, 144, 38, 200, 82, 155, 53, 51, 122, 68, 149, 
+    237, 232, 6, 134, 10, 69, 241, 137, 129, 227, 21, 38, 25, 165, 159, 92, 
+    233, 133, 49, 113, 154, 154, 206, 189, 171, 227, 48, 61, 32, 60, 127, 63, 
+    219, 186, 246, 219, 179, 13, 59, 14, 20, 0
+};
+static uint16_t genpoly_8_154[155] = {
+    51, 79, 103, 193, 150, 6, 207, 92, 98, 24, 130, 184, 108, 155, 213, 169, 
+    187, 200, 27, 189, 208, 171, 66, 97, 191, 79, 93, 135, 191, 213, 166, 4, 
+    224, 113, 0, 164, 133, 210, 190, 43, 190, 70, 196, 75, 72, 58, 199, 138, 
+    109, 232, 17, 28, 44, 114, 124, 119, 33, 131, 231, 9, 61, 181, 135, 16, 
+    46, 112, 147, 75, 232, 14, 189, 204, 25, 214, 130, 122, 207, 196, 54, 71, 
+    181, 112, 25, 51, 138, 65, 130, 75, 249, 61, 97, 169, 135, 28, 10, 60, 
+    129, 131, 135, 68, 175, 12, 44, 130, 221, 28, 7, 138, 46, 7, 123, 228, 
+    196, 172, 139, 94, 88, 210, 235, 113, 51, 11, 224, 106, 115, 9, 89, 135, 
+    195, 28, 242, 250, 66, 18, 157, 240, 180, 200, 34, 118, 9, 53, 108, 31, 
+    79, 75, 251, 92, 54, 210, 201, 91, 103, 181, 0
+};
+static uint16_t genpoly_8_155[156] = {
+    205, 213, 142, 159, 58, 69, 112, 55, 71, 215, 111, 69, 135, 70, 100, 237, 
+    121, 125, 173, 41, 102, 33, 43, 162, 248, 43, 252, 91, 19, 243, 0, 185, 
+    157, 212, 238, 178, 104, 219, 232, 93, 118, 71, 224, 214, 68, 149, 244, 219, 
+    179, 243, 185, 40, 113, 0, 104, 118, 136, 235, 229, 180, 87, 53, 213, 218, 
+    61, 94, 82, 142, 64, 129, 109, 79, 78, 51, 125, 90, 160, 73, 251, 184, 
+    215, 96, 123, 251, 98, 229, 95, 131, 55, 96, 209, 22, 25, 121, 62, 197, 
+    136, 31, 138, 140, 223, 55, 52, 11, 39, 30, 189, 226, 112, 238, 244, 9, 
+    1, 112, 60, 208, 29, 14, 102, 88, 8, 169, 244, 35, 164, 80, 169, 46, 
+    219, 226, 118, 169, 184, 166, 2, 172, 212, 190, 243, 85, 47, 11, 82, 248, 
+    28, 171, 121, 78, 163, 66, 124, 214, 161, 245, 162, 0
+};
+static uint16_t genpoly_8_156[157] = {
+    105, 8, 172, 94, 175, 128, 71, 111, 185, 84, 198, 201, 171, 248, 166, 20, 
+    85, 210, 249, 83, 105, 78, 56, 35, 209, 251, 112, 146, 126, 222, 181, 170, 
+    234, 41, 233, 57, 14, 86, 137, 31, 64, 150, 121, 138, 103, 41, 231, 160, 
+    156, 209, 92, 104, 21, 220, 141, 249, 31, 234, 229, 74, 154, 230, 236, 192, 
+    159, 5, 215, 228, 27, 112, 120, 150, 104, 0, 113, 236, 24, 177, 24, 22, 
+    224, 26, 3, 245, 194, 85, 155, 247, 7, 53, 140, 30, 29, 162, 51, 145, 
+    169, 189, 189, 39, 191, 254, 246, 170, 71, 254, 87, 49, 96, 200, 116, 26, 
+    188, 68, 151, 25, 39, 106, 57, 106, 134, 22, 43, 206, 244, 25, 136, 22, 
+    26, 146, 212, 196, 254, 180, 46, 168, 40, 118, 129, 190, 165, 200, 191, 118, 
+    141, 16, 113, 99, 45, 71, 131, 33, 180, 199, 122, 58, 0
+};
+static uint16_t genpoly_8_157[158] = {
+    6, 162, 221, 123, 109, 244, 129, 69, 240, 197, 66, 32, 47, 28, 88, 85, 
+    122, 173, 78, 158, 146, 80, 100, 47, 81, 211, 64, 5, 180, 73, 159, 95, 
+    218, 117, 61, 51, 147, 250, 3, 190, 1, 95, 199, 34, 26, 75, 122, 146, 
+    96, 185, 57, 10, 84, 127, 105, 30, 161, 128, 227, 73, 47, 41, 157, 214, 
+    132, 102, 125, 105, 112, 74, 102, 160, 174, 25, 61, 223, 169, 40, 127, 49, 
+    61, 34, 187, 124, 187, 180, 10, 51, 122, 4, 96, 215, 36, 165, 91, 133, 
+    116, 221, 91, 89, 89, 221, 189, 108, 229, 30, 55, 201, 173, 183, 77, 152, 
+    204, 254, 106, 115, 110, 115, 148, 60, 151, 147, 150, 4, 159, 104, 80, 243, 
+    1, 207, 131, 34, 25, 249, 59, 211, 35, 200, 56, 75, 14, 62, 124, 226, 
+    10, 128, 212, 90, 65, 207, 135, 39, 253, 217, 75, 17, 57, 0
+};
+static uint16_t genpoly_8_158[159] = {
+    163, 169, 226, 23, 244, 29, 96, 233, 49, 103, 30, 6, 239, 10, 229, 113, 
+    38, 61, 147, 93, 72, 227, 208, 197, 199, 189, 130, 63, 145, 233, 116, 179, 
+    249, 207, 243, 240, 247, 234, 18, 162, 11, 138, 250, 218, 28, 104, 7, 143, 
+    188, 231, 139, 81, 96, 41, 118, 100, 48, 109, 227, 177, 152, 40, 74, 241, 
+    5, 181, 73, 121, 95, 10, 170, 248, 35, 201, 192, 22, 7, 36, 96, 3, 
+    194, 232, 46, 159, 172, 24, 211, 12, 32, 225, 153, 22, 72, 23, 200, 24, 
+    210, 19, 229, 97, 245, 225, 7, 157, 18, 39, 192, 20, 176, 111, 166, 219, 
+    181, 121, 143, 176, 51, 37, 8, 2, 211, 15, 126, 217, 63, 125, 10, 38, 
+    73, 33, 43, 59, 224, 126, 234, 75, 184, 46, 244, 108, 5, 17, 92, 10, 
+    224, 103, 175, 40, 162, 78, 122, 149, 110, 141, 199, 76, 122, 163, 0
+};
+static uint16_t genpoly_8_159[160] = {
+    66, 153, 60, 110, 226, 246, 218, 27, 40, 249, 18, 52, 40, 29, 38, 81, 
+    148, 59, 117, 244, 89, 235, 182, 132, 176, 134, 190, 211, 30, 25, 103, 218, 
+    160, 65, 160, 249, 8, 161, 84, 4, 65, 230, 120, 96, 39, 188, 118, 110, 
+    12, 150, 12, 245, 249, 135, 114, 195, 200, 78, 35, 4, 83, 227, 155, 240, 
+    114, 136, 234, 151, 193, 75, 188, 143, 205, 144, 195, 235, 143, 211, 174, 54, 
+    230, 192, 71, 100, 34, 91, 137, 40, 75, 217, 201, 161, 216, 141, 140, 215, 
+    183, 195, 109, 62, 80, 208, 93, 57, 149, 165, 28, 239, 77, 196, 176, 135, 
+    75, 180, 92, 40, 194, 60, 12, 199, 235, 157, 76, 20, 103, 111, 113, 50, 
+    205, 187, 206, 53, 76, 152, 193, 77, 130, 22, 172, 123, 120, 90, 129, 60, 
+    90, 144, 232, 85, 194, 2, 75, 218, 47, 80, 205, 27, 8, 55, 245, 0
+};
+static uint16_t genpoly_8_160[161] = {
+    225, 201, 189, 89, 203, 118, 70, 39, 234, 130, 54, 185, 231, 230, 202, 35, 
+    6, 59, 5, 104, 130, 142, 80, 251, 1, 1, 25, 161, 68, 55, 40, 95, 
+    89, 121, 163, 56, 162, 67, 156, 215, 52, 174, 102, 111, 62, 89, 92, 111, 
+    124, 119, 76, 8, 48, 178, 98, 81, 185, 120, 149, 212, 55, 48, 232, 211, 
+    3, 135, 79, 202, 113, 63, 143, 51, 245, 204, 28, 128, 246, 237, 239, 22, 
+    171, 118, 176, 15, 120, 98, 94, 111, 248, 150, 83, 99, 245, 175, 148, 45, 
+    9, 58, 175, 87, 190, 188, 221, 33, 194, 186, 44, 220, 186, 242, 151, 35, 
+    136, 219, 41, 134, 203, 93, 180, 93, 67, 71, 108, 115, 51, 41, 244, 43, 
+    107, 209, 250, 106, 215, 149, 109, 181, 22, 113, 38, 196, 25, 95, 92, 242, 
+    30, 155, 163, 32, 129, 179, 144, 61, 6, 162, 34, 178, 104, 86, 27, 135, 
+    0
+};
+static uint16_t genpoly_8_161[162] = {
+    130, 4, 136, 117, 81, 249, 96, 45, 145, 223, 89, 120, 8, 65, 47, 98, 
+    114, 71, 159, 146, 144, 82, 141, 48, 19, 235, 46, 150, 172, 247, 224, 186, 
+    120, 204, 118, 213, 123, 120, 216, 186, 162, 60, 200, 247, 231, 11, 147, 239, 
+    24, 130, 199, 226, 220, 131, 40, 219, 225, 4, 90, 225, 162, 174, 207, 187, 
+    128, 178, 232, 201, 63, 137, 30, 160, 52, 143, 242, 115, 38, 239, 164, 241, 
+    38, 213, 1, 19, 189, 83, 0, 222, 218, 222, 170, 135, 82, 103, 81, 207, 
+    248, 38, 192, 52, 114, 197, 100, 60, 69, 130, 219, 135, 66, 250, 96, 164, 
+    190, 179, 234, 237, 196, 1, 112, 160, 115, 57, 176, 46, 45, 143, 73, 73, 
+    254, 10, 171, 49, 167, 187, 5, 251, 25, 159, 28, 216, 252, 154, 251, 104, 
+    111, 249, 73, 117, 230, 13, 220, 29, 3, 20, 15, 161, 154, 81, 212, 71, 
+    34, 0
+};
+static uint16_t genpoly_8_162[163] = {
+    36, 213, 243, 113, 158, 176, 21, 120, 200, 183, 231, 204, 247, 146, 186, 247, 
+    226, 228, 220, 94, 235, 145, 130, 158, 120, 47, 74, 220, 210, 145, 210, 164, 
+    5, 29, 250, 217, 74, 130, 63, 40, 182, 219, 135, 139, 161, 229, 118, 88, 
+    201, 79, 4, 143, 232, 97, 42, 210, 157, 93, 23, 215, 224, 75, 127, 211, 
+    153, 97, 69, 148, 111, 136, 153, 96, 210, 254, 230, 123, 74, 80, 215, 215, 
+    51, 129, 145, 148, 242, 201, 34, 177, 123, 241, 36, 16, 167, 244, 58, 189, 
+    204, 71, 221, 118, 128, 170, 158, 243, 145, 54, 212, 104, 30, 179, 153, 158, 
+    113, 27, 243, 224, 93, 43, 69, 141, 231, 154, 211, 163, 25, 186, 224, 206, 
+    78, 206, 21, 19, 159, 188, 92, 196, 144, 211, 123, 0, 66, 175, 104, 57, 
+    22, 124, 216, 76, 109, 163, 103, 154, 20, 66, 177, 191, 186, 180, 1, 50, 
+    19, 83, 0
+};
+static uint16_t genpoly_8_163[164] = {
+    198, 250, 73, 96, 30, 129, 79, 176, 151, 114, 67, 222, 207, 6, 143, 7, 
+    251, 216, 253, 31, 59, 112, 69, 23, 106, 24, 17, 124, 156, 59, 239, 26, 
+    114, 45, 206, 225, 209, 212, 204, 18, 167, 115, 170, 205, 184, 35, 212, 190, 
+    181, 132, 84, 79, 25, 240, 139, 88, 24, 156, 243, 24, 90, 13, 159, 7, 
+    53, 253, 119, 116, 189, 60, 28, 95, 22, 33, 217, 242, 213, 247, 187, 142, 
+    156, 18, 192, 168, 247, 130, 28, 87, 209, 22, 186, 13, 179, 205, 75, 42, 
+    62, 158, 130, 23, 70, 60, 7, 177, 204, 6, 12, 228, 130, 19, 213, 91, 
+    238, 81, 222, 109, 211, 71, 242, 229, 88, 146, 184, 74, 18, 42, 143, 233, 
+    87, 161, 93, 0, 5, 56, 224, 159, 220, 206, 51, 226, 236, 120, 1, 41, 
+    106, 166, 222, 95, 199, 173, 129, 168, 21, 214, 99, 229, 92, 88, 231, 225, 
+    129, 199, 214, 0
+};
+static uint16_t genpoly_8_164[165] = {
+    106, 89, 42, 113, 200, 188, 219, 166, 139, 252, 185, 245, 157, 153, 190, 151, 
+    198, 173, 173, 251, 183, 123, 223, 149, 158, 197, 181, 254, 247, 192, 85, 242, 
+    163, 86, 154, 113, 149, 24, 218, 91, 77, 32, 253, 172, 182, 245, 205, 216, 
+    215, 44, 69, 91, 148, 220, 214, 117, 89, 210, 238, 176, 86, 66, 29, 226, 
+    36, 85, 207, 98, 89, 70, 139, 157, 208, 32, 183, 161, 9, 63, 31, 46, 
+    15, 55, 13, 147, 199, 67, 144, 13, 51, 40, 154, 95, 108, 149, 223, 246, 
+    102, 203, 149, 119, 162, 189, 84, 213, 70, 252, 151, 215, 186, 51, 240, 83, 
+    103, 138, 208, 20, 28, 121, 202, 79, 108, 190, 108, 234, 116, 222, 186, 84, 
+    46, 102, 235, 4, 173, 89, 24, 223, 115, 214, 233, 86, 139, 222, 133, 125, 
+    22, 182, 196, 33, 150, 195, 71, 126, 222, 147, 179, 83, 62, 181, 71, 132, 
+    236, 241, 7, 146, 0
+};
+static uint16_t genpoly_8_165[166] = {
+    15, 30, 169, 115, 250, 136, 56, 84, 162, 18, 101, 141, 213, 136, 115, 231, 
+    120, 153, 163, 204, 181, 25, 12, 81, 62, 27, 132, 196, 155, 61, 251, 121, 
+    157, 168, 228, 94, 70, 252, 63, 138, 183, 230, 203, 33, 182, 21, 193, 242, 
+    19, 111, 14, 109, 193, 121, 227, 225, 151, 53, 70, 204, 16, 95, 115, 129, 
+    33, 101, 72, 219, 104, 3, 182, 46, 48, 251, 215, 160, 216, 147, 135, 178, 
+    207, 202, 83, 1, 211, 52, 114, 162, 10, 170, 205, 96, 223, 111, 200, 172, 
+    84, 21, 227, 171, 36, 59, 246, 68, 139, 151, 175, 132, 206, 140, 50, 143, 
+    128, 36, 43, 39, 227, 226, 30, 72, 246, 243, 185, 191, 54, 98, 144, 160, 
+    185, 94, 209, 179, 210, 35, 90, 56, 212, 142, 19, 46, 32, 158, 13, 35, 
+    139, 131, 245, 40, 121, 179, 126, 101, 213, 126, 145, 196, 204, 184, 197, 5, 
+    176, 126, 82, 227, 179, 0
+};
+static uint16_t genpoly_8_166[167] = {
+    180, 241, 157, 34, 44, 233, 51, 223, 127, 88, 169, 104, 156, 239, 145, 203, 
+    247, 122, 190, 241, 181, 70, 216, 172, 41, 233, 9, 194, 144, 16, 167, 79, 
+    83, 209, 102, 215, 98, 220, 83, 30, 22, 128, 193, 30, 90, 68, 16, 22, 
+    92, 217, 128, 101, 3, 213, 175, 30, 51, 162, 215, 83, 91, 72, 191, 7, 
+    238, 145, 135, 131, 17, 65, 162, 136, 239, 138, 226, 239, 7, 146, 11, 74, 
+    131, 186, 22, 118, 112, 111, 146, 179, 206, 176, 127, 194, 16, 18, 209, 196, 
+    57, 50, 92, 41, 135, 235, 163, 22, 41, 12, 121, 203, 170, 207, 186, 0, 
+    235, 108, 243, 176, 38, 217, 182, 202, 31, 173, 30, 60, 58, 83, 67, 165, 
+    53, 25, 248, 200, 177, 119, 83, 169, 92, 31, 249, 134, 39, 98, 251, 217, 
+    96, 40, 241, 136, 175, 197, 157, 203, 235, 164, 171, 209, 109, 118, 247, 178, 
+    96, 113, 14, 94, 52, 226, 0
+};
+static uint16_t genpoly_8_167[168] = {
+    91, 19, 236, 145, 86, 150, 16, 86, 134, 176, 107, 40, 242, 50, 116, 101, 
+    87, 117, 27, 136, 86, 193, 129, 244, 0, 80, 83, 194, 10, 128, 245, 118, 
+    164, 3, 11, 212, 87, 116, 174, 173, 37, 90, 214, 143, 210, 99, 186, 223, 
+    250, 158, 102, 83, 118, 146, 135, 101, 234, 185, 192, 96, 93, 15, 36, 206, 
+    239, 218, 47, 62, 52, 101, 92, 239, 197, 197, 236, 118, 209, 60, 133, 73, 
+    150, 233, 129, 180, 97, 135, 73, 79, 91, 240, 1, 239, 237, 189, 239, 73, 
+    204, 146, 244, 29, 128, 202, 207, 62, 118, 37, 105, 17, 109, 39, 121, 4, 
+    215, 83, 183, 244, 43, 151, 41, 222, 29, 81, 83, 28, 50, 210, 175, 211, 
+    181, 16, 47, 107, 66, 209, 35, 30, 73, 34, 6, 232, 250, 228, 59, 68, 
+    146, 120, 18, 0, 139, 119, 43, 102, 205, 54, 77, 103, 245, 146, 49, 96, 
+    137, 156, 124, 149, 42, 222, 94, 0
+};
+static uint16_t genpoly_8_168[169] = {
+    3, 165, 249, 204, 177, 172, 168, 31, 232, 163, 175, 213, 158, 116, 162, 52, 
+    220, 192, 2, 208, 216, 78, 232, 137, 52, 19, 165, 248, 245, 229, 82, 176, 
+    183, 64, 40, 101, 64, 85, 50, 244, 160, 85, 156, 144, 48, 199, 197, 118, 
+    176, 41, 23, 37, 80, 241, 48, 41, 30, 93, 195, 53, 86, 252, 214, 31, 
+    163, 199, 100, 209, 218, 116, 108, 149, 25, 135, 20, 108, 68, 242, 27, 175, 
+    129, 232, 156, 12, 139, 100, 77, 241, 226, 105, 45, 93, 7, 135, 135, 83, 
+    61, 18, 65, 161, 96, 175, 154, 86, 138, 94, 110, 236, 158, 213, 188, 174, 
+    199, 43, 138, 164, 91, 136, 210, 61, 29, 59, 226, 61, 253, 182, 27, 44, 
+    207, 124, 18, 141, 208, 78, 105, 217, 169, 250, 244, 224, 73, 164, 169, 111, 
+    232, 150, 78, 12, 238, 63, 200, 223, 84, 4, 202, 244, 119, 7, 57, 133, 
+    35, 177, 147, 239, 77, 192, 70, 74, 0
+};
+static uint16_t genpoly_8_169[170] = {
+    171, 49, 112, 189, 208, 235, 162, 155, 149, 233, 134, 253, 48, 4, 200, 70, 
+    143, 42, 49, 155, 5, 180, 89, 212, 172, 43, 76, 47, 16, 181, 155, 240, 
+    213, 55, 73, 102, 180, 34, 246, 92, 203, 180, 123, 58, 21, 9, 14, 101, 
+    43, 194, 133, 185, 6, 175, 115, 181, 197, 116, 75, 28, 15, 217, 168, 181, 
+    215, 95, 53, 234, 82, 254, 95, 137, 162, 190, 185, 119, 30, 73, 181, 41, 
+    203, 183, 127, 11, 198, 114, 14, 217, 105, 212, 137, 109, 88, 132, 53, 206, 
+    43, 102, 164, 209, 200, 115, 99, 5, 134, 86, 139, 213, 94, 234, 79, 213, 
+    86, 254, 70, 91, 238, 156, 167, 202, 95, 31, 176, 176, 3, 102, 226, 123, 
+    12, 122, 98, 84, 214, 192, 201, 4, 73, 63, 177, 179, 37, 214, 77, 193, 
+    247, 208, 80, 44, 222, 134, 116, 97, 177, 110, 124, 86, 232, 108, 145, 113, 
+    44, 47, 140, 234, 139, 199, 12, 22, 46, 0
+};
+static uint16_t genpoly_8_170[171] = {
+    85, 157, 191, 247, 133, 206, 165, 89, 213, 90, 144, 152, 28, 89, 28, 48, 
+    101, 160, 94, 142, 147, 164, 131, 9, 187, 103, 40, 153, 10, 147, 47, 253, 
+    217, 25, 4, 75, 121, 90, 135, 228, 246, 163, 158, 220, 130, 177, 19, 113, 
+    221, 1, 226, 235, 94, 41, 244, 188, 22, 223, 38, 103, 185, 86, 73, 75, 
+    50, 87, 144, 127, 47, 58, 173, 64, 90, 12, 180, 224, 236, 230, 207, 135, 
+    9, 197, 18, 177, 137, 113, 223, 94, 21, 31, 184, 141, 44, 153, 245, 64, 
+    106, 24, 188, 248, 188, 159, 234, 145, 248, 22, 71, 182, 11, 110, 40, 44, 
+    65, 81, 221, 218, 105, 243, 127, 99, 176, 37, 88, 66, 58, 47, 86, 7, 
+    31, 122, 36, 104, 97, 138, 0, 40, 55, 162, 185, 52, 187, 118, 67, 41, 
+    14, 163, 78, 241, 194, 58, 127, 208, 246, 143, 170, 203, 14, 161, 186, 141, 
+    219, 251, 205, 167, 74, 201, 214, 159, 189, 241, 0
+};
+static uint16_t genpoly_8_171[172] = {
+    0, 116, 89, 116, 236, 176, 181, 137, 192, 199, 46, 207, 227, 114, 158, 176, 
+    124, 163, 2, 232, 179, 96, 160, 96, 29, 163, 145, 162, 161, 186, 58, 190, 
+    20, 74, 19, 51, 139, 76, 236, 162, 172, 251, 186, 45, 82, 76, 232, 163, 
+    23, 224, 78, 118, 189, 174, 155, 107, 74, 93, 190, 111, 50, 46, 242, 25, 
+    244, 222, 181, 8, 240, 68, 22, 187, 62, 240, 47, 9, 131, 226, 154, 206, 
+    148, 48, 77, 113, 93, 97, 12, 93, 198, 247, 48, 233, 121, 154, 56, 46, 
+    9, 132, 155, 62, 17, 192, 68, 70, 178, 181, 52, 159, 25, 72, 216, 50, 
+    196, 105, 93, 159, 22, 155, 4, 104, 118, 163, 139, 23, 248, 147, 76, 167, 
+    215, 186, 81, 87, 162, 66, 246, 139, 136, 189, 74, 105, 105, 58, 16, 76, 
+    162, 230, 78, 29, 181, 75, 96, 9, 147, 2, 248, 39, 176, 243, 29, 227, 
+    37, 216, 199, 22, 52, 181, 6, 151, 116, 174, 31, 0
+};
+static uint16_t genpoly_8_172[173] = {
+    171, 108, 125, 91, 182, 101, 228, 230, 62, 0, 232, 186, 104, 135, 5, 128, 
+    74, 8, 82, 217, 91, 205, 169, 202, 193, 82, 27, 89, 247, 159, 174, 23, 
+    34, 209, 145, 143, 192, 171, 44, 85, 183, 254, 96, 150, 239, 105, 208, 198, 
+    150, 103, 123, 47, 149, 91, 110, 95, 70, 222, 137, 85, 135, 243, 24, 16, 
+    16, 238, 138, 122, 198, 83, 109, 113, 7, 34, 97, 208, 248, 198, 227, 230, 
+    41, 9, 5, 249, 106, 130, 73, 214, 19, 246, 86, 174, 35, 53, 134, 189, 
+    68, 112, 85, 106, 163, 98, 178, 236, 180, 188, 33, 217, 79, 163, 0, 48, 
+    24, 58, 194, 108, 40, 149, 248, 58, 200, 182, 87, 151, 27, 159, 253, 234, 
+    197, 192, 222, 209, 222, 208, 251, 207, 57, 92, 178, 71, 235, 53, 33, 102, 
+    19, 200, 222, 106, 46, 139, 190, 55, 25, 235, 184, 194, 89, 227, 188, 147, 
+    200, 111, 241, 93, 239, 236, 63, 20, 185, 178, 41, 108, 0
+};
+static uint16_t genpoly_8_173[174] = {
+    88, 240, 78, 88, 118, 8, 114, 238, 116, 86, 249, 78, 44, 228, 242, 191, 
+    242, 174, 143, 3, 37, 78, 239, 172, 5, 207, 162, 187, 135, 206, 108, 100, 
+    83, 184, 241, 230, 245, 185, 100, 109, 67, 226, 60, 21, 50, 223, 198, 135, 
+    146, 191, 218, 53, 39, 12, 243, 11, 19, 179, 227, 248, 70, 34, 182, 14, 
+    223, 226, 115, 40, 18, 2, 85, 161, 149, 195, 107, 219, 153, 21, 160, 9, 
+    26, 118, 182, 138, 203, 104, 67, 236, 101, 28, 46, 173, 192, 183, 249, 228, 
+    172, 132, 26, 252, 168, 205, 45, 52, 52, 151, 1, 159, 98, 178, 52, 48, 
+    238, 102, 108, 170, 205, 128, 203, 8, 115, 225, 67, 60, 116, 154, 226, 117, 
+    225, 135, 189, 56, 50, 229, 99, 173, 86, 229, 42, 136, 162, 144, 244, 80, 
+    6, 18, 153, 211, 84, 220, 215, 110, 32, 74, 123, 91, 205, 101, 133, 12, 
+    81, 235, 97, 96, 16, 129, 79, 38, 15, 208, 6, 79, 69, 0
+};
+static uint16_t genpoly_8_174[175] = {
+    6, 254, 52, 138, 212, 41, 118, 221, 221, 237, 177, 192, 33, 10, 177, 15, 
+    147, 184, 151, 161, 175, 121, 209, 84, 72, 116, 129, 164, 75, 191, 252, 131, 
+    2, 75, 58, 168, 174, 80, 211, 7, 188, 207, 129, 82, 18, 131, 158, 222, 
+    180, 29, 148, 245, 142, 254, 6, 241, 32, 225, 26, 180, 75, 66, 70, 14, 
+    63, 20, 200, 114, 33, 174, 101, 234, 39, 179, 110, 71, 6, 23, 80, 39, 
+    157, 200, 133, 157, 189, 43, 138, 72, 220, 207, 180, 230, 33, 182, 221, 185, 
+    53, 78, 143, 35, 156, 52, 249, 16, 220, 120, 61, 224, 137, 39, 164, 197, 
+    80, 158, 249, 181, 109, 135, 24, 60, 162, 237, 207, 137, 122, 85, 63, 187, 
+    205, 5, 229, 120, 249, 154, 217, 118, 149, 100, 21, 97, 69, 168, 177, 133, 
+    81, 102, 68, 239, 31, 100, 138, 232, 184, 178, 59, 127, 199, 59, 104, 54, 
+    43, 213, 63, 49, 116, 3, 69, 151, 130, 135, 133, 141, 137, 166, 0
+};
+static uint16_t genpoly_8_175[176] = {
+    180, 199, 93, 139, 34, 162, 178, 252, 231, 114, 100, 147, 174, 26, 241, 232, 
+    253, 116, 188, 196, 105, 31, 24, 81, 11, 210, 65, 158, 79, 158, 9, 47, 
+    60, 21, 231, 12, 139, 36, 133, 145, 113, 100, 137, 178, 106, 126, 93, 209, 
+    39, 90, 13, 202, 106, 129, 20, 31, 34, 10, 99, 6, 34, 98, 129, 184, 
+    90, 142, 21, 226, 134, 216, 45, 22, 139, 96, 121, 101, 140, 158, 109, 241, 
+    214, 103, 242, 135, 235, 56, 104, 170, 83, 98, 131, 136, 117, 50, 247, 184, 
+    37, 241, 116, 179, 221, 67, 123, 247, 211, 60, 57, 56, 229, 105, 52, 81, 
+    1, 27, 77, 94, 147, 66, 58, 163, 241, 56, 246, 49, 226, 118, 21, 51, 
+    47, 12, 126, 187, 85, 125, 169, 8, 121, 190, 174, 103, 57, 102, 228, 93, 
+    161, 204, 179, 181, 86, 74, 45, 182, 78, 102, 190, 90, 7, 80, 89, 52, 
+    112, 202, 68, 42, 96, 130, 225, 168, 15, 22, 87, 40, 226, 6, 193, 0
+};
+static uint16_t genpoly_8_176[177] = {
+    100, 133, 53, 195, 50, 254, 59, 72, 22, 139, 247, 85, 144, 182, 17, 56, 
+    230, 237, 135, 248, 155, 231, 204, 166, 23, 164, 174, 109, 88, 177, 246, 74, 
+    246, 94, 192, 200, 253, 16, 104, 82, 11, 40, 45, 201, 217, 229, 103, 159, 
+    41, 219, 89, 82, 78, 108, 165, 60, 94, 27, 154, 94, 130, 72, 176, 3, 
+    20, 184, 158, 62, 6, 77, 102, 236, 197, 211, 53, 127, 185, 52, 4, 30, 
+    176, 175, 160, 4, 228, 117, 132, 151, 196, 231, 37, 102, 38, 149, 130, 225, 
+    51, 240, 39, 167, 125, 147, 153, 136, 202, 66, 12, 67, 76, 212, 133, 239, 
+    155, 218, 216, 192, 75, 119, 4, 212, 104, 150, 80, 103, 153, 237, 69, 24, 
+    181, 124, 148, 99, 167, 231, 155, 230, 26, 177, 24, 16, 78, 105, 177, 159, 
+    136, 44, 41, 52, 43, 144, 34, 104, 43, 11, 129, 236, 240, 158, 125, 52, 
+    125, 31, 72, 62, 104, 125, 112, 84, 47, 177, 244, 9, 140, 110, 48, 208, 
+    0
+};
+static uint16_t genpoly_8_177[178] = {
+    21, 129, 63, 231, 182, 91, 227, 29, 173, 6, 93, 53, 158, 228, 249, 163, 
+    130, 35, 77, 16, 28, 102, 225, 167, 184, 252, 204, 39, 115, 7, 86, 132, 
+    94, 101, 86, 237, 7, 206, 160, 129, 24, 14, 61, 185, 61, 161, 27, 245, 
+    67, 42, 39, 234, 34, 156, 220, 26, 199, 163, 247, 225, 39, 244, 226, 126, 
+    170, 190, 21, 20, 173, 25, 39, 114, 232, 90, 244, 135, 32, 173, 229, 1, 
+    41, 213, 53, 253, 173, 186, 14, 0, 253, 165, 246, 84, 80, 146, 50, 184, 
+    168, 75, 114, 166, 189, 127, 54, 242, 167, 133, 94, 98, 163, 135, 61, 141, 
+    134, 193, 228, 152, 249, 123, 133, 234, 229, 89, 250, 13, 28, 240, 9, 148, 
+    230, 79, 81, 197, 155, 134, 82, 37, 69, 158, 87, 197, 67, 202, 1, 184, 
+    23, 95, 212, 245, 245, 177, 180, 169, 41, 52, 114, 251, 207, 212, 24, 164, 
+    201, 120, 232, 142, 200, 209, 183, 47, 39, 30, 220, 242, 185, 100, 228, 139, 
+    29, 0
+};
+static uint16_t genpoly_8_178[179] = {
+    198, 240, 249, 176, 153, 158, 254, 132, 65, 92, 150, 89, 61, 177, 230, 75, 
+    172, 125, 65, 148, 241, 165, 31, 123, 120, 93, 227, 4, 235, 224, 106, 162, 
+    87, 139, 28, 66, 234, 150, 30, 120, 6, 217, 225, 136, 235, 195, 149, 104, 
+    88, 3, 52, 119, 121, 47, 203, 16, 100, 203, 63, 253, 105, 88, 78, 111, 
+    228, 20, 217, 73, 66, 127, 177, 241, 45, 60, 58, 6, 230, 210, 30, 161, 
+    202, 13, 26, 81, 102, 66, 18, 72, 37, 157, 115, 228, 252, 123, 237, 39, 
+    62, 127, 139, 176, 123, 126, 224, 78, 208, 33, 96, 115, 129, 157, 174, 4, 
+    226, 107, 138, 99, 144, 232, 72, 43, 186, 149, 124, 118, 128, 50, 202, 23, 
+    34, 63, 226, 65, 188, 57, 175, 154, 66, 136, 3, 195, 183, 126, 33, 198, 
+    238, 172, 198, 96, 118, 59, 148, 250, 41, 240, 90, 171, 157, 114, 13, 253, 
+    248, 131, 1, 237, 215, 240, 202, 53, 192, 212, 8, 153, 98, 80, 153, 254, 
+    150, 219, 0
+};
+static uint16_t genpoly_8_179[180] = {
+    121, 246, 189, 191, 182, 213, 150, 243, 252, 68, 65, 230, 181, 164, 8, 140, 
+    168, 251, 239, 220, 202, 207, 178, 13, 160, 113, 152, 111, 29, 173, 152, 11, 
+    201, 216, 150, 92, 147, 206, 58, 74, 81, 28, 2, 129, 15, 198, 12, 55, 
+    31, 108, 97, 216, 90, 218, 178, 83, 174, 188, 187, 153, 217, 238, 6, 47, 
+    42, 162, 131, 98, 203, 104, 108, 208, 1, 212, 112, 159, 185, 237, 151, 46, 
+    191, 3, 165, 138, 14, 79, 237, 160, 193, 25, 191, 181, 225, 124, 43, 55, 
+    1, 105, 20, 30, 217, 144, 52, 77, 128, 158, 80, 201, 230, 207, 25, 201, 
+    173, 28, 136, 93, 175, 211, 10, 66, 79, 190, 13, 76, 62, 234, 96, 45, 
+    248, 206, 39, 39, 140, 174, 182, 76, 12, 217, 65, 195, 10, 71, 41, 59, 
+    81, 216, 104, 166, 53, 16, 114, 47, 206, 69, 107, 231, 161, 148, 254, 71, 
+    166, 7, 96, 90, 139, 84, 62, 156, 27, 194, 19, 25, 93, 77, 217, 8, 
+    94, 169, 48, 0
+};
+static uint16_t genpoly_8_180[181] = {
+    45, 248, 19, 210, 21, 66, 29, 218, 187, 79, 120, 224, 146, 108, 74, 252, 
+    57, 71, 189, 218, 98, 247, 44, 239, 129, 232, 251, 115, 215, 46, 180, 136, 
+    129, 154, 51, 38, 252, 198, 193, 181, 114, 182, 147, 240, 87, 57, 94, 252, 
+    61, 130, 26, 85, 11, 11, 173, 137, 65, 86, 251, 101, 196, 174, 235, 54, 
+    57, 55, 97, 91, 52, 65, 164, 218, 47, 247, 88, 37, 162, 16, 2, 246, 
+    155, 71, 234, 101, 150, 70, 74, 203, 105, 5, 138, 81, 2, 176, 123, 195, 
+    96, 123, 77, 245, 150, 62, 149, 239, 206, 157, 29, 9, 140, 132, 154, 131, 
+    194, 54, 136, 170, 248, 66, 68, 83, 181, 162, 133, 44, 99, 247, 104, 18, 
+    94, 244, 6, 186, 193, 205, 123, 162, 13, 242, 225, 81, 89, 232, 65, 146, 
+    21, 138, 227, 151, 202, 30, 150, 92, 82, 58, 15, 72, 45, 231, 112, 136, 
+    63, 4, 51, 9, 71, 87, 240, 95, 209, 108, 80, 115, 44, 151, 38, 151, 
+    182, 192, 77, 127, 0
+};
+static uint16_t genpoly_8_181[182] = {
+    225, 222, 71, 90, 90, 210, 187, 147, 212, 64, 181, 74, 190, 123, 68, 113, 
+    219, 10, 59, 218, 146, 193, 134, 155, 150, 251, 165, 9, 14, 27, 103, 214, 
+    49, 132, 39, 244, 248, 98, 235, 111, 16, 10, 96, 180, 248, 179, 3, 129, 
+    53, 210, 98, 64, 185, 237, 16, 182, 169, 27, 199, 215, 194, 203, 221, 78, 
+    114, 120, 40, 107, 95, 219, 175, 69, 107, 88, 173, 63, 90, 43, 86, 147, 
+    150, 85, 97, 220, 163, 1, 115, 90, 198, 222, 168, 78, 207, 3, 225, 70, 
+    31, 13, 145, 97, 160, 45, 117, 131, 163, 30, 78, 8, 253, 92, 129, 55, 
+    174, 125, 212, 220, 120, 189, 228, 191, 248, 59, 155, 214, 117, 79, 167, 76, 
+    117, 140, 94, 203, 135, 53, 204, 153, 149, 38, 45, 36, 25, 106, 21, 220, 
+    158, 128, 199, 69, 237, 229, 214, 178, 177, 239, 54, 30, 191, 165, 245, 44, 
+    178, 206, 98, 14, 40, 69, 38, 68, 198, 85, 44, 226, 184, 152, 162, 22, 
+    120, 75, 150, 206, 177, 0
+};
+static uint16_t genpoly_8_182[183] = {
+    151, 33, 186, 28, 111, 165, 217, 191, 27, 230, 52, 21, 181, 53, 224, 248, 
+    221, 58, 139, 229, 32, 127, 221, 131, 207, 158, 70, 64, 49, 222, 225, 23, 
+    13, 193, 158, 118, 85, 235, 21, 39, 87, 53, 65, 15, 74, 226, 11, 179, 
+    71, 88, 64, 22, 50, 42, 128, 166, 100, 17, 26, 49, 194, 87, 136, 205, 
+    24, 63, 246, 191, 252, 148, 215, 221, 99, 34, 155, 34, 2, 112, 254, 117, 
+    192, 221, 252, 224, 168, 155, 187, 17, 226, 201, 16, 249, 90, 94, 193, 58, 
+    47, 89, 176, 51, 153, 196, 241, 240, 196, 128, 92, 198, 138, 91, 230, 171, 
+    239, 246, 169, 182, 56, 202, 237, 237, 242, 12, 193, 122, 173, 238, 140, 25, 
+    61, 49, 131, 177, 38, 136, 193, 120, 26, 60, 237, 252, 121, 183, 36, 62, 
+    118, 151, 75, 182, 41, 150, 44, 128, 149, 220, 121, 210, 35, 197, 65, 63, 
+    227, 207, 186, 202, 186, 179, 161, 7, 57, 215, 162, 76, 181, 178, 49, 32, 
+    132, 154, 174, 165, 142, 63, 0
+};
+static uint16_t genpoly_8_183[184] = {
+    78, 112, 150, 41, 202, 84, 70, 119, 224, 198, 116, 45, 26, 197, 52, 47, 
+    254, 213, 85, 207, 196, 166, 53, 116, 81, 113, 130, 122, 2, 155, 63, 43, 
+    230, 55, 117, 135, 112, 225, 56, 233, 168, 22, 6, 137, 62, 205, 211, 85, 
+    19, 4, 95, 141, 161, 60, 86, 176, 237, 101, 169, 29, 181, 240, 173, 18, 
+    49, 126, 87, 40, 234, 203, 42, 159, 149, 179, 254, 169, 126, 177, 221, 183, 
+    60, 161, 31, 22, 70, 58, 239, 242, 51, 127, 148, 250, 159, 130, 182, 179, 
+    188, 3, 150, 235, 5, 87, 35, 7, 203, 59, 88, 110, 226, 129, 127, 170, 
+    253, 209, 188, 37, 171, 36, 148, 144, 186, 159, 44, 58, 234, 192, 197, 151, 
+    163, 146, 193, 112, 165, 192, 174, 7, 146, 90, 157, 87, 235, 177, 11, 230, 
+    113, 9, 251, 211, 52, 107, 118, 111, 252, 90, 0, 175, 113, 194, 250, 36, 
+    144, 154, 85, 188, 17, 223, 169, 28, 149, 227, 190, 92, 184, 73, 228, 72, 
+    40, 64, 151, 87, 254, 181, 216, 0
+};
+static uint16_t genpoly_8_184[185] = {
+    6, 24, 214, 245, 200, 160, 229, 212, 137, 125, 69, 94, 35, 27, 181, 115, 
+    38, 231, 225, 138, 159, 60, 77, 188, 51, 227, 70, 167, 45, 93, 236, 121, 
+    235, 2, 219, 79, 114, 237, 31, 253, 92, 88, 215, 63, 169, 178, 175, 15, 
+    165, 192, 251, 157, 10, 156, 89, 119, 232, 223, 238, 157, 146, 212, 56, 40, 
+    102, 136, 135, 121, 68, 170, 82, 226, 72, 214, 129, 253, 246, 31, 16, 135, 
+    111, 14, 211, 41, 108, 200, 127, 24, 6, 192, 59, 112, 145, 184, 203, 153, 
+    39, 129, 49, 194, 174, 179, 166, 41, 210, 51, 4, 91, 123, 202, 150, 52, 
+    237, 208, 136, 41, 11, 136, 222, 40, 78, 88, 176, 149, 155, 238, 136, 193, 
+    19, 233, 20, 159, 85, 49, 215, 228, 18, 195, 172, 247, 55, 21, 245, 190, 
+    11, 244, 94, 117, 66, 103, 60, 170, 220, 178, 110, 39, 63, 2, 232, 206, 
+    102, 56, 17, 72, 243, 39, 198, 21, 155, 49, 187, 105, 185, 61, 108, 236, 
+    65, 212, 46, 49, 161, 23, 64, 201, 0
+};
+static uint16_t genpoly_8_185[186] = {
+    190, 3, 177, 105, 200, 209, 101, 167, 26, 89, 47, 98, 135, 87, 62, 40, 
+    157, 66, 39, 74, 141, 74, 22, 8, 174, 248, 235, 158, 141, 187, 225, 90, 
+    109, 58, 217, 232, 109, 35, 94, 24, 163, 63, 77, 68, 146, 81, 199, 30, 
+    146, 134, 235, 109, 77, 56, 236, 173, 226, 14, 156, 22, 70, 228, 79, 229, 
+    175, 240, 196, 220, 200, 55, 100, 62, 190, 188, 215, 179, 126, 202, 176, 236, 
+    114, 116, 115, 17, 178, 34, 65, 218, 94, 198, 175, 74, 58, 221, 53, 225, 
+    64, 31, 226, 144, 184, 144, 54, 223, 40, 109, 47, 58, 155, 150, 19, 126, 
+    170, 243, 186, 40, 66, 27, 118, 165, 25, 31, 156, 77, 42, 210, 233, 183, 
+    112, 140, 158, 37, 183, 20, 123, 65, 35, 118, 73, 58, 11, 147, 140, 220, 
+    22, 193, 125, 11, 23, 168, 107, 163, 75, 197, 249, 200, 233, 3, 91, 239, 
+    68, 65, 225, 55, 178, 61, 65, 101, 199, 106, 60, 153, 249, 113, 147, 167, 
+    25, 33, 245, 250, 174, 236, 212, 100, 252, 0
+};
+static uint16_t genpoly_8_186[187] = {
+    120, 131, 100, 12, 4, 153, 94, 238, 180, 177, 210, 20, 83, 131, 66, 120, 
+    26, 129, 73, 87, 21, 0, 235, 152, 193, 60, 200, 12, 76, 227, 8, 23, 
+    22, 131, 217, 174, 206, 229, 91, 31, 133, 78, 251, 129, 95, 2, 46, 253, 
+    105, 59, 121, 37, 228, 67, 80, 9, 224, 207, 146, 139, 134, 96, 39, 196, 
+    53, 2, 244, 225, 243, 131, 184, 24, 225, 250, 133, 209, 251, 26, 36, 85, 
+    159, 63, 161, 120, 98, 48, 98, 100, 232, 230, 125, 134, 219, 78, 34, 19, 
+    80, 0, 72, 10, 78, 98, 218, 55, 166, 138, 49, 45, 66, 126, 166, 194, 
+    188, 120, 165, 34, 9, 26, 208, 5, 94, 177, 43, 1, 169, 41, 149, 224, 
+    46, 177, 9, 119, 5, 62, 38, 172, 71, 79, 195, 158, 21, 47, 210, 59, 
+    251, 148, 18, 241, 116, 69, 116, 154, 12, 251, 212, 28, 83, 117, 36, 42, 
+    45, 230, 178, 207, 105, 195, 31, 167, 223, 94, 61, 225, 241, 121, 143, 150, 
+    155, 192, 10, 138, 64, 193, 114, 192, 95, 196, 0
+};
+static uint16_t genpoly_8_187[188] = {
+    51, 225, 137, 99, 75, 121, 202, 140, 160, 240, 207, 92, 169, 243, 19, 33, 
+    15, 162, 45, 30, 198, 44, 70, 19, 246, 243, 176, 141, 94, 71, 212, 225, 
+    119, 208, 199, 83, 57, 235, 194, 192, 49, 212, 175, 212, 65, 115, 131, 9, 
+    237, 182, 210, 87, 65, 127, 0, 17, 224, 114, 248, 38, 160, 69, 71, 65, 
+    184, 44, 170, 182, 157, 83, 169, 17, 96, 194, 104, 36, 190, 60, 24, 109, 
+    172, 17, 17, 75, 110, 132, 21, 42, 23, 22, 66, 248, 188, 148, 55, 164, 
+    38, 180, 205, 20, 108, 156, 81, 128, 162, 173, 242, 211, 217, 201, 51, 250, 
+    165, 47, 206, 177, 167, 133, 116, 4, 98, 155, 98, 52, 2, 77, 144, 49, 
+    251, 20, 210, 134, 251, 48, 244, 251, 87, 24, 65, 189, 30, 221, 19, 38, 
+    254, 31, 137, 43, 0, 71, 181, 72, 167, 97, 175, 155, 75, 131, 59, 151, 
+    12, 116, 252, 69, 166, 31, 74, 42, 198, 27, 213, 135, 222, 22, 60, 55, 
+    47, 231, 78, 67, 116, 247, 235, 3, 96, 203, 105, 0
+};
+static uint16_t genpoly_8_188[189] = {
+    238, 151, 226, 131, 157, 187, 165, 243, 57, 215, 10, 84, 236, 69, 126, 236, 
+    178, 146, 73, 252, 136, 216, 109, 104, 108, 36, 99, 112, 218, 84, 51, 169, 
+    61, 45, 16, 60, 216, 81, 195, 35, 205, 123, 49, 131, 143, 80, 239, 89, 
+    243, 54, 73, 171, 110, 214, 55, 187, 227, 109, 150, 135, 54, 90, 39, 92, 
+    48, 170, 207, 103, 109, 247, 116, 252, 84, 60, 43, 2, 12, 249, 53, 92, 
+    191, 25, 221, 181, 60, 139, 100, 215, 215, 63, 108, 184, 42, 112, 120, 180, 
+    178, 133, 125, 148, 113, 181, 134, 241, 230, 164, 17, 144, 123, 92, 121, 130, 
+    216, 19, 128, 213, 50, 31, 218, 162, 92, 154, 71, 102, 48, 160, 175, 39, 
+    71, 220, 48, 75, 6, 34, 225, 197, 161, 35, 5, 54, 56, 225, 188, 97, 
+    228, 29, 15, 157, 52, 205, 178, 132, 80, 247, 16, 113, 197, 118, 68, 169, 
+    116, 78, 133, 138, 23, 87, 160, 80, 68, 252, 141, 27, 127, 253, 211, 222, 
+    202, 118, 112, 130, 40, 39, 29, 119, 157, 199, 107, 100, 0
+};
+static uint16_t genpoly_8_189[190] = {
+    171, 109, 178, 246, 215, 40, 2, 232, 186, 138, 11, 168, 254, 162, 233, 114, 
+    152, 80, 83, 51, 129, 180, 52, 169, 219, 179, 173, 61, 215, 234, 90, 34, 
+    31, 13, 134, 158, 219, 11, 67, 62, 74, 50, 241, 31, 88, 184, 230, 223, 
+    94, 86, 226, 60, 220, 30, 168, 13, 168, 138, 171, 63, 177, 10, 86, 86, 
+    101, 60, 104, 166, 56, 225, 51, 225, 90, 74, 190, 222, 4, 97, 13, 147, 
+    200, 70, 0, 156, 192, 115, 133, 65, 159, 26, 175, 252, 4, 247, 110, 16, 
+    220, 44, 104, 94, 12, 212, 185, 65, 114, 3, 34, 200, 82, 24, 38, 226, 
+    122, 96, 126, 161, 112, 195, 142, 35, 21, 174, 96, 101, 124, 232, 29, 96, 
+    87, 66, 19, 194, 228, 70, 237, 204, 133, 135, 42, 20, 202, 22, 218, 37, 
+    58, 29, 39, 61, 192, 28, 83, 155, 166, 186, 192, 235, 181, 11, 81, 204, 
+    160, 208, 121, 45, 118, 225, 242, 192, 132, 148, 137, 236, 45, 184, 213, 144, 
+    140, 44, 25, 190, 129, 244, 102, 194, 44, 31, 129, 128, 126, 0
+};
+static uint16_t genpoly_8_190[191] = {
+    105, 220, 59, 121, 253, 21, 33, 247, 98, 190, 112, 92, 6, 103, 249, 144, 
+    208, 232, 195, 239, 106, 96, 194, 35, 207, 213, 239, 58, 87, 154, 163, 251, 
+    74, 161, 25, 199, 240, 192, 175, 112, 24, 97, 91, 146, 166, 52, 2, 137, 
+    151, 115, 181, 136, 32, 63, 162, 49, 172, 2, 123, 7, 28, 56, 184, 56, 
+    18, 36, 172, 241, 42, 95, 207, 83, 241, 3, 127, 37, 147, 12, 39, 30, 
+    178, 2, 223, 113, 90, 170, 32, 21, 187, 148, 61, 242, 250, 132, 168, 184, 
+    234, 9, 193, 251, 136, 34, 139, 39, 116, 65, 51, 140, 61, 161, 148, 66, 
+    141, 180, 126, 82, 238, 180, 229, 137, 72, 26, 39, 49, 46, 231, 24, 128, 
+    67, 5, 43, 88, 15, 215, 196, 139, 63, 30, 65, 235, 91, 91, 193, 245, 
+    176, 37, 217, 8, 19, 91, 84, 238, 112, 195, 54, 79, 226, 173, 152, 140, 
+    118, 175, 174, 211, 203, 243, 48, 197, 167, 135, 211, 155, 177, 25, 67, 69, 
+    240, 160, 129, 26, 112, 1, 230, 190, 42, 96, 139, 73, 77, 49, 0
+};
+static uint16_t genpoly_8_191[192] = {
+    40, 158, 174, 6, 132, 63, 18, 27, 117, 106, 168, 197, 189, 114, 194, 164, 
+    242, 37, 96, 100, 43, 77, 114, 181, 77, 205, 22, 128, 88, 30, 87, 73, 
+    40, 208, 177, 94, 30, 217, 105, 224, 78, 51, 142, 0, 30, 134, 129, 168, 
+    69, 176, 214, 95, 112, 134, 199, 47, 212, 10, 246, 218, 231, 166, 234, 158, 
+    247, 212, 152, 58, 121, 85, 81, 243, 103, 158, 60, 233, 221, 159, 213, 60, 
+    65, 239, 159, 85, 51, 72, 91, 179, 147, 180, 187, 132, 244, 127, 57, 246, 
+    151, 27, 162, 89, 42, 162, 220, 252, 94, 71, 117, 161, 5, 144, 34, 180, 
+    240, 203, 214, 86, 163, 55, 218, 228, 178, 81, 150, 251, 253, 157, 27, 127, 
+    103, 244, 241, 116, 168, 6, 90, 102, 2, 219, 219, 7, 55, 239, 11, 224, 
+    133, 159, 229, 190, 225, 177, 151, 243, 199, 145, 67, 200, 74, 222, 63, 215, 
+    58, 137, 145, 13, 118, 77, 70, 7, 176, 174, 202, 233, 100, 161, 167, 182, 
+    169, 9, 249, 134, 207, 243, 246, 67, 42, 98, 208, 87, 26, 4, 53, 0
+};
+static uint16_t genpoly_8_192[193] = {
+    231, 56, 75, 84, 235, 160, 23, 230, 115, 88, 47, 216, 2, 5, 168, 72, 
+    225, 34, 119, 219, 122, 232, 58, 64, 186, 38, 232, 129, 121, 249, 181, 215, 
+    80, 137, 187, 209, 143, 225, 93, 117, 153, 68, 59, 14, 102, 216, 174, 3, 
+    63, 57, 238, 91, 34, 177, 233, 47, 173, 13, 217, 49, 150, 77, 52, 171, 
+    57, 149, 36, 1, 156, 127, 34, 80, 226, 238, 178, 129, 125, 196, 68, 197, 
+    58, 89, 104, 239, 241, 251, 211, 201, 13, 103, 182, 221, 97, 84, 15, 98, 
+    176, 162, 143, 21, 98, 31, 56, 41, 15, 12, 86, 190, 244, 51, 235, 29, 
+    62, 10, 200, 137, 130, 198, 56, 180, 232, 150, 168, 70, 163, 72, 171, 93, 
+    65, 243, 188, 22, 159, 122, 99, 214, 183, 121, 116, 124, 45, 166, 122, 5, 
+    75, 79, 59, 165, 115, 91, 200, 18, 167, 195, 235, 176, 158, 33, 75, 89, 
+    96, 40, 70, 202, 138, 210, 122, 247, 204, 146, 204, 187, 141, 47, 11, 245, 
+    245, 156, 61, 217, 23, 46, 196, 46, 137, 61, 173, 119, 3, 171, 226, 16, 
+    0
+};
+static uint16_t genpoly_8_193[194] = {
+    168, 44, 25, 37, 110, 60, 172, 32, 115, 138, 81, 147, 73, 125, 111, 98, 
+    185, 69, 168, 39, 38, 108, 10, 60, 121, 199, 117, 136, 174, 79, 197, 106, 
+    19, 229, 168, 16, 55, 135, 153, 157, 98, 195, 128, 238, 168, 85, 53, 100, 
+    205, 103, 171, 167, 82, 151, 73, 133, 225, 26, 17, 72, 33, 48, 15, 41, 
+    122, 11, 25, 192, 151, 214, 128, 85, 115, 158, 55, 44, 73, 152, 157, 104, 
+    247, 134, 6, 236, 192, 238, 187, 118, 87, 21, 157, 13, 238, 244, 24, 108, 
+    80, 239, 75, 54, 82, 139, 232, 184, 111, 240, 79, 211, 70, 87, 194, 27, 
+    218, 139, 59, 175, 233, 217, 251, 70, 236, 1, 34, 140, 34, 34, 138, 34, 
+    83, 2, 239, 21, 117, 165, 12, 20, 92, 99, 70, 73, 214, 208, 101, 168, 
+    163, 73, 31, 47, 142, 33, 166, 119, 249, 215, 82, 141, 186, 169, 193, 153, 
+    22, 130, 25, 179, 124, 27, 52, 96, 241, 226, 228, 241, 147, 140, 204, 141, 
+    105, 29, 5, 81, 158, 169, 51, 48, 168, 208, 188, 136, 87, 200, 190, 241, 
+    68, 0
+};
+static uint16_t genpoly_8_194[195] = {
+    106, 22, 54, 28, 104, 231, 113, 222, 213, 179, 172, 222, 45, 237, 17, 82, 
+    252, 70, 244, 129, 154, 65, 182, 53, 158, 175, 64, 62, 222, 173, 68, 163, 
+    206, 209, 46, 38, 158, 88, 104, 3, 179, 181, 41, 93, 178, 192, 218, 20, 
+    88, 31, 3, 141, 199, 240, 88, 14, 97, 119, 71, 168, 97, 227, 27, 45, 
+    33, 117, 183, 222, 128, 250, 1, 220, 161, 88, 16, 217, 29, 141, 154, 234, 
+    195, 109, 92, 179, 230, 230, 215, 135, 45, 136, 116, 29, 71, 171, 225, 158, 
+    131, 184, 193, 27, 156, 164, 126, 146, 40, 122, 93, 245, 132, 209, 16, 27, 
+    2, 81, 229, 75, 57, 106, 56, 51, 167, 46, 181, 47, 145, 201, 141, 42, 
+    65, 61, 39, 113, 157, 164, 96, 229, 194, 49, 89, 68, 204, 163, 184, 188, 
+    112, 202, 66, 60, 65, 101, 149, 126, 136, 83, 143, 29, 192, 238, 115, 57, 
+    127, 97, 156, 175, 142, 54, 165, 67, 131, 49, 94, 51, 242, 187, 83, 120, 
+    42, 185, 174, 66, 63, 90, 215, 199, 211, 25, 121, 192, 145, 70, 5, 246, 
+    79, 109, 0
+};
+static uint16_t genpoly_8_195[196] = {
+    45, 130, 202, 227, 10, 140, 199, 78, 63, 192, 128, 228, 35, 124, 44, 158, 
+    151, 52, 160, 120, 159, 96, 54, 140, 66, 127, 210, 179, 63, 136, 77, 204, 
+    178, 56, 196, 86, 95, 106, 227, 124, 195, 177, 197, 176, 203, 117, 240, 100, 
+    178, 84, 101, 143, 88, 17, 92, 199, 148, 161, 79, 137, 108, 206, 121, 227, 
+    207, 198, 204, 40, 73, 142, 207, 8, 211, 49, 116, 93, 117, 12, 58, 146, 
+    240, 227, 237, 180, 88, 183, 122, 78, 232, 9, 146, 158, 2, 174, 67, 19, 
+    96, 150, 53, 60, 44, 153, 66, 210, 172, 221, 145, 174, 81, 186, 53, 19, 
+    172, 35, 86, 160, 127, 100, 115, 26, 63, 147, 141, 109, 222, 227, 223, 215, 
+    243, 213, 13, 83, 164, 119, 10, 228, 63, 66, 209, 2, 114, 68, 54, 186, 
+    47, 66, 110, 10, 248, 194, 132, 24, 58, 140, 181, 5, 250, 159, 99, 149, 
+    201, 117, 38, 221, 53, 242, 107, 95, 17, 109, 87, 87, 222, 197, 45, 169, 
+    191, 37, 245, 150, 218, 165, 51, 23, 22, 238, 108, 40, 116, 43, 45, 231, 
+    254, 35, 24, 0
+};
+static uint16_t genpoly_8_196[197] = {
+    240, 199, 185, 250, 84, 176, 238, 39, 49, 172, 16, 59, 171, 244, 61, 60, 
+    102, 81, 17, 166, 25, 231, 215, 142, 28, 165, 37, 200, 55, 107, 170, 88, 
+    94, 158, 173, 111, 18, 173, 120, 122, 191, 68, 68, 207, 161, 17, 40, 252, 
+    133, 49, 29, 116, 220, 36, 254, 78, 208, 87, 251, 20, 207, 92, 230, 196, 
+    9, 247, 160, 191, 21, 217, 229, 89, 129, 229, 207, 68, 123, 230, 59, 180, 
+    27, 147, 230, 200, 219, 171, 205, 115, 50, 71, 149, 63, 6, 235, 200, 246, 
+    87, 245, 149, 50, 207, 171, 185, 25, 111, 228, 119, 101, 140, 10, 160, 186, 
+    39, 80, 170, 147, 87, 45, 239, 215, 168, 173, 117, 199, 159, 179, 124, 172, 
+    36, 11, 40, 187, 9, 1, 95, 17, 192, 65, 101, 252, 178, 108, 89, 186, 
+    175, 131, 104, 184, 73, 252, 100, 137, 86, 192, 113, 173, 101, 92, 150, 8, 
+    168, 66, 188, 233, 229, 28, 170, 167, 175, 125, 22, 210, 133, 52, 185, 6, 
+    115, 61, 227, 96, 177, 195, 1, 244, 231, 179, 196, 157, 94, 144, 148, 146, 
+    114, 85, 80, 154, 0
+};
+static uint16_t genpoly_8_197[198] = {
+    181, 246, 106, 85, 214, 102, 126, 185, 117, 10, 103, 54, 109, 232, 33, 184, 
+    111, 139, 153, 130, 178, 204, 202, 155, 137, 234, 182, 134, 183, 206, 248, 33, 
+    85, 181, 127, 195, 150, 203, 39, 122, 41, 171, 66, 185, 44, 82, 47, 159, 
+    137, 111, 101, 151, 45, 20, 125, 92, 194, 254, 29, 44, 197, 43, 223, 157, 
+    85, 156, 61, 254, 24, 17, 156, 218, 62, 254, 239, 11, 205, 88, 129, 33, 
+    168, 41, 2, 45, 91, 154, 45, 50, 194, 251, 63, 173, 18, 91, 113, 231, 
+    166, 88, 96, 253, 49, 186, 55, 251, 33, 19, 233, 182, 174, 176, 91, 145, 
+    58, 54, 67, 83, 181, 112, 36, 191, 209, 130, 250, 27, 101, 223, 183, 180, 
+    100, 166, 200, 66, 220, 208, 84, 209, 88, 46, 207, 251, 25, 24, 236, 73, 
+    27, 111, 21, 30, 99, 184, 10, 212, 51, 72, 17, 212, 121, 50, 190, 166, 
+    134, 140, 244, 235, 93, 56, 63, 82, 99, 135, 145, 252, 108, 70, 147, 253, 
+    59, 92, 103, 185, 230, 6, 138, 46, 49, 240, 244, 97, 63, 229, 101, 101, 
+    136, 52, 237, 62, 6, 0
+};
+static uint16_t genpoly_8_198[199] = {
+    123, 84, 50, 158, 201, 129, 204, 225, 160, 230, 93, 38, 1, 67, 173, 53, 
+    132, 45, 108, 163, 39, 254, 72, 39, 47, 240, 148, 176, 14, 231, 244, 8, 
+    182, 69, 47, 46, 131, 232, 221, 193, 193, 173, 66, 80, 174, 117, 9, 63, 
+    196, 12, 60, 120, 232, 252, 6, 115, 105, 137, 93, 229, 118, 185, 71, 47, 
+    198, 129, 122, 52, 239, 172, 108, 42, 88, 84, 161, 195, 45, 67, 139, 0, 
+    173, 79, 48, 224, 88, 178, 180, 42, 26, 37, 140, 239, 25, 0, 121, 41, 
+    48, 64, 91, 97, 149, 180, 222, 18, 156, 93, 176, 193, 152, 107, 154, 228, 
+    169, 225, 193, 132, 14, 103, 0, 140, 82, 68, 104, 57, 81, 62, 124, 136, 
+    5, 127, 252, 123, 251, 61, 188, 95, 177, 94, 85, 254, 176, 23, 49, 117, 
+    66, 115, 153, 99, 97, 107, 94, 19, 23, 189, 49, 13, 57, 222, 45, 103, 
+    189, 3, 215, 188, 247, 72, 243, 127, 166, 211, 52, 17, 47, 197, 62, 112, 
+    203, 188, 31, 213, 216, 211, 101, 80, 3, 210, 202, 42, 155, 95, 83, 206, 
+    243, 226, 101, 116, 66, 158, 0
+};
+static uint16_t genpoly_8_199[200] = {
+    66, 212, 74, 33, 205, 47, 162, 234, 131, 204, 244, 214, 171, 145, 194, 124, 
+    187, 252, 200, 49, 3, 46, 53, 95, 117, 81, 85, 73, 242, 248, 200, 190, 
+    88, 97, 121, 152, 168, 144, 181, 51, 195, 1, 254, 11, 0, 178, 230, 211, 
+    31, 2, 147, 10, 132, 115, 169, 182, 59, 234, 162, 224, 234, 37, 144, 81, 
+    19, 173, 26, 44, 223, 63, 194, 180, 98, 41, 177, 48, 160, 93, 49, 196, 
+    71, 15, 17, 201, 198, 106, 135, 108, 204, 55, 112, 247, 22, 193, 216, 235, 
+    44, 132, 253, 23, 179, 211, 147, 116, 109, 147, 181, 67, 94, 16, 16, 222, 
+    183, 12, 40, 189, 249, 122, 177, 35, 217, 127, 228, 97, 42, 228, 149, 8, 
+    147, 218, 144, 106, 239, 23, 227, 130, 249, 114, 64, 63, 110, 105, 234, 116, 
+    41, 85, 88, 162, 97, 36, 203, 34, 16, 92, 97, 231, 44, 89, 148, 144, 
+    57, 244, 9, 90, 131, 157, 190, 238, 142, 209, 59, 110, 253, 67, 120, 213, 
+    248, 8, 58, 72, 175, 128, 237, 229, 223, 95, 103, 186, 31, 118, 135, 119, 
+    24, 9, 206, 166, 51, 149, 89, 0
+};
+static uint16_t genpoly_8_200[201] = {
+    10, 179, 226, 81, 104, 75, 104, 216, 164, 199, 242, 134, 116, 84, 41, 169, 
+    27, 76, 176, 165, 168, 34, 124, 100, 197, 175, 205, 34, 163, 245, 241, 170, 
+    39, 27, 173, 250, 43, 205, 117, 35, 77, 27, 106, 223, 210, 28, 60, 201, 
+    203, 116, 161, 121, 46, 39, 56, 114, 150, 212, 28, 62, 253, 177, 20, 178, 
+    77, 18, 94, 227, 239, 71, 109, 35, 5, 75, 158, 88, 37, 232, 99, 130, 
+    36, 192, 232, 194, 199, 240, 87, 87, 39, 2, 154, 243, 54, 214, 178, 99, 
+    7, 152, 90, 209, 129, 10, 202, 65, 231, 124, 4, 96, 247, 237, 204, 108, 
+    201, 50, 106, 60, 75, 126, 220, 236, 136, 31, 56, 245, 106, 213, 84, 57, 
+    43, 129, 4, 22, 246, 35, 213, 193, 53, 210, 108, 66, 198, 63, 85, 70, 
+    64, 84, 82, 121, 184, 60, 156, 167, 55, 109, 24, 48, 31, 100, 39, 16, 
+    122, 136, 19, 163, 57, 65, 44, 209, 22, 209, 81, 141, 115, 42, 14, 40, 
+    118, 77, 157, 123, 58, 111, 178, 134, 141, 84, 12, 111, 199, 18, 182, 195, 
+    216, 69, 13, 40, 125, 158, 104, 113, 0
+};
+static uint16_t genpoly_8_201[202] = {
+    210, 128, 198, 238, 157, 234, 137, 163, 151, 237, 242, 137, 41, 34, 240, 21, 
+    77, 176, 5, 146, 34, 204, 117, 176, 207, 5, 49, 159, 129, 171, 243, 216, 
+    24, 238, 108, 52, 146, 85, 183, 231, 66, 169, 137, 80, 172, 243, 170, 36, 
+    198, 38, 25, 140, 162, 213, 240, 6, 87, 53, 11, 188, 96, 201, 165, 59, 
+    179, 81, 199, 45, 172, 92, 122, 210, 120, 242, 197, 74, 82, 114, 243, 185, 
+    230, 162, 159, 159, 197, 246, 226, 44, 23, 97, 106, 35, 55, 251, 204, 66, 
+    131, 120, 115, 51, 65, 220, 6, 125, 185, 251, 241, 179, 26, 140, 175, 46, 
+    92, 73, 149, 131, 206, 212, 229, 29, 87, 210, 220, 78, 4, 27, 74, 252, 
+    97, 30, 175, 142, 167, 47, 230, 184, 121, 19, 209, 115, 206, 156, 48, 181, 
+    23, 112, 86, 120, 148, 152, 185, 125, 193, 153, 46, 235, 108, 92, 55, 167, 
+    254, 206, 171, 178, 135, 251, 212, 68, 253, 94, 86, 168, 151, 164, 249, 194, 
+    205, 207, 231, 227, 114, 254, 166, 80, 51, 7, 6, 25, 129, 191, 87, 247, 
+    42, 11, 78, 107, 4, 237, 118, 133, 118, 0
+};
+static uint16_t genpoly_8_202[203] = {
+    156, 108, 182, 245, 94, 67, 76, 231, 133, 4, 60, 172, 79, 249, 225, 0, 
+    219, 6, 140, 10, 50, 105, 67, 204, 63, 50, 169, 38, 34, 172, 204, 253, 
+    105, 3, 99, 22, 238, 223, 98, 77, 42, 193, 59, 146, 64, 240, 165, 181, 
+    68, 68, 237, 39, 216, 109, 194, 225, 14, 25, 142, 206, 2, 79, 224, 239, 
+    95, 218, 42, 185, 25, 60, 178, 3, 75, 137, 144, 148, 103, 194, 160, 109, 
+    65, 136, 164, 121, 197, 24, 12, 218, 15, 116, 236, 22, 137, 32, 21, 127, 
+    133, 24, 118, 111, 197, 191, 251, 219, 25, 240, 148, 196, 144, 209, 113, 52, 
+    65, 254, 207, 209, 57, 123, 95, 73, 170, 196, 179, 22, 127, 215, 178, 22, 
+    72, 119, 111, 93, 67, 3, 22, 236, 147, 122, 53, 251, 35, 199, 176, 179, 
+    169, 106, 149, 159, 182, 151, 57, 189, 186, 71, 125, 37, 75, 204, 82, 218, 
+    185, 118, 21, 110, 185, 109, 178, 16, 147, 105, 6, 208, 213, 235, 151, 209, 
+    139, 74, 141, 81, 253, 90, 89, 103, 32, 207, 219, 54, 78, 156, 40, 187, 
+    129, 127, 55, 207, 106, 151, 232, 182, 173, 153, 0
+};
+static uint16_t genpoly_8_203[204] = {
+    103, 181, 34, 101, 228, 131, 36, 42, 73, 113, 209, 117, 241, 159, 57, 112, 
+    70, 20, 97, 17, 41, 248, 95, 26, 218, 33, 86, 30, 40, 204, 77, 86, 
+    14, 211, 246, 140, 80, 187, 108, 119, 15, 41, 210, 195, 2, 4, 34, 48, 
+    85, 65, 139, 123, 242, 35, 217, 51, 105, 79, 241, 209, 147, 112, 229, 170, 
+    147, 6, 51, 155, 37, 40, 18, 186, 250, 219, 166, 222, 49, 87, 112, 153, 
+    116, 98, 10, 253, 31, 151, 172, 131, 61, 235, 127, 24, 251, 241, 184, 71, 
+    66, 153, 149, 241, 129, 195, 94, 81, 246, 207, 9, 230, 33, 199, 54, 117, 
+    198, 99, 5, 139, 7, 101, 133, 66, 86, 151, 37, 108, 198, 210, 238, 253, 
+    224, 221, 72, 156, 145, 30, 105, 155, 71, 20, 28, 222, 43, 155, 91, 179, 
+    39, 124, 15, 94, 93, 57, 183, 188, 122, 191, 170, 243, 4, 43, 66, 117, 
+    108, 176, 60, 87, 244, 31, 163, 109, 222, 126, 144, 0, 125, 169, 94, 238, 
+    26, 135, 135, 118, 234, 101, 52, 153, 182, 60, 36, 139, 234, 232, 132, 12, 
+    196, 86, 43, 56, 78, 125, 18, 168, 94, 80, 25, 0
+};
+static uint16_t genpoly_8_204[205] = {
+    51, 191, 170, 16, 147, 73, 163, 65, 202, 116, 126, 74, 249, 129, 30, 7, 
+    245, 189, 174, 37, 111, 47, 46, 117, 103, 251, 132, 10, 95, 18, 172, 22, 
+    165, 183, 7, 95, 6, 92, 135, 192, 120, 77, 121, 154, 114, 5, 116, 235, 
+    15, 145, 199, 88, 134, 124, 206, 137, 249, 233, 103, 116, 213, 65, 70, 238, 
+    141, 121, 157, 227, 70, 115, 61, 89, 241, 202, 56, 52, 186, 96, 68, 168, 
+    223, 212, 35, 162, 226, 48, 107, 99, 37, 89, 54, 233, 61, 163, 201, 42, 
+    73, 149, 86, 80, 67, 190, 161, 242, 171, 236, 39, 154, 130, 151, 107, 121, 
+    71, 40, 168, 0, 0, 114, 174, 167, 142, 130, 55, 29, 92, 89, 41, 121, 
+    8, 181, 237, 180, 16, 171, 195, 46, 53, 7, 244, 5, 77, 226, 110, 157, 
+    102, 57, 96, 23, 91, 31, 152, 122, 184, 190, 98, 96, 18, 35, 223, 164, 
+    70, 162, 181, 189, 29, 153, 148, 157, 123, 9, 228, 201, 235, 144, 91, 244, 
+    118, 85, 4, 175, 79, 145, 126, 179, 40, 18, 207, 19, 127, 196, 16, 167, 
+    84, 216, 65, 107, 245, 160, 55, 17, 143, 64, 15, 88, 0
+};
+static uint16_t genpoly_8_205[206] = {
+    0, 210, 251, 223, 133, 63, 176, 8, 41, 61, 200, 62, 22, 208, 71, 51, 
+    211, 180, 159, 185, 202, 188, 171, 139, 10, 207, 166, 127, 146, 144, 57, 188, 
+    172, 150, 50, 182, 32, 89, 111, 35, 9, 253, 228, 136, 144, 188, 188, 133, 
+    18, 146, 95, 219, 170, 87, 111, 197, 151, 193, 73, 49, 191, 202, 94, 150, 
+    25, 186, 88, 149, 213, 219, 207, 203, 215, 9, 110, 13, 87, 49, 148, 195, 
+    54, 135, 220, 3, 206, 59, 75, 105, 76, 136, 234, 231, 86, 44, 194, 130, 
+    115, 227, 153, 88, 232, 199, 227, 125, 148, 232, 139, 0, 125, 64, 130, 245, 
+    146, 239, 180, 234, 187, 178, 3, 24, 59, 2, 105, 118, 84, 54, 246, 250, 
+    202, 36, 13, 161, 111, 113, 152, 207, 15, 60, 47, 37, 186, 76, 252, 247, 
+    151, 191, 100, 175, 91, 100, 197, 162, 189, 68, 168, 95, 197, 120, 31, 137, 
+    188, 195, 238, 126, 202, 9, 86, 213, 242, 236, 182, 101, 252, 70, 137, 57, 
+    195, 248, 25, 115, 207, 61, 241, 69, 137, 202, 236, 6, 78, 160, 51, 122, 
+    55, 175, 11, 200, 112, 143, 161, 125, 63, 184, 70, 149, 159, 0
+};
+static uint16_t genpoly_8_206[207] = {
+    205, 234, 90, 124, 160, 124, 241, 96, 59, 230, 220, 211, 85, 56, 225, 167, 
+    75, 221, 225, 245, 170, 99, 132, 84, 107, 189, 197, 236, 83, 15, 3, 148, 
+    158, 232, 92, 45, 194, 190, 183, 86, 182, 217, 224, 63, 201, 38, 191, 25, 
+    246, 224, 171, 190, 121, 198, 149, 177, 31, 170, 108, 94, 199, 0, 51, 249, 
+    12, 145, 228, 155, 210, 182, 131, 169, 149, 58, 247, 142, 123, 25, 176, 95, 
+    156, 41, 218, 8, 122, 114, 161, 148, 157, 250, 101, 231, 159, 144, 150, 198, 
+    23, 89, 51, 230, 60, 184, 56, 11, 106, 29, 210, 175, 46, 134, 118, 88, 
+    90, 134, 199, 66, 241, 185, 142, 183, 246, 249, 52, 243, 248, 121, 31, 20, 
+    151, 50, 198, 12, 167, 28, 169, 239, 251, 97, 175, 170, 38, 5, 177, 209, 
+    61, 60, 54, 254, 63, 175, 86, 27, 49, 148, 121, 240, 16, 119, 191, 20, 
+    236, 133, 91, 3, 214, 2, 17, 226, 118, 175, 229, 130, 227, 162, 138, 178, 
+    83, 145, 8, 211, 222, 9, 232, 4, 102, 119, 240, 110, 140, 186, 90, 232, 
+    85, 221, 45, 221, 25, 85, 219, 51, 246, 179, 10, 24, 40, 234, 0
+};
+static uint16_t genpoly_8_207[208] = {
+    156, 23, 208, 57, 155, 245, 141, 0, 241, 87, 228, 70, 73, 213, 167, 160, 
+    30, 179, 105, 150, 69, 161, 137, 139, 146, 125, 18, 106, 31, 46, 223, 188, 
+    212, 57, 13, 181, 151, 191, 123, 252, 72, 229, 27, 153, 222, 189, 135, 122, 
+    232, 36, 88, 105, 186, 243, 99, 54, 105, 144, 179, 223, 83, 102, 198, 45, 
+    205, 226, 26, 134, 55, 18, 188, 187, 209, 86, 135, 118, 91, 155, 246, 217, 
+    150, 237, 218, 100, 221, 124, 55, 73, 39, 170, 54, 192, 253, 56, 89, 248, 
+    185, 91, 7, 222, 41, 106, 135, 189, 86, 81, 101, 85, 60, 149, 27, 170, 
+    27, 172, 188, 179, 167, 78, 243, 161, 244, 20, 138, 29, 212, 124, 192, 154, 
+    15, 93, 51, 36, 112, 178, 178, 95, 122, 172, 51, 137, 10, 206, 200, 228, 
+    117, 64, 17, 47, 236, 241, 0, 10, 8, 102, 40, 32, 0, 32, 29, 19, 
+    213, 20, 123, 205, 185, 108, 104, 251, 225, 145, 7, 16, 95, 231, 69, 18, 
+    43, 127, 254, 33, 157, 118, 19, 89, 131, 178, 251, 208, 83, 87, 210, 110, 
+    34, 90, 185, 94, 140, 92, 0, 203, 11, 201, 99, 58, 9, 209, 73, 0
+};
+static uint16_t genpoly_8_208[209] = {
+    108, 251, 19, 197, 110, 7, 29, 177, 167, 36, 107, 100, 209, 223, 91, 124, 
+    45, 156, 85, 52, 251, 82, 221, 166, 223, 186, 231, 204, 178, 16, 21, 175, 
+    19, 133, 115, 124, 54, 170, 146, 214, 5, 141, 61, 233, 79, 232, 53, 88, 
+    96, 44, 177, 44, 123, 75, 166, 26, 4, 240, 175, 61, 234, 8, 67, 214, 
+    23, 186, 129, 209, 56, 140, 46, 11, 249, 168, 185, 28, 89, 145, 143, 54, 
+    39, 253, 181, 122, 80, 245, 87, 244, 241, 74, 251, 167, 236, 172, 23, 209, 
+    2, 20, 31, 200, 55, 109, 79, 35, 31, 83, 175, 253, 247, 185, 64, 101, 
+    131, 131, 248, 190, 47, 26, 158, 29, 244, 40, 186, 137, 20, 110, 217, 82, 
+    171, 234, 116, 166, 158, 145, 95, 126, 0, 65, 148, 35, 254, 200, 168, 18, 
+    158, 142, 43, 32, 51, 181, 88, 201, 13, 83, 16, 228, 69, 38, 219, 134, 
+    234, 19, 32, 4, 154, 101, 232, 105, 17, 19, 254, 71, 3, 121, 160, 226, 
+    160, 109, 3, 46, 1, 75, 150, 153, 238, 229, 77, 241, 203, 52, 133, 252, 
+    189, 61, 76, 1, 35, 229, 29, 6, 185, 243, 143, 169, 65, 200, 70, 95, 
+    0
+};
+static uint16_t genpoly_8_209[210] = {
+    61, 38, 82, 98, 85, 52, 136, 155, 179, 52, 146, 69, 74, 194, 191, 138, 
+    99, 6, 152, 122, 243, 99, 232, 85, 85, 98, 127, 252, 111, 253, 81, 63, 
+    96, 30, 26, 61, 87, 163, 215, 72, 57, 164, 63, 102, 249, 179, 186, 96, 
+    152, 253, 20, 223, 152, 102, 88, 183, 66, 229, 106, 147, 162, 249, 63, 173, 
+    27, 94, 179, 147, 221, 231, 3, 214, 163, 43, 102, 168, 89, 233, 223, 41, 
+    221, 232, 32, 175, 192, 194, 43, 111, 247, 111, 245, 199, 46, 245, 229, 233, 
+    53, 182, 50, 59, 123, 213, 172, 69, 222, 118, 12, 162, 250, 207, 190, 228, 
+    152, 70, 42, 85, 148, 251, 196, 34, 202, 130, 41, 20, 218, 8, 38, 197, 
+    189, 225, 92, 66, 123, 26, 152, 133, 121, 33, 131, 222, 242, 24, 252, 76, 
+    38, 18, 211, 148, 126, 86, 118, 124, 39, 178, 87, 39, 100, 197, 60, 159, 
+    184, 130, 121, 3, 43, 160, 60, 68, 216, 156, 218, 153, 148, 119, 140, 152, 
+    203, 61, 75, 140, 104, 9, 197, 119, 137, 171, 218, 157, 71, 7, 188, 10, 
+    166, 51, 137, 237, 32, 214, 1, 125, 78, 252, 20, 48, 11, 91, 151, 182, 
+    185, 0
+};
+static uint16_t genpoly_8_210[211] = {
+    15, 101, 234, 16, 96, 137, 36, 117, 12, 174, 17, 218, 153, 169, 17, 93, 
+    223, 170, 112, 44, 168, 201, 104, 206, 114, 70, 149, 3, 14, 41, 173, 233, 
+    94, 217, 33, 82, 134, 51, 63, 251, 25, 71, 196, 214, 228, 204, 243, 84, 
+    15, 164, 84, 176, 186, 241, 225, 215, 78, 146, 205, 188, 103, 32, 159, 24, 
+    96, 208, 197, 52, 14, 251, 204, 26, 221, 67, 87, 195, 84, 88, 166, 231, 
+    63, 14, 121, 136, 100, 161, 102, 177, 224, 227, 137, 48, 188, 165, 157, 39, 
+    187, 88, 67, 188, 92, 136, 131, 17, 111, 164, 157, 109, 14, 65, 67, 209, 
+    134, 201, 91, 244, 153, 207, 21, 182, 62, 198, 241, 240, 211, 61, 46, 128, 
+    159, 98, 193, 152, 133, 101, 143, 45, 238, 9, 209, 60, 29, 122, 186, 15, 
+    206, 8, 197, 171, 97, 16, 133, 9, 72, 59, 37, 220, 21, 83, 74, 110, 
+    64, 190, 87, 202, 152, 159, 229, 6, 34, 210, 210, 227, 85, 119, 248, 242, 
+    239, 214, 137, 67, 53, 222, 241, 21, 213, 180, 15, 153, 97, 240, 253, 175, 
+    34, 138, 237, 153, 123, 66, 96, 207, 52, 0, 139, 35, 0, 147, 152, 118, 
+    127, 40, 0
+};
+static uint16_t genpoly_8_211[212] = {
+    225, 140, 127, 253, 99, 233, 206, 102, 59, 92, 224, 174, 132, 78, 77, 4, 
+    8, 124, 106, 89, 175, 211, 36, 163, 65, 184, 206, 110, 105, 29, 46, 155, 
+    94, 45, 50, 174, 240, 183, 36, 184, 34, 124, 188, 177, 170, 13, 98, 226, 
+    88, 112, 80, 70, 224, 105, 194, 182, 195, 243, 207, 117, 229, 58, 27, 205, 
+    32, 107, 141, 155, 4, 129, 54, 57, 118, 210, 196, 10, 196, 168, 106, 4, 
+    83, 196, 243, 55, 146, 154, 154, 66, 120, 34, 83, 25, 122, 137, 162, 52, 
+    78, 52, 58, 35, 51, 190, 139, 61, 144, 138, 33, 84, 46, 169, 10, 171, 
+    200, 13, 52, 123, 142, 42, 62, 92, 40, 143, 139, 15, 6, 139, 184, 221, 
+    175, 153, 151, 83, 49, 196, 48, 121, 235, 211, 15, 223, 207, 249, 114, 34, 
+    230, 6, 17, 242, 205, 72, 148, 109, 42, 177, 3, 0, 32, 89, 45, 209, 
+    100, 155, 232, 253, 181, 98, 58, 5, 57, 113, 94, 49, 244, 141, 78, 180, 
+    159, 80, 120, 214, 65, 1, 29, 150, 200, 86, 109, 35, 178, 96, 61, 70, 
+    29, 91, 154, 83, 124, 242, 33, 132, 219, 59, 227, 239, 72, 221, 38, 204, 
+    148, 67, 125, 0
+};
+static uint16_t genpoly_8_212[213] = {
+    181, 71, 142, 122, 57, 212, 23, 248, 20, 115, 118, 102, 64, 33, 217, 40, 
+    150, 140, 36, 59, 196, 194, 22, 71, 253, 111, 41, 143, 188, 96, 10, 4, 
+    247, 21, 109, 167, 53, 10, 144, 133, 198, 109, 217, 145, 109, 186, 138, 57, 
+    206, 161, 4, 42, 94, 119, 34, 127, 138, 81, 25, 95, 134, 160, 29, 49, 
+    189, 19, 16, 75, 83, 95, 163, 138, 125, 83, 60, 95, 242, 1, 162, 175, 
+    87, 192, 146, 153, 41, 176, 123, 94, 240, 161, 121, 202, 75, 47, 110, 33, 
+    67, 174, 253, 2, 129, 125, 169, 45, 164, 147, 238, 191, 252, 177, 90, 90, 
+    138, 55, 95, 60, 252, 7, 128, 109, 181, 97, 60, 144, 12, 165, 238, 80, 
+    244, 145, 182, 17, 211, 88, 119, 2, 32, 184, 193, 5, 91, 148, 217, 193, 
+    225, 6, 246, 38, 252, 156, 180, 100, 118, 123, 97, 197, 43, 76, 27, 156, 
+    175, 167, 173, 119, 208, 103, 228, 65, 32, 112, 228, 164, 42, 21, 76, 241, 
+    73, 231, 217, 173, 188, 244, 39, 169, 50, 49, 246, 105, 36, 153, 148, 109, 
+    155, 62, 83, 231, 30, 219, 185, 45, 120, 202, 7, 48, 252, 14, 88, 66, 
+    210, 64, 128, 101, 0
+};
+static uint16_t genpoly_8_213[214] = {
+    138, 147, 193, 2, 46, 35, 122, 185, 31, 196, 6, 116, 112, 85, 37, 45, 
+    51, 147, 172, 109, 31, 80, 125, 177, 26, 164, 88, 98, 86, 44, 197, 88, 
+    216, 39, 205, 91, 166, 198, 91, 106, 12, 138, 67, 39, 197, 245, 176, 217, 
+    157, 144, 173, 86, 186, 109, 168, 87, 203, 144, 238, 33, 232, 185, 251, 171, 
+    153, 41, 48, 70, 123, 39, 249, 112, 71, 210, 53, 79, 192, 167, 115, 96, 
+    123, 61, 7, 176, 4, 191, 10, 183, 133, 146, 113, 105, 117, 120, 140, 101, 
+    168, 28, 240, 62, 216, 68, 224, 195, 13, 32, 112, 6, 224, 248, 218, 35, 
+    177, 113, 2, 223, 54, 237, 213, 40, 63, 103, 134, 185, 6, 36, 129, 254, 
+    223, 79, 39, 168, 10, 115, 131, 193, 33, 101, 31, 48, 248, 152, 236, 161, 
+    249, 121, 111, 132, 168, 68, 129, 252, 229, 64, 163, 156, 105, 207, 134, 3, 
+    242, 107, 50, 180, 194, 250, 98, 100, 212, 207, 92, 163, 22, 194, 76, 104, 
+    254, 10, 233, 135, 12, 232, 147, 44, 189, 19, 74, 107, 226, 131, 70, 61, 
+    59, 53, 174, 25, 43, 245, 27, 62, 153, 223, 15, 203, 181, 59, 1, 236, 
+    192, 246, 245, 224, 221, 0
+};
+static uint16_t genpoly_8_214[215] = {
+    96, 123, 33, 72, 200, 43, 219, 48, 242, 226, 106, 23, 145, 152, 108, 139, 
+    75, 67, 198, 9, 100, 189, 30, 44, 151, 211, 160, 164, 60, 216, 164, 39, 
+    64, 27, 242, 206, 109, 75, 43, 72, 4, 226, 115, 163, 110, 97, 254, 19, 
+    81, 114, 175, 19, 249, 220, 177, 240, 182, 228, 65, 10, 189, 47, 40, 157, 
+    39, 24, 89, 121, 137, 98, 212, 217, 64, 175, 199, 91, 195, 136, 45, 68, 
+    63, 116, 150, 56, 46, 173, 44, 89, 241, 58, 117, 116, 39, 181, 232, 150, 
+    0, 148, 113, 68, 40, 174, 186, 14, 182, 155, 16, 154, 58, 239, 53, 182, 
+    141, 171, 79, 149, 236, 58, 207, 144, 13, 4, 159, 23, 66, 49, 19, 164, 
+    161, 77, 247, 44, 180, 188, 177, 224, 243, 121, 222, 160, 55, 73, 4, 199, 
+    236, 164, 245, 16, 26, 3, 60, 220, 145, 194, 123, 241, 83, 33, 29, 129, 
+    108, 193, 9, 76, 19, 0, 9, 244, 11, 151, 206, 46, 40, 193, 13, 123, 
+    136, 210, 31, 170, 248, 75, 154, 171, 83, 177, 63, 209, 247, 85, 67, 2, 
+    30, 231, 184, 135, 111, 22, 72, 178, 189, 20, 55, 230, 100, 7, 65, 168, 
+    126, 247, 191, 105, 108, 240, 0
+};
+static uint16_t genpoly_8_215[216] = {
+    55, 143, 71, 229, 77, 4, 34, 207, 167, 244, 198, 185, 114, 247, 237, 17, 
+    231, 153, 180, 97, 62, 65, 201, 11, 80, 143, 14, 43, 188, 252, 143, 68, 
+    77, 192, 37, 50, 31, 80, 237, 86, 32, 25, 10, 18, 41, 72, 168, 159, 
+    200, 100, 207, 83, 244, 90, 95, 56, 142, 14, 211, 154, 228, 66, 219, 8, 
+    87, 227, 134, 224, 250, 174, 78, 242, 231, 230, 226, 44, 14, 201, 76, 60, 
+    97, 118, 12, 6, 243, 22, 88, 185, 209, 228, 91, 182, 112, 165, 100, 49, 
+    111, 42, 40, 3, 108, 60, 99, 38, 63, 131, 201, 120, 13, 135, 106, 79, 
+    95, 197, 199, 33, 224, 47, 90, 200, 179, 16, 122, 110, 221, 171, 94, 116, 
+    133, 77, 52, 59, 118, 165, 57, 77, 81, 138, 49, 158, 229, 197, 242, 29, 
+    81, 213, 95, 212, 227, 178, 57, 213, 175, 172, 60, 8, 230, 73, 172, 86, 
+    41, 121, 157, 97, 232, 142, 76, 217, 217, 12, 212, 222, 240, 18, 74, 122, 
+    217, 154, 38, 30, 90, 118, 59, 240, 17, 133, 28, 5, 156, 168, 83, 61, 
+    33, 9, 169, 207, 28, 152, 166, 30, 112, 118, 169, 77, 189, 243, 75, 39, 
+    120, 243, 254, 113, 51, 189, 47, 0
+};
+static uint16_t genpoly_8_216[217] = {
+    15, 20, 9, 185, 152, 54, 168, 195, 244, 87, 134, 195, 194, 134, 250, 64, 
+    27, 227, 184, 252, 68, 200, 250, 100, 220, 245, 119, 70, 240, 43, 97, 220, 
+    24, 123, 120, 18, 48, 175, 160, 198, 219, 226, 237, 86, 69, 176, 61, 246, 
+    3, 137, 111, 33, 226, 3, 138, 147, 131, 147, 170, 218, 35, 23, 156, 105, 
+    111, 193, 0, 187, 16, 205, 72, 26, 174, 60, 199, 244, 140, 193, 59, 9, 
+    7, 70, 187, 41, 111, 137, 110, 147, 223, 114, 179, 74, 96, 156, 2, 90, 
+    183, 71, 107, 103, 216, 46, 158, 124, 5, 185, 95, 223, 152, 8, 175, 50, 
+    165, 69, 143, 71, 26, 208, 252, 1, 153, 100, 52, 246, 226, 244, 134, 109, 
+    3, 222, 225, 37, 51, 21, 207, 130, 107, 149, 239, 158, 145, 34, 29, 185, 
+    84, 231, 62, 235, 86, 42, 150, 128, 86, 120, 211, 118, 170, 138, 130, 147, 
+    171, 227, 3, 163, 171, 18, 136, 202, 108, 136, 246, 146, 79, 136, 72, 101, 
+    134, 153, 155, 210, 123, 133, 20, 63, 4, 240, 157, 143, 125, 250, 84, 250, 
+    10, 185, 120, 110, 18, 242, 214, 42, 137, 214, 185, 109, 209, 250, 229, 222, 
+    164, 155, 168, 94, 232, 50, 169, 220, 0
+};
+static uint16_t genpoly_8_217[218] = {
+    231, 117, 23, 5, 245, 11, 100, 211, 114, 46, 114, 13, 86, 96, 19, 214, 
+    211, 160, 140, 138, 105, 88, 12, 31, 191, 12, 103, 57, 149, 232, 25, 56, 
+    58, 207, 188, 238, 153, 74, 137, 3, 213, 40, 65, 195, 19, 86, 47, 21, 
+    227, 77, 30, 74, 58, 122, 188, 72, 104, 18, 185, 59, 236, 222, 250, 179, 
+    90, 99, 103, 190, 116, 108, 240, 157, 95, 140, 166, 99, 222, 201, 188, 129, 
+    93, 117, 21, 98, 28, 142, 107, 51, 67, 10, 202, 44, 125, 22, 130, 129, 
+    106, 25, 18, 52, 198, 36, 26, 65, 228, 9, 31, 254, 137, 29, 185, 1, 
+    18, 21, 152, 152, 201, 147, 40, 45, 91, 211, 18, 58, 244, 131, 89, 31, 
+    133, 229, 252, 92, 166, 91, 200, 162, 42, 57, 132, 230, 27, 87, 3, 109, 
+    122, 116, 217, 84, 246, 38, 151, 103, 138, 168, 41, 151, 162, 215, 77, 242, 
+    114, 239, 246, 146, 119, 94, 149, 144, 230, 164, 252, 62, 140, 112, 72, 236, 
+    250, 207, 36, 209, 185, 48, 172, 161, 219, 109, 146, 154, 145, 101, 48, 133, 
+    81, 44, 178, 198, 58, 114, 186, 227, 31, 121, 163, 7, 123, 152, 118, 3, 
+    229, 81, 217, 145, 95, 113, 167, 224, 102, 0
+};
+static uint16_t genpoly_8_218[219] = {
+    193, 15, 57, 211, 2, 41, 249, 80, 67, 108, 10, 185, 96, 180, 173, 175, 
+    43, 26, 10, 31, 183, 62, 92, 240, 59, 175, 62, 233, 73, 78, 151, 176, 
+    86, 178, 209, 243, 55, 116, 228, 172, 210, 226, 71, 215, 65, 228, 149, 199, 
+    194, 238, 162, 185, 36, 146, 244, 59, 221, 183, 248, 11, 14, 105, 131, 210, 
+    101, 15, 201, 230, 56, 145, 80, 7, 163, 253, 183, 3, 14, 220, 133, 195, 
+    150, 140, 5, 124, 22, 251, 49, 240, 163, 46, 35, 4, 32, 243, 188, 194, 
+    82, 140, 164, 155, 84, 210, 208, 125, 106, 169, 47, 127, 105, 206, 143, 203, 
+    161, 66, 41, 98, 219, 4, 171, 25, 72, 86, 66, 216, 248, 86, 168, 178, 
+    247, 41, 196, 56, 158, 143, 207, 92, 11, 184, 232, 60, 36, 161, 248, 20, 
+    238, 91, 39, 176, 32, 135, 84, 41, 50, 157, 26, 173, 132, 144, 91, 126, 
+    146, 119, 195, 71, 39, 234, 162, 94, 109, 223, 217, 5, 248, 110, 240, 173, 
+    67, 5, 27, 27, 121, 47, 24, 250, 254, 6, 207, 80, 93, 58, 91, 34, 
+    156, 52, 229, 193, 83, 91, 250, 136, 153, 207, 7, 177, 213, 3, 212, 84, 
+    202, 83, 80, 131, 83, 168, 167, 159, 43, 39, 0
+};
+static uint16_t genpoly_8_219[220] = {
+    156, 124, 102, 137, 100, 200, 171, 121, 83, 208, 219, 228, 160, 82, 149, 221, 
+    151, 5, 23, 48, 223, 32, 213, 212, 160, 190, 117, 84, 141, 149, 144, 194, 
+    98, 98, 72, 156, 207, 165, 162, 155, 16, 115, 149, 113, 232, 166, 183, 193, 
+    9, 97, 215, 209, 39, 16, 160, 7, 100, 192, 50, 221, 113, 30, 161, 238, 
+    24, 173, 9, 220, 243, 232, 9, 249, 160, 213, 188, 167, 65, 159, 44, 32, 
+    108, 89, 175, 0, 195, 137, 50, 74, 244, 34, 218, 239, 139, 42, 46, 144, 
+    39, 8, 171, 193, 79, 243, 19, 199, 58, 194, 99, 35, 125, 66, 212, 53, 
+    0, 101, 233, 134, 57, 169, 175, 48, 199, 214, 88, 156, 43, 237, 15, 149, 
+    31, 47, 155, 147, 14, 27, 151, 246, 88, 45, 251, 52, 13, 62, 214, 157, 
+    41, 99, 161, 145, 16, 68, 73, 121, 135, 216, 162, 50, 46, 6, 167, 32, 
+    177, 43, 222, 167, 111, 46, 194, 254, 206, 249, 168, 117, 83, 110, 130, 233, 
+    151, 224, 227, 165, 86, 130, 170, 249, 235, 188, 251, 33, 166, 153, 195, 224, 
+    204, 19, 129, 136, 225, 8, 119, 92, 209, 221, 240, 168, 20, 240, 210, 70, 
+    175, 203, 229, 141, 216, 48, 114, 51, 125, 127, 186, 0
+};
+static uint16_t genpoly_8_220[221] = {
+    120, 105, 229, 200, 44, 61, 93, 61, 142, 242, 82, 200, 221, 164, 69, 215, 
+    215, 131, 20, 79, 3, 90, 201, 96, 150, 54, 150, 157, 10, 235, 233, 205, 
+    134, 128, 10, 37, 138, 80, 229, 107, 17, 194, 56, 209, 148, 96, 139, 245, 
+    21, 185, 92, 25, 81, 37, 48, 196, 66, 89, 77, 41, 86, 147, 104, 31, 
+    70, 114, 185, 46, 251, 182, 114, 196, 165, 228, 166, 190, 247, 228, 1, 216, 
+    218, 65, 142, 188, 89, 73, 209, 93, 96, 133, 224, 185, 137, 167, 118, 20, 
+    7, 238, 57, 218, 135, 1, 70, 28, 150, 164, 142, 105, 51, 104, 90, 140, 
+    123, 213, 31, 89, 111, 25, 103, 70, 240, 104, 234, 196, 1, 50, 184, 14, 
+    20, 104, 179, 124, 123, 156, 53, 208, 5, 140, 130, 89, 23, 57, 133, 141, 
+    196, 175, 187, 30, 3, 70, 24, 128, 233, 64, 239, 204, 196, 193, 47, 126, 
+    101, 92, 164, 212, 225, 136, 24, 49, 129, 109, 212, 86, 213, 218, 148, 141, 
+    229, 71, 209, 128, 242, 113, 16, 158, 252, 187, 196, 95, 137, 244, 53, 91, 
+    157, 85, 114, 54, 186, 168, 54, 234, 183, 40, 17, 164, 29, 65, 210, 86, 
+    179, 194, 112, 53, 244, 199, 12, 16, 35, 227, 37, 204, 0
+};
+static uint16_t genpoly_8_221[222] = {
+    85, 123, 9, 126, 161, 59, 8, 37, 136, 100, 170, 117, 247, 24, 205, 189, 
+    8, 249, 200, 130, 88, 179, 58, 138, 88, 98, 68, 244, 137, 158, 118, 93, 
+    199, 218, 94, 29, 73, 65, 198, 228, 23, 249, 189, 170, 43, 66, 123, 0, 
+    127, 251, 234, 211, 206, 133, 123, 138, 54, 109, 28, 122, 215, 174, 20, 28, 
+    172, 214, 180, 21, 131, 244, 118, 100, 166, 32, 235, 222, 69, 209, 124, 227, 
+    201, 229, 172, 209, 76, 21, 199, 51, 169, 39, 122, 245, 137, 219, 42, 146, 
+    192, 5, 86, 158, 214, 111, 137, 133, 33, 55, 166, 202, 175, 84, 182, 72, 
+    9, 135, 197, 196, 120, 133, 13, 52, 61, 199, 178, 141, 95, 62, 51, 237, 
+    194, 147, 35, 202, 154, 64, 236, 164, 21, 111, 24, 22, 114, 121, 182, 114, 
+    234, 129, 62, 110, 197, 111, 80, 133, 39, 216, 141, 80, 149, 142, 33, 60, 
+    249, 70, 12, 208, 69, 49, 168, 188, 233, 86, 126, 184, 236, 147, 55, 213, 
+    191, 203, 110, 164, 4, 68, 53, 58, 215, 3, 249, 94, 253, 14, 198, 3, 
+    78, 92, 234, 93, 158, 183, 13, 223, 124, 68, 145, 250, 79, 128, 89, 140, 
+    249, 252, 157, 245, 210, 26, 217, 223, 54, 191, 191, 109, 3, 0
+};
+static uint16_t genpoly_8_222[223] = {
+    51, 226, 165, 44, 225, 59, 144, 90, 250, 232, 166, 88, 47, 188, 203, 208, 
+    120, 180, 201, 193, 22, 147, 30, 133, 13, 174, 250, 45, 107, 168, 179, 116, 
+    225, 166, 67, 251, 203, 138, 66, 80, 27, 138, 127, 186, 142, 99, 231, 122, 
+    20, 240, 183, 236, 20, 141, 102, 96, 134, 235, 186, 211, 179, 186, 185, 82, 
+    52, 199, 163, 154, 244, 7, 63, 242, 208, 171, 177, 174, 239, 169, 243, 233, 
+    95, 95, 219, 122, 235, 146, 30, 179, 10, 250, 166, 26, 80, 102, 232, 208, 
+    201, 73, 246, 70, 37, 73, 130, 83, 21, 76, 195, 109, 155, 91, 45, 47, 
+    79, 159, 2, 245, 110, 25, 4, 100, 181, 158, 156, 223, 178, 39, 201, 242, 
+    45, 204, 216, 196, 115, 233, 27, 230, 115, 10, 133, 54, 185, 95, 129, 46, 
+    90, 50, 154, 123, 160, 188, 4, 72, 182, 160, 176, 120, 163, 233, 120, 184, 
+    66, 101, 128, 194, 203, 31, 219, 215, 0, 73, 241, 236, 217, 53, 122, 3, 
+    146, 48, 125, 203, 178, 223, 146, 233, 253, 104, 203, 30, 135, 13, 106, 31, 
+    128, 151, 124, 96, 80, 38, 166, 65, 251, 147, 56, 6, 48, 61, 35, 157, 
+    186, 205, 98, 173, 30, 130, 182, 56, 144, 93, 38, 146, 46, 141, 0
+};
+static uint16_t genpoly_8_223[224] = {
+    18, 28, 104, 36, 234, 214, 235, 62, 139, 182, 134, 175, 109, 79, 203, 42, 
+    230, 128, 223, 30, 176, 172, 89, 196, 99, 190, 162, 63, 254, 229, 25, 13, 
+    84, 28, 106, 60, 6, 104, 230, 39, 225, 233, 107, 215, 249, 34, 100, 66, 
+    233, 224, 8, 21, 136, 46, 201, 166, 183, 151, 148, 205, 104, 241, 33, 83, 
+    197, 170, 239, 228, 213, 211, 172, 23, 186, 49, 152, 207, 27, 175, 39, 188, 
+    192, 80, 176, 5, 239, 141, 246, 101, 229, 182, 213, 161, 207, 136, 206, 234, 
+    99, 173, 150, 66, 40, 242, 183, 167, 62, 155, 52, 229, 153, 162, 143, 1, 
+    145, 65, 117, 141, 250, 106, 242, 182, 65, 114, 206, 37, 96, 213, 14, 228, 
+    141, 146, 109, 213, 200, 30, 32, 112, 17, 195, 123, 254, 53, 2, 194, 84, 
+    113, 252, 166, 51, 9, 242, 172, 87, 212, 139, 211, 246, 39, 83, 47, 107, 
+    26, 9, 250, 146, 25, 1, 37, 102, 118, 186, 64, 187, 105, 125, 119, 161, 
+    27, 94, 61, 54, 53, 233, 137, 162, 9, 233, 140, 75, 162, 241, 196, 30, 
+    247, 37, 19, 77, 174, 51, 112, 54, 184, 110, 226, 8, 150, 121, 59, 194, 
+    39, 233, 142, 205, 49, 41, 122, 112, 68, 19, 31, 84, 174, 20, 232, 0
+};
+static uint16_t genpoly_8_224[225] = {
+    241, 130, 41, 110, 106, 103, 15, 33, 246, 206, 219, 23, 76, 21, 229, 177, 
+    199, 118, 51, 187, 148, 206, 249, 135, 42, 156, 58, 110, 152, 1, 221, 249, 
+    116, 22, 103, 234, 205, 42, 76, 83, 64, 56, 82, 75, 158, 21, 170, 70, 
+    57, 62, 127, 236, 56, 42, 241, 145, 133, 80, 199, 47, 233, 46, 223, 66, 
+    78, 195, 90, 184, 167, 60, 1, 12, 102, 162, 165, 62, 195, 98, 180, 119, 
+    27, 57, 41, 97, 2, 25, 121, 197, 31, 26, 25, 88, 222, 143, 120, 88, 
+    5, 206, 130, 105, 171, 125, 232, 100, 26, 76, 11, 221, 153, 40, 94, 234, 
+    234, 11, 158, 136, 26, 126, 203, 45, 27, 133, 42, 222, 45, 11, 68, 176, 
+    7, 122, 186, 241, 97, 250, 219, 252, 34, 232, 188, 124, 133, 5, 236, 29, 
+    31, 155, 248, 198, 72, 226, 106, 135, 107, 49, 70, 161, 45, 94, 32, 169, 
+    84, 104, 38, 148, 112, 213, 142, 55, 140, 184, 57, 145, 191, 148, 71, 38, 
+    65, 110, 242, 125, 39, 243, 27, 33, 73, 124, 149, 147, 87, 148, 49, 0, 
+    126, 36, 40, 107, 35, 25, 5, 135, 53, 178, 69, 58, 32, 103, 254, 98, 
+    211, 221, 50, 129, 216, 195, 168, 187, 4, 78, 92, 212, 247, 28, 246, 112, 
+    0
+};
+static uint16_t genpoly_8_225[226] = {
+    210, 76, 121, 25, 158, 208, 137, 46, 195, 36, 221, 86, 157, 221, 149, 181, 
+    57, 65, 19, 248, 28, 156, 6, 18, 214, 77, 2, 239, 177, 132, 226, 168, 
+    75, 32, 75, 209, 102, 219, 247, 162, 86, 128, 138, 28, 251, 163, 135, 118, 
+    39, 119, 198, 78, 249, 195, 215, 163, 90, 8, 106, 76, 53, 153, 6, 234, 
+    39, 54, 93, 13, 101, 247, 83, 74, 69, 56, 1, 53, 28, 244, 81, 238, 
+    191, 125, 251, 195, 72, 21, 238, 50, 105, 61, 102, 133, 127, 136, 105, 235, 
+    92, 90, 141, 63, 188, 234, 93, 127, 192, 18, 165, 158, 123, 18, 205, 163, 
+    190, 78, 82, 155, 254, 135, 201, 239, 123, 73, 39, 36, 208, 193, 99, 208, 
+    188, 221, 140, 41, 103, 125, 162, 162, 152, 227, 203, 167, 236, 63, 217, 49, 
+    209, 51, 129, 3, 197, 12, 68, 47, 133, 177, 213, 253, 193, 78, 21, 132, 
+    124, 140, 111, 169, 92, 23, 77, 138, 71, 184, 33, 116, 127, 212, 72, 223, 
+    175, 126, 236, 29, 88, 207, 15, 156, 177, 166, 18, 134, 137, 51, 189, 86, 
+    74, 148, 17, 106, 43, 119, 212, 6, 112, 25, 115, 134, 60, 218, 214, 16, 
+    93, 116, 16, 15, 118, 85, 45, 211, 57, 247, 129, 251, 98, 79, 232, 104, 
+    90, 0
+};
+static uint16_t genpoly_8_226[227] = {
+    180, 36, 58, 96, 64, 251, 233, 159, 199, 231, 42, 79, 211, 38, 85, 92, 
+    52, 169, 212, 207, 80, 27, 202, 21, 88, 240, 169, 174, 42, 148, 93, 164, 
+    240, 237, 76, 172, 68, 107, 160, 69, 156, 141, 201, 75, 195, 247, 13, 74, 
+    78, 92, 246, 140, 82, 124, 104, 128, 99, 211, 25, 229, 73, 219, 104, 8, 
+    198, 6, 198, 7, 176, 172, 6, 147, 122, 14, 141, 135, 10, 68, 218, 130, 
+    46, 25, 55, 141, 161, 82, 225, 158, 204, 126, 128, 201, 163, 32, 89, 211, 
+    230, 168, 16, 65, 137, 242, 193, 234, 210, 175, 98, 48, 51, 234, 174, 10, 
+    110, 25, 140, 70, 9, 99, 201, 228, 53, 160, 225, 24, 13, 92, 17, 230, 
+    211, 138, 230, 241, 149, 122, 28, 96, 53, 81, 189, 173, 15, 157, 11, 21, 
+    220, 220, 16, 130, 248, 128, 100, 0, 36, 194, 77, 132, 21, 217, 251, 112, 
+    78, 171, 138, 233, 104, 249, 133, 64, 145, 106, 24, 83, 89, 139, 127, 215, 
+    96, 227, 243, 14, 238, 247, 225, 135, 36, 6, 51, 249, 115, 92, 83, 217, 
+    151, 87, 120, 74, 33, 118, 42, 204, 229, 75, 208, 171, 127, 237, 65, 222, 
+    2, 244, 157, 227, 250, 233, 181, 79, 72, 36, 34, 24, 128, 176, 19, 81, 
+    73, 81, 0
+};
+static uint16_t genpoly_8_227[228] = {
+    151, 175, 187, 202, 49, 71, 190, 169, 226, 149, 151, 69, 118, 6, 71, 197, 
+    132, 78, 230, 59, 208, 248, 242, 131, 5, 28, 246, 0, 146, 182, 23, 200, 
+    150, 61, 195, 87, 200, 242, 217, 151, 232, 125, 128, 52, 156, 105, 11, 121, 
+    203, 45, 133, 102, 58, 126, 202, 186, 233, 134, 142, 62, 140, 153, 84, 20, 
+    141, 79, 64, 26, 84, 161, 100, 239, 109, 236, 13, 189, 6, 219, 211, 181, 
+    107, 49, 124, 114, 21, 85, 200, 59, 226, 139, 107, 141, 145, 237, 154, 109, 
+    120, 220, 8, 109, 53, 105, 115, 248, 231, 107, 169, 150, 110, 76, 49, 148, 
+    126, 114, 1, 42, 93, 23, 79, 142, 211, 4, 226, 124, 170, 66, 85, 62, 
+    147, 75, 61, 245, 8, 82, 194, 131, 156, 151, 212, 73, 190, 105, 19, 239, 
+    106, 145, 99, 186, 34, 93, 130, 201, 158, 11, 8, 165, 69, 214, 49, 1, 
+    227, 39, 83, 174, 82, 175, 18, 34, 240, 94, 115, 243, 225, 15, 223, 184, 
+    2, 62, 3, 190, 137, 56, 179, 4, 184, 34, 60, 196, 144, 239, 38, 25, 
+    196, 78, 228, 91, 170, 22, 210, 203, 86, 106, 172, 178, 78, 218, 253, 242, 
+    122, 67, 199, 27, 121, 24, 243, 129, 109, 220, 247, 98, 70, 120, 30, 37, 
+    219, 233, 250, 0
+};
+static uint16_t genpoly_8_228[229] = {
+    123, 33, 213, 218, 42, 198, 152, 13, 123, 63, 211, 65, 250, 55, 181, 70, 
+    124, 45, 26, 219, 202, 8, 95, 58, 2, 87, 176, 219, 114, 173, 199, 17, 
+    73, 113, 161, 93, 2, 6, 239, 95, 201, 88, 254, 121, 20, 208, 11, 6, 
+    137, 57, 228, 131, 162, 244, 91, 171, 178, 155, 207, 66, 115, 107, 160, 142, 
+    40, 164, 24, 34, 245, 211, 231, 220, 88, 110, 122, 203, 202, 102, 249, 61, 
+    45, 252, 35, 70, 136, 87, 90, 176, 14, 48, 7, 7, 227, 106, 246, 61, 
+    160, 252, 202, 243, 239, 163, 120, 57, 132, 15, 243, 108, 99, 22, 33, 165, 
+    151, 17, 232, 45, 207, 249, 145, 162, 12, 49, 212, 12, 157, 110, 201, 17, 
+    121, 153, 140, 218, 154, 83, 41, 184, 78, 141, 169, 238, 232, 167, 109, 134, 
+    211, 173, 166, 156, 232, 21, 237, 118, 246, 20, 222, 238, 244, 149, 188, 196, 
+    3, 75, 93, 6, 165, 40, 86, 61, 97, 76, 245, 221, 17, 38, 241, 167, 
+    113, 110, 235, 92, 200, 97, 130, 100, 195, 69, 230, 92, 233, 155, 72, 122, 
+    146, 10, 106, 86, 74, 46, 1, 3, 227, 105, 90, 29, 227, 56, 121, 62, 
+    29, 74, 164, 211, 63, 37, 176, 78, 46, 144, 63, 198, 31, 204, 116, 190, 
+    62, 11, 34, 137, 0
+};
+static uint16_t genpoly_8_229[230] = {
+    96, 86, 152, 70, 139, 17, 105, 56, 48, 41, 206, 206, 72, 13, 56, 6, 
+    78, 118, 74, 96, 188, 83, 191, 247, 10, 165, 61, 230, 159, 222, 16, 19, 
+    226, 117, 39, 140, 89, 144, 84, 198, 226, 138, 43, 73, 170, 153, 195, 87, 
+    103, 72, 66, 52, 17, 174, 35, 141, 244, 181, 54, 212, 200, 163, 195, 44, 
+    243, 144, 190, 75, 79, 198, 107, 177, 150, 170, 77, 138, 42, 124, 213, 180, 
+    6, 16, 64, 62, 173, 28, 173, 147, 212, 172, 252, 243, 174, 14, 196, 234, 
+    193, 118, 60, 8, 199, 175, 4, 143, 22, 252, 232, 8, 138, 92, 60, 230, 
+    249, 123, 216, 102, 36, 189, 197, 54, 113, 186, 83, 79, 126, 178, 71, 214, 
+    157, 208, 44, 123, 208, 55, 123, 112, 212, 144, 240, 21, 223, 35, 252, 50, 
+    187, 104, 20, 49, 28, 45, 246, 51, 244, 189, 57, 23, 143, 150, 204, 161, 
+    24, 187, 210, 97, 78, 204, 32, 210, 205, 14, 53, 177, 76, 166, 90, 11, 
+    177, 47, 109, 150, 183, 241, 252, 132, 117, 161, 91, 88, 210, 70, 69, 237, 
+    69, 41, 119, 45, 150, 31, 106, 130, 108, 72, 170, 28, 159, 31, 40, 11, 
+    185, 62, 252, 2, 73, 60, 15, 92, 76, 162, 68, 95, 212, 246, 26, 102, 
+    41, 190, 148, 2, 218, 0
+};
+static uint16_t genpoly_8_230[231] = {
+    70, 126, 17, 76, 58, 181, 246, 76, 158, 33, 251, 13, 25, 157, 81, 203, 
+    81, 139, 214, 211, 132, 136, 78, 155, 11, 240, 206, 182, 237, 79, 132, 158, 
+    40, 82, 110, 85, 203, 43, 34, 110, 141, 230, 160, 184, 189, 115, 207, 83, 
+    251, 105, 148, 212, 5, 96, 32, 152, 26, 59, 147, 126, 158, 60, 63, 146, 
+    212, 159, 237, 53, 187, 99, 161, 120, 174, 44, 204, 160, 44, 31, 47, 211, 
+    192, 44, 150, 158, 232, 132, 181, 42, 250, 182, 188, 45, 222, 28, 171, 251, 
+    178, 218, 248, 188, 31, 202, 83, 94, 175, 209, 26, 64, 105, 198, 197, 69, 
+    126, 33, 134, 153, 160, 85, 204, 173, 72, 99, 32, 17, 5, 214, 206, 151, 
+    166, 56, 166, 94, 180, 176, 162, 6, 207, 90, 55, 159, 73, 93, 187, 5, 
+    170, 147, 18, 225, 243, 163, 82, 127, 244, 254, 38, 180, 250, 116, 17, 244, 
+    56, 20, 134, 26, 236, 184, 8, 223, 166, 189, 58, 52, 99, 37, 30, 182, 
+    88, 178, 113, 91, 53, 36, 208, 66, 216, 150, 250, 16, 18, 114, 51, 46, 
+    251, 31, 217, 125, 176, 174, 158, 47, 47, 20, 204, 175, 225, 30, 82, 252, 
+    201, 30, 52, 157, 186, 137, 105, 253, 157, 4, 153, 167, 176, 239, 135, 79, 
+    20, 236, 139, 183, 150, 30, 0
+};
+static uint16_t genpoly_8_231[232] = {
+    45, 57, 14, 153, 21, 57, 112, 174, 135, 100, 200, 15, 44, 67, 182, 185, 
+    235, 99, 192, 53, 204, 37, 88, 254, 131, 198, 238, 29, 146, 114, 201, 231, 
+    136, 108, 32, 113, 105, 114, 145, 17, 10, 102, 209, 3, 2, 91, 126, 52, 
+    204, 210, 138, 251, 122, 41, 166, 106, 249, 53, 237, 176, 29, 230, 172, 226, 
+    16, 85, 209, 57, 122, 164, 19, 131, 74, 25, 35, 244, 23, 245, 166, 2, 
+    180, 187, 135, 201, 30, 148, 242, 7, 102, 177, 155, 193, 236, 33, 142, 183, 
+    152, 160, 50, 78, 168, 246, 67, 130, 83, 64, 195, 70, 118, 122, 5, 163, 
+    177, 122, 1, 28, 168, 166, 57, 137, 148, 15, 157, 178, 155, 50, 199, 243, 
+    60, 22, 226, 173, 108, 105, 240, 2, 58, 42, 213, 186, 168, 155, 202, 152, 
+    82, 87, 18, 180, 121, 80, 157, 175, 22, 211, 60, 118, 109, 180, 195, 14, 
+    96, 9, 179, 162, 122, 44, 200, 156, 136, 107, 190, 14, 186, 17, 113, 79, 
+    216, 46, 201, 52, 206, 118, 215, 234, 107, 206, 196, 132, 158, 134, 52, 240, 
+    17, 170, 164, 180, 213, 157, 3, 56, 176, 171, 109, 166, 74, 53, 38, 251, 
+    144, 3, 232, 169, 43, 207, 139, 45, 20, 42, 207, 209, 205, 160, 85, 145, 
+    209, 172, 142, 131, 33, 174, 242, 0
+};
+static uint16_t genpoly_8_232[233] = {
+    21, 88, 1, 206, 154, 76, 44, 96, 34, 133, 68, 20, 102, 142, 148, 87, 
+    18, 54, 208, 87, 102, 165, 45, 65, 31, 119, 252, 117, 49, 79, 37, 101, 
+    10, 5, 114, 91, 189, 72, 17, 184, 228, 27, 137, 108, 132, 215, 158, 27, 
+    229, 219, 44, 42, 217, 214, 167, 41, 4, 77, 32, 67, 135, 157, 143, 136, 
+    152, 200, 191, 85, 182, 155, 140, 45, 141, 236, 72, 131, 163, 25, 181, 177, 
+    27, 231, 79, 242, 129, 2, 59, 124, 123, 85, 206, 216, 185, 103, 203, 210, 
+    140, 190, 48, 191, 114, 184, 167, 170, 175, 28, 106, 40, 180, 191, 240, 27, 
+    72, 229, 146, 206, 99, 230, 194, 46, 168, 147, 129, 104, 117, 1, 91, 37, 
+    208, 227, 248, 34, 243, 89, 225, 136, 110, 204, 221, 145, 251, 51, 65, 223, 
+    30, 55, 14, 236, 132, 14, 130, 51, 126, 45, 73, 196, 103, 95, 60, 248, 
+    177, 105, 224, 8, 59, 241, 116, 149, 125, 133, 164, 202, 204, 160, 149, 218, 
+    169, 230, 125, 196, 223, 72, 98, 42, 76, 153, 53, 134, 75, 75, 128, 42, 
+    12, 247, 104, 183, 69, 250, 42, 212, 241, 101, 61, 127, 121, 213, 117, 8, 
+    199, 2, 6, 150, 111, 120, 10, 135, 123, 216, 46, 64, 48, 245, 62, 151, 
+    76, 162, 134, 190, 37, 113, 187, 43, 0
+};
+static uint16_t genpoly_8_233[234] = {
+    253, 34, 2, 163, 177, 179, 33, 253, 181, 2, 71, 113, 77, 170, 193, 23, 
+    145, 62, 133, 73, 106, 33, 143, 247, 67, 244, 143, 101, 107, 207, 227, 162, 
+    105, 104, 236, 143, 137, 126, 200, 26, 110, 215, 32, 6, 207, 60, 252, 29, 
+    174, 214, 23, 173, 233, 24, 55, 12, 164, 57, 26, 87, 251, 233, 40, 77, 
+    32, 51, 21, 37, 180, 185, 101, 136, 25, 18, 253, 138, 20, 135, 186, 162, 
+    172, 48, 93, 156, 140, 71, 138, 166, 210, 76, 84, 237, 178, 22, 243, 241, 
+    137, 148, 48, 159, 197, 100, 75, 240, 185, 90, 40, 176, 120, 223, 24, 232, 
+    161, 94, 223, 66, 247, 131, 228, 153, 47, 137, 231, 46, 13, 188, 12, 154, 
+    227, 90, 168, 26, 74, 194, 179, 91, 214, 226, 98, 123, 180, 104, 186, 56, 
+    71, 228, 207, 202, 158, 250, 34, 249, 227, 119, 132, 179, 151, 59, 200, 83, 
+    126, 156, 35, 23, 130, 148, 28, 35, 88, 92, 160, 146, 107, 148, 7, 224, 
+    23, 153, 24, 90, 82, 59, 22, 150, 109, 92, 225, 216, 47, 217, 39, 88, 
+    39, 212, 151, 93, 42, 76, 105, 221, 112, 136, 216, 49, 52, 230, 247, 57, 
+    181, 27, 230, 149, 62, 158, 148, 231, 183, 34, 190, 128, 128, 58, 117, 98, 
+    52, 254, 94, 152, 66, 87, 96, 213, 13, 0
+};
+static uint16_t genpoly_8_234[235] = {
+    231, 59, 251, 212, 182, 250, 184, 35, 131, 197, 243, 164, 218, 193, 14, 116, 
+    129, 237, 189, 46, 140, 85, 59, 138, 42, 73, 61, 40, 139, 58, 148, 145, 
+    214, 247, 128, 58, 237, 122, 47, 2, 0, 145, 13, 204, 153, 183, 145, 171, 
+    224, 207, 66, 200, 157, 88, 168, 203, 183, 10, 54, 129, 64, 142, 164, 22, 
+    21, 234, 175, 170, 180, 231, 179, 145, 164, 205, 83, 112, 75, 40, 89, 215, 
+    205, 241, 213, 218, 102, 130, 0, 38, 45, 211, 123, 163, 247, 63, 210, 74, 
+    216, 193, 54, 207, 213, 231, 39, 196, 48, 148, 150, 158, 49, 211, 104, 64, 
+    159, 231, 136, 191, 155, 72, 177, 235, 202, 64, 14, 196, 3, 132, 247, 123, 
+    137, 157, 79, 249, 114, 73, 77, 93, 217, 123, 168, 48, 206, 81, 32, 225, 
+    207, 62, 173, 188, 172, 69, 63, 201, 218, 13, 254, 31, 182, 155, 212, 16, 
+    9, 153, 134, 137, 193, 12, 238, 250, 22, 103, 167, 190, 99, 99, 43, 130, 
+    77, 55, 250, 37, 24, 221, 57, 122, 10, 173, 212, 181, 177, 237, 229, 47, 
+    133, 32, 164, 188, 0, 97, 234, 77, 169, 55, 44, 252, 22, 209, 57, 235, 
+    23, 57, 48, 166, 109, 157, 234, 162, 72, 142, 56, 65, 240, 186, 233, 201, 
+    47, 23, 234, 160, 76, 164, 118, 170, 231, 61, 0
+};
+static uint16_t genpoly_8_235[236] = {
+    210, 205, 189, 119, 144, 168, 168, 99, 81, 60, 96, 249, 182, 247, 205, 105, 
+    135, 134, 22, 15, 26, 32, 24, 222, 101, 216, 58, 126, 246, 3, 167, 234, 
+    110, 14, 184, 118, 65, 135, 211, 17, 144, 203, 111, 98, 9, 42, 181, 232, 
+    24, 170, 227, 156, 97, 180, 145, 229, 32, 197, 175, 70, 19, 123, 241, 59, 
+    134, 136, 16, 237, 226, 144, 138, 136, 86, 2, 183, 110, 217, 8, 162, 31, 
+    171, 187, 64, 251, 77, 5, 227, 68, 85, 214, 171, 115, 86, 45, 164, 209, 
+    217, 185, 12, 126, 174, 160, 83, 73, 172, 179, 121, 181, 199, 53, 5, 57, 
+    159, 142, 186, 17, 193, 148, 31, 97, 197, 132, 109, 147, 66, 35, 104, 16, 
+    19, 235, 59, 73, 250, 26, 124, 159, 132, 39, 233, 31, 44, 20, 177, 239, 
+    34, 111, 175, 67, 71, 251, 50, 143, 83, 172, 61, 66, 202, 99, 221, 196, 
+    110, 204, 44, 149, 220, 243, 15, 118, 150, 205, 91, 110, 56, 4, 162, 79, 
+    151, 22, 65, 176, 139, 76, 132, 70, 150, 242, 206, 81, 55, 25, 162, 150, 
+    5, 39, 152, 114, 8, 223, 168, 119, 193, 25, 131, 248, 138, 92, 204, 213, 
+    114, 67, 246, 152, 39, 117, 146, 161, 171, 199, 77, 99, 90, 211, 19, 230, 
+    63, 186, 171, 213, 252, 87, 108, 105, 101, 192, 229, 0
+};
+static uint16_t genpoly_8_236[237] = {
+    190, 84, 235, 212, 206, 30, 241, 238, 45, 165, 114, 2, 167, 111, 159, 196, 
+    24, 40, 74, 3, 150, 73, 126, 87, 85, 175, 101, 23, 232, 10, 12, 153, 
+    99, 65, 106, 74, 25, 118, 124, 81, 59, 247, 69, 96, 58, 53, 195, 168, 
+    240, 125, 90, 217, 208, 20, 137, 106, 213, 201, 7, 91, 115, 233, 122, 36, 
+    71, 149, 73, 233, 193, 90, 206, 250, 232, 79, 135, 110, 115, 50, 30, 4, 
+    142, 53, 165, 2, 10, 135, 2, 195, 15, 154, 74, 63, 193, 39, 46, 63, 
+    252, 86, 159, 239, 248, 21, 167, 17, 204, 203, 52, 52, 122, 103, 2, 113, 
+    52, 42, 252, 222, 174, 86, 7, 106, 214, 27, 77, 142, 172, 253, 162, 28, 
+    67, 17, 37, 208, 229, 62, 232, 106, 98, 109, 49, 251, 182, 13, 16, 29, 
+    203, 93, 124, 224, 105, 50, 132, 30, 180, 192, 120, 28, 137, 19, 65, 105, 
+    190, 205, 250, 214, 132, 170, 146, 50, 173, 233, 93, 189, 131, 116, 222, 98, 
+    0, 251, 187, 146, 178, 91, 142, 45, 253, 27, 175, 230, 110, 58, 105, 238, 
+    8, 66, 59, 2, 89, 131, 194, 208, 135, 204, 1, 235, 34, 108, 242, 5, 
+    247, 58, 156, 250, 180, 202, 6, 228, 70, 198, 34, 20, 24, 216, 199, 171, 
+    247, 102, 234, 50, 205, 163, 186, 250, 191, 217, 5, 129, 0
+};
+static uint16_t genpoly_8_237[238] = {
+    171, 106, 156, 45, 86, 134, 145, 98, 226, 171, 6, 62, 217, 138, 65, 192, 
+    157, 226, 22, 97, 180, 239, 209, 231, 247, 201, 102, 108, 171, 38, 61, 40, 
+    60, 96, 199, 38, 23, 120, 149, 36, 165, 204, 155, 96, 98, 144, 248, 224, 
+    218, 128, 87, 122, 56, 173, 19, 140, 132, 169, 53, 220, 178, 116, 19, 214, 
+    90, 128, 128, 77, 231, 99, 194, 105, 133, 12, 254, 104, 157, 245, 114, 169, 
+    157, 66, 73, 145, 58, 110, 174, 12, 184, 126, 56, 8, 183, 188, 82, 242, 
+    148, 163, 102, 173, 148, 137, 70, 143, 190, 22, 118, 25, 35, 68, 94, 152, 
+    150, 232, 194, 75, 166, 109, 242, 124, 10, 86, 14, 152, 209, 146, 167, 128, 
+    121, 107, 116, 228, 151, 83, 55, 1, 87, 117, 161, 109, 189, 193, 51, 165, 
+    35, 49, 148, 215, 49, 126, 228, 154, 109, 76, 182, 129, 141, 251, 27, 246, 
+    141, 72, 38, 207, 239, 124, 115, 223, 147, 43, 163, 233, 252, 233, 121, 200, 
+    61, 142, 203, 55, 190, 172, 199, 97, 15, 172, 2, 241, 46, 155, 180, 223, 
+    138, 111, 128, 206, 19, 254, 144, 21, 11, 188, 222, 147, 63, 46, 45, 85, 
+    81, 233, 189, 202, 65, 130, 133, 130, 179, 139, 75, 19, 242, 192, 246, 138, 
+    230, 73, 192, 155, 84, 158, 49, 115, 123, 94, 72, 202, 171, 0
+};
+static uint16_t genpoly_8_238[239] = {
+    153, 123, 214, 2, 210, 50, 30, 38, 122, 133, 48, 245, 58, 224, 128, 134, 
+    189, 140, 244, 81, 55, 50, 156, 95, 172, 144, 164, 145, 37, 13, 125, 125, 
+    238, 93, 11, 167, 23, 154, 187, 97, 156, 91, 148, 218, 134, 220, 120, 58, 
+    55, 142, 126, 155, 252, 57, 208, 58, 202, 124, 57, 47, 88, 215, 193, 147, 
+    49, 183, 143, 168, 111, 173, 239, 129, 24, 204, 223, 4, 187, 68, 90, 34, 
+    103, 117, 122, 89, 237, 194, 185, 220, 37, 76, 64, 26, 164, 214, 12, 59, 
+    108, 95, 215, 152, 118, 73, 222, 82, 97, 44, 228, 127, 44, 17, 95, 25, 
+    225, 111, 165, 53, 55, 137, 46, 140, 64, 173, 109, 125, 0, 219, 96, 169, 
+    2, 197, 242, 88, 207, 41, 112, 115, 18, 142, 205, 2, 83, 236, 12, 236, 
+    207, 172, 140, 20, 76, 106, 85, 31, 14, 41, 102, 227, 23, 36, 40, 244, 
+    63, 59, 196, 31, 13, 12, 105, 228, 101, 53, 9, 84, 77, 135, 19, 135, 
+    199, 239, 130, 107, 135, 220, 61, 190, 103, 225, 183, 104, 93, 127, 58, 79, 
+    159, 22, 209, 56, 4, 220, 48, 7, 115, 100, 242, 149, 11, 111, 19, 179, 
+    197, 103, 145, 16, 53, 51, 97, 38, 117, 29, 52, 96, 22, 191, 3, 221, 
+    233, 92, 199, 149, 225, 73, 80, 14, 24, 62, 240, 50, 25, 207, 0
+};
+static uint16_t genpoly_8_239[240] = {
+    136, 92, 218, 47, 154, 161, 188, 165, 49, 16, 252, 19, 228, 52, 201, 184, 
+    118, 159, 145, 35, 26, 167, 209, 29, 23, 56, 94, 194, 61, 121, 87, 176, 
+    55, 3, 250, 221, 139, 141, 208, 122, 204, 69, 22, 198, 243, 243, 183, 172, 
+    131, 221, 127, 181, 17, 240, 79, 234, 107, 181, 254, 38, 157, 112, 24, 53, 
+    224, 129, 185, 170, 189, 40, 45, 161, 35, 82, 147, 215, 74, 85, 155, 252, 
+    210, 50, 160, 125, 168, 105, 1, 218, 232, 171, 1, 21, 169, 182, 25, 231, 
+    167, 42, 134, 252, 84, 30, 145, 221, 23, 193, 237, 224, 133, 13, 31, 13, 
+    85, 173, 31, 11, 20, 13, 61, 186, 67, 214, 183, 207, 215, 252, 156, 85, 
+    30, 65, 64, 201, 54, 84, 57, 159, 119, 60, 217, 33, 218, 117, 42, 184, 
+    10, 76, 250, 254, 123, 120, 52, 130, 133, 188, 54, 134, 108, 160, 67, 244, 
+    48, 223, 170, 176, 79, 28, 235, 205, 93, 249, 6, 172, 170, 202, 163, 20, 
+    121, 109, 214, 21, 174, 152, 96, 39, 183, 45, 223, 17, 198, 161, 17, 199, 
+    2, 30, 107, 124, 96, 192, 1, 153, 88, 191, 141, 156, 0, 46, 71, 140, 
+    23, 206, 2, 214, 109, 26, 5, 244, 12, 209, 184, 60, 86, 213, 244, 220, 
+    48, 82, 205, 143, 206, 201, 237, 32, 165, 205, 195, 205, 115, 48, 194, 0
+};
+static uint16_t genpoly_8_240[241] = {
+    120, 4, 116, 235, 128, 34, 228, 252, 105, 127, 64, 152, 186, 151, 213, 186, 
+    97, 17, 93, 120, 164, 67, 0, 11, 141, 91, 190, 53, 39, 74, 124, 67, 
+    35, 4, 89, 134, 122, 186, 124, 72, 158, 46, 184, 1, 152, 26, 135, 164, 
+    174, 226, 135, 111, 227, 189, 191, 34, 212, 15, 240, 164, 77, 110, 105, 68, 
+    59, 233, 60, 141, 120, 47, 96, 151, 251, 22, 209, 68, 214, 156, 101, 246, 
+    102, 86, 22, 92, 133, 220, 96, 218, 159, 40, 25, 142, 93, 116, 177, 173, 
+    13, 30, 10, 100, 113, 180, 31, 73, 91, 48, 60, 162, 159, 31, 211, 133, 
+    2, 217, 22, 61, 162, 162, 121, 130, 42, 146, 153, 210, 226, 141, 118, 74, 
+    130, 22, 116, 207, 96, 115, 29, 33, 92, 90, 64, 229, 178, 181, 107, 143, 
+    142, 63, 83, 38, 31, 96, 250, 26, 161, 236, 130, 15, 199, 174, 120, 200, 
+    232, 137, 8, 79, 153, 23, 180, 9, 254, 170, 131, 98, 187, 224, 159, 93, 
+    190, 215, 13, 34, 17, 120, 212, 3, 216, 54, 227, 241, 40, 195, 235, 87, 
+    51, 57, 44, 206, 93, 213, 157, 35, 163, 93, 161, 239, 191, 219, 190, 121, 
+    168, 216, 34, 0, 236, 11, 164, 81, 147, 33, 38, 121, 234, 206, 195, 135, 
+    231, 81, 124, 78, 129, 111, 39, 118, 112, 20, 12, 89, 199, 67, 219, 123, 
+    0
+};
+static uint16_t genpoly_8_241[242] = {
+    105, 68, 108, 213, 141, 88, 181, 117, 17, 8, 0, 44, 144, 189, 137, 23, 
+    179, 76, 31, 148, 74, 30, 235, 137, 203, 34, 50, 229, 233, 132, 157, 184, 
+    6, 64, 170, 53, 115, 249, 249, 68, 188, 80, 241, 243, 35, 15, 253, 196, 
+    246, 94, 220, 199, 237, 224, 220, 226, 92, 200, 154, 230, 28, 110, 183, 229, 
+    154, 148, 244, 96, 171, 58, 183, 27, 66, 63, 229, 210, 147, 121, 252, 17, 
+    176, 58, 138, 34, 180, 10, 36, 138, 239, 47, 229, 246, 39, 120, 191, 150, 
+    35, 211, 78, 56, 41, 34, 6, 39, 23, 196, 250, 65, 177, 137, 54, 138, 
+    202, 214, 146, 132, 37, 129, 95, 15, 66, 201, 165, 5, 54, 232, 87, 116, 
+    199, 202, 153, 84, 182, 237, 140, 85, 46, 143, 174, 156, 199, 221, 251, 33, 
+    181, 20, 150, 206, 150, 84, 51, 49, 137, 89, 3, 171, 160, 90, 214, 78, 
+    13, 146, 2, 252, 136, 177, 0, 34, 138, 156, 132, 48, 193, 66, 6, 169, 
+    88, 109, 199, 168, 110, 43, 5, 199, 5, 167, 61, 70, 89, 117, 94, 130, 
+    19, 186, 151, 223, 0, 35, 3, 16, 125, 248, 143, 84, 99, 235, 188, 65, 
+    229, 186, 124, 112, 102, 218, 229, 65, 64, 248, 197, 55, 120, 179, 13, 166, 
+    226, 89, 203, 77, 144, 114, 29, 0, 23, 47, 162, 241, 163, 231, 63, 228, 
+    203, 0
+};
+static uint16_t genpoly_8_242[243] = {
+    91, 37, 156, 189, 103, 85, 219, 54, 121, 159, 120, 219, 20, 131, 159, 186, 
+    0, 142, 74, 70, 86, 179, 182, 101, 58, 80, 232, 73, 138, 55, 199, 201, 
+    107, 19, 214, 118, 18, 226, 41, 177, 168, 94, 4, 29, 6, 137, 226, 43, 
+    7, 150, 72, 13, 54, 218, 239, 239, 13, 64, 68, 128, 78, 45, 167, 36, 
+    44, 227, 143, 9, 110, 93, 178, 98, 181, 117, 254, 214, 18, 38, 201, 152, 
+    186, 116, 94, 134, 106, 41, 65, 62, 143, 111, 220, 179, 127, 50, 179, 148, 
+    251, 217, 243, 108, 236, 201, 99, 253, 228, 112, 127, 239, 64, 139, 144, 220, 
+    191, 143, 127, 240, 92, 243, 46, 228, 190, 209, 204, 1, 88, 44, 162, 69, 
+    225, 0, 62, 105, 43, 52, 246, 180, 82, 81, 211, 250, 110, 226, 20, 161, 
+    55, 43, 91, 2, 47, 187, 23, 89, 144, 49, 95, 28, 45, 35, 114, 156, 
+    130, 166, 250, 230, 38, 144, 138, 93, 147, 24, 102, 33, 127, 56, 87, 0, 
+    148, 246, 77, 83, 228, 120, 167, 231, 185, 195, 158, 143, 157, 150, 0, 228, 
+    46, 138, 9, 59, 1, 181, 64, 101, 90, 194, 27, 50, 183, 127, 188, 47, 
+    157, 231, 78, 186, 198, 68, 165, 114, 32, 149, 141, 198, 38, 49, 225, 223, 
+    241, 68, 195, 140, 127, 113, 16, 229, 144, 197, 173, 120, 44, 179, 211, 56, 
+    37, 187, 0
+};
+static uint16_t genpoly_8_243[244] = {
+    78, 35, 137, 249, 91, 59, 228, 104, 70, 20, 28, 96, 207, 19, 113, 220, 
+    175, 230, 152, 125, 20, 203, 88, 60, 34, 202, 35, 12, 249, 227, 134, 0, 
+    136, 132, 181, 174, 95, 141, 30, 236, 34, 86, 30, 59, 59, 120, 105, 28, 
+    121, 178, 140, 132, 135, 47, 245, 15, 38, 252, 199, 54, 243, 107, 114, 32, 
+    118, 129, 234, 175, 35, 44, 225, 105, 9, 244, 65, 251, 34, 176, 130, 113, 
+    78, 138, 164, 102, 218, 234, 108, 103, 79, 27, 41, 182, 72, 150, 121, 148, 
+    6, 190, 6, 30, 45, 153, 23, 103, 199, 74, 55, 128, 250, 38, 158, 67, 
+    30, 144, 68, 233, 212, 55, 172, 191, 160, 90, 224, 52, 96, 90, 241, 156, 
+    190, 38, 127, 26, 76, 180, 73, 43, 189, 129, 161, 44, 216, 149, 37, 197, 
+    195, 184, 126, 210, 110, 96, 138, 73, 196, 68, 67, 132, 169, 187, 71, 68, 
+    220, 40, 27, 235, 28, 58, 117, 243, 218, 45, 237, 15, 124, 2, 89, 93, 
+    246, 63, 226, 228, 155, 250, 1, 150, 229, 132, 198, 252, 242, 230, 45, 146, 
+    156, 177, 228, 184, 104, 194, 222, 174, 187, 171, 240, 201, 161, 223, 92, 59, 
+    151, 171, 135, 152, 29, 176, 27, 62, 93, 129, 54, 154, 193, 234, 107, 192, 
+    55, 95, 186, 144, 202, 108, 27, 228, 130, 75, 80, 143, 190, 72, 171, 216, 
+    132, 33, 199, 0
+};
+static uint16_t genpoly_8_244[245] = {
+    66, 35, 148, 243, 164, 60, 215, 126, 133, 237, 157, 17, 97, 219, 14, 187, 
+    222, 163, 253, 216, 88, 150, 125, 234, 6, 191, 170, 83, 201, 96, 64, 203, 
+    203, 174, 52, 154, 164, 231, 213, 238, 106, 220, 35, 98, 102, 186, 101, 175, 
+    119, 50, 181, 213, 12, 141, 87, 34, 82, 35, 145, 198, 182, 30, 189, 247, 
+    127, 216, 149, 24, 214, 237, 189, 165, 29, 85, 205, 75, 84, 205, 26, 55, 
+    52, 43, 199, 185, 199, 104, 59, 159, 133, 231, 225, 16, 88, 108, 234, 103, 
+    19, 213, 247, 61, 235, 230, 243, 40, 62, 58, 30, 69, 152, 237, 70, 94, 
+    145, 251, 82, 187, 218, 188, 252, 75, 136, 73, 118, 85, 160, 111, 45, 248, 
+    35, 16, 178, 104, 10, 226, 214, 138, 65, 249, 222, 7, 23, 13, 228, 227, 
+    244, 82, 25, 3, 76, 172, 60, 201, 193, 133, 99, 117, 31, 69, 236, 38, 
+    145, 143, 169, 25, 46, 61, 44, 235, 126, 129, 16, 163, 119, 12, 48, 108, 
+    97, 174, 56, 135, 58, 190, 144, 252, 161, 189, 148, 50, 109, 73, 138, 204, 
+    87, 45, 25, 161, 242, 55, 248, 90, 18, 26, 230, 172, 70, 214, 201, 231, 
+    176, 178, 88, 222, 8, 20, 148, 192, 54, 203, 47, 80, 162, 147, 50, 87, 
+    37, 177, 226, 148, 219, 196, 35, 252, 142, 74, 226, 63, 226, 231, 77, 189, 
+    50, 141, 58, 212, 0
+};
+static uint16_t genpoly_8_245[246] = {
+    55, 131, 1, 107, 11, 241, 69, 221, 8, 153, 227, 254, 126, 217, 67, 196, 
+    42, 63, 39, 170, 32, 71, 180, 124, 33, 16, 12, 71, 125, 156, 41, 241, 
+    4, 94, 202, 133, 252, 153, 156, 19, 216, 145, 22, 211, 249, 82, 20, 24, 
+    119, 156, 161, 107, 201, 126, 34, 239, 209, 187, 36, 252, 179, 77, 220, 175, 
+    195, 78, 89, 47, 171, 14, 235, 237, 197, 213, 154, 68, 16, 108, 163, 59, 
+    102, 125, 212, 73, 135, 193, 37, 218, 42, 138, 27, 53, 30, 232, 45, 69, 
+    82, 79, 123, 155, 119, 18, 173, 113, 107, 29, 122, 152, 201, 247, 122, 114, 
+    25, 219, 42, 54, 25, 47, 238, 8, 128, 157, 209, 87, 46, 28, 174, 160, 
+    235, 224, 9, 8, 196, 13, 113, 132, 13, 233, 195, 176, 94, 183, 200, 16, 
+    127, 239, 31, 10, 232, 246, 244, 231, 174, 238, 17, 2, 124, 39, 226, 56, 
+    223, 176, 125, 20, 199, 187, 155, 15, 226, 145, 208, 50, 120, 115, 166, 175, 
+    220, 133, 20, 73, 73, 201, 192, 248, 116, 229, 58, 108, 15, 48, 89, 150, 
+    253, 84, 1, 66, 72, 46, 217, 224, 42, 220, 193, 15, 149, 231, 45, 193, 
+    201, 56, 203, 28, 186, 107, 100, 166, 37, 17, 229, 181, 196, 224, 71, 138, 
+    40, 12, 161, 41, 76, 66, 231, 113, 19, 194, 78, 62, 254, 120, 89, 203, 
+    131, 167, 19, 179, 65, 0
+};
+static uint16_t genpoly_8_246[247] = {
+    45, 91, 68, 186, 101, 59, 221, 46, 74, 254, 114, 40, 79, 217, 36, 220, 
+    22, 109, 165, 182, 212, 241, 72, 150, 149, 14, 63, 139, 84, 51, 72, 189, 
+    13, 121, 93, 254, 202, 212, 49, 188, 223, 226, 173, 169, 78, 200, 142, 169, 
+    194, 127, 238, 58, 66, 31, 245, 157, 130, 30, 159, 114, 204, 45, 238, 177, 
+    94, 117, 177, 213, 165, 197, 238, 254, 240, 97, 253, 243, 235, 11, 37, 167, 
+    77, 146, 10, 57, 249, 100, 97, 167, 72, 18, 160, 81, 38, 145, 140, 106, 
+    19, 113, 215, 2, 184, 128, 187, 14, 151, 45, 64, 215, 0, 12, 103, 137, 
+    16, 70, 236, 240, 118, 80, 68, 220, 32, 120, 9, 149, 19, 140, 62, 5, 
+    118, 140, 188, 65, 71, 170, 126, 2, 233, 152, 150, 120, 234, 225, 86, 214, 
+    142, 93, 159, 242, 210, 118, 34, 131, 175, 190, 93, 146, 235, 103, 167, 17, 
+    212, 225, 129, 202, 165, 56, 252, 97, 232, 216, 195, 213, 233, 87, 240, 9, 
+    3, 227, 205, 8, 237, 187, 174, 12, 83, 155, 69, 244, 44, 180, 35, 72, 
+    170, 221, 11, 13, 203, 102, 179, 164, 147, 215, 103, 204, 218, 26, 33, 8, 
+    134, 52, 52, 114, 218, 1, 158, 89, 237, 226, 14, 79, 13, 229, 119, 130, 
+    62, 241, 222, 202, 195, 149, 72, 25, 106, 42, 169, 140, 224, 119, 204, 186, 
+    116, 219, 16, 111, 3, 36, 0
+};
+static uint16_t genpoly_8_247[248] = {
+    36, 220, 167, 137, 64, 33, 178, 82, 38, 204, 99, 66, 4, 54, 175, 73, 
+    185, 228, 95, 192, 108, 50, 126, 181, 59, 14, 200, 74, 36, 149, 106, 104, 
+    100, 14, 4, 29, 207, 46, 247, 220, 21, 117, 138, 204, 175, 168, 144, 175, 
+    223, 86, 93, 19, 156, 35, 34, 252, 187, 90, 141, 121, 205, 209, 90, 79, 
+    235, 155, 100, 185, 215, 75, 50, 141, 141, 24, 21, 226, 39, 114, 79, 180, 
+    69, 5, 170, 249, 117, 98, 143, 111, 160, 187, 179, 98, 205, 37, 192, 85, 
+    195, 189, 133, 233, 170, 77, 181, 167, 191, 228, 219, 41, 202, 205, 7, 2, 
+    178, 200, 226, 63, 188, 57, 240, 189, 128, 163, 111, 88, 220, 252, 58, 32, 
+    102, 162, 243, 128, 12, 184, 167, 154, 242, 1, 208, 214, 62, 249, 12, 239, 
+    224, 247, 152, 254, 71, 235, 45, 60, 214, 75, 184, 106, 8, 98, 115, 97, 
+    57, 98, 62, 90, 231, 161, 5, 78, 198, 106, 150, 84, 25, 84, 96, 222, 
+    231, 149, 183, 77, 56, 235, 44, 133, 241, 6, 134, 139, 64, 93, 51, 157, 
+    231, 22, 32, 162, 34, 117, 119, 10, 226, 204, 237, 253, 36, 234, 222, 135, 
+    88, 124, 187, 102, 188, 172, 191, 31, 44, 55, 107, 3, 50, 185, 8, 62, 
+    193, 147, 80, 147, 240, 152, 39, 5, 157, 13, 156, 115, 186, 228, 87, 185, 
+    238, 88, 207, 247, 74, 113, 175, 0
+};
+static uint16_t genpoly_8_248[249] = {
+    28, 88, 173, 113, 147, 128, 29, 171, 206, 45, 181, 183, 162, 111, 144, 89, 
+    170, 13, 91, 254, 250, 78, 67, 112, 222, 56, 77, 88, 103, 233, 81, 15, 
+    147, 233, 29, 72, 114, 183, 213, 40, 185, 47, 161, 46, 87, 142, 244, 54, 
+    106, 247, 184, 6, 249, 2, 170, 173, 159, 24, 78, 235, 89, 87, 131, 63, 
+    14, 173, 15, 240, 64, 2, 60, 85, 160, 57, 80, 126, 154, 50, 59, 99, 
+    214, 129, 161, 31, 186, 98, 18, 34, 236, 152, 225, 249, 99, 81, 216, 14, 
+    51, 242, 86, 28, 23, 195, 7, 38, 221, 145, 24, 73, 160, 29, 77, 38, 
+    175, 239, 233, 185, 143, 4, 94, 238, 229, 136, 31, 67, 36, 75, 47, 160, 
+    6, 23, 142, 60, 207, 2, 58, 72, 16, 142, 189, 149, 33, 209, 168, 42, 
+    126, 206, 183, 124, 215, 228, 39, 203, 20, 246, 201, 74, 100, 3, 242, 177, 
+    14, 75, 67, 155, 251, 104, 242, 218, 56, 204, 172, 171, 28, 8, 225, 210, 
+    66, 254, 237, 187, 2, 186, 224, 135, 239, 41, 117, 81, 91, 245, 96, 50, 
+    193, 215, 220, 60, 60, 80, 11, 82, 204, 160, 103, 9, 217, 184, 52, 201, 
+    92, 210, 136, 114, 53, 19, 239, 196, 118, 249, 68, 228, 106, 99, 96, 83, 
+    2, 155, 118, 137, 62, 74, 174, 104, 14, 196, 4, 234, 38, 67, 73, 200, 
+    114, 87, 208, 60, 87, 61, 129, 52, 0
+};
+static uint16_t genpoly_8_249[250] = {
+    21, 78, 39, 117, 121, 209, 122, 20, 38, 211, 20, 8, 22, 12, 199, 56, 
+    184, 251, 129, 248, 55, 218, 93, 51, 151, 217, 117, 218, 115, 43, 163, 243, 
+    56, 23, 246, 95, 155, 88, 93, 4, 3, 209, 89, 67, 182, 52, 216, 152, 
+    238, 128, 88, 95, 234, 93, 135, 52, 78, 249, 10, 170, 201, 224, 7, 102, 
+    251, 205, 31, 153, 117, 104, 240, 93, 102, 74, 111, 183, 52, 163, 248, 77, 
+    131, 17, 28, 20, 221, 165, 16, 162, 157, 226, 188, 38, 248, 228, 3, 36, 
+    233, 96, 137, 234, 71, 46, 123, 117, 90, 173, 194, 131, 190, 240, 154, 106, 
+    209, 234, 15, 190, 8, 212, 39, 90, 21, 235, 2, 240, 13, 144, 123, 147, 
+    132, 180, 1, 212, 137, 195, 129, 216, 187, 169, 73, 128, 221, 178, 126, 196, 
+    182, 106, 140, 153, 83, 115, 30, 195, 161, 50, 115, 89, 66, 93, 145, 47, 
+    92, 30, 42, 158, 59, 122, 183, 198, 194, 60, 13, 191, 113, 9, 147, 82, 
+    52, 87, 85, 239, 110, 130, 173, 58, 239, 37, 150, 62, 31, 15, 246, 93, 
+    84, 175, 156, 246, 211, 104, 227, 227, 19, 136, 57, 128, 226, 108, 0, 29, 
+    156, 212, 220, 61, 63, 137, 84, 242, 26, 66, 5, 187, 74, 153, 8, 169, 
+    21, 217, 124, 173, 50, 149, 94, 237, 111, 51, 185, 80, 155, 172, 165, 184, 
+    127, 216, 205, 59, 153, 72, 75, 4, 50, 0
+};
+static uint16_t genpoly_8_250[251] = {
+    15, 4, 217, 171, 58, 116, 136, 46, 75, 231, 119, 35, 35, 60, 33, 44, 
+    84, 198, 45, 219, 237, 211, 166, 10, 23, 79, 211, 191, 178, 243, 161, 3, 
+    217, 120, 224, 245, 111, 62, 186, 72, 155, 215, 184, 183, 136, 80, 59, 57, 
+    14, 193, 157, 187, 1, 11, 159, 205, 145, 101, 168, 35, 69, 14, 77, 166, 
+    223, 120, 251, 102, 218, 90, 20, 206, 43, 204, 61, 147, 42, 249, 39, 199, 
+    42, 122, 104, 75, 143, 133, 16, 93, 218, 80, 195, 189, 225, 55, 83, 11, 
+    188, 211, 179, 218, 210, 27, 162, 166, 102, 230, 155, 234, 181, 203, 43, 116, 
+    210, 201, 198, 160, 201, 10, 180, 223, 61, 215, 34, 144, 119, 54, 125, 156, 
+    52, 239, 91, 4, 222, 58, 0, 220, 9, 18, 33, 200, 133, 44, 28, 87, 
+    14, 95, 228, 43, 45, 171, 105, 119, 86, 124, 107, 191, 14, 247, 168, 138, 
+    150, 41, 185, 66, 250, 118, 134, 72, 107, 131, 57, 220, 66, 27, 81, 192, 
+    112, 6, 106, 20, 95, 171, 50, 195, 95, 225, 79, 28, 200, 143, 204, 176, 
+    60, 254, 49, 115, 75, 188, 184, 121, 97, 139, 221, 15, 23, 50, 112, 165, 
+    172, 209, 155, 78, 198, 80, 135, 20, 5, 162, 10, 57, 221, 54, 250, 14, 
+    40, 169, 119, 112, 19, 70, 102, 90, 177, 81, 228, 194, 189, 222, 203, 209, 
+    44, 162, 12, 244, 85, 71, 19, 138, 190, 238, 0
+};
+static uint16_t genpoly_8_251[252] = {
+    10, 53, 198, 149, 167, 108, 98, 115, 156, 68, 194, 189, 117, 128, 136, 188, 
+    127, 153, 47, 190, 8, 193, 214, 138, 37, 6, 128, 85, 206, 106, 161, 56, 
+    32, 81, 121, 23, 61, 73, 215, 220, 23, 167, 245, 78, 52, 89, 142, 210, 
+    229, 24, 22, 56, 148, 88, 132, 29, 98, 223, 75, 248, 244, 192, 177, 36, 
+    87, 147, 221, 122, 222, 246, 61, 41, 211, 200, 246, 152, 61, 39, 180, 45, 
+    219, 88, 9, 206, 253, 110, 39, 148, 204, 196, 104, 251, 176, 87, 220, 146, 
+    218, 221, 94, 60, 249, 221, 198, 5, 206, 42, 12, 250, 84, 249, 61, 60, 
+    20, 2, 220, 143, 226, 3, 33, 164, 249, 55, 69, 231, 78, 215, 90, 213, 
+    116, 214, 205, 149, 69, 198, 173, 146, 68, 150, 192, 215, 5, 11, 204, 44, 
+    215, 237, 17, 186, 245, 188, 216, 249, 65, 104, 236, 238, 171, 250, 122, 216, 
+    41, 154, 251, 9, 213, 109, 185, 78, 36, 99, 183, 64, 150, 35, 154, 181, 
+    22, 121, 80, 96, 186, 211, 146, 127, 32, 136, 67, 12, 221, 112, 132, 189, 
+    198, 30, 183, 63, 254, 107, 68, 133, 46, 17, 24, 234, 220, 157, 109, 77, 
+    108, 25, 207, 68, 15, 15, 133, 126, 93, 196, 161, 117, 146, 1, 206, 56, 
+    195, 243, 126, 162, 13, 94, 78, 153, 85, 202, 58, 37, 103, 56, 53, 47, 
+    124, 134, 13, 106, 70, 58, 73, 137, 124, 178, 38, 0
+};
+static uint16_t genpoly_8_252[253] = {
+    6, 113, 57, 195, 210, 27, 155, 142, 35, 214, 96, 74, 81, 20, 14, 101, 
+    81, 6, 67, 2, 44, 29, 6, 251, 230, 85, 120, 67, 165, 199, 89, 121, 
+    150, 216, 147, 240, 159, 88, 36, 59, 236, 100, 7, 204, 12, 70, 216, 103, 
+    192, 49, 173, 241, 82, 45, 19, 67, 242, 241, 7, 220, 12, 177, 165, 201, 
+    22, 76, 58, 157, 52, 60, 27, 147, 111, 178, 52, 147, 131, 123, 35, 251, 
+    130, 75, 40, 176, 194, 30, 81, 236, 69, 247, 30, 225, 48, 103, 62, 93, 
+    163, 61, 169, 40, 156, 70, 202, 106, 110, 211, 144, 172, 165, 217, 172, 143, 
+    29, 132, 86, 230, 19, 93, 91, 82, 0, 53, 229, 76, 230, 239, 61, 243, 
+    238, 88, 245, 73, 24, 110, 123, 129, 59, 19, 134, 184, 85, 203, 236, 30, 
+    237, 248, 224, 40, 198, 198, 43, 170, 5, 148, 26, 177, 28, 217, 190, 235, 
+    184, 110, 174, 140, 221, 137, 241, 194, 107, 93, 216, 0, 59, 184, 227, 64, 
+    76, 96, 5, 135, 72, 112, 251, 33, 29, 138, 43, 65, 15, 198, 166, 182, 
+    21, 233, 24, 7, 12, 96, 52, 82, 123, 31, 222, 102, 249, 164, 26, 139, 
+    85, 26, 88, 185, 70, 152, 133, 189, 9, 94, 5, 78, 16, 246, 218, 77, 
+    47, 208, 10, 234, 128, 153, 167, 194, 213, 175, 244, 187, 11, 35, 207, 217, 
+    27, 24, 50, 172, 252, 108, 125, 1, 188, 177, 43, 103, 0
+};
+static uint16_t genpoly_8_253[254] = {
+    3, 103, 111, 48, 250, 64, 68, 193, 56, 87, 236, 225, 215, 233, 155, 228, 
+    243, 209, 169, 16, 105, 59, 91, 37, 82, 17, 193, 53, 141, 152, 176, 43, 
+    209, 73, 21, 5, 115, 180, 45, 129, 69, 52, 189, 215, 132, 24, 191, 171, 
+    79, 6, 192, 131, 6, 228, 225, 203, 19, 124, 19, 146, 233, 194, 144, 183, 
+    181, 5, 236, 243, 81, 139, 90, 107, 211, 72, 24, 202, 120, 187, 113, 100, 
+    75, 235, 21, 201, 158, 220, 250, 17, 151, 106, 75, 145, 16, 224, 72, 184, 
+    104, 0, 3, 109, 130, 226, 45, 104, 205, 109, 52, 43, 81, 37, 134, 248, 
+    106, 135, 210, 90, 100, 135, 175, 134, 167, 53, 221, 230, 69, 130, 79, 208, 
+    7, 204, 113, 107, 197, 59, 29, 73, 36, 4, 252, 120, 48, 22, 167, 56, 
+    217, 9, 229, 241, 46, 145, 47, 246, 175, 82, 64, 216, 216, 68, 151, 42, 
+    197, 247, 124, 57, 91, 139, 8, 244, 217, 158, 204, 27, 244, 87, 115, 131, 
+    208, 144, 229, 54, 105, 247, 146, 132, 184, 129, 39, 35, 62, 241, 246, 210, 
+    8, 50, 221, 97, 205, 103, 35, 60, 66, 102, 230, 39, 111, 187, 27, 50, 
+    141, 252, 83, 60, 181, 201, 9, 183, 66, 4, 152, 171, 226, 110, 202, 83, 
+    62, 54, 224, 112, 194, 7, 220, 22, 248, 42, 211, 112, 155, 192, 180, 110, 
+    191, 176, 189, 203, 57, 29, 169, 47, 46, 235, 36, 102, 97, 0
+};
+static uint16_t genpoly_8_254[255] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 
+    129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 
+    145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 
+    161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 
+    177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 
+    193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 
+    225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 0
+};
+static const struct rs_control rs_codecs_8[255] = {
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_0, .nroots = 0, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_1, .nroots = 1, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_2, .nroots = 2, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_3, .nroots = 3, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_4, .nroots = 4, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_5, .nroots = 5, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_6, .nroots = 6, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_7, .nroots = 7, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_8, .nroots = 8, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_9, .nroots = 9, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_10, .nroots = 10, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_11, .nroots = 11, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_12, .nroots = 12, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_13, .nroots = 13, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_14, .nroots = 14, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_15, .nroots = 15, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_16, .nroots = 16, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_17, .nroots = 17, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_18, .nroots = 18, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_19, .nroots = 19, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_20, .nroots = 20, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_21, .nroots = 21, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_22, .nroots = 22, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_23, .nroots = 23, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_24, .nroots = 24, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_25, .nroots = 25, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_26, .nroots = 26, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_27, .nroots = 27, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_28, .nroots = 28, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_29, .nroots = 29, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_30, .nroots = 30, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_31, .nroots = 31, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_32, .nroots = 32, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_33, .nroots = 33, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_34, .nroots = 34, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_35, .nroots = 35, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_36, .nroots = 36, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_37, .nroots = 37, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_38, .nroots = 38, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_39, .nroots = 39, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_40, .nroots = 40, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_41, .nroots = 41, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_42, .nroots = 42, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_43, .nroots = 43, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_44, .nroots = 44, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_45, .nroots = 45, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_46, .nroots = 46, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_47, .nroots = 47, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_48, .nroots = 48, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_49, .nroots = 49, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_50, .nroots = 50, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_51, .nroots = 51, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_52, .nroots = 52, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_53, .nroots = 53, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_54, .nroots = 54, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_55, .nroots = 55, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_56, .nroots = 56, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_57, .nroots = 57, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_58, .nroots = 58, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_59, .nroots = 59, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_60, .nroots = 60, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_61, .nroots = 61, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_62, .nroots = 62, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_63, .nroots = 63, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_64, .nroots = 64, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_65, .nroots = 65, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_66, .nroots = 66, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_67, .nroots = 67, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_68, .nroots = 68, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_69, .nroots = 69, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_70, .nroots = 70, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_71, .nroots = 71, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_72, .nroots = 72, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_73, .nroots = 73, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_74, .nroots = 74, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_75, .nroots = 75, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_76, .nroots = 76, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_77, .nroots = 77, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_78, .nroots = 78, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_79, .nroots = 79, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_80, .nroots = 80, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_81, .nroots = 81, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_82, .nroots = 82, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_83, .nroots = 83, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_84, .nroots = 84, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_85, .nroots = 85, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_86, .nroots = 86, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_87, .nroots = 87, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_88, .nroots = 88, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_89, .nroots = 89, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_90, .nroots = 90, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_91, .nroots = 91, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_92, .nroots = 92, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_93, .nroots = 93, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_94, .nroots = 94, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_95, .nroots = 95, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_96, .nroots = 96, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_97, .nroots = 97, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_98, .nroots = 98, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_99, .nroots = 99, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_100, .nroots = 100, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_101, .nroots = 101, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_102, .nroots = 102, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_103, .nroots = 103, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_104, .nroots = 104, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_105, .nroots = 105, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_106, .nroots = 106, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_107, .nroots = 107, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_108, .nroots = 108, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_109, .nroots = 109, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_110, .nroots = 110, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_111, .nroots = 111, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_112, .nroots = 112, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_113, .nroots = 113, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_114, .nroots = 114, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_115, .nroots = 115, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_116, .nroots = 116, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_117, .nroots = 117, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_118, .nroots = 118, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_119, .nroots = 119, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_120, .nroots = 120, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_121, .nroots = 121, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_122, .nroots = 122, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_123, .nroots = 123, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_124, .nroots = 124, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_125, .nroots = 125, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_126, .nroots = 126, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_127, .nroots = 127, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_128, .nroots = 128, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_129, .nroots = 129, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_130, .nroots = 130, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_131, .nroots = 131, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_132, .nroots = 132, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_133, .nroots = 133, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_134, .nroots = 134, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_135, .nroots = 135, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_136, .nroots = 136, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_137, .nroots = 137, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_138, .nroots = 138, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_139, .nroots = 139, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_140, .nroots = 140, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_141, .nroots = 141, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_142, .nroots = 142, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_143, .nroots = 143, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_144, .nroots = 144, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_145, .nroots = 145, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_146, .nroots = 146, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_147, .nroots = 147, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_148, .nroots = 148, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_149, .nroots = 149, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_150, .nroots = 150, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_151, .nroots = 151, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_152, .nroots = 152, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_153, .nroots = 153, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_154, .nroots = 154, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_155, .nroots = 155, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_156, .nroots = 156, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_157, .nroots = 157, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_158, .nroots = 158, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_159, .nroots = 159, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_160, .nroots = 160, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_161, .nroots = 161, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_162, .nroots = 162, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_163, .nroots = 163, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_164, .nroots = 164, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_165, .nroots = 165, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_166, .nroots = 166, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_167, .nroots = 167, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_168, .nroots = 168, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_169, .nroots = 169, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_170, .nroots = 170, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_171, .nroots = 171, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_172, .nroots = 172, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_173, .nroots = 173, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_174, .nroots = 174, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_175, .nroots = 175, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_176, .nroots = 176, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_177, .nroots = 177, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_178, .nroots = 178, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_179, .nroots = 179, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_180, .nroots = 180, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_181, .nroots = 181, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_182, .nroots = 182, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_183, .nroots = 183, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_184, .nroots = 184, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_185, .nroots = 185, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_186, .nroots = 186, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_187, .nroots = 187, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_188, .nroots = 188, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_189, .nroots = 189, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_190, .nroots = 190, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_191, .nroots = 191, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_192, .nroots = 192, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_193, .nroots = 193, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_194, .nroots = 194, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_195, .nroots = 195, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_196, .nroots = 196, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_197, .nroots = 197, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_198, .nroots = 198, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_199, .nroots = 199, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_200, .nroots = 200, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_201, .nroots = 201, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_202, .nroots = 202, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_203, .nroots = 203, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_204, .nroots = 204, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_205, .nroots = 205, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_206, .nroots = 206, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_207, .nroots = 207, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_208, .nroots = 208, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_209, .nroots = 209, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_210, .nroots = 210, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_211, .nroots = 211, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_212, .nroots = 212, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_213, .nroots = 213, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_214, .nroots = 214, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_215, .nroots = 215, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_216, .nroots = 216, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_217, .nroots = 217, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_218, .nroots = 218, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_219, .nroots = 219, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_220, .nroots = 220, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_221, .nroots = 221, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_222, .nroots = 222, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_223, .nroots = 223, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_224, .nroots = 224, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_225, .nroots = 225, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_226, .nroots = 226, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_227, .nroots = 227, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_228, .nroots = 228, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_229, .nroots = 229, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_230, .nroots = 230, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_231, .nroots = 231, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_232, .nroots = 232, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_233, .nroots = 233, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_234, .nroots = 234, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_235, .nroots = 235, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_236, .nroots = 236, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_237, .nroots = 237, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_238, .nroots = 238, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_239, .nroots = 239, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_240, .nroots = 240, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_241, .nroots = 241, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_242, .nroots = 242, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_243, .nroots = 243, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_244, .nroots = 244, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_245, .nroots = 245, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_246, .nroots = 246, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_247, .nroots = 247, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_248, .nroots = 248, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_249, .nroots = 249, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_250, .nroots = 250, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_251, .nroots = 251, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_252, .nroots = 252, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_253, .nroots = 253, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+    { .mm = 8, .nn = 255, .alpha_to = alpha_to_8, .index_of = index_of_8, .genpoly = genpoly_8_254, .nroots = 254, .fcr = 0, .prim = 1, .iprim = 1, .gfpoly = 391 },
+};
+
+static const struct rs_control* const rs_codecs[RS_TABLES_MAX_SYMSIZE + 1] = {
+    NULL,
+    NULL,
+    rs_codecs_2,
+    rs_codecs_3,
+    rs_codecs_4,
+    rs_codecs_5,
+    rs_codecs_6,
+    rs_codecs_7,
+    rs_codecs_8,
+};
+
+const struct rs_control* rs_tables_get(int symsize, int nroots) {
+
+    if(symsize < RS_TABLES_MIN_SYMSIZE || symsize > RS_TABLES_MAX_SYMSIZE) return NULL;
+    if(nroots < 0 || nroots >= (1 << symsize) - 1) return NULL;
+    return &rs_codecs[symsize][nroots];
+}
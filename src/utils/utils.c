@@ -1,5 +1,9 @@
 #include "utils/utils.h"
 
+#if defined(__BMI2__)
+  #include <immintrin.h>
+#endif
+
 uint8_t is_little_endian_machine() {
 
 	uint16_t x = 1;
@@ -8,6 +12,42 @@ uint8_t is_little_endian_machine() {
 	return ((uint8_t*)(&x))[0];
 }
 
+uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+void rng_seed(RNG* rng, uint64_t seed) {
+
+    // expand the seed with splitmix64, so close seeds give unrelated states
+    // (and the state is never all zeros)
+    for(uint8_t i = 0; i < 4; i++) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        rng->s[i] = z ^ (z >> 31);
+    }
+}
+
+uint64_t rng_next(RNG* rng) {
+
+    uint64_t* s = rng->s;
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return result;
+}
+
+unsigned long rng_below(RNG* rng, unsigned long n) {
+
+    // with 64 random bits the modulo bias is negligible for our 'n's
+    return rng_next(rng) % n;
+}
+
 unsigned long ceil_power_of_2(unsigned long n) {
 
     n--;
@@ -92,17 +132,16 @@ void set_bit(uint8_t* data, unsigned long idx, uint8_t value) {
     }
 }
 
-void invert_binary_sequence(uint8_t* data, unsigned long size) {
+// 'bit_reverse_table[b]' is byte 'b' with its bits in reverse order
+#define R2(n) n, n + 2*64, n + 1*64, n + 3*64
+#define R4(n) R2(n), R2(n + 2*16), R2(n + 1*16), R2(n + 3*16)
+#define R6(n) R4(n), R4(n + 2*4), R4(n + 1*4), R4(n + 3*4)
+static const uint8_t bit_reverse_table[256] = { R6(0), R6(2), R6(1), R6(3) };
 
-    unsigned long total_n_bits = size * 8;
-    unsigned long half_n_bits = total_n_bits/2;
-    for(unsigned long i = 0; i < half_n_bits; i++) {
+void invert_binary_sequence(uint8_t* data, unsigned long size) {
 
-        uint8_t bit1 = get_bit(data, i);
-        uint8_t bit2 = get_bit(data, total_n_bits-i-1);
-        set_bit(data, i, bit2);
-        set_bit(data, total_n_bits-i-1, bit1);
-    }
+    invert_byte_sequence(data, size);
+    for(unsigned long i = 0; i < size; i++) data[i] = bit_reverse_table[data[i]];
 }
 
 void invert_byte_sequence(uint8_t* data, unsigned long size) {
@@ -119,10 +158,15 @@ void invert_byte_sequence(uint8_t* data, unsigned long size) {
 
 unsigned long get_first_positive_bit_index(uint8_t* data, unsigned long size_in_bytes) {
 
-    for(unsigned long i = 0; i < size_in_bytes; i++)
-        if(data[i])
-            for(uint8_t j = 0; j < 8; j++)
-                if(get_bit(data, i*8 + j)) return i*8+j;
+    unsigned long i = 0;
+    // skip zeros a word at a time
+    for(; i + sizeof(uint64_t) <= size_in_bytes; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        if(word) break;
+    }
+    for(; i < size_in_bytes; i++)
+        if(data[i]) return i*8 + __builtin_clz(data[i]) - (sizeof(unsigned int) - 1) * 8;
     return ULONG_MAX;
 }
 
@@ -175,25 +219,40 @@ void* encode_numeric_string(char* string, unsigned long* data_len) {
 }
 
 unsigned long get_number_of_left_zeros(uint8_t* data, unsigned long data_len) {
-  unsigned long byte_idx = 0;
-  while(!data[byte_idx] && byte_idx < data_len) byte_idx++;
+  unsigned long idx = get_first_positive_bit_index(data, data_len);
   // check if its all zeros
-  if(byte_idx == data_len - 1 && !data[byte_idx]) return data_len * 8;
-  uint8_t bit_idx = 0;
-  while(!get_bit(&data[byte_idx], bit_idx) && bit_idx < 8) bit_idx++;
-  return byte_idx * 8 + bit_idx;
+  return idx == ULONG_MAX ? data_len * 8 : idx;
 }
 
 unsigned long get_number_of_right_zeros(uint8_t* data, unsigned long data_len) {
-  unsigned long byte_idx = 0;
-  while(!data[data_len - byte_idx - 1] && byte_idx < data_len) byte_idx++;
-  byte_idx = data_len - byte_idx - 1;
+  unsigned long byte_idx = data_len;
+  while(byte_idx && !data[byte_idx - 1]) byte_idx--;
   // check if its all zeros
-  if(byte_idx == 0 && !data[byte_idx]) return data_len * 8;
-  uint8_t bit_idx = 0;
-  while(!get_bit(&data[byte_idx], 7 - bit_idx) && bit_idx < 8) bit_idx++;
-  byte_idx = data_len - byte_idx - 1;
-  return byte_idx * 8 + bit_idx;
+  if(!byte_idx) return data_len * 8;
+  return (data_len - byte_idx) * 8 + __builtin_ctz(data[byte_idx - 1]);
+}
+
+// shift the whole sequence 'n' bits to the left (towards index 0) in place, filling with zeros
+void shift_sequence_left(uint8_t* data, unsigned long data_len, unsigned long n) {
+  unsigned long byte_shift = n / 8;
+  uint8_t bit_shift = n % 8;
+  for(unsigned long i = 0; i < data_len; i++) {
+    unsigned long j = i + byte_shift;
+    uint8_t high = j < data_len ? data[j] << bit_shift : 0;
+    uint8_t low = bit_shift && j + 1 < data_len ? data[j + 1] >> (8 - bit_shift) : 0;
+    data[i] = high | low;
+  }
+}
+
+// shift the whole sequence 'n' bits to the right (away from index 0) in place, filling with zeros
+void shift_sequence_right(uint8_t* data, unsigned long data_len, unsigned long n) {
+  unsigned long byte_shift = n / 8;
+  uint8_t bit_shift = n % 8;
+  for(unsigned long i = data_len; i-- > 0;) {
+    uint8_t low = i >= byte_shift ? data[i - byte_shift] >> bit_shift : 0;
+    uint8_t high = bit_shift && i >= byte_shift + 1 ? data[i - byte_shift - 1] << (8 - bit_shift) : 0;
+    data[i] = high | low;
+  }
 }
 
 void remove_left_zeros(uint8_t* data, unsigned long* data_len) {
@@ -201,61 +260,210 @@ void remove_left_zeros(uint8_t* data, unsigned long* data_len) {
 
   unsigned long n_bits = (*data_len) * 8;
 
-  // iterate over non-left-zero part of the sequence, throwing its values
-  // back to the beginning
-  unsigned long cursor = 0;
-  for(unsigned long i = n_left_zeros; i < n_bits; i++) {
-    set_bit(data, cursor, get_bit(data, i));
-    cursor++;
-  }
+  // throw the non-left-zero part of the sequence back to the beginning
+  shift_sequence_left(data, *data_len, n_left_zeros);
   // calculate new data_len
   *data_len = (n_bits - n_left_zeros) / 8 + !!n_left_zeros;
 }
 
 void add_left_zeros(uint8_t** data, unsigned long* data_len, unsigned long num_zeros) {
-  unsigned long old_n_bits = (*data_len) * 8;
-  unsigned long new_n_bits = num_zeros + old_n_bits;
+  unsigned long old_n_bytes = *data_len;
+  unsigned long new_n_bits = num_zeros + old_n_bytes * 8;
   unsigned long new_n_bytes = new_n_bits / 8 + !!(new_n_bits % 8);
-  new_n_bits = new_n_bytes * 8;
 
-  uint8_t* new_data = malloc(new_n_bytes);
-  memset(new_data, 0x00, new_n_bytes);
+  // grow the buffer and shift it in place
+  *data = realloc(*data, new_n_bytes);
+  memset(*data + old_n_bytes, 0x00, new_n_bytes - old_n_bytes);
+  shift_sequence_right(*data, new_n_bytes, num_zeros);
+  *data_len = new_n_bytes;
+}
 
-  for(unsigned long i = 0; i < old_n_bits; i++) {
-    set_bit(new_data, num_zeros + i, get_bit(*data, i));
+// bit stream cursors used by the packing kernels: bits go through a 64-bit
+// accumulator and memory is touched one whole byte at a time, with no
+// division or modulo per bit
+typedef struct BIT_CURSOR {
+  uint8_t* data;
+  unsigned long byte_idx;
+  uint64_t acc;
+  unsigned long acc_bits;
+} BIT_CURSOR;
+
+BIT_CURSOR bit_writer_create(uint8_t* data, unsigned long bit_idx) {
+  BIT_CURSOR writer = { data, bit_idx / 8, 0, bit_idx % 8 };
+  // keep the bits before 'bit_idx' in the first byte
+  if(writer.acc_bits) writer.acc = data[writer.byte_idx] >> (8 - writer.acc_bits);
+  return writer;
+}
+
+// 'n' can be at most 56
+void bit_writer_push(BIT_CURSOR* writer, uint64_t value, unsigned long n) {
+  writer->acc = (writer->acc << n) | value;
+  writer->acc_bits += n;
+  while(writer->acc_bits >= 8) {
+    writer->acc_bits -= 8;
+    writer->data[writer->byte_idx++] = (uint8_t)(writer->acc >> writer->acc_bits);
   }
-  free(*data);
-  *data = new_data;
-  *data_len = new_n_bytes;
+}
+
+void bit_writer_push64(BIT_CURSOR* writer, uint64_t value, unsigned long n) {
+  if(n > 32) {
+    bit_writer_push(writer, value >> 32, n - 32);
+    n = 32;
+  }
+  bit_writer_push(writer, value & ((1ULL << n) - 1), n);
+}
+
+// write the remaining bits, keeping the bits after them in the last byte
+void bit_writer_flush(BIT_CURSOR* writer) {
+  if(!writer->acc_bits) return;
+  uint8_t keep_mask = 0xff >> writer->acc_bits;
+  uint8_t bits = (uint8_t)(writer->acc << (8 - writer->acc_bits));
+  writer->data[writer->byte_idx] = (writer->data[writer->byte_idx] & keep_mask) | (bits & ~keep_mask);
+}
+
+BIT_CURSOR bit_reader_create(uint8_t* data, unsigned long bit_idx) {
+  BIT_CURSOR reader = { data, bit_idx / 8, 0, 0 };
+  if(bit_idx % 8) {
+    reader.acc = data[reader.byte_idx++];
+    reader.acc_bits = 8 - bit_idx % 8;
+  }
+  return reader;
+}
+
+// 'n' can be at most 56. Only bytes holding requested bits are read
+uint64_t bit_reader_pull(BIT_CURSOR* reader, unsigned long n) {
+  while(reader->acc_bits < n) {
+    reader->acc = (reader->acc << 8) | reader->data[reader->byte_idx++];
+    reader->acc_bits += 8;
+  }
+  reader->acc_bits -= n;
+  return (reader->acc >> reader->acc_bits) & ((1ULL << n) - 1);
+}
+
+uint64_t bit_reader_pull64(BIT_CURSOR* reader, unsigned long n) {
+  if(n <= 32) return bit_reader_pull(reader, n);
+  uint64_t high = bit_reader_pull(reader, n - 32);
+  return (high << 32) | bit_reader_pull(reader, 32);
+}
+
+// elements are big endian (like 'get_bit'), the symbol is in their lowest bits
+uint16_t element_get_symbol(uint8_t* element, unsigned long element_size, uint16_t mask) {
+  uint16_t value = element[element_size-1];
+  if(element_size > 1) value |= element[element_size-2] << 8;
+  return value & mask;
+}
+
+void element_set_symbol(uint8_t* element, unsigned long element_size, uint16_t mask, uint16_t value) {
+  element[element_size-1] = (element[element_size-1] & ~mask) | (value & mask);
+  if(element_size > 1) element[element_size-2] = (element[element_size-2] & ~(mask >> 8)) | ((value & mask) >> 8);
+}
+
+uint64_t load_big_endian64(uint8_t* data) {
+  uint64_t value;
+  memcpy(&value, data, sizeof(value));
+  return is_little_endian_machine() ? __builtin_bswap64(value) : value;
+}
+
+void store_big_endian64(uint8_t* data, uint64_t value) {
+  if(is_little_endian_machine()) value = __builtin_bswap64(value);
+  memcpy(data, &value, sizeof(value));
+}
+
+#if defined(__BMI2__)
+// mask with the lowest 'symbol_size' bits of every 'lane_bits' lane
+uint64_t lane_mask(unsigned long lane_bits, unsigned long symbol_size) {
+  uint64_t mask = 0;
+  for(unsigned long i = 0; i < 64; i += lane_bits) mask |= ((1ULL << symbol_size) - 1) << i;
+  return mask;
+}
+
+#endif
+
+void pack_symbols(void* from, unsigned long num_symbols, unsigned long element_size, unsigned long symbol_size, uint8_t* to, unsigned long* next_bit) {
+
+  uint8_t* elements = from;
+  // wider symbols go bit by bit
+  if(symbol_size > 16 || element_size * 8 < symbol_size) {
+    unsigned long offset = element_size * 8 - symbol_size;
+    for(unsigned long i = 0; i < num_symbols; i++) {
+      for(unsigned long j = 0; j < symbol_size; j++) {
+        set_bit(to, (*next_bit)++, get_bit(elements + element_size * i, offset + j));
+      }
+    }
+    return;
+  }
+
+  BIT_CURSOR writer = bit_writer_create(to, *next_bit);
+  uint16_t mask = (1UL << symbol_size) - 1;
+  unsigned long i = 0;
+#if defined(__BMI2__)
+  // gather 8 (1 byte elements) or 4 (2 byte elements) symbols with a single pext
+  if(element_size <= 2) {
+    unsigned long lane_bits = element_size * 8;
+    unsigned long symbols_per_word = 64 / lane_bits;
+    uint64_t word_mask = lane_mask(lane_bits, symbol_size);
+    for(; i + symbols_per_word <= num_symbols; i += symbols_per_word) {
+      uint64_t word = load_big_endian64(elements + element_size * i);
+      bit_writer_push64(&writer, _pext_u64(word, word_mask), symbols_per_word * symbol_size);
+    }
+  }
+#endif
+  for(; i < num_symbols; i++) {
+    bit_writer_push(&writer, element_get_symbol(elements + element_size * i, element_size, mask), symbol_size);
+  }
+  bit_writer_flush(&writer);
+  *next_bit += num_symbols * symbol_size;
+}
+
+void unpack_symbols(uint8_t* from, unsigned long* next_bit, unsigned long num_symbols, unsigned long element_size, unsigned long symbol_size, void* to) {
+
+  uint8_t* elements = to;
+  if(symbol_size > 16 || element_size * 8 < symbol_size) {
+    unsigned long offset = element_size * 8 - symbol_size;
+    for(unsigned long i = 0; i < num_symbols; i++) {
+      for(unsigned long j = 0; j < symbol_size; j++) {
+        set_bit(elements + element_size * i, offset + j, get_bit(from, (*next_bit)++));
+      }
+    }
+    return;
+  }
+
+  BIT_CURSOR reader = bit_reader_create(from, *next_bit);
+  uint16_t mask = (1UL << symbol_size) - 1;
+  unsigned long i = 0;
+#if defined(__BMI2__)
+  // scatter 8 (1 byte elements) or 4 (2 byte elements) symbols with a single pdep
+  if(element_size <= 2) {
+    unsigned long lane_bits = element_size * 8;
+    unsigned long symbols_per_word = 64 / lane_bits;
+    uint64_t word_mask = lane_mask(lane_bits, symbol_size);
+    for(; i + symbols_per_word <= num_symbols; i += symbols_per_word) {
+      uint64_t bits = bit_reader_pull64(&reader, symbols_per_word * symbol_size);
+      uint64_t word = load_big_endian64(elements + element_size * i);
+      store_big_endian64(elements + element_size * i, (word & ~word_mask) | _pdep_u64(bits, word_mask));
+    }
+  }
+#endif
+  for(; i < num_symbols; i++) {
+    element_set_symbol(elements + element_size * i, element_size, mask, bit_reader_pull(&reader, symbol_size));
+  }
+  *next_bit += num_symbols * symbol_size;
 }
 
 void merge_arr(void* data, unsigned long* data_len, unsigned long element_size, unsigned long symbol_size) {
 
   unsigned long num_elements = (*data_len)/element_size;
   unsigned long next_bit = 0;
-  unsigned long offset = element_size * 8 - symbol_size;
-  for(unsigned long i = 0; i < num_elements; i++) {
-    void* element = ((uint8_t*)data)+(element_size * i);
-    // iterate over element bits
-    for(unsigned long j = 0; j < symbol_size; j++) {
-      // shift element's bit to where next_bit is pointing to
-      set_bit(data, next_bit, get_bit(element, offset + j));
-      next_bit++;
-    } 
-  }
+  // packing never writes past the element being read, so it can be done in place
+  pack_symbols(data, num_elements, element_size, symbol_size, data, &next_bit);
   // update 'data_len' with size of the new sequence
   *data_len = next_bit / 8 + !!(next_bit % 8);
   // set any bits left to zero
-  unsigned long n_bits = *data_len * 8;
-  for(; next_bit < n_bits; next_bit++) {
-    set_bit(data, next_bit, 0);
-  }
-
+  if(next_bit % 8) ((uint8_t*)data)[next_bit / 8] &= ~(0xff >> (next_bit % 8));
 }
 
 void unmerge_arr(void* data, unsigned long num_symbols, unsigned long element_size, unsigned long symbol_size, void** res) {
 
-  // iterate over 'new_data' elements
   unsigned long symbol_bytes = (symbol_size / 8) + !!(symbol_size % 8);
   unsigned long res_size = (num_symbols) * symbol_bytes;
   unsigned long next_bit = 0;
@@ -263,15 +471,179 @@ void unmerge_arr(void* data, unsigned long num_symbols, unsigned long element_si
     *res = malloc(res_size);
   }
   memset(*res, 0x00, res_size);
-  unsigned long offset = element_size * 8 - symbol_size;
-  for(unsigned long i = 0; i < num_symbols; i ++) {
-    void* element = ((uint8_t*)*res)+(element_size * i);
-    // iterate over symbol bits and populate element with symbol bits
-    for(unsigned long j = 0; j < symbol_size; j++) {
-      set_bit(element, offset + j, get_bit(data, next_bit));
-      next_bit++;
-    }
+  unpack_symbols(data, &next_bit, num_symbols, element_size, symbol_size, *res);
+}
+
+// bit vector
+// words are kept as a big endian byte sequence (same bit order as 'get_bit'), so
+// '(uint8_t*)bv->words' can be handed to any of the byte oriented functions; bits
+// past 'n_bits' are always zero
+#define BITVEC_WORD_BITS 64
+#define bitvec_num_words(n_bits) ((n_bits) / BITVEC_WORD_BITS + !!((n_bits) % BITVEC_WORD_BITS))
+
+BITVEC* bitvec_create(unsigned long n_bits) {
+
+  BITVEC* bv = malloc(sizeof(BITVEC));
+  bv->n_bits = n_bits;
+  bv->n_words = bitvec_num_words(n_bits);
+  bv->words = calloc(bv->n_words ? bv->n_words : 1, sizeof(uint64_t));
+  return bv;
+}
+
+BITVEC* bitvec_from_bytes(void* data, unsigned long n_bits) {
+
+  BITVEC* bv = bitvec_create(n_bits);
+  memcpy(bv->words, data, n_bits / 8 + !!(n_bits % 8));
+  bitvec_resize(bv, n_bits);
+  return bv;
+}
+
+BITVEC* bitvec_from_sequence(void* data, unsigned long num_bytes) {
+
+  BITVEC* bv = bitvec_from_bytes(data, num_bytes * 8);
+  bitvec_remove_left_zeros(bv);
+  return bv;
+}
+
+uint8_t* bitvec_to_sequence(BITVEC* bv, unsigned long* num_bytes) {
+
+  *num_bytes = bv->n_bits / 8 + !!(bv->n_bits % 8);
+  uint8_t* data = calloc(*num_bytes ? *num_bytes : 1, sizeof(uint8_t));
+  memcpy(data, bv->words, *num_bytes);
+  // throw the bits to the right, filling the left with zeros
+  shift_sequence_right(data, *num_bytes, (*num_bytes) * 8 - bv->n_bits);
+  return data;
+}
+
+BITVEC* bitvec_copy(BITVEC* bv) {
+
+  BITVEC* copy = bitvec_create(bv->n_bits);
+  memcpy(copy->words, bv->words, bv->n_words * sizeof(uint64_t));
+  return copy;
+}
+
+void bitvec_free(BITVEC* bv) {
+  if(!bv) return;
+  free(bv->words);
+  free(bv);
+}
+
+uint8_t bitvec_get(BITVEC* bv, unsigned long idx) {
+  return get_bit((uint8_t*)bv->words, idx);
+}
+
+void bitvec_set(BITVEC* bv, unsigned long idx, uint8_t value) {
+  set_bit((uint8_t*)bv->words, idx, value);
+}
+
+uint8_t bitvec_equal(BITVEC* bv1, BITVEC* bv2) {
+  return bv1->n_bits == bv2->n_bits && !memcmp(bv1->words, bv2->words, bv1->n_words * sizeof(uint64_t));
+}
+
+void bitvec_resize(BITVEC* bv, unsigned long n_bits) {
+
+  unsigned long n_words = bitvec_num_words(n_bits);
+  if(n_words > bv->n_words) {
+    bv->words = realloc(bv->words, n_words * sizeof(uint64_t));
+    memset(bv->words + bv->n_words, 0x00, (n_words - bv->n_words) * sizeof(uint64_t));
+  }
+  bv->n_words = n_words;
+  bv->n_bits = n_bits;
+  // clear bits past the end
+  if(n_bits % BITVEC_WORD_BITS) {
+    uint8_t* last = (uint8_t*)&bv->words[n_words - 1];
+    store_big_endian64(last, load_big_endian64(last) & ~(UINT64_MAX >> (n_bits % BITVEC_WORD_BITS)));
+  }
+}
+
+unsigned long bitvec_get_first_positive_bit_index(BITVEC* bv) {
+
+  for(unsigned long i = 0; i < bv->n_words; i++) {
+    uint64_t word = load_big_endian64((uint8_t*)&bv->words[i]);
+    if(word) return i * BITVEC_WORD_BITS + __builtin_clzll(word);
+  }
+  return ULONG_MAX;
+}
+
+unsigned long bitvec_get_number_of_left_zeros(BITVEC* bv) {
+  unsigned long idx = bitvec_get_first_positive_bit_index(bv);
+  return idx == ULONG_MAX ? bv->n_bits : idx;
+}
+
+unsigned long bitvec_get_number_of_right_zeros(BITVEC* bv) {
+
+  unsigned long pad = bv->n_words * BITVEC_WORD_BITS - bv->n_bits;
+  for(unsigned long i = bv->n_words; i-- > 0;) {
+    uint64_t word = load_big_endian64((uint8_t*)&bv->words[i]);
+    if(word) return (bv->n_words - i - 1) * BITVEC_WORD_BITS + __builtin_ctzll(word) - pad;
+  }
+  return bv->n_bits;
+}
+
+// move every bit 'n' positions towards index 0, filling the end with zeros
+void bitvec_shift_left(BITVEC* bv, unsigned long n) {
+
+  unsigned long word_shift = n / BITVEC_WORD_BITS;
+  unsigned long bit_shift = n % BITVEC_WORD_BITS;
+  for(unsigned long i = 0; i < bv->n_words; i++) {
+    unsigned long j = i + word_shift;
+    uint64_t high = j < bv->n_words ? load_big_endian64((uint8_t*)&bv->words[j]) << bit_shift : 0;
+    uint64_t low = bit_shift && j + 1 < bv->n_words ? load_big_endian64((uint8_t*)&bv->words[j + 1]) >> (BITVEC_WORD_BITS - bit_shift) : 0;
+    store_big_endian64((uint8_t*)&bv->words[i], high | low);
+  }
+}
+
+// move every bit 'n' positions away from index 0, filling the beginning with zeros
+// (bits moved past 'n_bits' are lost)
+void bitvec_shift_right(BITVEC* bv, unsigned long n) {
+
+  unsigned long word_shift = n / BITVEC_WORD_BITS;
+  unsigned long bit_shift = n % BITVEC_WORD_BITS;
+  for(unsigned long i = bv->n_words; i-- > 0;) {
+    uint64_t low = i >= word_shift ? load_big_endian64((uint8_t*)&bv->words[i - word_shift]) >> bit_shift : 0;
+    uint64_t high = bit_shift && i >= word_shift + 1 ? load_big_endian64((uint8_t*)&bv->words[i - word_shift - 1]) << (BITVEC_WORD_BITS - bit_shift) : 0;
+    store_big_endian64((uint8_t*)&bv->words[i], high | low);
+  }
+  bitvec_resize(bv, bv->n_bits);
+}
+
+void bitvec_remove_left_zeros(BITVEC* bv) {
+
+  unsigned long n_left_zeros = bitvec_get_number_of_left_zeros(bv);
+  bitvec_shift_left(bv, n_left_zeros);
+  bitvec_resize(bv, bv->n_bits - n_left_zeros);
+}
+
+void bitvec_add_left_zeros(BITVEC* bv, unsigned long num_zeros) {
+
+  bitvec_resize(bv, bv->n_bits + num_zeros);
+  bitvec_shift_right(bv, num_zeros);
+}
+
+uint64_t reverse_bits64(uint64_t word) {
+
+  word = __builtin_bswap64(word);
+  uint8_t* bytes = (uint8_t*)&word;
+  for(uint8_t i = 0; i < sizeof(word); i++) bytes[i] = bit_reverse_table[bytes[i]];
+  return word;
+}
+
+void bitvec_invert(BITVEC* bv) {
+
+  if(!bv->n_words) return;
+  // reverse the whole word array...
+  for(unsigned long i = 0, j = bv->n_words - 1; i < j; i++, j--) {
+    uint64_t tmp = bv->words[i];
+    bv->words[i] = bv->words[j];
+    bv->words[j] = tmp;
+  }
+  // ...and every word
+  for(unsigned long i = 0; i < bv->n_words; i++) {
+    uint8_t* word = (uint8_t*)&bv->words[i];
+    store_big_endian64(word, reverse_bits64(load_big_endian64(word)));
   }
+  // the padding at the end is now at the beginning
+  bitvec_shift_left(bv, bv->n_words * BITVEC_WORD_BITS - bv->n_bits);
 }
 
 void* decode_numeric_string(void* data, unsigned long* data_len) {
@@ -326,16 +698,16 @@ uint8_t has_possible_backedge(STACK* possible_backedges, GRAPH* graph, unsigned
             graph_get_connection(graph->nodes[current_idx-1], graph->nodes[possible_backedges->stack[0]]));
 }
 
-unsigned long get_backedge_index(STACK* possible_backedges, GRAPH* graph, unsigned long current_idx) {
+unsigned long get_backedge_index(STACK* possible_backedges, GRAPH* graph, unsigned long current_idx, RNG* rng) {
 
     CONNECTION* last_node_backedge = graph_get_backedge(graph->nodes[current_idx-1]);
-    unsigned long backedge_idx = rand() % possible_backedges->n;
+    unsigned long backedge_idx = rng_below(rng, possible_backedges->n);
     if( last_node_backedge && backedge_idx == last_node_backedge->node->graph_idx ) {
         if(backedge_idx == 0) {
             return 1;
         } else if(backedge_idx == possible_backedges->n-1){
             return backedge_idx-1;
-        } else if(rand()&1) {
+        } else if(rng_next(rng) >> 63) {
             return backedge_idx-1;
         } else {
             return backedge_idx+1;
@@ -1,4 +1,9 @@
 #include "checker/checker.h"
+#include "code_generation/code_generation.h"
+#include "encoder/encode_table.h"
+#include "decoder/extract.h"
+#include "decoder/keyless.h"
+#include "registry/registry.h"
 #include "ctdd/ctdd.h"
 #include "decoder/decoder.h"
 #include "dijkstra/dijkstra.h"
@@ -218,6 +223,166 @@ int merge_unmerge_test() {
   return 0;
 }
 
+int pack_unpack_symbols_test() {
+
+  for (unsigned long symbol_size = 1; symbol_size <= 16; symbol_size++) {
+    unsigned long element_size = symbol_size / 8 + !!(symbol_size % 8);
+    unsigned long offset = element_size * 8 - symbol_size;
+    for (unsigned long num_symbols = 1; num_symbols < 40; num_symbols += 3) {
+      for (unsigned long first_bit = 0; first_bit < 12; first_bit += 5) {
+
+        uint8_t elements[num_symbols * element_size];
+        for (unsigned long i = 0; i < sizeof(elements); i++)
+          elements[i] = rand();
+
+        // every bit around the packed ones should be left untouched
+        unsigned long n_bytes = (first_bit + num_symbols * symbol_size) / 8 + 2;
+        uint8_t packed[n_bytes];
+        uint8_t expected[n_bytes];
+        for (unsigned long i = 0; i < n_bytes; i++)
+          packed[i] = expected[i] = rand();
+        for (unsigned long i = 0; i < num_symbols; i++) {
+          for (unsigned long j = 0; j < symbol_size; j++) {
+            set_bit(expected, first_bit + i * symbol_size + j,
+                    get_bit(&elements[i * element_size], offset + j));
+          }
+        }
+        unsigned long next_bit = first_bit;
+        pack_symbols(elements, num_symbols, element_size, symbol_size, packed,
+                     &next_bit);
+        ctdd_assert(next_bit == first_bit + num_symbols * symbol_size);
+        ctdd_assert(!memcmp(packed, expected, n_bytes));
+
+        uint8_t unpacked[num_symbols * element_size];
+        memset(unpacked, 0x00, sizeof(unpacked));
+        next_bit = first_bit;
+        unpack_symbols(packed, &next_bit, num_symbols, element_size,
+                       symbol_size, unpacked);
+        ctdd_assert(next_bit == first_bit + num_symbols * symbol_size);
+        for (unsigned long i = 0; i < num_symbols; i++) {
+          for (unsigned long j = 0; j < element_size * 8; j++) {
+            uint8_t bit = j < offset ? 0 : get_bit(&elements[i * element_size], j);
+            ctdd_assert(get_bit(&unpacked[i * element_size], j) == bit);
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+int bitvec_test() {
+
+  for (unsigned long n_bits = 1; n_bits < 200; n_bits += 7) {
+
+    unsigned long n_bytes = n_bits / 8 + !!(n_bits % 8);
+    uint8_t data[n_bytes];
+    for (unsigned long i = 0; i < n_bytes; i++)
+      data[i] = rand();
+    // leave some zeros on both ends
+    for (unsigned long i = 0; i < n_bits && i < n_bits / 3; i++) {
+      set_bit(data, i, 0);
+      set_bit(data, n_bits - i - 1, 0);
+    }
+    for (unsigned long i = n_bits; i < n_bytes * 8; i++)
+      set_bit(data, i, 0);
+    BITVEC *bv = bitvec_from_bytes(data, n_bits);
+    ctdd_assert(bv->n_bits == n_bits);
+
+    // scans
+    unsigned long left_zeros = 0, right_zeros = 0;
+    while (left_zeros < n_bits && !get_bit(data, left_zeros))
+      left_zeros++;
+    while (right_zeros < n_bits && !get_bit(data, n_bits - right_zeros - 1))
+      right_zeros++;
+    ctdd_assert(bitvec_get_number_of_left_zeros(bv) == left_zeros);
+    ctdd_assert(bitvec_get_number_of_right_zeros(bv) == right_zeros);
+    ctdd_assert(get_number_of_left_zeros(data, n_bytes) == left_zeros);
+    ctdd_assert(get_number_of_right_zeros(data, n_bytes) ==
+                right_zeros + n_bytes * 8 - n_bits);
+
+    // bit reversal
+    BITVEC *inverted = bitvec_copy(bv);
+    bitvec_invert(inverted);
+    for (unsigned long i = 0; i < n_bits; i++)
+      ctdd_assert(bitvec_get(inverted, i) == get_bit(data, n_bits - i - 1));
+    bitvec_invert(inverted);
+    ctdd_assert(bitvec_equal(inverted, bv));
+    bitvec_free(inverted);
+
+    // realignment
+    unsigned long num_bytes;
+    uint8_t *sequence = bitvec_to_sequence(bv, &num_bytes);
+    ctdd_assert(num_bytes == n_bytes);
+    for (unsigned long i = 0; i < n_bits; i++)
+      ctdd_assert(get_bit(sequence, n_bytes * 8 - n_bits + i) == get_bit(data, i));
+    bitvec_add_left_zeros(bv, n_bits % 13);
+    ctdd_assert(bv->n_bits == n_bits + n_bits % 13);
+    ctdd_assert(bitvec_get_number_of_left_zeros(bv) == left_zeros + n_bits % 13);
+    bitvec_remove_left_zeros(bv);
+    if (left_zeros == n_bits) {
+      ctdd_assert(!bv->n_bits);
+    } else {
+      BITVEC *from_sequence = bitvec_from_sequence(sequence, num_bytes);
+      ctdd_assert(bitvec_equal(from_sequence, bv));
+      for (unsigned long i = 0; i < bv->n_bits; i++)
+        ctdd_assert(bitvec_get(bv, i) == get_bit(data, left_zeros + i));
+      bitvec_free(from_sequence);
+    }
+    free(sequence);
+    bitvec_free(bv);
+  }
+
+  // codec variants
+  for (unsigned long n_bits = 2; n_bits < 130; n_bits += 5) {
+    BITVEC *key = bitvec_create(n_bits);
+    bitvec_set(key, 0, 1);
+    for (unsigned long i = 1; i < n_bits; i++)
+      bitvec_set(key, i, rand() & 1);
+
+    GRAPH *graph = watermark_encode_bitvec(key);
+    BITVEC *result = watermark_decode_bitvec(graph);
+    ctdd_assert(bitvec_equal(result, key));
+    bitvec_free(result);
+    result = watermark_decode_improved_bitvec(graph, key);
+    ctdd_assert(bitvec_equal(result, key));
+    bitvec_free(result);
+    result = watermark_decode_analysis_bitvec(graph);
+    ctdd_assert(bitvec_equal(result, key));
+    bitvec_free(result);
+    graph_free(graph);
+
+    graph = watermark2014_encode_bitvec(key);
+    result = watermark2014_decode_bitvec(graph);
+    ctdd_assert(bitvec_equal(result, key));
+    bitvec_free(result);
+    graph_free(graph);
+    bitvec_free(key);
+  }
+
+  // RS codec variants, with keys of whole 8 bit symbols
+  for (unsigned long n_bits = 8; n_bits <= 128; n_bits += 8) {
+    BITVEC *key = bitvec_create(n_bits);
+    bitvec_set(key, 0, 1);
+    for (unsigned long i = 1; i < n_bits; i++)
+      bitvec_set(key, i, rand() & 1);
+
+    GRAPH *graph = watermark_rs_encode_bitvec(key, 3, 8);
+    BITVEC *result = watermark_rs_decode_bitvec(graph, 3);
+    ctdd_assert(result && bitvec_equal(result, key));
+    bitvec_free(result);
+    graph_free(graph);
+
+    graph = watermark2014_rs_encode_bitvec(key, 3);
+    result = watermark2014_rs_decode_bitvec(graph, 3);
+    ctdd_assert(result && bitvec_equal(result, key));
+    bitvec_free(result);
+    graph_free(graph);
+    bitvec_free(key);
+  }
+  return 0;
+}
+
 void last_n_to_zero(uint8_t *arr, unsigned long size, unsigned long num_zeros) {
   unsigned long n_bits = size * 8;
   for (unsigned long i = 0; i < num_zeros; i++) {
@@ -296,6 +461,56 @@ int append_remove_rs_code_test() {
   return 0;
 }
 
+int append_rs_code_batch_test() {
+
+  for (unsigned long symsize = 2; symsize <= 8; symsize++) {
+    for (unsigned long num_data_symbols = 1;
+         num_data_symbols * symsize <= 24 && num_data_symbols < 3 * symsize;
+         num_data_symbols++) {
+
+      unsigned long num_parity_symbols = num_data_symbols / 2 + 1;
+      if (num_data_symbols + num_parity_symbols > (1UL << symsize) - 1)
+        continue;
+      // more than one group of lanes, with the last one incomplete
+      unsigned long num_keys = RS_BATCH_LANES + 37;
+      unsigned long keys[num_keys];
+      for (unsigned long k = 0; k < num_keys; k++) {
+        unsigned long *key = malloc(sizeof(unsigned long));
+        *key = (k * 2654435761UL) % (1UL << (num_data_symbols * symsize));
+        get_key_from_k((unsigned long **)&key, symsize, num_data_symbols);
+        // the key may have been shrunk, only its data bits are there
+        keys[k] = 0;
+        memcpy(&keys[k], key,
+               (num_data_symbols * symsize) / 8 + !!((num_data_symbols * symsize) % 8));
+        free(key);
+      }
+
+      unsigned long res_len = 0;
+      unsigned long num_bits = 0;
+      uint8_t *batch = append_rs_code_batch(
+          keys, sizeof(unsigned long), num_keys, num_data_symbols,
+          num_parity_symbols, symsize, &res_len, &num_bits);
+      ctdd_assert(batch);
+      ctdd_assert(num_bits ==
+                  (num_data_symbols + num_parity_symbols) * symsize);
+
+      for (unsigned long k = 0; k < num_keys; k++) {
+        unsigned long n_bits = num_data_symbols;
+        uint8_t *data_with_rs =
+            append_rs_code(&keys[k], &n_bits, num_parity_symbols, symsize);
+        ctdd_assert(n_bits == num_bits);
+        for (unsigned long i = 0; i < num_bits; i++) {
+          ctdd_assert(get_bit(data_with_rs, i) ==
+                      get_bit(batch + k * res_len, i));
+        }
+        free(data_with_rs);
+      }
+      free(batch);
+    }
+  }
+  return 0;
+}
+
 int numeric_encoding_string_test() {
 
   for (uint8_t k = 1; k < 255; k++) {
@@ -482,7 +697,6 @@ int watermark2017_decode_analysis_test() {
     GRAPH *graph = watermark_encode8(&k, sizeof(k));
     unsigned long size;
     uint8_t *result = watermark_decode_analysis(graph, &size);
-    graph_free_info(graph);
     uint8_t *result_seq = get_sequence_from_bit_arr(result, size, &size);
     ctdd_assert(size == 1);
     ctdd_assert(binary_sequence_equal(&k, result_seq, sizeof(k), size));
@@ -495,7 +709,6 @@ int watermark2017_decode_analysis_test() {
     GRAPH *graph = watermark_encode8(&k, sizeof(k));
     unsigned long size;
     uint8_t *result = watermark_decode_analysis(graph, &size);
-    graph_free_info(graph);
     uint8_t *result_seq = get_sequence_from_bit_arr(result, size, &size);
     ctdd_assert(
         binary_sequence_equal((uint8_t *)&k, result_seq, sizeof(k), size));
@@ -513,7 +726,6 @@ int watermark2017_rs_decode_analysis_test() {
     GRAPH *graph = watermark_rs_encode8(&k, sizeof(k), 3);
     unsigned long size = 3;
     uint8_t *result = watermark_rs_decode_analysis(graph, &size);
-    graph_free_info(graph);
     uint8_t *result_seq = get_sequence_from_bit_arr(result, size, &size);
     ctdd_assert(size == 1);
     ctdd_assert(binary_sequence_equal(&k, result_seq, sizeof(k), size));
@@ -526,7 +738,6 @@ int watermark2017_rs_decode_analysis_test() {
     GRAPH *graph = watermark_rs_encode8(&k, sizeof(k), 24);
     unsigned long size = 24;
     uint8_t *result = watermark_rs_decode_analysis(graph, &size);
-    graph_free_info(graph);
     uint8_t *result_seq = get_sequence_from_bit_arr(result, size, &size);
     ctdd_assert(
         binary_sequence_equal((uint8_t *)&k, result_seq, sizeof(k), size));
@@ -698,6 +909,344 @@ int dijkstra_watermark_code_test() {
   return 0;
 }
 
+uint8_t same_edges(GRAPH *graph1, GRAPH *graph2) {
+
+  if (graph1->num_nodes != graph2->num_nodes)
+    return 0;
+  for (unsigned long i = 0; i < graph1->num_nodes; i++) {
+    NODE *node = graph1->nodes[i];
+    if (node->num_out_neighbours != graph2->nodes[i]->num_out_neighbours)
+      return 0;
+    for (CONNECTION *conn = node->out; conn; conn = conn->next) {
+      if (!graph_get_connection(graph2->nodes[i],
+                                graph2->nodes[conn->node->graph_idx]))
+        return 0;
+    }
+  }
+  return 1;
+}
+
+int rng_test() {
+
+  RNG rng1, rng2;
+  rng_seed(&rng1, 42);
+  rng_seed(&rng2, 42);
+  for (unsigned long i = 0; i < 100; i++)
+    ctdd_assert(rng_next(&rng1) == rng_next(&rng2));
+  rng_seed(&rng2, 43);
+  ctdd_assert(rng_next(&rng1) != rng_next(&rng2));
+  for (unsigned long i = 1; i < 100; i++)
+    ctdd_assert(rng_below(&rng1, i) < i);
+
+  // same key and seed, same graph (and code)
+  for (unsigned long k = 1; k < 2000; k += 37) {
+    unsigned long key = invert_unsigned_long(k);
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    GRAPH *graph1 = watermark_encode_rng(&key, sizeof(key) * 8, &rng1);
+    GRAPH *graph2 = watermark_encode_rng(&key, sizeof(key) * 8, &rng2);
+    ctdd_assert(same_edges(graph1, graph2));
+    char *dijkstra_code = dijkstra_get_code(graph1);
+    char *code1 = watermark_generate_code_seeded(dijkstra_code, k);
+    char *code2 = watermark_generate_code_seeded(dijkstra_code, k);
+    ctdd_assert(!strcmp(code1, code2));
+    free(code1);
+    free(code2);
+    free(dijkstra_code);
+    graph_free(graph1);
+    graph_free(graph2);
+
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    graph1 = watermark2014_encode_rng(&key, sizeof(key), &rng1);
+    graph2 = watermark2014_encode_rng(&key, sizeof(key), &rng2);
+    ctdd_assert(same_edges(graph1, graph2));
+    graph_free(graph1);
+    graph_free(graph2);
+
+    // RS variants, including the parity
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    graph1 = watermark2014_rs_encode_rng(&key, sizeof(key), 3, &rng1);
+    graph2 = watermark2014_rs_encode_rng(&key, sizeof(key), 3, &rng2);
+    ctdd_assert(same_edges(graph1, graph2));
+    graph_free(graph1);
+    graph_free(graph2);
+
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    graph1 = watermark_rs_encode8_rng(&key, sizeof(key), 3, &rng1);
+    graph2 = watermark_rs_encode8_rng(&key, sizeof(key), 3, &rng2);
+    ctdd_assert(same_edges(graph1, graph2));
+    graph_free(graph1);
+    graph_free(graph2);
+
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    graph1 = watermark_rs_encode_rng(&key, sizeof(key), 3, 8, &rng1);
+    graph2 = watermark_rs_encode_rng(&key, sizeof(key), 3, 8, &rng2);
+    ctdd_assert(graph1 && same_edges(graph1, graph2));
+    graph_free(graph1);
+    graph_free(graph2);
+  }
+  return 0;
+}
+
+int watermark_encode_batch_test() {
+
+  unsigned long n = 300;
+  unsigned long keys[n];
+  for (unsigned long k = 0; k < n; k++)
+    keys[k] = invert_unsigned_long(k + 1);
+  GRAPH *graphs[n];
+  ENCODE_OPTS opts = {.key_len = sizeof(unsigned long),
+                      .n_bits = sizeof(unsigned long) * 8,
+                      .seed = 7};
+  watermark_encode_batch(keys, n, &opts, graphs);
+  for (unsigned long k = 0; k < n; k++) {
+    RNG rng;
+    rng_seed(&rng, opts.seed + k);
+    GRAPH *graph = watermark_encode_rng(&keys[k], opts.n_bits, &rng);
+    ctdd_assert(same_edges(graph, graphs[k]));
+    graph_free(graph);
+    graph_free(graphs[k]);
+  }
+
+  // with RS
+  unsigned long symsize = 4, num_data_symbols = 3;
+  for (unsigned long k = 0; k < n; k++) {
+    keys[k] = 0;
+    for (unsigned long i = 0; i < num_data_symbols * symsize; i++)
+      set_bit((uint8_t *)&keys[k], i, (k + i) & 1 || !i);
+  }
+  opts.n_bits = num_data_symbols * symsize;
+  opts.num_parity_symbols = 2;
+  opts.symsize = symsize;
+  opts.num_threads = 3;
+  watermark_encode_batch(keys, n, &opts, graphs);
+  for (unsigned long k = 0; k < n; k++) {
+    unsigned long n_bits = num_data_symbols;
+    uint8_t *key_with_parity =
+        append_rs_code(&keys[k], &n_bits, opts.num_parity_symbols, symsize);
+    RNG rng;
+    rng_seed(&rng, opts.seed + k);
+    GRAPH *graph = watermark_encode_rng(key_with_parity, n_bits, &rng);
+    ctdd_assert(same_edges(graph, graphs[k]));
+    free(key_with_parity);
+    graph_free(graph);
+    graph_free(graphs[k]);
+  }
+  return 0;
+}
+
+int watermark_encode_large_test() {
+
+  RNG key_rng;
+  rng_seed(&key_rng, 34);
+  WORKSPACE *ws = workspace_create(0);
+  for (unsigned long k = 0; k < 100; k++) {
+    uint64_t key[4] = {rng_next(&key_rng), rng_next(&key_rng),
+                       rng_next(&key_rng), rng_next(&key_rng)};
+    unsigned long n_bits = 8 * sizeof(key) - k % 64;
+    RNG rng1, rng2;
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    GRAPH *graph1 = watermark_encode_rng(key, n_bits, &rng1);
+    GRAPH *graph2 = watermark_encode_large_workspace(key, n_bits, &rng2, ws);
+    ctdd_assert(same_edges(graph1, graph2));
+    ctdd_assert(graph1->num_connections == graph2->num_connections);
+    // neighbours come in the same order too
+    ctdd_assert(dijkstra_is_equal(graph1, graph2));
+    graph_free(graph1);
+    graph_free(graph2);
+  }
+  workspace_free(ws);
+
+  // long key
+  unsigned long n_bits = 100000;
+  uint8_t *key = malloc(n_bits / 8);
+  for (unsigned long i = 0; i < n_bits / 8; i++)
+    key[i] = rng_next(&key_rng);
+  RNG rng1, rng2;
+  rng_seed(&rng1, 1);
+  rng_seed(&rng2, 1);
+  GRAPH *graph1 = watermark_encode_rng(key, n_bits, &rng1);
+  GRAPH *graph2 = watermark_encode_large_rng(key, n_bits, &rng2);
+  ctdd_assert(same_edges(graph1, graph2));
+  ctdd_assert(graph1->num_connections == graph2->num_connections);
+  graph_free(graph1);
+  graph_free(graph2);
+  free(key);
+  return 0;
+}
+
+typedef struct ENUMERATED_CODES {
+  char *codes[4096];
+  unsigned long n;
+  unsigned long stop_after;
+} ENUMERATED_CODES;
+
+int enumerated_codes_callback(GRAPH *graph, void *arg) {
+
+  ENUMERATED_CODES *codes = arg;
+  char *code = dijkstra_get_code(graph);
+  int stop = 0;
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+  {
+    if (codes->n < sizeof(codes->codes) / sizeof(char *)) {
+      codes->codes[codes->n++] = code;
+      code = NULL;
+    }
+    stop = codes->stop_after && codes->n >= codes->stop_after;
+  }
+  free(code);
+  return stop;
+}
+
+int watermark_encode_enumerate_test() {
+
+  RNG key_rng;
+  rng_seed(&key_rng, 35);
+  for (unsigned long k = 0; k < 10; k++) {
+    uint64_t key = rng_next(&key_rng);
+    unsigned long n_bits = 40;
+    ENUMERATED_CODES *codes = calloc(1, sizeof(ENUMERATED_CODES));
+    unsigned long n =
+        watermark_encode_enumerate(&key, n_bits, enumerated_codes_callback, codes);
+    ctdd_assert(n == codes->n);
+    ctdd_assert(n >= 1);
+    // every graph is different
+    for (unsigned long i = 0; i < n; i++)
+      for (unsigned long j = i + 1; j < n; j++)
+        ctdd_assert(strcmp(codes->codes[i], codes->codes[j]));
+    // and every seed gives one of them
+    for (unsigned long seed = 0; seed < 20; seed++) {
+      RNG rng;
+      rng_seed(&rng, seed);
+      GRAPH *graph = watermark_encode_rng(&key, n_bits, &rng);
+      char *code = dijkstra_get_code(graph);
+      uint8_t found = 0;
+      for (unsigned long i = 0; i < n && !found; i++)
+        found = !strcmp(code, codes->codes[i]);
+      ctdd_assert(found);
+      free(code);
+      graph_free(graph);
+    }
+    for (unsigned long i = 0; i < n; i++)
+      free(codes->codes[i]);
+    free(codes);
+  }
+
+  // stop early, on a key with thousands of graphs
+  uint64_t key = 0x123456789abcdef1;
+  ENUMERATED_CODES *codes = calloc(1, sizeof(ENUMERATED_CODES));
+  unsigned long n =
+      watermark_encode_enumerate(&key, 64, enumerated_codes_callback, codes);
+  for (unsigned long i = 0; i < codes->n; i++)
+    free(codes->codes[i]);
+  codes->n = 0;
+  codes->stop_after = 1;
+  unsigned long stopped_n =
+      watermark_encode_enumerate(&key, 64, enumerated_codes_callback, codes);
+  ctdd_assert(n > 1000);
+  ctdd_assert(stopped_n >= 1 && stopped_n < n / 2);
+  for (unsigned long i = 0; i < codes->n; i++)
+    free(codes->codes[i]);
+  free(codes);
+  return 0;
+}
+
+int encode_table_test() {
+
+  ctdd_assert(!encode_table_create(0, 0));
+  ctdd_assert(!encode_table_create(ENCODE_TABLE_MAX_BITS + 1, 0));
+
+  unsigned long n_bits = 10;
+  ENCODE_TABLE *created = encode_table_create(n_bits, 7);
+  ctdd_assert(encode_table_save(created, "encode_table.bin"));
+  ENCODE_TABLE *table = encode_table_load("encode_table.bin");
+  remove("encode_table.bin");
+  ctdd_assert(table);
+  ctdd_assert(table->header->first_key == 1UL << (n_bits - 1));
+  ctdd_assert(table->header->num_keys == 1UL << (n_bits - 1));
+
+  WORKSPACE *ws = workspace_create(0);
+  for (unsigned long key = 1UL << (n_bits - 1); key < 1UL << n_bits; key++) {
+    uint64_t identifier = key;
+    invert_byte_sequence((uint8_t *)&identifier, sizeof(identifier));
+    RNG rng;
+    rng_seed(&rng, 7 + key);
+    GRAPH *graph = watermark_encode_rng(&identifier, 64, &rng);
+    GRAPH *from_table = encode_table_get_graph(table, key, ws);
+    ctdd_assert(same_edges(graph, from_table));
+    ctdd_assert(graph->num_connections == from_table->num_connections);
+    ctdd_assert(dijkstra_is_equal(graph, from_table));
+
+    unsigned long found_key = 0;
+    ctdd_assert(encode_table_find_key(created, graph, &found_key));
+    ctdd_assert(found_key == key);
+    ctdd_assert(encode_table_find_key(table, from_table, &found_key));
+    ctdd_assert(found_key == key);
+
+    // without its last hamiltonian edge, it isn't the graph of any key
+    graph_oriented_disconnect(graph->nodes[graph->num_nodes - 2],
+                              graph->nodes[graph->num_nodes - 1]);
+    ctdd_assert(!encode_table_find_key(table, graph, &found_key));
+    graph_free(graph);
+    graph_free(from_table);
+  }
+  ctdd_assert(!encode_table_get_graph(table, 1, ws));
+  ctdd_assert(!encode_table_get_graph(table, 1 << n_bits, ws));
+  ctdd_assert(!encode_table_load("encode_table.bin"));
+
+  workspace_free(ws);
+  encode_table_free(table);
+  encode_table_free(created);
+  return 0;
+}
+
+int watermark_encode_dijkstra_code_test() {
+
+  // every 8 bit key
+  for (unsigned long k = 0; k < 256; k++) {
+    uint8_t key = k;
+    RNG rng1, rng2;
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    GRAPH *graph = watermark_encode_rng(&key, 8, &rng1);
+    char *expected = dijkstra_get_code(graph);
+    char *code = watermark_encode_dijkstra_code_rng(&key, 8, &rng2);
+    ctdd_assert(!strcmp(code, expected));
+    free(expected);
+    free(code);
+    graph_free(graph);
+  }
+
+  // longer keys, with lengths that aren't multiples of 8
+  RNG key_rng;
+  rng_seed(&key_rng, 33);
+  WORKSPACE *ws = workspace_create(0);
+  for (unsigned long k = 0; k < 200; k++) {
+    uint64_t key[4] = {rng_next(&key_rng), rng_next(&key_rng),
+                       rng_next(&key_rng), rng_next(&key_rng)};
+    unsigned long n_bits = 8 * sizeof(key) - k % 64;
+    RNG rng1, rng2;
+    rng_seed(&rng1, k);
+    rng_seed(&rng2, k);
+    GRAPH *graph = watermark_encode_rng(key, n_bits, &rng1);
+    char *expected = dijkstra_get_code(graph);
+    char *code = watermark_encode_dijkstra_code_workspace(key, n_bits, &rng2, ws);
+    ctdd_assert(!strcmp(code, expected));
+    free(expected);
+    free(code);
+    graph_free(graph);
+  }
+  workspace_free(ws);
+  return 0;
+}
+
 int watermark_check_test() {
 
   for (uint8_t k = 1; k < 255; k++) {
@@ -720,6 +1269,107 @@ int watermark_check_test() {
   return 0;
 }
 
+int watermark_check_keys_test() {
+
+  // every one byte key against the graph of every one byte key
+  uint8_t keys[256];
+  for (unsigned long k = 0; k < 256; k++)
+    keys[k] = k;
+  for (uint8_t k = 1; k < 255; k++) {
+    GRAPH *graph = watermark_encode8(&k, sizeof(k));
+    CHECK_PLAN *plan = watermark_check_plan(graph);
+    uint8_t results[256];
+    watermark_check_keys(plan, keys, 256, 1, results);
+    ctdd_assert(results[k]);
+    for (unsigned long i = 0; i < 256; i++)
+      ctdd_assert(results[i] == watermark_check(graph, &keys[i], 1));
+    watermark_check_plan_free(plan);
+    graph_free(graph);
+  }
+
+  // 64 bit keys with a few bits flipped, against graphs with an edge removed
+  RNG rng;
+  rng_seed(&rng, 42);
+  for (unsigned long t = 0; t < 20; t++) {
+    uint64_t key = rng_next(&rng) | ((uint64_t)1 << 63);
+    uint8_t data[sizeof(key)];
+    for (unsigned long i = 0; i < sizeof(key); i++)
+      data[i] = key >> (8 * (sizeof(key) - 1 - i));
+    RNG encode_rng;
+    rng_seed(&encode_rng, t);
+    GRAPH *graph = watermark_encode_rng(data, 8 * sizeof(data), &encode_rng);
+    if (t & 1) {
+      NODE *node = graph->nodes[rng_below(&rng, graph->num_nodes)];
+      if (node->out)
+        graph_oriented_disconnect(node, node->out->node);
+    }
+    unsigned long n = 200;
+    uint8_t *variants = malloc(n * sizeof(data));
+    for (unsigned long k = 0; k < n; k++) {
+      memcpy(variants + k * sizeof(data), data, sizeof(data));
+      for (unsigned long f = 0; f < k % 3; f++) {
+        unsigned long b = rng_below(&rng, 8 * sizeof(data));
+        variants[k * sizeof(data) + b / 8] ^= 0x80 >> (b % 8);
+      }
+    }
+    uint8_t results[200];
+    CHECK_PLAN *plan = watermark_check_plan(graph);
+    watermark_check_keys(plan, variants, n, sizeof(data), results);
+    for (unsigned long k = 0; k < n; k++)
+      ctdd_assert(results[k] == watermark_check(graph, variants + k * sizeof(data), sizeof(data)));
+    watermark_check_plan_free(plan);
+    free(variants);
+    graph_free(graph);
+  }
+  return 0;
+}
+
+unsigned long count_forward_edges(GRAPH *graph) {
+  unsigned long n = 0;
+  for (unsigned long i = 0; i < graph->num_nodes; i++)
+    n += !!graph_get_forward(graph->nodes[i]);
+  return n;
+}
+
+int graph_count_forward_edges_test() {
+
+  RNG rng;
+  rng_seed(&rng, 43);
+  for (unsigned long t = 0; t < 20; t++) {
+    uint64_t key = rng_next(&rng) | ((uint64_t)1 << 63);
+    uint8_t data[sizeof(key)];
+    for (unsigned long i = 0; i < sizeof(key); i++)
+      data[i] = key >> (8 * (sizeof(key) - 1 - i));
+    RNG encode_rng;
+    rng_seed(&encode_rng, t);
+    GRAPH *graph = t & 1 ? watermark_encode_large_rng(data, 8 * sizeof(data), &encode_rng)
+                         : watermark_encode_rng(data, 8 * sizeof(data), &encode_rng);
+    ctdd_assert(graph_count_forward_edges(graph) == count_forward_edges(graph));
+    ctdd_assert(watermark_check(graph, data, sizeof(data)));
+
+    // kept up to date as edges come and go
+    for (unsigned long i = 0; i + 3 < graph->num_nodes; i++) {
+      NODE *from = graph->nodes[i];
+      NODE *to = graph->nodes[i + 2 + rng_below(&rng, 2)];
+      uint8_t was_connected = graph_oriented_disconnect(from, to);
+      ctdd_assert(graph->has_num_forward_edges);
+      ctdd_assert(graph->num_forward_edges == count_forward_edges(graph));
+      graph_oriented_connect(from, to);
+      ctdd_assert(graph->num_forward_edges == count_forward_edges(graph));
+      if (!was_connected)
+        graph_oriented_disconnect(from, to);
+    }
+    ctdd_assert(watermark_check(graph, data, sizeof(data)));
+    // and counted again once nodes move
+    graph_insert(graph, 1 + rng_below(&rng, graph->num_nodes - 1));
+    ctdd_assert(!graph->has_num_forward_edges);
+    ctdd_assert(graph_count_forward_edges(graph) == count_forward_edges(graph));
+    ctdd_assert(!watermark_check(graph, data, sizeof(data)));
+    graph_free(graph);
+  }
+  return 0;
+}
+
 uint8_t has_x(uint8_t *bits, unsigned long size) {
   for (unsigned long i = 0; i < size; i++) {
     if (bits[i] == 'x')
@@ -735,7 +1385,6 @@ int watermark_check_analysis_test() {
     GRAPH *graph = watermark_encode8(&k, sizeof(k));
     unsigned long size = sizeof(k);
     uint8_t *bit_arr = watermark_check_analysis(graph, &k, &size);
-    graph_free_info(graph);
     uint8_t result = has_x(bit_arr, size);
     if (!result) {
       PRINT_K(k);
@@ -749,7 +1398,6 @@ int watermark_check_analysis_test() {
     GRAPH *graph = watermark_encode8(&k, sizeof(k));
     unsigned long size = sizeof(k);
     uint8_t *bit_arr = watermark_check_analysis(graph, &k, &size);
-    graph_free_info(graph);
     uint8_t result = has_x(bit_arr, size);
     free(bit_arr);
     graph_free(graph);
@@ -758,6 +1406,81 @@ int watermark_check_analysis_test() {
   return 0;
 }
 
+int watermark_check_analysis_batch_test() {
+
+  // every one byte key against the graph of every one byte key, checked against
+  // 'watermark_check': a pair matches exactly when every reached status is a bit
+  unsigned long n = 254 * 254;
+  GRAPH *graphs[254];
+  GRAPH **pairs = malloc(n * sizeof(GRAPH *));
+  uint8_t *keys = malloc(n);
+  for (unsigned long k = 0; k < 254; k++) {
+    uint8_t key = k + 1;
+    graphs[k] = watermark_encode8(&key, sizeof(key));
+    for (unsigned long j = 0; j < 254; j++) {
+      pairs[k * 254 + j] = graphs[k];
+      keys[k * 254 + j] = j + 1;
+    }
+  }
+  CHECK_ANALYSIS_OPTS opts = {.key_len = 1, .num_threads = 2};
+  uint8_t *arena = malloc(n * CHECK_STATUS_BYTES(8));
+  unsigned long *num_positions = malloc(n * sizeof(unsigned long));
+  unsigned long histogram[CHECK_NUM_STATUS * 8] = {0};
+  watermark_check_analysis_batch(pairs, keys, n, &opts, arena, num_positions, histogram);
+  unsigned long num_errors = 0, counted = 0, num_matches = 0;
+  for (unsigned long i = 0; i < n; i++) {
+    uint8_t *statuses = arena + i * CHECK_STATUS_BYTES(8);
+    uint8_t matches = num_positions[i] != 0;
+    for (unsigned long j = 0; j < num_positions[i]; j++) {
+      CHECK_STATUS status = check_status_get(statuses, j);
+      matches &= status != CHECK_STATUS_X;
+      num_errors += status == CHECK_STATUS_X;
+    }
+    ctdd_assert(matches == watermark_check(pairs[i], &keys[i], 1));
+    num_matches += matches;
+    // a key against its own graph has no errors
+    if (i / 254 == i % 254)
+      for (unsigned long j = 0; j < num_positions[i]; j++)
+        ctdd_assert(check_status_get(statuses, j) != CHECK_STATUS_X);
+    counted += num_positions[i];
+  }
+  unsigned long histogram_errors = 0, histogram_total = 0;
+  for (unsigned long j = 0; j < 8; j++) {
+    histogram_errors += histogram[CHECK_NUM_STATUS * j + CHECK_STATUS_X];
+    for (unsigned long status = 0; status < CHECK_NUM_STATUS; status++)
+      histogram_total += histogram[CHECK_NUM_STATUS * j + status];
+  }
+  // every key matches its own graph, and not every other one
+  ctdd_assert(num_matches >= 254 && num_matches < n);
+  ctdd_assert(histogram_errors == num_errors);
+  ctdd_assert(histogram_total == counted);
+  for (unsigned long k = 0; k < 254; k++)
+    graph_free(graphs[k]);
+  free(pairs);
+  free(keys);
+  free(arena);
+  free(num_positions);
+
+  // with RS the parity is analysed too
+  uint8_t data[4] = {0xde, 0xad, 0xbe, 0xef};
+  GRAPH *graph = watermark_rs_encode8(data, sizeof(data), 2);
+  CHECK_ANALYSIS_OPTS rs_opts = {.key_len = sizeof(data), .num_parity_symbols = 2, .symsize = 8};
+  uint8_t rs_arena[CHECK_STATUS_BYTES(8 * (sizeof(data) + 2))];
+  unsigned long rs_num_positions;
+  // sized by the codeword, parity included
+  unsigned long rs_histogram[CHECK_NUM_STATUS * 8 * (sizeof(data) + 2)];
+  memset(rs_histogram, 0, sizeof(rs_histogram));
+  watermark_check_analysis_batch(&graph, data, 1, &rs_opts, rs_arena, &rs_num_positions, rs_histogram);
+  ctdd_assert(rs_num_positions == 8 * (sizeof(data) + 2));
+  for (unsigned long j = 0; j < rs_num_positions; j++) {
+    CHECK_STATUS status = check_status_get(rs_arena, j);
+    ctdd_assert(status != CHECK_STATUS_X);
+    ctdd_assert(rs_histogram[CHECK_NUM_STATUS * j + status] == 1);
+  }
+  graph_free(graph);
+  return 0;
+}
+
 int watermark_check_rs_test() {
 
   for (uint8_t k = 1; k < 255; k++) {
@@ -789,7 +1512,6 @@ int watermark_check_rs_analysis_test() {
     GRAPH *graph = watermark_rs_encode8(&k, sizeof(k), 3);
     unsigned long size = sizeof(k);
     uint8_t *bit_arr = watermark_rs_check_analysis(graph, &k, &size, 3);
-    graph_free_info(graph);
     uint8_t result = has_x(bit_arr, size);
     if (!result) {
       PRINT_K(k);
@@ -803,7 +1525,6 @@ int watermark_check_rs_analysis_test() {
     GRAPH *graph = watermark_rs_encode8(&k, sizeof(k), 24);
     unsigned long size = sizeof(k);
     uint8_t *bit_arr = watermark_rs_check_analysis(graph, &k, &size, 24);
-    graph_free_info(graph);
     uint8_t result = has_x(bit_arr, size);
     free(bit_arr);
     graph_free(graph);
@@ -812,6 +1533,376 @@ int watermark_check_rs_analysis_test() {
   return 0;
 }
 
+int workspace_test() {
+
+  WORKSPACE *ws = workspace_create(0);
+  for (unsigned long n_bytes = 1; n_bytes < 40; n_bytes += 3) {
+    uint8_t key[n_bytes];
+    for (unsigned long i = 0; i < n_bytes; i++)
+      key[i] = rand();
+    key[0] |= 0x80;
+    GRAPH *graph = watermark_encode8(key, n_bytes);
+
+    // same results as the allocating versions, with the workspace reused
+    unsigned long num_bytes, ws_num_bytes;
+    uint8_t *result = watermark_decode(graph, &num_bytes);
+    uint8_t *ws_result = watermark_decode_workspace(graph, ws, &ws_num_bytes);
+    ctdd_assert(num_bytes == ws_num_bytes);
+    ctdd_assert(!memcmp(result, ws_result, num_bytes));
+    free(result);
+
+    unsigned long num_bits = n_bytes * 8, ws_num_bits = n_bytes * 8;
+    result = watermark_decode_improved(graph, key, &num_bits);
+    ws_result = watermark_decode_improved_workspace(graph, key, &ws_num_bits, ws,
+                                                    &ws_num_bytes);
+    ctdd_assert(num_bits == ws_num_bits);
+    ctdd_assert(!memcmp(result, ws_result, ws_num_bytes));
+    ctdd_assert(binary_sequence_equal(key, ws_result, n_bytes, ws_num_bytes));
+    free(result);
+
+    ctdd_assert(watermark_check_workspace(graph, key, n_bytes, ws));
+    key[n_bytes / 2] ^= 1;
+    ctdd_assert(watermark_check_workspace(graph, key, n_bytes, ws) ==
+                watermark_check(graph, key, n_bytes));
+    graph_free(graph);
+  }
+
+  // graphs too big for the stack
+  unsigned long n_bytes = 1 << 15;
+  uint8_t *key = malloc(n_bytes);
+  for (unsigned long i = 0; i < n_bytes; i++)
+    key[i] = rand();
+  key[0] |= 0x80;
+  GRAPH *graph = watermark_encode8(key, n_bytes);
+  unsigned long num_bytes;
+  uint8_t *result = watermark_decode_workspace(graph, ws, &num_bytes);
+  ctdd_assert(binary_sequence_equal(key, result, n_bytes, num_bytes));
+  ctdd_assert(watermark_check_workspace(graph, key, n_bytes, ws));
+  graph_free(graph);
+  free(key);
+  workspace_free(ws);
+  return 0;
+}
+
+int watermark_decode_improved_view_test() {
+
+  RNG key_rng;
+  rng_seed(&key_rng, 37);
+  WORKSPACE *ws = workspace_create(0);
+  for (unsigned long k = 0; k < 200; k++) {
+    uint64_t key = rng_next(&key_rng) >> (k % 60);
+    key |= 1;
+    uint8_t data[sizeof(key)];
+    for (unsigned long i = 0; i < sizeof(key); i++)
+      data[i] = key >> (8 * (sizeof(key) - 1 - i));
+    RNG rng;
+    rng_seed(&rng, k);
+    GRAPH *graph = watermark_encode_rng(data, 8 * sizeof(data), &rng);
+    workspace_load_graph(ws, graph);
+    uint8_t view_result[graph->num_nodes / 8 + 1];
+
+    // every non hamiltonian edge removed, one at a time, from both the graph and the view
+    for (unsigned long from = 0; from < graph->num_nodes; from++) {
+      unsigned long num_out = graph->nodes[from]->num_out_neighbours;
+      if (!num_out)
+        continue;
+      unsigned long out[num_out];
+      unsigned long n = 0;
+      for (CONNECTION *conn = graph->nodes[from]->out; conn; conn = conn->next)
+        if (conn->node->graph_idx != from + 1)
+          out[n++] = conn->node->graph_idx;
+      for (unsigned long j = 0; j < n; j++) {
+        GRAPH *copy = graph_copy(graph);
+        ctdd_assert(graph_oriented_disconnect(copy->nodes[from], copy->nodes[out[j]]));
+        ctdd_assert(workspace_view_disconnect(ws, from, out[j]));
+
+        unsigned long num_bits = 8 * sizeof(data), view_num_bits = 8 * sizeof(data);
+        unsigned long num_bytes;
+        uint8_t *result = watermark_decode_improved(copy, data, &num_bits);
+        watermark_decode_improved_view(ws, data, &view_num_bits, view_result, &num_bytes);
+        ctdd_assert(num_bits == view_num_bits);
+        ctdd_assert(!memcmp(result, view_result, num_bytes));
+        free(result);
+        graph_free(copy);
+        workspace_view_connect(ws, from, out[j]);
+      }
+    }
+
+    // the view is back to the original graph
+    unsigned long num_bits = 8 * sizeof(data), num_bytes;
+    watermark_decode_improved_view(ws, data, &num_bits, view_result, &num_bytes);
+    ctdd_assert(binary_sequence_equal(data, view_result, sizeof(data), num_bytes));
+    ctdd_assert(!workspace_view_disconnect(ws, 0, graph->num_nodes - 1));
+    graph_free(graph);
+  }
+  workspace_free(ws);
+  return 0;
+}
+
+int watermark_decode_batch_test() {
+
+  unsigned long n = 300;
+  unsigned long symsize = 8, num_parity_symbols = 4;
+  RNG key_rng;
+  rng_seed(&key_rng, 38);
+  uint64_t *keys = malloc(n * sizeof(uint64_t));
+  for (unsigned long i = 0; i < n; i++) {
+    uint64_t key = rng_next(&key_rng) | 1;
+    for (unsigned long j = 0; j < sizeof(key); j++)
+      ((uint8_t *)&keys[i])[j] = key >> (8 * (sizeof(key) - 1 - j));
+  }
+  ENCODE_OPTS encode_opts = {.key_len = sizeof(uint64_t), .n_bits = 64};
+  GRAPH **graphs = malloc(n * sizeof(GRAPH *));
+  GRAPH **rs_graphs = malloc(n * sizeof(GRAPH *));
+  watermark_encode_batch(keys, n, &encode_opts, graphs);
+  encode_opts.num_parity_symbols = num_parity_symbols;
+  encode_opts.symsize = symsize;
+  watermark_encode_batch(keys, n, &encode_opts, rs_graphs);
+  // too small to be decoded
+  graph_free(graphs[n / 2]);
+  graphs[n / 2] = graph_create(2);
+
+  DECODE_RESULT *results = malloc(n * sizeof(DECODE_RESULT));
+  for (METHOD method = ORIGINAL; method <= IMPROVED_WITH_RS; method++) {
+    DECODE_OPTS opts = {.method = method,
+                        .keys = keys,
+                        .key_len = sizeof(uint64_t),
+                        .n_bits = 64,
+                        .num_parity_symbols = num_parity_symbols,
+                        .symsize = symsize,
+                        .num_threads = 3};
+    GRAPH **batch = method == IMPROVED_WITH_RS ? rs_graphs : graphs;
+    DECODE_STATS stats;
+    watermark_decode_batch(batch, n, &opts, results, &stats);
+    ctdd_assert(stats.num_decoded == (method == IMPROVED_WITH_RS ? n : n - 1));
+#if defined(_OPENMP)
+    ctdd_assert(stats.num_threads == 3);
+#endif
+    ctdd_assert(stats.graphs_per_second > 0);
+
+    // same results as decoding one graph at a time
+    for (unsigned long i = 0; i < n; i++) {
+      unsigned long num_bytes = method == IMPROVED_WITH_RS ? 64 / symsize : 64;
+      uint8_t *result = NULL;
+      if (batch[i]->num_nodes < 3) {
+        ctdd_assert(results[i].status == DECODE_TOO_SMALL);
+      } else if (method == ORIGINAL) {
+        result = watermark_decode(batch[i], &num_bytes);
+      } else if (method == IMPROVED) {
+        result = watermark_decode_improved(batch[i], (uint8_t *)&keys[i], &num_bytes);
+        num_bytes = num_bytes / 8 + !!(num_bytes % 8);
+      } else {
+        result = watermark_rs_decode_improved(batch[i], &keys[i], &num_bytes,
+                                              num_parity_symbols, symsize);
+        if (!result)
+          ctdd_assert(results[i].status == DECODE_RS_FAILED);
+      }
+      if (result) {
+        ctdd_assert(results[i].status == DECODE_OK);
+        ctdd_assert(results[i].num_bytes == num_bytes);
+        ctdd_assert(!memcmp(results[i].bits, result, num_bytes));
+        if (method != ORIGINAL)
+          ctdd_assert(binary_sequence_equal((uint8_t *)&keys[i], result, sizeof(uint64_t), num_bytes));
+      } else {
+        ctdd_assert(!results[i].bits);
+      }
+      free(result);
+      free(results[i].bits);
+    }
+  }
+
+  for (unsigned long i = 0; i < n; i++) {
+    graph_free(graphs[i]);
+    graph_free(rs_graphs[i]);
+  }
+  free(results);
+  free(graphs);
+  free(rs_graphs);
+  free(keys);
+  return 0;
+}
+
+int watermark_extract_test() {
+
+  RNG rng;
+  rng_seed(&rng, 39);
+  for (unsigned long k = 0; k < 20; k++) {
+    uint64_t key = rng_next(&rng) | 1;
+    uint8_t data[sizeof(key)];
+    for (unsigned long i = 0; i < sizeof(key); i++)
+      data[i] = key >> (8 * (sizeof(key) - 1 - i));
+    RNG encode_rng;
+    rng_seed(&encode_rng, k);
+    GRAPH *watermark = watermark_encode_rng(data, 8 * sizeof(data), &encode_rng);
+    unsigned long num_bytes;
+    uint8_t *expected = watermark_decode(watermark, &num_bytes);
+
+    // watermark in the middle of a host with loops and ifs of its own, entered
+    // from the host's second node and leaving to its last one
+    unsigned long pre = 25, post = 25;
+    unsigned long entry = pre, exit = pre + watermark->num_nodes - 1;
+    GRAPH *host = graph_create(pre + watermark->num_nodes + post);
+    for (unsigned long i = 0; i + 1 < host->num_nodes; i++)
+      graph_oriented_connect(host->nodes[i], host->nodes[i + 1]);
+    for (unsigned long i = 0; i < watermark->num_nodes; i++)
+      for (CONNECTION *conn = watermark->nodes[i]->out; conn; conn = conn->next)
+        if (conn->node->graph_idx != i + 1)
+          graph_oriented_connect(host->nodes[entry + i], host->nodes[entry + conn->node->graph_idx]);
+    for (unsigned long i = 0; i < 3; i++) {
+      unsigned long a = 2 + rng_below(&rng, pre - 5);
+      unsigned long b = exit + 1 + rng_below(&rng, post - 3);
+      graph_oriented_connect(host->nodes[a + 2], host->nodes[a]);
+      graph_oriented_connect(host->nodes[b], host->nodes[b + 2]);
+    }
+    graph_oriented_connect(host->nodes[1], host->nodes[entry]);
+    graph_oriented_connect(host->nodes[exit], host->nodes[host->num_nodes - 1]);
+
+    EXTRACT_OPTS opts = {.num_threads = 2};
+    unsigned long num_candidates;
+    EXTRACT_CANDIDATE *candidates = watermark_extract(host, &opts, &num_candidates);
+    ctdd_assert(num_candidates);
+    ctdd_assert(candidates[0].entry == entry);
+    // the watermark's window decodes as if it had been cut out by hand
+    uint8_t found = 0;
+    for (unsigned long i = 0; i < num_candidates; i++) {
+      if (i)
+        ctdd_assert(candidates[i - 1].score >= candidates[i].score);
+      if (candidates[i].num_bytes == num_bytes &&
+          !memcmp(candidates[i].bits, expected, num_bytes)) {
+        ctdd_assert(candidates[i].entry == entry && candidates[i].exit == exit);
+        found = 1;
+      }
+    }
+    ctdd_assert(found);
+
+    watermark_extract_free(candidates, num_candidates);
+    free(expected);
+    graph_free(host);
+    graph_free(watermark);
+  }
+  return 0;
+}
+
+int watermark_decode_keyless_test() {
+
+  RNG rng;
+  rng_seed(&rng, 40);
+  for (unsigned long k = 0; k < 40; k++) {
+    uint64_t key = (rng_next(&rng) >> (k % 40)) | 1;
+    uint8_t data[sizeof(key)];
+    for (unsigned long i = 0; i < sizeof(key); i++)
+      data[i] = key >> (8 * (sizeof(key) - 1 - i));
+    BITVEC *expected = bitvec_from_bytes(data, 8 * sizeof(data));
+    bitvec_remove_left_zeros(expected);
+
+    // without RS: the key is always found and every key found decodes to itself
+    RNG encode_rng;
+    rng_seed(&encode_rng, k);
+    GRAPH *graph = watermark_encode_rng(data, 8 * sizeof(data), &encode_rng);
+    KEYLESS_OPTS opts = {0};
+    unsigned long num_keys;
+    BITVEC **keys = watermark_decode_keyless(graph, &opts, &num_keys);
+    uint8_t found = 0;
+    for (unsigned long i = 0; i < num_keys; i++) {
+      BITVEC *result = watermark_decode_improved_bitvec(graph, keys[i]);
+      ctdd_assert(bitvec_equal(result, keys[i]));
+      found |= bitvec_equal(keys[i], expected);
+      bitvec_free(result);
+      bitvec_free(keys[i]);
+    }
+    ctdd_assert(found);
+    free(keys);
+
+    // the search stops once it has enough keys
+    opts.max_keys = 1;
+    keys = watermark_decode_keyless(graph, &opts, &num_keys);
+    ctdd_assert(num_keys == 1);
+    bitvec_free(keys[0]);
+    free(keys);
+    graph_free(graph);
+
+    // with RS only valid codewords are kept
+    unsigned long num_parity_symbols = 4;
+    graph = watermark_rs_encode8(data, sizeof(data), num_parity_symbols);
+    KEYLESS_OPTS rs_opts = {.num_data_symbols = sizeof(data),
+                            .num_parity_symbols = num_parity_symbols,
+                            .symsize = 8};
+    BITVEC *expected_data = bitvec_from_bytes(data, 8 * sizeof(data));
+    keys = watermark_decode_keyless(graph, &rs_opts, &num_keys);
+    found = 0;
+    for (unsigned long i = 0; i < num_keys; i++) {
+      ctdd_assert(keys[i]->n_bits == 8 * sizeof(data));
+      BITVEC *result = watermark_rs_decode_improved_bitvec(graph, keys[i], num_parity_symbols, 8);
+      ctdd_assert(result && bitvec_equal(result, keys[i]));
+      found |= bitvec_equal(keys[i], expected_data);
+      bitvec_free(result);
+      bitvec_free(keys[i]);
+    }
+    ctdd_assert(found);
+    free(keys);
+    graph_free(graph);
+    bitvec_free(expected_data);
+    bitvec_free(expected);
+  }
+  return 0;
+}
+
+int registry_test() {
+
+  // 40 bit keys, the way 'watermark_encode_batch' issues them
+  unsigned long n = 2000, key_len = 5;
+  RNG rng;
+  rng_seed(&rng, 41);
+  uint8_t *keys = malloc(n * key_len);
+  for (unsigned long i = 0; i < n * key_len; i++)
+    keys[i] = rng_next(&rng);
+  for (unsigned long i = 0; i < n; i++)
+    keys[i * key_len] |= 0x80;
+
+  for (unsigned long num_parity_symbols = 0; num_parity_symbols < 3; num_parity_symbols += 2) {
+    ENCODE_OPTS opts = {.key_len = key_len, .n_bits = 8 * key_len,
+                        .num_parity_symbols = num_parity_symbols, .symsize = 8,
+                        .seed = 7, .num_threads = 2};
+    REGISTRY *registry = registry_create(keys, n, &opts);
+    WORKSPACE *ws = workspace_create(1);
+    for (unsigned long i = 0; i < n; i += 97) {
+      GRAPH *graph;
+      watermark_encode_batch(keys + i * key_len, 1, &(ENCODE_OPTS){.key_len = key_len, .n_bits = 8 * key_len,
+                                                                   .num_parity_symbols = num_parity_symbols,
+                                                                   .symsize = 8, .seed = 7 + i, .num_threads = 1}, &graph);
+      // the key the graph was made from is the first candidate
+      unsigned long key_idxs[4];
+      ctdd_assert(registry_lookup(registry, graph, ws, key_idxs, 4) >= 1);
+      ctdd_assert(key_idxs[0] == i);
+      unsigned long key_idx;
+      ctdd_assert(registry_find_key_workspace(registry, graph, &key_idx, ws));
+      ctdd_assert(key_idx == i);
+      graph_free(graph);
+
+      // other backedges picked by the RNG still match the backedge parities
+      watermark_encode_batch(keys + i * key_len, 1, &(ENCODE_OPTS){.key_len = key_len, .n_bits = 8 * key_len,
+                                                                   .num_parity_symbols = num_parity_symbols,
+                                                                   .symsize = 8, .seed = 1000 + i, .num_threads = 1}, &graph);
+      ctdd_assert(registry_find_key(registry, graph, &key_idx));
+      ctdd_assert(key_idx == i);
+      graph_free(graph);
+    }
+    // a key that wasn't issued
+    uint8_t other[5] = {0x80, 0, 0, 0, 1};
+    GRAPH *graph;
+    watermark_encode_batch(other, 1, &(ENCODE_OPTS){.key_len = key_len, .n_bits = 8 * key_len,
+                                                    .num_parity_symbols = num_parity_symbols,
+                                                    .symsize = 8, .num_threads = 1}, &graph);
+    unsigned long key_idx;
+    ctdd_assert(!registry_find_key_workspace(registry, graph, &key_idx, ws));
+    graph_free(graph);
+    workspace_free(ws);
+    registry_free(registry);
+  }
+  free(keys);
+  return 0;
+}
+
 int sequence_alignment_score_test() {
 
   watermark_needleman_wunsch("GATTACA", "GTCGACGCA", 10, -10, -1);
@@ -909,7 +2000,10 @@ int run_tests() {
   ctdd_verify(get_bit_test);
   ctdd_verify(rs_test);
   ctdd_verify(merge_unmerge_test);
+  ctdd_verify(pack_unpack_symbols_test);
+  ctdd_verify(bitvec_test);
   ctdd_verify(append_remove_rs_code_test);
+  ctdd_verify(append_rs_code_batch_test);
   ctdd_verify(watermark2014_test);
   ctdd_verify(watermark2014_rs_test);
   ctdd_verify(watermark2017_test);
@@ -921,10 +2015,25 @@ int run_tests() {
   ctdd_verify(dijkstra_recognition_test);
   ctdd_verify(dijkstra_code_test);
   ctdd_verify(dijkstra_watermark_code_test);
+  ctdd_verify(rng_test);
+  ctdd_verify(watermark_encode_batch_test);
+  ctdd_verify(watermark_encode_large_test);
+  ctdd_verify(watermark_encode_dijkstra_code_test);
+  ctdd_verify(watermark_encode_enumerate_test);
+  ctdd_verify(encode_table_test);
   ctdd_verify(watermark_check_test);
+  ctdd_verify(watermark_check_keys_test);
+  ctdd_verify(graph_count_forward_edges_test);
   ctdd_verify(watermark_check_analysis_test);
+  ctdd_verify(watermark_check_analysis_batch_test);
   ctdd_verify(watermark_check_rs_test);
   ctdd_verify(watermark_check_rs_analysis_test);
+  ctdd_verify(workspace_test);
+  ctdd_verify(watermark_decode_improved_view_test);
+  ctdd_verify(watermark_decode_batch_test);
+  ctdd_verify(watermark_extract_test);
+  ctdd_verify(watermark_decode_keyless_test);
+  ctdd_verify(registry_test);
   ctdd_verify(sequence_alignment_score_test);
   ctdd_verify(watermark2017_rs_3_bit_test);
 
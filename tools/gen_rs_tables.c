@@ -0,0 +1,153 @@
+// generates src/rs_api/rs_tables.c (run 'make rs_tables')
+//
+// for every supported symbol size, precompute the galois field log/antilog
+// tables and the generator polynomial for every possible number of roots,
+// so the codec used by 'rs_encode'/'rs_decode' is a pointer lookup instead
+// of being built at runtime
+#include <stdio.h>
+#include <stdint.h>
+
+#define MIN_SYMSIZE 2
+#define MAX_SYMSIZE 8
+#define VALUES_PER_LINE 16
+
+typedef struct GF_PARAMS {
+    int gfpoly;
+    int fcr;
+    int prim;
+} GF_PARAMS;
+
+// same parameters 'get_rs_struct' used to pick at runtime
+GF_PARAMS get_gf_params(int symsize) {
+
+    GF_PARAMS params;
+    switch(symsize) {
+        case 5:
+            params.gfpoly = 0x5;
+            params.fcr = 1;
+            params.prim = 1;
+            break;
+        case 8:
+            params.gfpoly = 0x187;
+            params.fcr = 0;
+            params.prim = 1;
+            break;
+        default:
+            params.gfpoly = 0x3;
+            params.fcr = 1;
+            params.prim = 1;
+            break;
+    }
+    return params;
+}
+
+int modnn(int x, int symsize, int nn) {
+
+    while(x >= nn) {
+        x -= nn;
+        x = (x >> symsize) + (x & nn);
+    }
+    return x;
+}
+
+// not const: 'struct rs_control' points to its tables as 'uint16_t*', and only reaches
+// them through the const codecs below
+void print_array(const char* name, uint16_t* arr, int len) {
+
+    printf("static uint16_t %s[%d] = {", name, len);
+    for(int i = 0; i < len; i++) {
+        if(!(i % VALUES_PER_LINE)) printf("\n    ");
+        printf("%u%s", arr[i], i != len - 1 ? ", " : "");
+    }
+    printf("\n};\n");
+}
+
+int main(void) {
+
+    printf("// generated by tools/gen_rs_tables.c ('make rs_tables'), do not edit\n");
+    printf("#include \"rs_api/rs_tables.h\"\n\n");
+
+    for(int symsize = MIN_SYMSIZE; symsize <= MAX_SYMSIZE; symsize++) {
+
+        GF_PARAMS params = get_gf_params(symsize);
+        int nn = (1 << symsize) - 1;
+        uint16_t alpha_to[nn + 1];
+        uint16_t index_of[nn + 1];
+        char name[64];
+
+        // generate galois field lookup tables
+        index_of[0] = nn;
+        alpha_to[nn] = 0;
+        int sr = 1;
+        for(int i = 0; i < nn; i++) {
+            index_of[sr] = i;
+            alpha_to[i] = sr;
+            sr <<= 1;
+            if(sr & (1 << symsize)) sr ^= params.gfpoly;
+            sr &= nn;
+        }
+        if(sr != 1) {
+            fprintf(stderr, "gen_rs_tables: polynomial 0x%x is not primitive for symbol size %d\n", params.gfpoly, symsize);
+            return 1;
+        }
+
+        int iprim;
+        for(iprim = 1; (iprim % params.prim) != 0; iprim += nn);
+        iprim /= params.prim;
+
+        printf("// symbol size %d\n", symsize);
+        sprintf(name, "alpha_to_%d", symsize);
+        print_array(name, alpha_to, nn + 1);
+        sprintf(name, "index_of_%d", symsize);
+        print_array(name, index_of, nn + 1);
+
+        // one generator polynomial per number of roots (a codeword must keep
+        // at least one data symbol, so nroots < nn)
+        for(int nroots = 0; nroots < nn; nroots++) {
+
+            uint16_t genpoly[nroots + 1];
+            genpoly[0] = 1;
+            for(int i = 0, root = params.fcr * params.prim; i < nroots; i++, root += params.prim) {
+                genpoly[i + 1] = 1;
+                for(int j = i; j > 0; j--) {
+                    if(genpoly[j] != 0) {
+                        genpoly[j] = genpoly[j - 1] ^ alpha_to[modnn(index_of[genpoly[j]] + root, symsize, nn)];
+                    } else {
+                        genpoly[j] = genpoly[j - 1];
+                    }
+                }
+                genpoly[0] = alpha_to[modnn(index_of[genpoly[0]] + root, symsize, nn)];
+            }
+            // index form, for quicker encoding
+            for(int i = 0; i <= nroots; i++) genpoly[i] = index_of[genpoly[i]];
+
+            sprintf(name, "genpoly_%d_%d", symsize, nroots);
+            print_array(name, genpoly, nroots + 1);
+        }
+
+        printf("static const struct rs_control rs_codecs_%d[%d] = {\n", symsize, nn);
+        for(int nroots = 0; nroots < nn; nroots++) {
+            printf("    { .mm = %d, .nn = %d, .alpha_to = alpha_to_%d, .index_of = index_of_%d, "
+                    ".genpoly = genpoly_%d_%d, .nroots = %d, .fcr = %d, .prim = %d, .iprim = %d, .gfpoly = %d },\n",
+                    symsize, nn, symsize, symsize, symsize, nroots, nroots, params.fcr, params.prim, iprim, params.gfpoly);
+        }
+        printf("};\n\n");
+    }
+
+    printf("static const struct rs_control* const rs_codecs[RS_TABLES_MAX_SYMSIZE + 1] = {\n");
+    for(int symsize = 0; symsize <= MAX_SYMSIZE; symsize++) {
+        if(symsize < MIN_SYMSIZE) {
+            printf("    NULL,\n");
+        } else {
+            printf("    rs_codecs_%d,\n", symsize);
+        }
+    }
+    printf("};\n\n");
+
+    printf("const struct rs_control* rs_tables_get(int symsize, int nroots) {\n\n");
+    printf("    if(symsize < RS_TABLES_MIN_SYMSIZE || symsize > RS_TABLES_MAX_SYMSIZE) return NULL;\n");
+    printf("    if(nroots < 0 || nroots >= (1 << symsize) - 1) return NULL;\n");
+    printf("    return &rs_codecs[symsize][nroots];\n");
+    printf("}\n");
+    return 0;
+}
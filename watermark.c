@@ -1,11 +1,16 @@
 #include "decoder/decoder.h"
 #include "encoder/encoder.h"
+#include "encoder/encode_table.h"
+#include "decoder/extract.h"
 #include "code_generation/code_generation.h"
 #include "graph/graph.h"
 #include "sequence_alignment/sequence_alignment.h"
 #include "dijkstra/dijkstra.h"
 #include <dirent.h>
+#include <sys/stat.h>
 #include <math.h>
+#include <errno.h>
+#include <stddef.h>
 
 #if defined(_OPENMP)
   #include <omp.h>
@@ -20,6 +25,33 @@
 
 #define SIZE_PERCENTAGE 0.8
 
+// number of keys prepared (and RS encoded) together in the removal attack
+#define ATTACK_BLOCK_SIZE (16 * RS_BATCH_LANES)
+// fewest combinations of removed edges a key is split into when a thread is idle
+#define ATTACK_MIN_RANGE 64
+// size of a cache line, per-thread histograms of the attack are kept this far apart
+#define ATTACK_CACHE_LINE 64
+
+// worst case of every key attacked, by number of bits (see 'write_to_report_matrix')
+#define REPORT_MATRIX_FILE "tests/report_matrix.plt"
+// first word of report matrices that carry a REPORT_HEADER
+#define REPORT_MAGIC 0x31747270726d7477UL
+// error distribution of every key attacked (see 'write_to_report_distribution')
+#define REPORT_DISTRIBUTION_FILE "tests/report_distribution.plt"
+// confidence intervals of the sampled attack (see 'write_to_report_intervals')
+#define REPORT_INTERVALS_FILE "tests/report_intervals.plt"
+// z of the confidence intervals of the sampled attack (95%)
+#define ATTACK_SAMPLING_Z 1.96
+// results each thread of the sampled attack remembers (a power of 2)
+#define ATTACK_CACHE_SIZE (1 << 16)
+// progress of the exhaustive attack, saved at least this often
+#define ATTACK_JOURNAL_FILE "tests/attack_journal.bin"
+#define ATTACK_CHECKPOINT_SECONDS 60
+
+// precomputed graphs used by the removal attack, if present (see option 13)
+#define ENCODE_TABLE_DIR "tables"
+#define ENCODE_TABLE_FILE ENCODE_TABLE_DIR "/encode_%lu.bin"
+
 #define MATCH 1
 #define MISMATCH -2
 #define GAP -1
@@ -39,6 +71,36 @@ typedef struct CONN_ARR {
   CONNECTION** arr;
 } CONN_ARR;
 
+// how the keys of a report matrix were picked
+typedef enum REPORT_KIND {
+    REPORT_EXHAUSTIVE,
+    REPORT_SAMPLED
+} REPORT_KIND;
+
+// keys a report matrix covers, as in 'ATTACK_SHARD'. A 'count' of 0 is a sum of shards
+typedef struct REPORT_SHARD {
+    unsigned long index;
+    unsigned long count;
+    unsigned long first_key;
+    unsigned long last_key;
+} REPORT_SHARD;
+
+// attack a report matrix came from, shards of an attack can only be merged if their
+// headers are the same up to 'shard', and their keys don't overlap
+typedef struct REPORT_HEADER {
+    unsigned long method;
+    unsigned long n_removals;
+    unsigned long symsize;
+    unsigned long n_parity_symbols;
+    unsigned long n_rows;
+    unsigned long n_columns;
+    // REPORT_KIND
+    unsigned long kind;
+    REPORT_SHARD shard;
+} REPORT_HEADER;
+
+#define REPORT_HEADER_WORDS (sizeof(REPORT_HEADER) / sizeof(unsigned long))
+
 typedef struct STATISTICS {
     unsigned long total;
     unsigned long errors;
@@ -47,12 +109,30 @@ typedef struct STATISTICS {
 
 unsigned long get_upper_bound(unsigned long n_bits) {
 
-    return 1 << (n_bits);
+    return 1UL << (n_bits);
 }
 
 unsigned long get_lower_bound(unsigned long n_bits) {
 
-    return 1 << (n_bits-1);
+    return 1UL << (n_bits-1);
+}
+
+// keys of 'current_n_bits' bits (symbols with RS) the shard attacks, in [lower_bound, upper_bound)
+void get_shard_bounds(METHOD method, unsigned long symsize, unsigned long current_n_bits, REPORT_SHARD* shard, unsigned long* lower_bound, unsigned long* upper_bound) {
+
+    *lower_bound = get_lower_bound(current_n_bits);
+    *upper_bound = get_upper_bound(current_n_bits);
+    if(method == IMPROVED_WITH_RS) {
+      *lower_bound = 1UL << ((current_n_bits-1) * symsize);
+      *upper_bound = 1UL << (current_n_bits * symsize);
+    }
+    unsigned long n = *upper_bound - *lower_bound;
+    unsigned long extra = n % shard->count;
+    *lower_bound += n / shard->count * shard->index + (shard->index < extra ? shard->index : extra);
+    *upper_bound = *lower_bound + n / shard->count + (shard->index < extra);
+    if(*lower_bound < shard->first_key) *lower_bound = shard->first_key;
+    if(*upper_bound > shard->last_key) *upper_bound = shard->last_key;
+    if(*lower_bound > *upper_bound) *lower_bound = *upper_bound;
 }
 
 unsigned long get_upper_bound_for_symbol(unsigned long n_symbols) {
@@ -73,12 +153,41 @@ unsigned long invert_unsigned_long(unsigned long n) {
     return n;
 }
 
+// NULL if there is no report. Reports written before the header only have its size,
+// the rest of the header is set to ULONG_MAX
+unsigned long* read_report_matrix(const char* filename, REPORT_HEADER* header) {
+
+    FILE* file = fopen(filename, "rb");
+    if(!file) return NULL;
+    unsigned long first;
+    uint8_t ok = fread(&first, sizeof(unsigned long), 1, file) == 1;
+    if(ok && first == REPORT_MAGIC) {
+        ok = fread(header, sizeof(unsigned long), REPORT_HEADER_WORDS, file) == REPORT_HEADER_WORDS;
+    } else if(ok) {
+        header->method = header->n_removals = header->symsize = header->n_parity_symbols = header->kind = ULONG_MAX;
+        header->shard = (REPORT_SHARD){ .index = 0, .count = 0, .first_key = 0, .last_key = 0 };
+        header->n_rows = first;
+        ok = fread(&header->n_columns, sizeof(unsigned long), 1, file) == 1;
+    }
+    unsigned long* matrix = NULL;
+    if(ok) {
+        matrix = malloc((header->n_rows * header->n_columns + 1) * sizeof(unsigned long));
+        if(fread(matrix, sizeof(unsigned long), header->n_rows * header->n_columns, file) != header->n_rows * header->n_columns) {
+            free(matrix);
+            matrix = NULL;
+        }
+    }
+    fclose(file);
+    return matrix;
+}
+
 void show_report_matrix(void) {
 
-    FILE* file = fopen("tests/report_matrix.plt", "rb");
-    unsigned long n_rows, n_columns;
-    fread(&n_rows, sizeof(unsigned long), 1, file);
-    fread(&n_columns, sizeof(unsigned long), 1, file);
+    REPORT_HEADER header;
+    unsigned long* matrix = read_report_matrix(REPORT_MATRIX_FILE, &header);
+    if(!matrix) return;
+    unsigned long n_rows = header.n_rows;
+    unsigned long n_columns = header.n_columns;
 
     unsigned long totals[n_rows];
     memset(totals, 0x00, sizeof(totals));
@@ -96,8 +205,7 @@ void show_report_matrix(void) {
         printf("%-5lu & ", i);
         for(unsigned long j = 0; j < n_columns; j++) {
 
-            unsigned long n;
-            fread(&n, sizeof(unsigned long), 1, file);
+            unsigned long n = matrix[i * n_columns + j];
             totals[j]+=n;
             printf("%-5lu", n);
             if(j != n_columns-1) printf(" & ");
@@ -113,15 +221,170 @@ void show_report_matrix(void) {
         }
     }
     printf("\\\\ \\hline\n");
+    free(matrix);
+}
+
+void write_to_report_matrix(const char* filename, REPORT_HEADER* header, unsigned long* matrix) {
+
+    FILE* file = fopen(filename, "wb");
+    if(!file) return;
+    unsigned long magic = REPORT_MAGIC;
+    fwrite(&magic, sizeof(unsigned long), 1, file);
+    fwrite(header, sizeof(unsigned long), REPORT_HEADER_WORDS, file);
+    fwrite(matrix, sizeof(unsigned long), header->n_rows * header->n_columns, file);
     fclose(file);
 }
 
-void write_to_report_matrix(unsigned long* matrix, unsigned long n_rows, unsigned long n_columns) {
+// 1 if shards 'a' and 'b' of the attack of 'header' attack any key in common
+uint8_t report_shards_overlap(REPORT_HEADER* header, REPORT_SHARD* a, REPORT_SHARD* b) {
+
+    unsigned long n_lengths = header->method == IMPROVED_WITH_RS ? header->n_columns / header->symsize : header->n_columns;
+    for(unsigned long current_n_bits = 1; current_n_bits <= n_lengths; current_n_bits++) {
+        unsigned long a_lower, a_upper, b_lower, b_upper;
+        get_shard_bounds(header->method, header->symsize, current_n_bits, a, &a_lower, &a_upper);
+        get_shard_bounds(header->method, header->symsize, current_n_bits, b, &b_lower, &b_upper);
+        if(a_lower < b_upper && b_lower < a_upper) return 1;
+    }
+    return 0;
+}
+
+// sum the report matrices of the shards of an attack into 'filename', returns 0 (and
+// writes nothing) if a report is missing, comes from a different attack, is already a
+// sum, or has keys of another shard
+uint8_t merge_report_matrices(const char* filename, char** shard_files, unsigned long num_shards) {
+
+    REPORT_HEADER header;
+    unsigned long* matrix = NULL;
+    REPORT_SHARD shards[num_shards + 1];
+    for(unsigned long i = 0; i < num_shards; i++) {
+        REPORT_HEADER shard_header;
+        unsigned long* shard = read_report_matrix(shard_files[i], &shard_header);
+        if(!shard) {
+            fprintf(stderr, "%s: no report matrix\n", shard_files[i]);
+            free(matrix);
+            return 0;
+        }
+        const char* error = NULL;
+        if(shard_header.method == ULONG_MAX || (matrix && memcmp(&header, &shard_header, offsetof(REPORT_HEADER, shard)))) {
+            error = "report matrix of a different attack";
+        } else if(!shard_header.shard.count || shard_header.shard.index >= shard_header.shard.count) {
+            error = "report matrix of a sum of shards";
+        }
+        for(unsigned long j = 0; !error && j < i; j++) {
+            if(!memcmp(&shards[j], &shard_header.shard, sizeof(REPORT_SHARD))) error = "same shard as a previous report matrix";
+            else if(report_shards_overlap(&shard_header, &shards[j], &shard_header.shard)) error = "keys overlap a previous report matrix";
+        }
+        if(error) {
+            fprintf(stderr, "%s: %s\n", shard_files[i], error);
+            free(shard);
+            free(matrix);
+            return 0;
+        }
+        shards[i] = shard_header.shard;
+        if(!matrix) {
+            header = shard_header;
+            matrix = shard;
+            continue;
+        }
+        for(unsigned long j = 0; j < header.n_rows * header.n_columns; j++) matrix[j] += shard[j];
+        free(shard);
+    }
+    if(!matrix) return 0;
+    header.shard = (REPORT_SHARD){ .index = 0, .count = 0, .first_key = 0, .last_key = 0 };
+    write_to_report_matrix(filename, &header, matrix);
+    free(matrix);
+    return 1;
+}
+
+// starts with how many counters each key has, then each key as its number of bits,
+// the key and how many combinations of removed edges lost 0, 1, 2... bits
+FILE* create_report_distribution(const char* filename, unsigned long num_errors) {
+
+    FILE* file = fopen(filename, "wb");
+    if(file) fwrite(&num_errors, sizeof(unsigned long), 1, file);
+    return file;
+}
+
+// keep the first 'offset' bytes of the report and write after them
+FILE* open_report_distribution(const char* filename, long offset) {
+
+    FILE* file = fopen(filename, "r+b");
+    if(file && fseek(file, offset, SEEK_SET)) {
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+void write_to_report_distribution(FILE* file, unsigned long n_bits, unsigned long first_key, unsigned long n_keys, unsigned long* distributions, unsigned long num_errors) {
+
+    if(!file) return;
+    for(unsigned long k = 0; k < n_keys; k++) {
+        unsigned long key = first_key + k;
+        fwrite(&n_bits, sizeof(unsigned long), 1, file);
+        fwrite(&key, sizeof(unsigned long), 1, file);
+        fwrite(distributions + k * num_errors, sizeof(unsigned long), num_errors, file);
+    }
+}
+
+// Wilson score interval of a proportion
+void get_confidence_interval(unsigned long successes, unsigned long n, double* low, double* high) {
+
+    double z2 = ATTACK_SAMPLING_Z * ATTACK_SAMPLING_Z;
+    double p = successes / (double)n;
+    double center = (p + z2 / (2 * n)) / (1 + z2 / n);
+    double half = ATTACK_SAMPLING_Z * sqrt(p * (1 - p) / n + z2 / (4.0 * n * n)) / (1 + z2 / n);
+    *low = center - half < 0 ? 0 : center - half;
+    *high = center + half > 1 ? 1 : center + half;
+}
 
-    FILE* file = fopen("tests/report_matrix.plt", "wb");
+// number of rows and columns, then the estimate, lowest and highest value of every cell
+void write_to_report_intervals(unsigned long* matrix, unsigned long* num_samples, unsigned long n_rows, unsigned long n_columns) {
+
+    FILE* file = fopen(REPORT_INTERVALS_FILE, "wb");
+    if(!file) return;
     fwrite(&n_rows, sizeof(unsigned long), 1, file);
     fwrite(&n_columns, sizeof(unsigned long), 1, file);
-    fwrite(matrix, sizeof(unsigned long), n_rows * n_columns, file);
+    for(unsigned long i = 0; i < n_rows; i++) {
+        for(unsigned long j = 0; j < n_columns; j++) {
+            double cell[3] = {0, 0, 1};
+            if(num_samples[j]) {
+                cell[0] = matrix[i * n_columns + j] / (double)num_samples[j];
+                get_confidence_interval(matrix[i * n_columns + j], num_samples[j], &cell[1], &cell[2]);
+            }
+            fwrite(cell, sizeof(double), 3, file);
+        }
+    }
+    fclose(file);
+}
+
+void show_report_intervals(void) {
+
+    FILE* file = fopen(REPORT_INTERVALS_FILE, "rb");
+    if(!file) return;
+    unsigned long n_rows, n_columns;
+    fread(&n_rows, sizeof(unsigned long), 1, file);
+    fread(&n_columns, sizeof(unsigned long), 1, file);
+
+    printf("lost bits\\bits in key\n");
+    printf("        ");
+    for(unsigned long i = 0; i < n_columns; i++) {
+        printf("%-20lu", i+1);
+        if( i != n_columns-1) printf(" & ");
+    }
+    printf("\n");
+    for(unsigned long i = 0; i < n_rows; i++) {
+
+        printf("%-5lu & ", i);
+        for(unsigned long j = 0; j < n_columns; j++) {
+
+            double cell[3];
+            fread(cell, sizeof(double), 3, file);
+            printf("%.3F [%.3F, %.3F]", cell[0], cell[1], cell[2]);
+            if(j != n_columns-1) printf(" & ");
+        }
+        printf("\\\\ \\hline\n");
+    }
     fclose(file);
 }
 
@@ -196,17 +459,32 @@ void conn_arr_free(CONN_ARR* arr) {
   free(arr);
 }
 
-typedef enum METHOD {
-  ORIGINAL,
-  IMPROVED,
-  IMPROVED_WITH_RS
-} METHOD;
+// errors of the graphs a thread already decoded, by the hash of the key and of the
+// edges left after the removal (see 'attack_hash_edge')
+typedef struct ATTACK_CACHE_ENTRY {
+  uint64_t hash[2];
+  unsigned long errors;
+} ATTACK_CACHE_ENTRY;
+
+typedef struct ATTACK_CACHE {
+  ATTACK_CACHE_ENTRY* entries;
+  unsigned long num_lookups;
+  unsigned long num_hits;
+  // keeps the counters of two threads in different cache lines
+  uint8_t padding[ATTACK_CACHE_LINE];
+} ATTACK_CACHE;
 
 typedef struct ATTACK {
   METHOD method;
   void* identifier;
   unsigned long n_removals;
   GRAPH* graph;
+  // IMPROVED decodes 'graph' loaded here, removing edges from the view instead of a copy
+  WORKSPACE* ws;
+  // if set, results are looked up here before decoding, with 'hash' being the hash
+  // of the key and of every non hamiltonian edge of 'graph'
+  ATTACK_CACHE* cache;
+  uint64_t hash[2];
   unsigned long identifier_len;
   union {
     struct {
@@ -220,11 +498,51 @@ typedef struct ATTACK {
   } info;
 } ATTACK;
 
-unsigned long _test_with_removed_connections(
+// returns ULONG_MAX, with the view left as it was, for removals the view can't make (and,
+// in DEBUG, for results worth printing): those go through a copy of the graph
+unsigned long _test_view_with_removed_connections(
+        ATTACK* attack,
+        CONNECTION** conns,
+        unsigned long num_removals) {
+
+    WORKSPACE* ws = attack->ws;
+    unsigned long num_disconnected = 0;
+    for(; num_disconnected < num_removals; num_disconnected++) {
+      unsigned long from = conns[num_disconnected]->parent->graph_idx;
+      unsigned long to = conns[num_disconnected]->node->graph_idx;
+#ifdef DEBUG
+      // hamiltonian edges are reported by the graph copy
+      if(to > from && to != from + 2) break;
+#endif
+      if(!workspace_view_disconnect(ws, from, to)) break;
+    }
+
+    unsigned long errors = ULONG_MAX;
+    if(num_disconnected == num_removals) {
+      uint8_t result[ws->view_num_nodes / 8 + 1];
+      unsigned long num_bits = attack->identifier_len * 8;
+      unsigned long num_bytes;
+      watermark_decode_improved_view(ws, attack->identifier, &num_bits, result, &num_bytes);
+      errors = _check(result, attack->identifier, num_bytes, attack->identifier_len);
+#ifdef DEBUG
+      if(errors >= 2) errors = ULONG_MAX;
+#endif
+    }
+
+    for(unsigned long i = num_disconnected; i--;) {
+      workspace_view_connect(ws, conns[i]->parent->graph_idx, conns[i]->node->graph_idx);
+    }
+    return errors;
+}
+
+unsigned long _decode_with_removed_connections(
         ATTACK* attack,
         CONNECTION** conns,
         unsigned long num_removals) { // num_removals may be lower than requested, if there aren't enough edges
-    if(!conns) return 0;
+    if(attack->ws) {
+      unsigned long errors = _test_view_with_removed_connections(attack, conns, num_removals);
+      if(errors != ULONG_MAX) return errors;
+    }
 
 #ifdef DEBUG
     uint8_t has_forward_removal = 0;
@@ -308,6 +626,43 @@ unsigned long _test_with_removed_connections(
     return errors;
 }
 
+// hashes of an edge, the hash of a set of edges is the sum of theirs, so the edges left
+// after a removal are hashed by subtracting the removed ones
+void attack_hash_edge(CONNECTION* conn, uint64_t hash[2]) {
+
+    // splitmix64 of the seed gives two unrelated words
+    RNG mix;
+    rng_seed(&mix, ((uint64_t)conn->parent->graph_idx << 32) | conn->node->graph_idx);
+    hash[0] = mix.s[0];
+    hash[1] = mix.s[1];
+}
+
+unsigned long _test_with_removed_connections(
+        ATTACK* attack,
+        CONNECTION** conns,
+        unsigned long num_removals) {
+    if(!conns) return 0;
+    if(!attack->cache) return _decode_with_removed_connections(attack, conns, num_removals);
+
+    uint64_t hash[2] = { attack->hash[0], attack->hash[1] };
+    for(unsigned long i = 0; i < num_removals; i++) {
+        uint64_t edge_hash[2];
+        attack_hash_edge(conns[i], edge_hash);
+        hash[0] -= edge_hash[0];
+        hash[1] -= edge_hash[1];
+    }
+    ATTACK_CACHE_ENTRY* entry = &attack->cache->entries[hash[0] & (ATTACK_CACHE_SIZE - 1)];
+    attack->cache->num_lookups++;
+    if(entry->hash[0] == hash[0] && entry->hash[1] == hash[1]) {
+        attack->cache->num_hits++;
+        return entry->errors;
+    }
+    entry->errors = _decode_with_removed_connections(attack, conns, num_removals);
+    entry->hash[0] = hash[0];
+    entry->hash[1] = hash[1];
+    return entry->errors;
+}
+
 CONN_ARR* get_list_of_non_hamiltonian_edges(GRAPH* graph) {
  
   CONN_ARR* arr = NULL;
@@ -328,72 +683,66 @@ CONN_ARR* get_list_of_non_hamiltonian_edges(GRAPH* graph) {
   return arr;
 }
 
-void** stack_combinations(void** comb1, unsigned long comb1len, void** comb2, unsigned long comb2len) {
-
-  unsigned long nrows = comb1len + comb2len;
-  void** combinations = calloc(nrows, sizeof(void*));
-  for(unsigned long i = 0; i < comb1len; i++) {
-    combinations[i] = comb1[i];
-  }
-  for(unsigned long i = comb1len; i < nrows; i++) {
-    combinations[i] = comb2[i - comb1len];
+unsigned long get_gcd(unsigned long a, unsigned long b) {
+  while(b) {
+    unsigned long r = a % b;
+    a = b;
+    b = r;
   }
-  free(comb1);
-  free(comb2);
-  return combinations;
+  return a;
 }
 
-void** get_list_of_combinations(void* arr, unsigned long* len, unsigned long element_size, unsigned long k) {
-  if(!arr || *len < k || !k) return NULL;
-  // for k = 1 is just every element in a different row
-  if(k == 1) {
-    void** combinations = malloc(sizeof(void*) * (*len));
-    for(unsigned long i = 0; i < *len; i++) {
-      combinations[i] = malloc(element_size);
-      memcpy(combinations[i], (uint8_t*)arr + (element_size * i), element_size);
-    }
-    return combinations;
-  }
-  unsigned long arr_len = *len;
-  void** combinations = NULL;
-  unsigned long combinations_len = 0;
-  for(unsigned long i = 0; i < arr_len; i++) {
-    unsigned long n_comb = *len - i - 1;
-    void** sub_combinations = get_list_of_combinations(((uint8_t*)arr) + (element_size * (i+1)), &n_comb, element_size, k-1);
-    if(!sub_combinations || !n_comb) continue;
-    // append current element to the sub_combinations (each row is in reverse order)
-    for(unsigned long j = 0; j < n_comb; j++) {
-      sub_combinations[j] = realloc(sub_combinations[j], element_size * k);
-      memcpy(((uint8_t*)sub_combinations[j]) + (element_size * (k-1)), ((uint8_t*)arr) + ( element_size * i), element_size);
-    }
-    // stack combinations
-    combinations = stack_combinations(combinations, combinations_len, sub_combinations, n_comb);
-    combinations_len += n_comb;
+// ULONG_MAX if there are more than that
+unsigned long get_number_of_combinations(unsigned long n, unsigned long k) {
+  if(k > n) return 0;
+  if(k > n - k) k = n - k;
+  unsigned long combinations = 1;
+  for(unsigned long i = 0; i < k; i++) {
+    // (i + 1) divides combinations * (n - i), divided beforehand so only a result
+    // that doesn't fit overflows
+    unsigned long g = get_gcd(combinations, i + 1);
+    if(__builtin_mul_overflow(combinations / g, (n - i) / ((i + 1) / g), &combinations)) return ULONG_MAX;
   }
-  *len = combinations_len;
   return combinations;
 }
 
-void remove_combinations(void** combinations, unsigned long len) {
-  for(unsigned long i = 0; i < len; i++) {
-    free(combinations[i]);
+// indexes (increasing) of the combination of 'k' out of 'n' elements that comes at
+// position 'rank' in lexicographic order
+void get_combination(unsigned long rank, unsigned long n, unsigned long k, unsigned long* idxs) {
+  unsigned long x = 0;
+  for(unsigned long i = 0; i < k; i++, x++) {
+    // skip every combination that has 'x' at position 'i'
+    for(unsigned long c; rank >= (c = get_number_of_combinations(n - x - 1, k - i - 1)); x++) rank -= c;
+    idxs[i] = x;
   }
-  free(combinations);
 }
 
-void _multiple_removal_test(
-    ATTACK* attack,
-    STATISTICS* statistics,
-    CONNECTION*** combinations,
-    unsigned long num_combinations,
-    unsigned long num_removals) {
+// indexes (increasing) of 'k' out of 'n' elements picked with 'rng', every combination
+// being as likely (a partial Fisher-Yates shuffle, so it works for any 'n' and 'k')
+void get_random_combination(RNG* rng, unsigned long n, unsigned long k, unsigned long* idxs) {
+  unsigned long shuffled[n + 1];
+  for(unsigned long i = 0; i < n; i++) shuffled[i] = i;
+  for(unsigned long i = 0; i < k; i++) {
+    unsigned long j = i + rng_below(rng, n - i);
+    unsigned long idx = shuffled[j];
+    shuffled[j] = shuffled[i];
+    // insertion sort, 'k' is small
+    unsigned long x = i;
+    for(; x && idxs[x - 1] > idx; x--) idxs[x] = idxs[x - 1];
+    idxs[x] = idx;
+  }
+}
 
-  // iterate through combinations and attack from them
-  for(unsigned long i = 0; i < num_combinations; i++) {
-    statistics->errors = _test_with_removed_connections(attack, combinations[i], num_removals);
-  statistics->total++;
-    if(statistics->errors > statistics->worst_case) statistics->worst_case = statistics->errors;
+// move 'idxs' to the next combination, returns 0 if it was the last one
+uint8_t get_next_combination(unsigned long n, unsigned long k, unsigned long* idxs) {
+  for(unsigned long i = k; i--;) {
+    if(idxs[i] < n - k + i) {
+      idxs[i]++;
+      for(unsigned long j = i + 1; j < k; j++) idxs[j] = idxs[j-1] + 1;
+      return 1;
+    }
   }
+  return 0;
 }
 
 unsigned long fac(unsigned long n) {
@@ -401,18 +750,6 @@ unsigned long fac(unsigned long n) {
   return n * fac(n-1);
 }
 
-void multiple_removal_test(ATTACK* attack, STATISTICS* statistics) {
-    CONN_ARR* arr = get_list_of_non_hamiltonian_edges(attack->graph);
-    // no edges no errors
-    if(!arr) return;
-    unsigned long combinations_len = arr->len;
-    unsigned long num_removals = MIN(arr->len, attack->n_removals);
-    CONNECTION*** combinations = (CONNECTION***)get_list_of_combinations(arr->arr, &combinations_len, sizeof(CONNECTION*), num_removals);
-    _multiple_removal_test(attack, statistics, combinations, combinations_len, num_removals);
-    conn_arr_free(arr);
-    remove_combinations((void**)combinations, combinations_len);
-}
-
 uint8_t key_is_non_zero(unsigned long key, unsigned long n_data_symbols, unsigned long symsize) {
   unsigned long n_bits = n_data_symbols * symsize;
   for(unsigned long i = 0; i < n_bits; i++) {
@@ -439,97 +776,872 @@ void get_key_from_k(unsigned long** k, unsigned long symsize, unsigned long num_
   // show_bits((void*)*k, data_bits );
 }
 
-void attack(METHOD method, unsigned long n_removal, unsigned long n_bits, unsigned long n_parity_symbols, unsigned long symsize) {
+// part of the keys of a removal attack, for attacks split among processes whose
+// report matrices are then merged (see 'merge_report_matrices')
+typedef struct ATTACK_SHARD {
+  // the keys of every number of bits are split in 'count' ranges, this is range 'index'
+  unsigned long index;
+  unsigned long count;
+  // and only keys in [first_key, last_key) of it are attacked
+  unsigned long first_key;
+  unsigned long last_key;
+  // report matrix of the shard, its distribution report and journal are named after
+  // it (NULL for the default ones)
+  const char* report_file;
+} ATTACK_SHARD;
+
+// state shared by every task of the removal attack. The threads live through the
+// whole attack, the keys of a block are tasks, and the combinations of removed edges
+// of a key are split in ranges (new tasks) whenever a thread would be idle
+typedef struct ATTACK_POOL {
+  METHOD method;
+  unsigned long n_removals;
+  unsigned long n_parity_symbols;
+  unsigned long symsize;
+  unsigned long num_threads;
+  // scratch space to encode graphs, one per thread
+  WORKSPACE** thread_ws;
+  // tasks waiting for a thread, and tasks running
+  unsigned long num_queued;
+  unsigned long num_running;
+  // keys being attacked, in [lower_bound, upper_bound)
+  unsigned long current_n_bits;
+  unsigned long lower_bound;
+  unsigned long upper_bound;
+  unsigned long block;
+  unsigned long* identifiers;
+  // keys as they are encoded (with RS parity, if any)
+  uint8_t* encoded_keys;
+  unsigned long encoded_len;
+  unsigned long encoded_n_bits;
+  ENCODE_TABLE* table;
+  // errors of every combination of removed edges of each key of the block,
+  // 'num_errors' counters per key
+  unsigned long* distributions;
+  // worst cases of the keys of the current number of bits, one histogram per thread,
+  // 'histogram_stride' counters apart so no two threads write to the same cache line
+  unsigned long* histograms;
+  unsigned long histogram_stride;
+  // one per thread, only for the sampled attack
+  ATTACK_CACHE* caches;
+  // rows of the matrix, 0 to 'matrix_size' lost bits
+  unsigned long num_errors;
+  unsigned long* matrix;
+  unsigned long matrix_size;
+  ATTACK_SHARD shard;
+  char report_file[MAX_SIZE + 1];
+  char distribution_file[MAX_SIZE + 1];
+  char journal_file[MAX_SIZE + 1];
+} ATTACK_POOL;
+
+// a key being attacked, its ranges of combinations merge their statistics here
+typedef struct ATTACK_JOB {
+  ATTACK attack;
+  CONN_ARR* edges;
+  unsigned long num_removals;
+  STATISTICS statistics;
+  // slot of the key in 'ATTACK_POOL.distributions'
+  unsigned long* distribution;
+  // ranges not finished, the last one records the key in the matrix
+  unsigned long num_ranges;
+} ATTACK_JOB;
+
+void attack_spawn_range(ATTACK_POOL* pool, ATTACK_JOB* job, unsigned long begin, unsigned long end);
+
+void attack_record(ATTACK_POOL* pool, unsigned long worst_case) {
+
+  #if defined(_OPENMP)
+    unsigned long thread = omp_get_thread_num();
+  #else
+    unsigned long thread = 0;
+  #endif
+  pool->histograms[thread * pool->histogram_stride + worst_case]++;
+}
+
+// add the histograms of every thread to the column of the current number of bits
+void attack_merge_histograms(ATTACK_POOL* pool) {
+
+  for(unsigned long thread = 0; thread < pool->num_threads; thread++) {
+    unsigned long* histogram = pool->histograms + thread * pool->histogram_stride;
+    for(unsigned long i = 0; i < pool->num_errors; i++) {
+      pool->matrix[i * pool->matrix_size + pool->current_n_bits - 1] += histogram[i];
+      histogram[i] = 0;
+    }
+  }
+}
+
+uint8_t attack_has_idle_threads(ATTACK_POOL* pool) {
+
+  unsigned long num_queued, num_running;
+  #if defined(_OPENMP)
+    #pragma omp atomic read
+  #endif
+  num_queued = pool->num_queued;
+  #if defined(_OPENMP)
+    #pragma omp atomic read
+  #endif
+  num_running = pool->num_running;
+  return !num_queued && num_running < pool->num_threads;
+}
+
+// test the combinations in [begin, end) of a key, giving half of what is left to
+// another task whenever a thread has nothing to do
+void attack_run_range(ATTACK_POOL* pool, ATTACK_JOB* job, unsigned long begin, unsigned long end) {
+
+  ATTACK attack = job->attack;
+  if(attack.method == IMPROVED) {
+    attack.ws = workspace_create(attack.graph->num_nodes);
+    workspace_load_graph(attack.ws, attack.graph);
+  }
+  unsigned long n = job->edges->len;
+  unsigned long k = job->num_removals;
+  unsigned long idxs[k + 1];
+  CONNECTION* conns[k + 1];
+  get_combination(begin, n, k, idxs);
+
+  STATISTICS statistics = {0};
+  unsigned long distribution[pool->num_errors];
+  memset(distribution, 0x00, sizeof(distribution));
+  for(unsigned long i = begin; i < end; i++) {
+    if(end - i >= 2 * ATTACK_MIN_RANGE && attack_has_idle_threads(pool)) {
+      unsigned long middle = i + (end - i) / 2;
+      attack_spawn_range(pool, job, middle, end);
+      end = middle;
+    }
+    // edges of the combination are removed last to first
+    for(unsigned long j = 0; j < k; j++) conns[j] = job->edges->arr[idxs[k - 1 - j]];
+    statistics.errors = _test_with_removed_connections(&attack, conns, k);
+    if(statistics.errors >= pool->num_errors) statistics.errors = pool->num_errors - 1;
+    distribution[statistics.errors]++;
+    statistics.total++;
+    if(statistics.errors > statistics.worst_case) statistics.worst_case = statistics.errors;
+    get_next_combination(n, k, idxs);
+  }
+  workspace_free(attack.ws);
+
+  unsigned long num_ranges;
+  #if defined(_OPENMP)
+    #pragma omp critical(attack_job)
+  #endif
+  {
+    job->statistics.total += statistics.total;
+    for(unsigned long j = 0; j < pool->num_errors; j++) job->distribution[j] += distribution[j];
+    if(statistics.worst_case > job->statistics.worst_case) job->statistics.worst_case = statistics.worst_case;
+    num_ranges = --job->num_ranges;
+  }
+  if(num_ranges) return;
+
+  attack_record(pool, job->statistics.worst_case);
+  conn_arr_free(job->edges);
+  graph_free(job->attack.graph);
+  free(job);
+}
+
+// build the graph of the 'k'th key of the block and test every combination of its
+// removable edges
+void attack_run_key(ATTACK_POOL* pool, unsigned long k) {
+
+  #if defined(_OPENMP)
+    WORKSPACE* ws = pool->thread_ws[omp_get_thread_num()];
+  #else
+    WORKSPACE* ws = pool->thread_ws[0];
+  #endif
+  // each graph is seeded by its key, so every run (and thread count) gives the same graphs.
+  // Keys the table doesn't have are encoded again
+  GRAPH* graph = pool->table ? encode_table_get_graph(pool->table, pool->block + k, ws) : NULL;
+  if(!graph) {
+    RNG rng;
+    rng_seed(&rng, pool->block + k);
+    graph = watermark_encode_workspace(pool->encoded_keys + k * pool->encoded_len, pool->encoded_n_bits, &rng, ws);
+  }
+
+  ATTACK_JOB* job = calloc(1, sizeof(ATTACK_JOB));
+  job->distribution = pool->distributions + k * pool->num_errors;
+  job->attack.n_removals = pool->n_removals;
+  job->attack.graph = graph;
+  job->attack.identifier = &pool->identifiers[k];
+  job->attack.identifier_len = sizeof(unsigned long);
+  job->attack.method = pool->method;
+  if(pool->method == IMPROVED_WITH_RS) {
+    job->attack.info.rs.n_parity_symbols = pool->n_parity_symbols;
+    job->attack.info.rs.symsize = pool->symsize;
+    job->attack.info.rs.n_data_symbols = pool->current_n_bits;
+  } else {
+    job->attack.info.no_rs.n_bits = pool->current_n_bits;
+  }
+
+  job->edges = get_list_of_non_hamiltonian_edges(graph);
+  // no edges no errors
+  if(!job->edges) {
+    attack_record(pool, 0);
+    graph_free(graph);
+    free(job);
+    return;
+  }
+  job->num_removals = MIN(job->edges->len, pool->n_removals);
+  job->num_ranges = 1;
+  attack_run_range(pool, job, 0, get_number_of_combinations(job->edges->len, job->num_removals));
+}
+
+void attack_task_start(ATTACK_POOL* pool) {
+
+  #if defined(_OPENMP)
+    #pragma omp atomic
+  #endif
+  pool->num_queued--;
+  #if defined(_OPENMP)
+    #pragma omp atomic
+  #endif
+  pool->num_running++;
+}
+
+void attack_task_end(ATTACK_POOL* pool) {
+
+  #if defined(_OPENMP)
+    #pragma omp atomic
+  #endif
+  pool->num_running--;
+}
+
+void attack_spawn_range(ATTACK_POOL* pool, ATTACK_JOB* job, unsigned long begin, unsigned long end) {
+
+  // under the same critical section as the decrement in 'attack_run_range', atomics
+  // don't exclude critical sections
+  #if defined(_OPENMP)
+    #pragma omp critical(attack_job)
+  #endif
+  job->num_ranges++;
+  #if defined(_OPENMP)
+    #pragma omp atomic
+  #endif
+  pool->num_queued++;
+  #if defined(_OPENMP)
+    #pragma omp task firstprivate(pool, job, begin, end)
+  #endif
+  {
+    attack_task_start(pool);
+    attack_run_range(pool, job, begin, end);
+    attack_task_end(pool);
+  }
+}
+
+void attack_spawn_key(ATTACK_POOL* pool, unsigned long k) {
+
+  #if defined(_OPENMP)
+    #pragma omp atomic
+  #endif
+  pool->num_queued++;
+  #if defined(_OPENMP)
+    #pragma omp task firstprivate(pool, k)
+  #endif
+  {
+    attack_task_start(pool);
+    attack_run_key(pool, k);
+    attack_task_end(pool);
+  }
+}
+
+double get_seconds() {
+
+    #if defined(_OPENMP)
+      return omp_get_wtime();
+    #else
+      return clock() / (double) CLOCKS_PER_SEC;
+    #endif
+}
+
+// journal of the attack whose report matrix is 'report_file' (NULL for the default one)
+void get_attack_journal_file(const char* report_file, char journal_file[MAX_SIZE + 1]) {
+
+    if(report_file) {
+        snprintf(journal_file, MAX_SIZE + 1, "%s.journal", report_file);
+    } else {
+        strcpy(journal_file, ATTACK_JOURNAL_FILE);
+    }
+}
+
+void attack_pool_init(ATTACK_POOL* pool, METHOD method, unsigned long n_removal, unsigned long n_bits, unsigned long n_parity_symbols, unsigned long symsize, unsigned long num_threads, ATTACK_SHARD* shard) {
 
-    unsigned long matrix_size = method == IMPROVED_WITH_RS ? n_bits * symsize: n_bits;
-    unsigned long matrix[matrix_size][matrix_size];
-    memset(matrix, 0x00, sizeof(unsigned long) * matrix_size * matrix_size);
   #if defined(_OPENMP)
-    omp_set_num_threads(4);
-    printf("openmp is being used.\n");
+    // OMP_NUM_THREADS, or one per core
+    if(!num_threads) num_threads = omp_get_max_threads();
+    printf("openmp is being used (%lu threads).\n", num_threads);
   #else
+    num_threads = 1;
     printf("openmp is not being used.\n");
   #endif
 
-    unsigned long identifier_len = sizeof(unsigned long);
-    for(unsigned long current_n_bits = 1; current_n_bits <= n_bits; current_n_bits++) {
+    memset(pool, 0x00, sizeof(ATTACK_POOL));
+    pool->method = method;
+    pool->n_removals = n_removal;
+    pool->n_parity_symbols = n_parity_symbols;
+    pool->symsize = symsize;
+    pool->num_threads = num_threads;
+    pool->thread_ws = malloc(num_threads * sizeof(WORKSPACE*));
+    for(unsigned long i = 0; i < num_threads; i++) pool->thread_ws[i] = workspace_create(0);
+
+    pool->matrix_size = method == IMPROVED_WITH_RS ? n_bits * symsize: n_bits;
+    // a failed RS decoding loses every bit, hence the extra row
+    pool->num_errors = pool->matrix_size + 1;
+    pool->matrix = calloc(pool->num_errors * pool->matrix_size, sizeof(unsigned long));
+    pool->distributions = malloc(ATTACK_BLOCK_SIZE * pool->num_errors * sizeof(unsigned long));
+    // rounded up to whole cache lines, plus one as 'calloc' doesn't align to them
+    pool->histogram_stride = (pool->num_errors / (ATTACK_CACHE_LINE / sizeof(unsigned long)) + 2) * (ATTACK_CACHE_LINE / sizeof(unsigned long));
+    pool->histograms = calloc(num_threads * pool->histogram_stride, sizeof(unsigned long));
+
+    ATTACK_SHARD all_keys = { .index = 0, .count = 1, .first_key = 0, .last_key = ULONG_MAX, .report_file = NULL };
+    pool->shard = shard ? *shard : all_keys;
+    if(pool->shard.report_file) {
+        snprintf(pool->report_file, sizeof(pool->report_file), "%s", pool->shard.report_file);
+        snprintf(pool->distribution_file, sizeof(pool->distribution_file), "%s.distribution", pool->shard.report_file);
+    } else {
+        strcpy(pool->report_file, REPORT_MATRIX_FILE);
+        strcpy(pool->distribution_file, REPORT_DISTRIBUTION_FILE);
+    }
+    get_attack_journal_file(pool->shard.report_file, pool->journal_file);
+}
+
+REPORT_SHARD attack_get_report_shard(ATTACK_POOL* pool) {
+
+    REPORT_SHARD shard = {
+      .index = pool->shard.index,
+      .count = pool->shard.count,
+      .first_key = pool->shard.first_key,
+      .last_key = pool->shard.last_key
+    };
+    return shard;
+}
+
+void attack_pool_write_report(ATTACK_POOL* pool, REPORT_KIND kind) {
+
+    REPORT_HEADER header = {
+      .method = pool->method,
+      .n_removals = pool->n_removals,
+      .symsize = pool->symsize,
+      .n_parity_symbols = pool->n_parity_symbols,
+      .n_rows = pool->num_errors,
+      .n_columns = pool->matrix_size,
+      .kind = kind,
+      .shard = attack_get_report_shard(pool)
+    };
+    write_to_report_matrix(pool->report_file, &header, pool->matrix);
+}
+
+void attack_pool_free(ATTACK_POOL* pool) {
+
+    for(unsigned long i = 0; i < pool->num_threads; i++) workspace_free(pool->thread_ws[i]);
+    free(pool->thread_ws);
+    free(pool->histograms);
+    free(pool->distributions);
+    free(pool->matrix);
+    if(pool->caches) {
+      for(unsigned long i = 0; i < pool->num_threads; i++) free(pool->caches[i].entries);
+      free(pool->caches);
+    }
+}
+
+// get the keys of 'current_n_bits' bits (symbols with RS) and, without RS, their
+// precomputed graphs (if there is a table for them)
+void attack_pool_start(ATTACK_POOL* pool, unsigned long current_n_bits) {
+
+    pool->current_n_bits = current_n_bits;
+    // keys of this shard
+    REPORT_SHARD shard = attack_get_report_shard(pool);
+    get_shard_bounds(pool->method, pool->symsize, current_n_bits, &shard, &pool->lower_bound, &pool->upper_bound);
+    fprintf(stderr,"lower bound: %lu, upper bound: %lu\n", pool->lower_bound, pool->upper_bound);
+
+    // graphs without RS can come from a precomputed table instead of being encoded again
+    pool->table = NULL;
+    if(pool->method != IMPROVED_WITH_RS) {
+        char filename[sizeof(ENCODE_TABLE_FILE) + 20];
+        sprintf(filename, ENCODE_TABLE_FILE, current_n_bits);
+        pool->table = encode_table_load(filename);
+        // a table built for another bit length (or with a seed) doesn't have these graphs
+        if(pool->table && (pool->table->header->seed || pool->table->header->n_bits != current_n_bits)) {
+            encode_table_free(pool->table);
+            pool->table = NULL;
+        }
+    }
+}
+
+void attack_pool_end(ATTACK_POOL* pool) {
+
+    encode_table_free(pool->table);
+    pool->table = NULL;
+    attack_merge_histograms(pool);
+}
+
+// identifier the attack encodes for key 'k'
+unsigned long attack_get_identifier(ATTACK_POOL* pool, unsigned long k) {
+
+    if(pool->method != IMPROVED_WITH_RS) return invert_unsigned_long(k);
+
+    unsigned long* identifier = malloc(sizeof(unsigned long));
+    *identifier = k;
+    get_key_from_k(&identifier, pool->symsize, pool->current_n_bits);
+    // the key may have been shrunk, only its data bits are there
+    unsigned long result = 0;
+    memcpy(&result, identifier, (pool->current_n_bits * pool->symsize) / 8 + !!((pool->current_n_bits * pool->symsize) % 8));
+    free(identifier);
+    return result;
+}
+
+// progress of an exhaustive removal attack, so it can be resumed (see option 17)
+typedef struct ATTACK_JOURNAL {
+  unsigned long method;
+  unsigned long n_removal;
+  unsigned long n_bits;
+  unsigned long n_parity_symbols;
+  unsigned long symsize;
+  unsigned long shard_index;
+  unsigned long shard_count;
+  unsigned long first_key;
+  unsigned long last_key;
+  // number of bits being attacked, and first key of it not attacked yet (0 if none was)
+  unsigned long current_n_bits;
+  unsigned long next_block;
+  // size of the error distribution report so far
+  long distribution_offset;
+  // 'matrix_size' + 1 rows of 'matrix_size' counters
+  unsigned long matrix_size;
+  unsigned long* matrix;
+} ATTACK_JOURNAL;
+
+ATTACK_JOURNAL* read_attack_journal(const char* filename) {
+
+    FILE* file = fopen(filename, "rb");
+    if(!file) return NULL;
+    ATTACK_JOURNAL* journal = calloc(1, sizeof(ATTACK_JOURNAL));
+    unsigned long header[13];
+    if(fread(header, sizeof(unsigned long), 13, file) != 13) {
+        fclose(file);
+        free(journal);
+        return NULL;
+    }
+    journal->method = header[0];
+    journal->n_removal = header[1];
+    journal->n_bits = header[2];
+    journal->n_parity_symbols = header[3];
+    journal->symsize = header[4];
+    journal->shard_index = header[5];
+    journal->shard_count = header[6];
+    journal->first_key = header[7];
+    journal->last_key = header[8];
+    journal->current_n_bits = header[9];
+    journal->next_block = header[10];
+    journal->distribution_offset = header[11];
+    journal->matrix_size = header[12];
+    unsigned long matrix_len = (journal->matrix_size + 1) * journal->matrix_size;
+    journal->matrix = malloc(matrix_len * sizeof(unsigned long));
+    unsigned long n = fread(journal->matrix, sizeof(unsigned long), matrix_len, file);
+    fclose(file);
+    if(n != matrix_len) {
+        free(journal->matrix);
+        free(journal);
+        return NULL;
+    }
+    return journal;
+}
+
+void free_attack_journal(ATTACK_JOURNAL* journal) {
+
+    if(!journal) return;
+    free(journal->matrix);
+    free(journal);
+}
+
+// everything before key 'next_block' of 'current_n_bits' bits is done. The journal is
+// written to a temporary file and renamed over the previous one, so a crash leaves
+// either of them whole
+void write_attack_journal(ATTACK_POOL* pool, unsigned long n_bits, unsigned long current_n_bits, unsigned long next_block, FILE* distribution_file) {
+
+    long distribution_offset = 0;
+    if(distribution_file) {
+        fflush(distribution_file);
+        distribution_offset = ftell(distribution_file);
+    }
+
+    char tmp_file[MAX_SIZE + 5];
+    sprintf(tmp_file, "%s.tmp", pool->journal_file);
+    FILE* file = fopen(tmp_file, "wb");
+    if(!file) return;
+    unsigned long header[13] = { pool->method, pool->n_removals, n_bits, pool->n_parity_symbols, pool->symsize,
+        pool->shard.index, pool->shard.count, pool->shard.first_key, pool->shard.last_key,
+        current_n_bits, next_block, distribution_offset, pool->matrix_size };
+    fwrite(header, sizeof(unsigned long), 13, file);
+    // the keys of the current number of bits are still in the histograms of the threads
+    for(unsigned long i = 0; i < pool->num_errors; i++) {
+        unsigned long row[pool->matrix_size];
+        memcpy(row, pool->matrix + i * pool->matrix_size, sizeof(row));
+        for(unsigned long thread = 0; thread < pool->num_threads; thread++) {
+            row[pool->current_n_bits - 1] += pool->histograms[thread * pool->histogram_stride + i];
+        }
+        fwrite(row, sizeof(unsigned long), pool->matrix_size, file);
+    }
+    uint8_t failed = ferror(file);
+    if(fclose(file) || failed || rename(tmp_file, pool->journal_file)) {
+        fprintf(stderr, "couldn't write %s\n", pool->journal_file);
+    }
+}
+
+// only the keys of 'shard' are attacked, if given. 'journal', if given, has the work of
+// a previous run of the same attack
+void attack(METHOD method, unsigned long n_removal, unsigned long n_bits, unsigned long n_parity_symbols, unsigned long symsize, unsigned long num_threads, ATTACK_SHARD* shard, ATTACK_JOURNAL* journal) {
+
+    ATTACK_POOL pool;
+    attack_pool_init(&pool, method, n_removal, n_bits, n_parity_symbols, symsize, num_threads, shard);
+    FILE* distribution_file = NULL;
+    unsigned long first_n_bits = 1;
+    if(journal) {
+        memcpy(pool.matrix, journal->matrix, pool.num_errors * pool.matrix_size * sizeof(unsigned long));
+        distribution_file = open_report_distribution(pool.distribution_file, journal->distribution_offset);
+        first_n_bits = journal->current_n_bits;
+    } else {
+        distribution_file = create_report_distribution(pool.distribution_file, pool.num_errors);
+    }
+    double last_checkpoint = get_seconds();
+
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(pool.num_threads)
+      #pragma omp single
+    #endif
+    for(unsigned long current_n_bits = first_n_bits; current_n_bits <= n_bits; current_n_bits++) {
 
         printf("\tnumber of bits: %lu", current_n_bits);
-        #if defined(_OPENMP)
-          double start = omp_get_wtime();
-        #else
-          clock_t start = clock();
-        #endif
+        double start = get_seconds();
+        attack_pool_start(&pool, current_n_bits);
+        unsigned long first_block = pool.lower_bound;
+        if(journal && current_n_bits == journal->current_n_bits && journal->next_block) first_block = journal->next_block;
+
+        for(unsigned long block = first_block; block < pool.upper_bound; block += ATTACK_BLOCK_SIZE) {
+
+          unsigned long n_keys = pool.upper_bound - block < ATTACK_BLOCK_SIZE ? pool.upper_bound - block : ATTACK_BLOCK_SIZE;
+          unsigned long* identifiers = calloc(n_keys, sizeof(unsigned long));
+          for(unsigned long k = 0; k < n_keys; k++) identifiers[k] = attack_get_identifier(&pool, block + k);
+
+          // RS codes of the whole block are computed together (bit-sliced)
+          pool.block = block;
+          pool.identifiers = identifiers;
+          memset(pool.distributions, 0x00, n_keys * pool.num_errors * sizeof(unsigned long));
+          pool.encoded_keys = (uint8_t*)identifiers;
+          pool.encoded_len = sizeof(unsigned long);
+          pool.encoded_n_bits = sizeof(unsigned long) * 8;
+          if(method == IMPROVED_WITH_RS) {
+            pool.encoded_keys = append_rs_code_batch(identifiers, sizeof(unsigned long), n_keys, current_n_bits,
+                n_parity_symbols, symsize, &pool.encoded_len, &pool.encoded_n_bits);
+          }
 
-        unsigned long lower_bound = get_lower_bound(current_n_bits);
-        unsigned long upper_bound = get_upper_bound(current_n_bits);
+          #if defined(_OPENMP)
+            #pragma omp taskgroup
+          #endif
+          {
+            for(unsigned long k = 0; k < n_keys; k++) attack_spawn_key(&pool, k);
+          }
+          write_to_report_distribution(distribution_file, current_n_bits, block, n_keys, pool.distributions, pool.num_errors);
+          if(pool.encoded_keys != (uint8_t*)identifiers) free(pool.encoded_keys);
+          free(identifiers);
 
-        if(method == IMPROVED_WITH_RS) {
-          lower_bound = 1 << ((current_n_bits-1) * symsize);
-          upper_bound = 1 << (current_n_bits * symsize);
+          if(get_seconds() - last_checkpoint >= ATTACK_CHECKPOINT_SECONDS && block + n_keys < pool.upper_bound) {
+            write_attack_journal(&pool, n_bits, current_n_bits, block + n_keys, distribution_file);
+            last_checkpoint = get_seconds();
+          }
         }
-        fprintf(stderr,"lower bound: %lu, upper bound: %lu\n", lower_bound, upper_bound);
+        attack_pool_end(&pool);
+        write_attack_journal(&pool, n_bits, current_n_bits + 1, 0, distribution_file);
+        last_checkpoint = get_seconds();
+        printf(" - %F secs\n", get_seconds() - start);
+    }
+    if(distribution_file) fclose(distribution_file);
+    attack_pool_write_report(&pool, REPORT_EXHAUSTIVE);
+    // nothing left to resume
+    remove(pool.journal_file);
+    attack_pool_free(&pool);
+}
 
-        #if defined(_OPENMP)
-          #pragma omp parallel for schedule(dynamic)
-        #endif
-        for(unsigned long i = lower_bound; i < upper_bound; i++) {
+// continue the attack whose report is 'report_file' (NULL for the default one) from its
+// journal, returns 0 if there is none
+uint8_t attack_resume(const char* report_file, unsigned long num_threads) {
+
+    char journal_file[MAX_SIZE + 1];
+    get_attack_journal_file(report_file, journal_file);
+    ATTACK_JOURNAL* journal = read_attack_journal(journal_file);
+    if(!journal) return 0;
+    unsigned long matrix_size = journal->method == IMPROVED_WITH_RS ? journal->n_bits * journal->symsize : journal->n_bits;
+    if(journal->method > IMPROVED_WITH_RS || journal->matrix_size != matrix_size) {
+        free_attack_journal(journal);
+        return 0;
+    }
+    printf("resuming from %lu bits", journal->current_n_bits);
+    if(journal->next_block) printf(" (key %lu)", journal->next_block);
+    printf("\n");
+    ATTACK_SHARD shard = {
+      .index = journal->shard_index,
+      .count = journal->shard_count,
+      .first_key = journal->first_key,
+      .last_key = journal->last_key,
+      .report_file = report_file
+    };
+    attack(journal->method, journal->n_removal, journal->n_bits, journal->n_parity_symbols, journal->symsize, num_threads, &shard, journal);
+    free_attack_journal(journal);
+    return 1;
+}
 
-            STATISTICS statistics = {0};
+typedef struct ATTACK_SAMPLING_OPTS {
+    unsigned long seed;
+    // a number of bits is done once every interval of its column is narrower than this
+    double max_width;
+    // or once this many keys were attacked with it
+    unsigned long max_samples;
+} ATTACK_SAMPLING_OPTS;
 
-            unsigned long* identifier = malloc(sizeof(unsigned long));
-            memset(identifier, 0x00, sizeof(unsigned long));
-            if(method == IMPROVED_WITH_RS) {
-              *identifier = i;
-              get_key_from_k(&identifier, symsize, current_n_bits);
-            } else {
-              *identifier = invert_unsigned_long(i);
-            }
-            // if(!key_is_non_zero(*identifier, current_n_bits, symsize)) {
-            //   fprintf(stderr, "i: %lu\n", i);
-            //   show_bits((void*)&i, current_n_bits * symsize);
-            //   fprintf(stderr, "identifier: %lu\n", *identifier);
-            //   show_bits((void*)identifier, current_n_bits * symsize);
-            //   exit(EXIT_FAILURE);
-            // }
-
-            GRAPH* graph = NULL;
-            if(method == IMPROVED_WITH_RS) {
-              graph = watermark_rs_encode(identifier, current_n_bits, n_parity_symbols, symsize); 
-            } else {
-              graph = watermark_encode8(identifier, identifier_len);
-            }
-            ATTACK attack = {0};
-            attack.n_removals = n_removal;
-            attack.graph = graph;
-            attack.identifier = identifier;
-            attack.identifier_len = identifier_len;
-            attack.method = method;
-            if(method == IMPROVED_WITH_RS) {
-              attack.info.rs.n_parity_symbols = n_parity_symbols;
-              attack.info.rs.symsize = symsize;
-              attack.info.rs.n_data_symbols = current_n_bits;
-            } else {
-              attack.info.no_rs.n_bits = current_n_bits;
+// attack the graph of a random key with a random combination of removed edges
+void attack_run_sample(ATTACK_POOL* pool, RNG* rng) {
+
+  #if defined(_OPENMP)
+    unsigned long thread = omp_get_thread_num();
+  #else
+    unsigned long thread = 0;
+  #endif
+  WORKSPACE* ws = pool->thread_ws[thread];
+  unsigned long key = pool->lower_bound + rng_below(rng, pool->upper_bound - pool->lower_bound);
+  unsigned long identifier = attack_get_identifier(pool, key);
+
+  // same graph the exhaustive attack builds for this key
+  GRAPH* graph = pool->table ? encode_table_get_graph(pool->table, key, ws) : NULL;
+  if(!graph) {
+    uint8_t* encoded_key = (uint8_t*)&identifier;
+    unsigned long encoded_len = sizeof(unsigned long);
+    unsigned long encoded_n_bits = sizeof(unsigned long) * 8;
+    if(pool->method == IMPROVED_WITH_RS) {
+      encoded_key = append_rs_code_batch(&identifier, sizeof(unsigned long), 1, pool->current_n_bits,
+          pool->n_parity_symbols, pool->symsize, &encoded_len, &encoded_n_bits);
+    }
+    RNG graph_rng;
+    rng_seed(&graph_rng, key);
+    graph = watermark_encode_workspace(encoded_key, encoded_n_bits, &graph_rng, ws);
+    if(encoded_key != (uint8_t*)&identifier) free(encoded_key);
+  }
+
+  unsigned long errors = 0;
+  CONN_ARR* edges = get_list_of_non_hamiltonian_edges(graph);
+  if(edges) {
+    ATTACK attack = {0};
+    attack.n_removals = pool->n_removals;
+    attack.graph = graph;
+    attack.identifier = &identifier;
+    attack.identifier_len = sizeof(unsigned long);
+    attack.method = pool->method;
+    if(pool->method == IMPROVED_WITH_RS) {
+      attack.info.rs.n_parity_symbols = pool->n_parity_symbols;
+      attack.info.rs.symsize = pool->symsize;
+      attack.info.rs.n_data_symbols = pool->current_n_bits;
+    } else {
+      attack.info.no_rs.n_bits = pool->current_n_bits;
+    }
+    // keys (and so graphs) are drawn again and again when there are few of them
+    attack.cache = &pool->caches[thread];
+    RNG mix;
+    rng_seed(&mix, key);
+    attack.hash[0] = mix.s[0];
+    attack.hash[1] = mix.s[1];
+    for(unsigned long i = 0; i < edges->len; i++) {
+      uint64_t edge_hash[2];
+      attack_hash_edge(edges->arr[i], edge_hash);
+      attack.hash[0] += edge_hash[0];
+      attack.hash[1] += edge_hash[1];
+    }
+    if(pool->method == IMPROVED) {
+      attack.ws = ws;
+      workspace_load_graph(ws, graph);
+    }
+
+    unsigned long n = edges->len;
+    unsigned long k = MIN(n, pool->n_removals);
+    unsigned long idxs[k + 1];
+    CONNECTION* conns[k + 1];
+    get_random_combination(rng, n, k, idxs);
+    for(unsigned long j = 0; j < k; j++) conns[j] = edges->arr[idxs[k - 1 - j]];
+    errors = _test_with_removed_connections(&attack, conns, k);
+    if(errors >= pool->num_errors) errors = pool->num_errors - 1;
+    conn_arr_free(edges);
+  }
+  graph_free(graph);
+  attack_record(pool, errors);
+}
+
+// samples in [begin, end) of the current number of bits, each with its own RNG so the
+// estimates don't depend on the number of threads
+void attack_spawn_samples(ATTACK_POOL* pool, unsigned long seed, unsigned long begin, unsigned long end) {
+
+  #if defined(_OPENMP)
+    #pragma omp task firstprivate(pool, seed, begin, end)
+  #endif
+  for(unsigned long i = begin; i < end; i++) {
+    RNG rng;
+    rng_seed(&rng, seed + (pool->current_n_bits << 32) + i);
+    attack_run_sample(pool, &rng);
+  }
+}
+
+// same as 'attack', but every number of bits gets random keys attacked with one random
+// combination of removed edges each, until the interval of every row of its column is
+// narrower than 'max_width'. The matrix counts samples instead of keys, and its cells
+// estimate the chance of an attack losing that many bits (see 'write_to_report_intervals')
+void attack_sampled(METHOD method, unsigned long n_removal, unsigned long n_bits, unsigned long n_parity_symbols, unsigned long symsize, unsigned long num_threads, ATTACK_SAMPLING_OPTS* opts) {
+
+    ATTACK_POOL pool;
+    attack_pool_init(&pool, method, n_removal, n_bits, n_parity_symbols, symsize, num_threads, NULL);
+    unsigned long* num_samples = calloc(pool.matrix_size, sizeof(unsigned long));
+    pool.caches = calloc(pool.num_threads, sizeof(ATTACK_CACHE));
+    for(unsigned long i = 0; i < pool.num_threads; i++) pool.caches[i].entries = calloc(ATTACK_CACHE_SIZE, sizeof(ATTACK_CACHE_ENTRY));
+
+    #if defined(_OPENMP)
+      #pragma omp parallel num_threads(pool.num_threads)
+      #pragma omp single
+    #endif
+    for(unsigned long current_n_bits = 1; current_n_bits <= n_bits; current_n_bits++) {
+
+        printf("\tnumber of bits: %lu", current_n_bits);
+        double start = get_seconds();
+        attack_pool_start(&pool, current_n_bits);
+
+        double width = 1;
+        unsigned long* samples = &num_samples[current_n_bits-1];
+        while(*samples < opts->max_samples && width > opts->max_width) {
+
+          unsigned long n = opts->max_samples - *samples < ATTACK_BLOCK_SIZE ? opts->max_samples - *samples : ATTACK_BLOCK_SIZE;
+          #if defined(_OPENMP)
+            #pragma omp taskgroup
+          #endif
+          {
+            for(unsigned long i = 0; i < n; i += ATTACK_MIN_RANGE) {
+              attack_spawn_samples(&pool, opts->seed, *samples + i, *samples + (i + ATTACK_MIN_RANGE < n ? i + ATTACK_MIN_RANGE : n));
             }
+          }
+          *samples += n;
+          attack_merge_histograms(&pool);
+
+          width = 0;
+          for(unsigned long i = 0; i < pool.num_errors; i++) {
+            double low, high;
+            get_confidence_interval(pool.matrix[i * pool.matrix_size + current_n_bits - 1], *samples, &low, &high);
+            if(high - low > width) width = high - low;
+          }
+        }
+        attack_pool_end(&pool);
+        unsigned long num_lookups = 0, num_hits = 0;
+        for(unsigned long i = 0; i < pool.num_threads; i++) {
+          num_lookups += pool.caches[i].num_lookups;
+          num_hits += pool.caches[i].num_hits;
+          pool.caches[i].num_lookups = pool.caches[i].num_hits = 0;
+        }
+        printf(" - %lu samples, widest interval %F, %.1F%% cached - %F secs\n", *samples, width,
+            num_lookups ? 100.0 * num_hits / num_lookups : 0.0, get_seconds() - start);
+    }
+    attack_pool_write_report(&pool, REPORT_SAMPLED);
+    write_to_report_intervals(pool.matrix, num_samples, pool.num_errors, pool.matrix_size);
+    free(num_samples);
+    attack_pool_free(&pool);
+}
 
-            multiple_removal_test(&attack, &statistics);
-            graph_free(graph);
-            #if defined(_OPENMP) 
-              #pragma omp critical
-            #endif
-            matrix[statistics.worst_case][current_n_bits-1]++;
-            free(identifier);
+// time every encoder on random keys of 1000, 10000, ... bits up to 'max_bits'
+void benchmark_encoders(unsigned long max_bits) {
+
+    RNG key_rng;
+    rng_seed(&key_rng, 0);
+    WORKSPACE* ws = workspace_create(0);
+    printf("%10s %12s %12s %12s %12s\n", "bits", "graph", "large graph", "plan", "code");
+    for(unsigned long n_bits = 1000; n_bits <= max_bits; n_bits *= 10) {
+
+        unsigned long num_bytes = n_bits / 8 + 1;
+        uint8_t* key = malloc(num_bytes);
+        for(unsigned long i = 0; i < num_bytes; i++) key[i] = rng_next(&key_rng);
+        key[0] |= 0x80;
+        RNG rng;
+
+        rng_seed(&rng, n_bits);
+        double start = get_seconds();
+        GRAPH* graph = watermark_encode_workspace(key, n_bits, &rng, ws);
+        double graph_duration = get_seconds() - start;
+        graph_free(graph);
+
+        rng_seed(&rng, n_bits);
+        start = get_seconds();
+        graph = watermark_encode_large_workspace(key, n_bits, &rng, ws);
+        double large_duration = get_seconds() - start;
+        graph_free(graph);
+
+        rng_seed(&rng, n_bits);
+        start = get_seconds();
+        watermark_encode_plan(key, n_bits, &rng, ws);
+        double plan_duration = get_seconds() - start;
+
+        rng_seed(&rng, n_bits);
+        start = get_seconds();
+        char* code = watermark_encode_dijkstra_code_workspace(key, n_bits, &rng, ws);
+        double code_duration = get_seconds() - start;
+        free(code);
+
+        printf("%10lu %11Fs %11Fs %11Fs %11Fs\n", n_bits, graph_duration, large_duration, plan_duration, code_duration);
+        free(key);
+    }
+    workspace_free(ws);
+}
+
+void benchmark_decoders(unsigned long num_graphs) {
+
+    RNG key_rng;
+    rng_seed(&key_rng, 0);
+    unsigned long* keys = malloc(num_graphs * sizeof(unsigned long));
+    for(unsigned long i = 0; i < num_graphs; i++) keys[i] = invert_unsigned_long(rng_next(&key_rng) | 1);
+    unsigned long symsize = 8;
+    unsigned long num_parity_symbols = 4;
+    ENCODE_OPTS encode_opts = {
+      .key_len = sizeof(unsigned long),
+      .n_bits = sizeof(unsigned long) * 8
+    };
+    GRAPH** graphs = malloc(num_graphs * sizeof(GRAPH*));
+    GRAPH** rs_graphs = malloc(num_graphs * sizeof(GRAPH*));
+    watermark_encode_batch(keys, num_graphs, &encode_opts, graphs);
+    encode_opts.num_parity_symbols = num_parity_symbols;
+    encode_opts.symsize = symsize;
+    watermark_encode_batch(keys, num_graphs, &encode_opts, rs_graphs);
+
+    DECODE_RESULT* results = malloc(num_graphs * sizeof(DECODE_RESULT));
+    const char* names[] = { "original", "improved", "improved rs" };
+    unsigned long max_threads = 1;
+    #if defined(_OPENMP)
+      max_threads = omp_get_max_threads();
+    #endif
+    printf("%12s %8s %14s %10s\n", "method", "threads", "graphs/s", "failed");
+    for(METHOD method = ORIGINAL; method <= IMPROVED_WITH_RS; method++) {
+        for(unsigned long num_threads = 1;; num_threads = num_threads * 2 < max_threads ? num_threads * 2 : max_threads) {
+
+            DECODE_OPTS decode_opts = {
+              .method = method,
+              .keys = keys,
+              .key_len = sizeof(unsigned long),
+              .n_bits = sizeof(unsigned long) * 8,
+              .num_parity_symbols = num_parity_symbols,
+              .symsize = symsize,
+              .num_threads = num_threads
+            };
+            DECODE_STATS stats;
+            watermark_decode_batch(method == IMPROVED_WITH_RS ? rs_graphs : graphs, num_graphs, &decode_opts, results, &stats);
+            printf("%12s %8lu %14.0F %10lu\n", names[method], stats.num_threads, stats.graphs_per_second, num_graphs - stats.num_decoded);
+            for(unsigned long i = 0; i < num_graphs; i++) free(results[i].bits);
+            if(num_threads == max_threads) break;
         }
-        #if defined(_OPENMP)
-          double duration = omp_get_wtime() - start;
-          printf(" - %F secs\n", duration);
-        #else
-          clock_t duration = clock() - start;
-          printf(" - %F secs\n", duration / (double) CLOCKS_PER_SEC);
-        #endif
     }
-    write_to_report_matrix((unsigned long*)&matrix, matrix_size, matrix_size);
+
+    for(unsigned long i = 0; i < num_graphs; i++) {
+        graph_free(graphs[i]);
+        graph_free(rs_graphs[i]);
+    }
+    free(results);
+    free(graphs);
+    free(rs_graphs);
+    free(keys);
 }
 
 int ask_for_comparison(char* dijkstra_code) {
@@ -661,7 +1773,107 @@ uint8_t* get_binary_sequence(const char* msg, unsigned long* n_bits, unsigned lo
     return bin_u8;
 }
 
-int main(void) {
+int print_usage(void) {
+
+    fprintf(stderr, "usage: watermark attack <original|improved|rs> <removals> <bits (symbols for rs)> [<parity symbols> <symbol size>]\n");
+    fprintf(stderr, "                        [--shard <index>/<count>] [--keys <first>-<last>] [--threads <n>] [--output <report>] [--resume]\n");
+    fprintf(stderr, "       watermark merge <report> <shard report>...\n");
+    fprintf(stderr, "keys have 1 to 63 bits (symbols * symbol size for rs, symbol size 1 to 8)\n");
+    fprintf(stderr, "shards of the same attack (each with its own --output) are summed by merge\n");
+    return EXIT_FAILURE;
+}
+
+// 0 unless all of 's' is a decimal number
+uint8_t parse_ulong(const char* s, unsigned long* n) {
+
+    char* end;
+    errno = 0;
+    *n = strtoul(s, &end, 10);
+    return *s >= '0' && *s <= '9' && !*end && !errno;
+}
+
+// 0 unless 's' is two decimal numbers separated by 'separator'
+uint8_t parse_ulong_pair(const char* s, char separator, unsigned long* a, unsigned long* b) {
+
+    const char* middle = strchr(s, separator);
+    if(!middle || (unsigned long)(middle - s) > MAX_SIZE) return 0;
+    char first[MAX_SIZE + 1];
+    memcpy(first, s, middle - s);
+    first[middle - s] = '\0';
+    return parse_ulong(first, a) && parse_ulong(middle + 1, b);
+}
+
+// exhaustive removal attack, or a shard of it, without the menu
+int attack_command(int argc, char** argv) {
+
+    if(argc < 5) return print_usage();
+    METHOD method;
+    if(!strcmp(argv[2], "original")) {
+        method = ORIGINAL;
+    } else if(!strcmp(argv[2], "improved")) {
+        method = IMPROVED;
+    } else if(!strcmp(argv[2], "rs")) {
+        method = IMPROVED_WITH_RS;
+    } else {
+        return print_usage();
+    }
+    unsigned long n_removals, n_bits;
+    if(!parse_ulong(argv[3], &n_removals) || !parse_ulong(argv[4], &n_bits) || !n_bits) return print_usage();
+    unsigned long n_parity = 0, symsize = 0;
+    int i = 5;
+    if(method == IMPROVED_WITH_RS) {
+        if(argc < 7 || !parse_ulong(argv[5], &n_parity) || !parse_ulong(argv[6], &symsize)) return print_usage();
+        i = 7;
+    }
+    // keys are shifted into an unsigned long, one bit past the longest key
+    if(method == IMPROVED_WITH_RS ? !symsize || symsize > 8 || n_bits >= 64 || n_bits * symsize >= 64 : n_bits >= 64) {
+        return print_usage();
+    }
+
+    ATTACK_SHARD shard = { .index = 0, .count = 1, .first_key = 0, .last_key = ULONG_MAX, .report_file = NULL };
+    unsigned long num_threads = 0;
+    uint8_t resume = 0;
+    for(; i < argc; i++) {
+        if(!strcmp(argv[i], "--shard") && i + 1 < argc) {
+            if(!parse_ulong_pair(argv[++i], '/', &shard.index, &shard.count) || shard.index >= shard.count) return print_usage();
+        } else if(!strcmp(argv[i], "--keys") && i + 1 < argc) {
+            if(!parse_ulong_pair(argv[++i], '-', &shard.first_key, &shard.last_key) || shard.first_key >= shard.last_key) return print_usage();
+        } else if(!strcmp(argv[i], "--threads") && i + 1 < argc) {
+            if(!parse_ulong(argv[++i], &num_threads)) return print_usage();
+        } else if(!strcmp(argv[i], "--output") && i + 1 < argc) {
+            shard.report_file = argv[++i];
+        } else if(!strcmp(argv[i], "--resume")) {
+            resume = 1;
+        } else {
+            return print_usage();
+        }
+    }
+
+    ATTACK_JOURNAL* journal = NULL;
+    if(resume) {
+        char journal_file[MAX_SIZE + 1];
+        get_attack_journal_file(shard.report_file, journal_file);
+        journal = read_attack_journal(journal_file);
+        if( journal && (journal->method != method || journal->n_removal != n_removals || journal->n_bits != n_bits ||
+                journal->n_parity_symbols != n_parity || journal->symsize != symsize || journal->shard_index != shard.index ||
+                journal->shard_count != shard.count || journal->first_key != shard.first_key || journal->last_key != shard.last_key) ) {
+            fprintf(stderr, "%s: journal of a different attack\n", journal_file);
+            free_attack_journal(journal);
+            return EXIT_FAILURE;
+        }
+    }
+    attack(method, n_removals, n_bits, n_parity, symsize, num_threads, &shard, journal);
+    free_attack_journal(journal);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+
+    if(argc > 1) {
+        if(!strcmp(argv[1], "attack")) return attack_command(argc, argv);
+        if(!strcmp(argv[1], "merge") && argc > 3) return merge_report_matrices(argv[2], argv + 3, argc - 3) ? EXIT_SUCCESS : EXIT_FAILURE;
+        return print_usage();
+    }
 
     printf("1) encode string\n");
     printf("2) encode number\n");
@@ -674,6 +1886,12 @@ int main(void) {
     printf("9) reed solomon decode\n");
     printf("10) show report matrix\n");
     printf("11) get .dot file dijkstra code\n");
+    printf("12) benchmark encoders on long keys\n");
+    printf("13) generate encoding tables for the removal test\n");
+    printf("14) benchmark batch decoding\n");
+    printf("15) find watermarks in a .dot file\n");
+    printf("16) estimate removal test results by sampling\n");
+    printf("17) resume interrupted removal test\n");
     printf("else) exit\n");
     switch(get_uint8_t("input an option: ")) {
         case 1: {
@@ -745,7 +1963,7 @@ int main(void) {
             printf("input maximum number of bits: ");
             unsigned long n_bits;
             scanf("%lu", &n_bits);
-            attack(ORIGINAL, n_removals, n_bits, 0, 0);
+            attack(ORIGINAL, n_removals, n_bits, 0, 0, 0, NULL, NULL);
             show_report_matrix();
             break;
         }
@@ -756,7 +1974,7 @@ int main(void) {
             printf("input maximum number of bits: ");
             unsigned long n_bits;
             scanf("%lu", &n_bits);
-            attack(IMPROVED, n_removals, n_bits, 0, 0);
+            attack(IMPROVED, n_removals, n_bits, 0, 0, 0, NULL, NULL);
             show_report_matrix();
             break;
         }
@@ -773,7 +1991,7 @@ int main(void) {
             printf("input symbol size (1-8): ");
             unsigned long symsize;
             scanf("%lu", &symsize);
-            attack(IMPROVED_WITH_RS, n_removals, n_symbols, n_parity, symsize);
+            attack(IMPROVED_WITH_RS, n_removals, n_symbols, n_parity, symsize, 0, NULL, NULL);
             show_report_matrix();
             break;           
         }
@@ -850,6 +2068,94 @@ int main(void) {
                 }
                 graph_free(graph);
             }
+            break;
+        }
+        case 12: {
+            benchmark_encoders(get_ulong("maximum number of bits: "));
+            break;
+        }
+        case 13: {
+            unsigned long max_bits = get_ulong("maximum number of bits: ");
+            mkdir(ENCODE_TABLE_DIR, 0755);
+            for(unsigned long n_bits = 1; n_bits <= max_bits && n_bits <= ENCODE_TABLE_MAX_BITS; n_bits++) {
+                char filename[sizeof(ENCODE_TABLE_FILE) + 20];
+                sprintf(filename, ENCODE_TABLE_FILE, n_bits);
+                ENCODE_TABLE* table = encode_table_create(n_bits, 0);
+                if(!encode_table_save(table, filename)) printf("couldn't write %s\n", filename);
+                else printf("%s: %lu keys\n", filename, (unsigned long)table->header->num_keys);
+                encode_table_free(table);
+            }
+            break;
+        }
+        case 14: {
+            benchmark_decoders(get_ulong("number of graphs: "));
+            break;
+        }
+        case 15: {
+            char filename[1000];
+            printf(".dot file name: ");
+            scanf("%s", filename);
+            FILE* f = NULL;
+            if(!( f = fopen(filename, "rb") )) break;
+            GRAPH* graph = graph_create_from_dot(f);
+            fclose(f);
+            graph_topological_sort(graph);
+
+            EXTRACT_OPTS opts = {0};
+            unsigned long num_candidates;
+            EXTRACT_CANDIDATE* candidates = watermark_extract(graph, &opts, &num_candidates);
+            printf("%lu candidate keys\n", num_candidates);
+            for(unsigned long i = 0; i < num_candidates && i < 10; i++) {
+                EXTRACT_CANDIDATE* candidate = &candidates[i];
+                printf("nodes %lu to %lu, score %ld, %lu windows: ", candidate->entry, candidate->exit, candidate->score, candidate->num_windows);
+                unsigned long n_bits = candidate->num_bytes * 8;
+                for(unsigned long j = get_first_positive_bit_index(candidate->bits, candidate->num_bytes); j < n_bits; j++) {
+                    printf("%hhu", get_bit(candidate->bits, j));
+                }
+                printf("\n");
+            }
+            watermark_extract_free(candidates, num_candidates);
+            graph_free(graph);
+            break;
+        }
+        case 16: {
+            printf("method (0 original, 1 improved, 2 improved with reed solomon): ");
+            unsigned long method;
+            scanf("%lu", &method);
+            if(method > IMPROVED_WITH_RS) break;
+            printf("input number of removals: ");
+            unsigned long n_removals;
+            scanf("%lu", &n_removals);
+            unsigned long n_bits, n_parity = 0, symsize = 0;
+            if(method == IMPROVED_WITH_RS) {
+                printf("input maximum number of message symbols: ");
+                scanf("%lu", &n_bits);
+                printf("input number of parity symbols: ");
+                scanf("%lu", &n_parity);
+                printf("input symbol size (1-8): ");
+                scanf("%lu", &symsize);
+            } else {
+                printf("input maximum number of bits: ");
+                scanf("%lu", &n_bits);
+            }
+            ATTACK_SAMPLING_OPTS opts;
+            printf("input widest confidence interval: ");
+            scanf("%lf", &opts.max_width);
+            printf("input maximum number of samples per number of bits: ");
+            scanf("%lu", &opts.max_samples);
+            printf("input seed: ");
+            scanf("%lu", &opts.seed);
+            attack_sampled(method, n_removals, n_bits, n_parity, symsize, 0, &opts);
+            show_report_intervals();
+            break;
+        }
+        case 17: {
+            if(!attack_resume(NULL, 0)) {
+                printf("no removal test to resume\n");
+                break;
+            }
+            show_report_matrix();
+            break;
         }
     }
 